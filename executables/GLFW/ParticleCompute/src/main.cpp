@@ -0,0 +1,258 @@
+#include "chaos/Chaos.h"
+
+// XXX : compare the CPU particle simulation (ParticleLayer) with the GPU one (ParticleComputeLayer)
+//
+//       for each particle count, both layers run the same simulation for some frames. The time measured is
+//       Tick(...) + Display(...) (simulation, vertices generation and upload for the CPU, compute dispatch for the GPU)
+//       surrounded by glFinish() calls
+//
+//       to run with a software renderer (Mesa llvmpipe): LIBGL_ALWAYS_SOFTWARE=1
+
+// ==============================================================
+// CPU particles
+// ==============================================================
+
+class ParticleCPU : public chaos::ParticleDefault
+{
+public:
+
+	glm::vec2 velocity = { 0.0f, 0.0f };
+	float lifetime = 0.0f;
+	float remaining_time = 0.0f;
+};
+
+CHAOS_REGISTER_CLASS(ParticleCPU, chaos::ParticleDefault);
+
+class ParticleCPULayerTrait : public chaos::ParticleLayerTrait<ParticleCPU, chaos::VertexDefault>
+{
+public:
+
+	// the same simulation than ParticleComputeDefaultLayerTrait
+	bool UpdateParticle(float delta_time, ParticleCPU& particle) const
+	{
+		particle.velocity += acceleration * delta_time;
+		particle.bounding_box.position += particle.velocity * delta_time;
+		if (particle.lifetime > 0.0f)
+		{
+			particle.remaining_time -= delta_time;
+			if (particle.remaining_time <= 0.0f)
+				return true;
+		}
+		return false;
+	}
+
+	void ParticleToPrimitives(ParticleCPU const& particle, chaos::GPUPrimitiveOutput<chaos::VertexDefault>& output) const
+	{
+		chaos::ParticleToPrimitives(particle, output);
+	}
+
+public:
+
+	glm::vec2 acceleration = { 0.0f, 0.0f };
+};
+
+// ==============================================================
+// Application
+// ==============================================================
+
+class MyWindow : public chaos::Window
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyWindow, chaos::Window);
+
+	static constexpr int BENCHMARK_FRAME_COUNT = 100;
+
+	static constexpr float WORLD_SIZE = 1000.0f;
+
+	static constexpr float GRAVITY = -100.0f;
+
+	class BenchmarkPhase
+	{
+	public:
+
+		size_t particle_count = 0;
+		bool gpu = false;
+	};
+
+protected:
+
+	virtual bool OnInitialize(chaos::JSONReadConfiguration config) override
+	{
+		if (!chaos::Window::OnInitialize(config))
+			return false;
+
+		for (size_t particle_count : {10000, 100000, 1000000})
+		{
+			phases.push_back({ particle_count, false });
+			phases.push_back({ particle_count, true });
+		}
+		return true;
+	}
+
+	virtual void Finalize() override
+	{
+		benchmark_layer = nullptr;
+		demo_layer = nullptr;
+		chaos::Window::Finalize();
+	}
+
+	virtual bool OnDraw(chaos::GPURenderContext * render_context, chaos::GPUProgramProviderInterface const * uniform_provider, chaos::WindowDrawParams const& draw_params) override
+	{
+		glm::vec4 clear_color(0.0f, 0.0f, 0.0f, 0.0f);
+		glClearBufferfv(GL_COLOR, 0, (GLfloat*)&clear_color);
+
+		float far_plane = 1000.0f;
+		glClearBufferfi(GL_DEPTH_STENCIL, 0, far_plane, 0);
+
+		chaos::GPUProgramProviderChain main_uniform_provider(uniform_provider);
+		main_uniform_provider.AddVariable("local_to_camera", glm::scale(glm::vec3(2.0f / WORLD_SIZE, 2.0f / WORLD_SIZE, 1.0f)));
+		main_uniform_provider.AddVariable("projection_matrix", glm::mat4(1.0f));
+
+		chaos::GPURenderParams render_params;
+
+		if (phase_index < phases.size())
+			RunBenchmarkFrame(render_context, &main_uniform_provider, render_params);
+		else
+			RunDemoFrame(render_context, &main_uniform_provider, render_params);
+
+		return true;
+	}
+
+	void RunBenchmarkFrame(chaos::GPURenderContext* render_context, chaos::GPUProgramProviderInterface const* uniform_provider, chaos::GPURenderParams const& render_params)
+	{
+		BenchmarkPhase const& phase = phases[phase_index];
+
+		// create the layer with all its particles
+		if (benchmark_layer == nullptr)
+		{
+			benchmark_layer = (phase.gpu) ? CreateGPULayer(phase.particle_count) : CreateCPULayer(phase.particle_count);
+			if (benchmark_layer == nullptr)
+			{
+				++phase_index;
+				return;
+			}
+			frame_index = 0;
+			benchmark_duration = 0.0;
+		}
+
+		// the first frame (upload of the initial particles) is ignored
+		glFinish();
+		auto start_time = std::chrono::steady_clock::now();
+		benchmark_layer->Tick(1.0f / 60.0f);
+		benchmark_layer->Display(render_context, uniform_provider, render_params);
+		glFinish();
+		auto end_time = std::chrono::steady_clock::now();
+
+		if (frame_index > 0)
+			benchmark_duration += std::chrono::duration<double, std::milli>(end_time - start_time).count();
+
+		// end of the phase
+		if (++frame_index > BENCHMARK_FRAME_COUNT)
+		{
+			double particles_per_ms = double(phase.particle_count) * double(BENCHMARK_FRAME_COUNT) / benchmark_duration;
+			chaos::Log::Message("%s : %8d particles : %8.3f ms per frame (%.0f particles per ms)",
+				(phase.gpu) ? "GPU" : "CPU",
+				int(phase.particle_count),
+				benchmark_duration / double(BENCHMARK_FRAME_COUNT),
+				particles_per_ms);
+
+			benchmark_layer = nullptr;
+			++phase_index;
+		}
+	}
+
+	void RunDemoFrame(chaos::GPURenderContext* render_context, chaos::GPUProgramProviderInterface const* uniform_provider, chaos::GPURenderParams const& render_params)
+	{
+		// a fountain of particles
+		if (demo_layer == nullptr)
+		{
+			chaos::ParticleComputeDefaultLayerTrait trait;
+			trait.acceleration = { 0.0f, GRAVITY };
+			demo_layer = new chaos::ParticleComputeLayer<chaos::ParticleComputeDefaultLayerTrait>(200000, trait);
+			if (demo_layer == nullptr)
+				return;
+		}
+
+		for (chaos::ParticleCompute& particle : demo_layer->EmitParticles(1000))
+		{
+			InitializeParticle(particle.position, particle.velocity, particle.half_size, particle.color);
+			particle.lifetime = particle.remaining_time = 3.0f;
+		}
+		demo_layer->Tick(1.0f / 60.0f);
+		demo_layer->Display(render_context, uniform_provider, render_params);
+	}
+
+	chaos::ParticleLayerBase* CreateCPULayer(size_t particle_count)
+	{
+		ParticleCPULayerTrait trait;
+		trait.acceleration = { 0.0f, GRAVITY };
+
+		chaos::ParticleLayer<ParticleCPULayerTrait>* result = new chaos::ParticleLayer<ParticleCPULayerTrait>(trait);
+		if (result == nullptr)
+			return nullptr;
+		result->SetRenderMaterial(chaos::DefaultParticleProgram::GetMaterial());
+
+		chaos::ParticleAllocationBase* allocation = result->SpawnParticles(particle_count);
+		if (allocation == nullptr)
+			return nullptr;
+
+		for (ParticleCPU& particle : allocation->GetParticleAccessor<ParticleCPU>())
+		{
+			glm::vec2 half_size;
+			InitializeParticle(particle.bounding_box.position, particle.velocity, half_size, particle.color);
+			particle.bounding_box.half_size = half_size;
+			particle.texcoords.bitmap_index = -1;
+		}
+		return result;
+	}
+
+	chaos::ParticleLayerBase* CreateGPULayer(size_t particle_count)
+	{
+		chaos::ParticleComputeDefaultLayerTrait trait;
+		trait.acceleration = { 0.0f, GRAVITY };
+
+		chaos::ParticleComputeLayer<chaos::ParticleComputeDefaultLayerTrait>* result = new chaos::ParticleComputeLayer<chaos::ParticleComputeDefaultLayerTrait>(particle_count, trait);
+		if (result == nullptr)
+			return nullptr;
+
+		for (chaos::ParticleCompute& particle : result->EmitParticles(particle_count))
+			InitializeParticle(particle.position, particle.velocity, particle.half_size, particle.color);
+
+		return result;
+	}
+
+	void InitializeParticle(glm::vec2& position, glm::vec2& velocity, glm::vec2& half_size, glm::vec4& color)
+	{
+		float angle = chaos::MathTools::RandFloat() * 6.28f;
+		float speed = 100.0f + chaos::MathTools::RandFloat() * 200.0f;
+
+		position = { 0.0f, 0.0f };
+		velocity = { speed * std::cos(angle), speed * std::sin(angle) };
+		half_size = { 2.0f, 2.0f };
+		color = glm::vec4(chaos::GLMTools::RandVec3(), 1.0f);
+	}
+
+protected:
+
+	/** the benchmarks to run */
+	std::vector<BenchmarkPhase> phases;
+	/** the current benchmark */
+	size_t phase_index = 0;
+	/** the frame in the current benchmark */
+	int frame_index = 0;
+	/** the time spent in the current benchmark */
+	double benchmark_duration = 0.0;
+	/** the layer for the current benchmark */
+	chaos::shared_ptr<chaos::ParticleLayerBase> benchmark_layer;
+	/** the layer displayed once the benchmarks are over */
+	chaos::shared_ptr<chaos::ParticleComputeLayer<chaos::ParticleComputeDefaultLayerTrait>> demo_layer;
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WindowApplicationData window_application_data;
+	window_application_data.startup_windows =
+	{
+		{ "main_window", MyWindow::GetStaticClass(), {}, {}, nullptr}
+	};
+	return chaos::RunApplication<chaos::WindowApplication>(argc, argv, env, &window_application_data);
+}
\ No newline at end of file
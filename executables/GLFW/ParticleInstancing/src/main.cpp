@@ -0,0 +1,186 @@
+#include "chaos/Chaos.h"
+
+// XXX : compare the rendering of ParticleDefault as 4 vertices per particle (VertexDefault) with one instance per particle (QuadInstanceDefault)
+//
+//       for each particle count, both layers move their particles for some frames. The time measured is
+//       Tick(...) + Display(...) (vertices generation, upload and draw) surrounded by glFinish() calls
+//
+//       the uploaded size is the size of the vertex buffer that is generated each frame
+
+// ==============================================================
+// Layer traits
+// ==============================================================
+
+template<typename VERTEX_TYPE>
+class MovingParticleLayerTrait : public chaos::ParticleLayerTrait<chaos::ParticleDefault, VERTEX_TYPE>
+{
+public:
+
+	bool UpdateParticle(float delta_time, chaos::ParticleDefault& particle) const
+	{
+		particle.rotation += delta_time;
+		return false;
+	}
+};
+
+using VertexLayerTrait = MovingParticleLayerTrait<chaos::VertexDefault>;
+
+using InstanceLayerTrait = MovingParticleLayerTrait<chaos::QuadInstanceDefault>;
+
+// ==============================================================
+// Application
+// ==============================================================
+
+class MyWindow : public chaos::Window
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyWindow, chaos::Window);
+
+	static constexpr int BENCHMARK_FRAME_COUNT = 100;
+
+	static constexpr float WORLD_SIZE = 1000.0f;
+
+	class BenchmarkPhase
+	{
+	public:
+
+		size_t particle_count = 0;
+		bool instanced = false;
+	};
+
+protected:
+
+	virtual bool OnInitialize(chaos::JSONReadConfiguration config) override
+	{
+		if (!chaos::Window::OnInitialize(config))
+			return false;
+
+		for (size_t particle_count : {10000, 100000, 500000})
+		{
+			phases.push_back({ particle_count, false });
+			phases.push_back({ particle_count, true });
+		}
+		return true;
+	}
+
+	virtual void Finalize() override
+	{
+		layer = nullptr;
+		chaos::Window::Finalize();
+	}
+
+	virtual bool OnDraw(chaos::GPURenderContext * render_context, chaos::GPUProgramProviderInterface const * uniform_provider, chaos::WindowDrawParams const& draw_params) override
+	{
+		glm::vec4 clear_color(0.0f, 0.0f, 0.0f, 0.0f);
+		glClearBufferfv(GL_COLOR, 0, (GLfloat*)&clear_color);
+
+		float far_plane = 1000.0f;
+		glClearBufferfi(GL_DEPTH_STENCIL, 0, far_plane, 0);
+
+		chaos::GPUProgramProviderChain main_uniform_provider(uniform_provider);
+		main_uniform_provider.AddVariable("local_to_camera", glm::scale(glm::vec3(2.0f / WORLD_SIZE, 2.0f / WORLD_SIZE, 1.0f)));
+		main_uniform_provider.AddVariable("projection_matrix", glm::mat4(1.0f));
+
+		chaos::GPURenderParams render_params;
+
+		// once the benchmarks are over, keep on displaying the last (instanced) layer
+		if (phase_index >= phases.size())
+		{
+			if (layer != nullptr)
+			{
+				layer->Tick(1.0f / 60.0f);
+				layer->Display(render_context, &main_uniform_provider, render_params);
+			}
+			return true;
+		}
+
+		BenchmarkPhase const& phase = phases[phase_index];
+
+		// create the layer with all its particles
+		if (layer == nullptr)
+		{
+			layer = (phase.instanced) ? CreateLayer<InstanceLayerTrait>(phase.particle_count, chaos::DefaultParticleInstanceProgram::GetMaterial()) : CreateLayer<VertexLayerTrait>(phase.particle_count, chaos::DefaultParticleProgram::GetMaterial());
+			if (layer == nullptr)
+			{
+				++phase_index;
+				return true;
+			}
+			frame_index = 0;
+			benchmark_duration = 0.0;
+		}
+
+		// the first frame (allocation of the buffers) is ignored
+		glFinish();
+		auto start_time = std::chrono::steady_clock::now();
+		layer->Tick(1.0f / 60.0f);
+		layer->Display(render_context, &main_uniform_provider, render_params);
+		glFinish();
+		auto end_time = std::chrono::steady_clock::now();
+
+		if (frame_index > 0)
+			benchmark_duration += std::chrono::duration<double, std::milli>(end_time - start_time).count();
+
+		// end of the phase
+		if (++frame_index > BENCHMARK_FRAME_COUNT)
+		{
+			size_t upload_size = (phase.instanced) ?
+				phase.particle_count * sizeof(chaos::QuadInstanceDefault) :
+				phase.particle_count * sizeof(chaos::VertexDefault) * 4;
+
+			chaos::Log::Message("%-9s : %8d particles : %8.3f ms per frame, %8.2f MB uploaded per frame",
+				(phase.instanced) ? "instances" : "vertices",
+				int(phase.particle_count),
+				benchmark_duration / double(BENCHMARK_FRAME_COUNT),
+				double(upload_size) / (1024.0 * 1024.0));
+
+			if (++phase_index < phases.size())
+				layer = nullptr;
+		}
+		return true;
+	}
+
+	template<typename TRAIT>
+	chaos::ParticleLayerBase* CreateLayer(size_t particle_count, chaos::GPURenderMaterial* render_material)
+	{
+		chaos::ParticleLayer<TRAIT>* result = new chaos::ParticleLayer<TRAIT>();
+		if (result == nullptr)
+			return nullptr;
+		result->SetRenderMaterial(render_material);
+
+		chaos::ParticleAllocationBase* allocation = result->SpawnParticles(particle_count);
+		if (allocation == nullptr)
+			return nullptr;
+
+		for (chaos::ParticleDefault& particle : allocation->GetParticleAccessor<chaos::ParticleDefault>())
+		{
+			particle.bounding_box.position = (chaos::GLMTools::RandVec2() - glm::vec2(0.5f, 0.5f)) * WORLD_SIZE;
+			particle.bounding_box.half_size = { 2.0f, 4.0f };
+			particle.rotation = chaos::MathTools::RandFloat() * 6.28f;
+			particle.color = glm::vec4(chaos::GLMTools::RandVec3(), 1.0f);
+			particle.texcoords.bitmap_index = -1;
+		}
+		return result;
+	}
+
+protected:
+
+	/** the benchmarks to run */
+	std::vector<BenchmarkPhase> phases;
+	/** the current benchmark */
+	size_t phase_index = 0;
+	/** the frame in the current benchmark */
+	int frame_index = 0;
+	/** the time spent in the current benchmark */
+	double benchmark_duration = 0.0;
+	/** the layer for the current benchmark */
+	chaos::shared_ptr<chaos::ParticleLayerBase> layer;
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WindowApplicationData window_application_data;
+	window_application_data.startup_windows =
+	{
+		{ "main_window", MyWindow::GetStaticClass(), {}, {}, nullptr}
+	};
+	return chaos::RunApplication<chaos::WindowApplication>(argc, argv, env, &window_application_data);
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+-- =============================================================================
+-- ROOT_PATH/executables/GLFW/ParticleInstancing
+-- =============================================================================
+
+local project = build:WindowedApp()
+project:DependOnLib("chaos")
\ No newline at end of file
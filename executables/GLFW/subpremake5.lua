@@ -11,6 +11,8 @@ build:ProcessSubPremake("Framebuffer")
 build:ProcessSubPremake("Instancing")
 build:ProcessSubPremake("LooseTree27")
 build:ProcessSubPremake("MultiMeshGenerator")
+build:ProcessSubPremake("ParticleCompute")
+build:ProcessSubPremake("ParticleInstancing")
 build:ProcessSubPremake("ParticleRefactor")
 build:ProcessSubPremake("RenderMaterial")
 build:ProcessSubPremake("TextSpriteFormat")
@@ -0,0 +1,230 @@
+#include "chaos/Chaos.h"
+
+// XXX : measure C++ <-> Lua calls for a typical per-entity update script
+//
+//       - 'string glue'   : hand-written binding with a __index function that compares the member names (as LuaBinding sample does)
+//       - 'LuaBinding'    : generated bindings with cached metatables
+//
+//       for each binding, the update is done:
+//
+//       - by a script loop (the entities are in a lua table)
+//       - by a C++ loop that calls a lua function for each entity (the entity is pushed each time)
+
+class Entity : public chaos::Object
+{
+	CHAOS_DECLARE_OBJECT_CLASS(Entity, chaos::Object);
+
+public:
+
+	float GetX() const { return position.x; }
+	float GetY() const { return position.y; }
+	float GetVelocityX() const { return velocity.x; }
+	float GetVelocityY() const { return velocity.y; }
+
+	void SetPosition(float x, float y) { position = { x, y }; }
+
+public:
+
+	glm::vec2 position = { 0.0f, 0.0f };
+	glm::vec2 velocity = { 0.0f, 0.0f };
+};
+
+static char const* update_script = R"(
+function UpdateEntities(entities, count, dt)
+	for i = 1, count do
+		local e = entities[i]
+		e:SetPosition(e:GetX() + e:GetVelocityX() * dt, e:GetY() + e:GetVelocityY() * dt)
+	end
+end
+
+function UpdateEntity(e, dt)
+	e:SetPosition(e:GetX() + e:GetVelocityX() * dt, e:GetY() + e:GetVelocityY() * dt)
+end
+)";
+
+// ---------------------------------------------------------------------------
+// hand-written glue: string comparisons for each method access
+// ---------------------------------------------------------------------------
+
+static Entity* GlueCheckEntity(lua_State* state, int index)
+{
+	Entity** ptr = (Entity**)luaL_checkudata(state, index, "Entity");
+	return *ptr;
+}
+
+static int GlueGetX(lua_State* state) { lua_pushnumber(state, GlueCheckEntity(state, 1)->GetX()); return 1; }
+static int GlueGetY(lua_State* state) { lua_pushnumber(state, GlueCheckEntity(state, 1)->GetY()); return 1; }
+static int GlueGetVelocityX(lua_State* state) { lua_pushnumber(state, GlueCheckEntity(state, 1)->GetVelocityX()); return 1; }
+static int GlueGetVelocityY(lua_State* state) { lua_pushnumber(state, GlueCheckEntity(state, 1)->GetVelocityY()); return 1; }
+static int GlueSetPosition(lua_State* state)
+{
+	GlueCheckEntity(state, 1)->SetPosition(float(luaL_checknumber(state, 2)), float(luaL_checknumber(state, 3)));
+	return 0;
+}
+
+static int GlueIndex(lua_State* state)
+{
+	char const* name = luaL_checkstring(state, 2);
+	if (strcmp(name, "GetX") == 0)
+		lua_pushcfunction(state, GlueGetX);
+	else if (strcmp(name, "GetY") == 0)
+		lua_pushcfunction(state, GlueGetY);
+	else if (strcmp(name, "GetVelocityX") == 0)
+		lua_pushcfunction(state, GlueGetVelocityX);
+	else if (strcmp(name, "GetVelocityY") == 0)
+		lua_pushcfunction(state, GlueGetVelocityY);
+	else if (strcmp(name, "SetPosition") == 0)
+		lua_pushcfunction(state, GlueSetPosition);
+	else
+		lua_pushnil(state);
+	return 1;
+}
+
+static void GluePushEntity(lua_State* state, Entity* entity)
+{
+	Entity** ptr = (Entity**)lua_newuserdata(state, sizeof(Entity*)); // a new userdata each time
+	*ptr = entity;
+	luaL_setmetatable(state, "Entity");
+}
+
+static void GlueRegister(lua_State* state)
+{
+	luaL_newmetatable(state, "Entity");
+	lua_pushcfunction(state, GlueIndex);
+	lua_setfield(state, -2, "__index");
+	lua_pop(state, 1);
+}
+
+static void BindingRegister(lua_State* state)
+{
+	chaos::LuaBinding binding(state);
+	binding.AddClass<Entity>("Entity")
+		.AddMethod<&Entity::GetX>("GetX")
+		.AddMethod<&Entity::GetY>("GetY")
+		.AddMethod<&Entity::GetVelocityX>("GetVelocityX")
+		.AddMethod<&Entity::GetVelocityY>("GetVelocityY")
+		.AddMethod<&Entity::SetPosition>("SetPosition");
+}
+
+static void BindingPushEntity(lua_State* state, Entity* entity)
+{
+	chaos::LuaBinding::PushObject(state, entity);
+}
+
+// ---------------------------------------------------------------------------
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	using RegisterFunc = void(*)(lua_State*);
+	using PushFunc = void(*)(lua_State*, Entity*);
+
+	void RunBenchmark(char const* title, RegisterFunc register_func, PushFunc push_func, std::vector<chaos::shared_ptr<Entity>> const& entities, int frame_count)
+	{
+		lua_State* state = chaos::LuaTools::CreateStandardLuaState();
+		if (state == nullptr)
+			return;
+
+		register_func(state);
+		if (luaL_loadstring(state, update_script) != 0 || lua_pcall(state, 0, 0, 0) != 0)
+		{
+			chaos::LuaLog::Error("%s", lua_tostring(state, -1));
+			lua_close(state);
+			return;
+		}
+
+		float const dt = 1.0f / 60.0f;
+		size_t const calls_per_entity = 5;
+
+		// the script loop (the table is filled once)
+		lua_createtable(state, int(entities.size()), 0);
+		for (size_t i = 0; i < entities.size(); ++i)
+		{
+			push_func(state, entities[i].get());
+			lua_rawseti(state, -2, lua_Integer(i + 1));
+		}
+		int table_index = lua_gettop(state);
+
+		auto start_time = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < frame_count; ++frame)
+		{
+			lua_getglobal(state, "UpdateEntities");
+			lua_pushvalue(state, table_index);
+			lua_pushinteger(state, lua_Integer(entities.size()));
+			lua_pushnumber(state, dt);
+			if (lua_pcall(state, 3, 0, 0) != 0)
+			{
+				chaos::LuaLog::Error("%s: %s", title, lua_tostring(state, -1));
+				lua_close(state);
+				return;
+			}
+		}
+		auto script_loop_time = std::chrono::steady_clock::now();
+
+		lua_pop(state, 1); // the table
+
+		// the C++ loop (the entities are pushed for each call)
+		for (int frame = 0; frame < frame_count; ++frame)
+		{
+			for (chaos::shared_ptr<Entity> const& entity : entities)
+			{
+				lua_getglobal(state, "UpdateEntity");
+				push_func(state, entity.get());
+				lua_pushnumber(state, dt);
+				if (lua_pcall(state, 2, 0, 0) != 0)
+				{
+					chaos::LuaLog::Error("%s: %s", title, lua_tostring(state, -1));
+					lua_close(state);
+					return;
+				}
+			}
+		}
+		auto cpp_loop_time = std::chrono::steady_clock::now();
+
+		double script_loop_duration = std::chrono::duration<double>(script_loop_time - start_time).count();
+		double cpp_loop_duration = std::chrono::duration<double>(cpp_loop_time - script_loop_time).count();
+
+		double script_loop_calls = double(frame_count) * double(entities.size() * calls_per_entity);
+		double cpp_loop_calls = double(frame_count) * double(entities.size() * (calls_per_entity + 1));
+
+		chaos::Log::Message("%-12s : script loop %8.2f ms (%6.2f M calls/s), C++ loop %8.2f ms (%6.2f M calls/s)",
+			title,
+			1000.0 * script_loop_duration, script_loop_calls / (1000000.0 * script_loop_duration),
+			1000.0 * cpp_loop_duration, cpp_loop_calls / (1000000.0 * cpp_loop_duration));
+
+		lua_close(state);
+	}
+
+	virtual int Main() override
+	{
+		size_t const entity_count = 10000;
+		int const frame_count = 100;
+
+		std::vector<chaos::shared_ptr<Entity>> entities;
+		for (size_t i = 0; i < entity_count; ++i)
+		{
+			Entity* entity = new Entity;
+			entity->position = { float(i), 0.0f };
+			entity->velocity = { 1.0f, float(i % 7) };
+			entities.emplace_back(entity);
+		}
+
+		chaos::Log::Message("%d entities, %d frames", int(entity_count), frame_count);
+
+		RunBenchmark("string glue", &GlueRegister, &GluePushEntity, entities, frame_count);
+		RunBenchmark("LuaBinding", &BindingRegister, &BindingPushEntity, entities, frame_count);
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
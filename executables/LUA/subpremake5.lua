@@ -3,6 +3,7 @@
 -- =============================================================================
 
 build:ProcessSubPremake("LuaBinding")
+build:ProcessSubPremake("LuaBindingBenchmark")
 build:ProcessSubPremake("LuaBindingPreprocess")
 build:ProcessSubPremake("LuaBinding_2")
 build:ProcessSubPremake("LuaFiles")
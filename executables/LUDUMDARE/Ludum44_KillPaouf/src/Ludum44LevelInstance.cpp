@@ -85,6 +85,21 @@ bool LudumLevelInstance::SerializeIntoJSON(nlohmann::json * json) const
 	return true;
 }
 
+bool LudumLevelInstance::SerializeIntoSnapshot(chaos::SnapshotWriter & writer) const
+{
+	if (!chaos::TMLevelInstance::SerializeIntoSnapshot(writer))
+		return false;
+	writer.Write(scroll_factor);
+	return true;
+}
+
+bool LudumLevelInstance::SerializeFromSnapshot(chaos::SnapshotReader & reader)
+{
+	if (!chaos::TMLevelInstance::SerializeFromSnapshot(reader))
+		return false;
+	return reader.Read(scroll_factor);
+}
+
 void LudumLevelInstance::SetScrollFactor(float in_scroll_factor)
 {
 	scroll_factor = in_scroll_factor;
@@ -35,6 +35,10 @@ protected:
 	bool SerializeFromJSON(chaos::JSONReadConfiguration config) override;
 	/** override */
 	bool SerializeIntoJSON(nlohmann::json * json) const override;
+	/** override */
+	bool SerializeIntoSnapshot(chaos::SnapshotWriter & writer) const override;
+	/** override */
+	bool SerializeFromSnapshot(chaos::SnapshotReader & reader) override;
 
 protected:
 
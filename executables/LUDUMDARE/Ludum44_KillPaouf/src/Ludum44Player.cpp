@@ -193,3 +193,25 @@ bool LudumPlayer::SerializeIntoJSON(nlohmann::json * json) const
 	chaos::JSONTools::SetAttribute(json, "FIRE_RATE_INDEX", current_fire_rate_index);
 	return true;
 }
+
+bool LudumPlayer::SerializeIntoSnapshot(chaos::SnapshotWriter & writer) const
+{
+	if (!chaos::Player::SerializeIntoSnapshot(writer))
+		return false;
+	writer.Write(current_speed_index);
+	writer.Write(current_damage_index);
+	writer.Write(current_charged_damage_index);
+	writer.Write(current_fire_rate_index);
+	return true;
+}
+
+bool LudumPlayer::SerializeFromSnapshot(chaos::SnapshotReader & reader)
+{
+	if (!chaos::Player::SerializeFromSnapshot(reader))
+		return false;
+	reader.Read(current_speed_index);
+	reader.Read(current_damage_index);
+	reader.Read(current_charged_damage_index);
+	reader.Read(current_fire_rate_index);
+	return !reader.HasError();
+}
@@ -29,6 +29,10 @@ protected:
 	virtual bool SerializeFromJSON(chaos::JSONReadConfiguration config) override;
 	/** override */
 	virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+	/** override */
+	virtual bool SerializeIntoSnapshot(chaos::SnapshotWriter & writer) const override;
+	/** override */
+	virtual bool SerializeFromSnapshot(chaos::SnapshotReader & reader) override;
 
 	/** override */
 	virtual void TickInternal(float delta_time) override;
@@ -172,7 +172,10 @@ chaos::ParticleLayerBase * LudumLevel::DoCreateParticleLayer(chaos::TMLayerInsta
 	{
 		ParticleEnemyLayerTrait enemy_trait;
 		enemy_trait.game = ludum_game;
-		return new chaos::ParticleLayer<ParticleEnemyLayerTrait>(enemy_trait);
+		chaos::ParticleLayerBase* result = new chaos::ParticleLayer<ParticleEnemyLayerTrait>(enemy_trait);
+		if (result != nullptr)
+			result->EnableBroadphase(64.0f); // the fires search for the enemies they collide
+		return result;
 	}
 
 	return chaos::TMLevel::DoCreateParticleLayer(layer_instance);
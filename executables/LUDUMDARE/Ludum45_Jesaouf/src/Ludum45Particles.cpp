@@ -37,31 +37,15 @@ static float OnCollisionWithEnemy(ParticleEnemy * enemy, float damage, LudumGame
 	return result;
 }
 
-static void FindEnemiesOnMap(LudumGame * game, std::vector<ParticleEnemy*> & result)
+static chaos::ParticleLayerBase * FindEnemiesLayer(LudumGame * game)
 {
 	// get the enemies
 	LudumLevelInstance* ludum_level_instance = game->GetLevelInstance();
 
 	chaos::TMLayerInstance * enemies_layer_instance = ludum_level_instance->FindLayerInstance("Enemies", true);
 	if (enemies_layer_instance != nullptr)
-	{
-		chaos::ParticleLayerBase * layer = enemies_layer_instance->GetParticleLayer();
-		if (layer != nullptr)
-		{
-			size_t allocation_count = layer->GetAllocationCount();
-			for (size_t i = 0 ; i < allocation_count ; ++i)
-			{
-				chaos::ParticleAllocationBase * allocation = layer->GetAllocation(i);
-				if (allocation != nullptr)
-				{
-					chaos::ParticleAccessor<ParticleEnemy> enemies = allocation->GetParticleAccessor();
-					size_t count = enemies.GetDataCount();
-					for (size_t j = 0 ; j < count ; ++j)
-						result.push_back(&enemies[j]);
-				}
-			}
-		}
-	}
+		return enemies_layer_instance->GetParticleLayer();
+	return nullptr;
 }
 
 // ===========================================================================
@@ -265,7 +249,9 @@ ParticleFireUpdateData ParticleFireLayerTrait::BeginUpdateParticles(float delta_
 			result.camera_box.half_size *= 1.1f;
 		}
 		// get the enemies
-		FindEnemiesOnMap(game, result.enemies);
+		result.enemies_layer = FindEnemiesLayer(game);
+		if (result.enemies_layer != nullptr)
+			result.enemies_broadphase = result.enemies_layer->GetBroadphase();
 		// get the players
 		result.player = game->GetPlayer(0);
 	}
@@ -289,13 +275,17 @@ bool ParticleFireLayerTrait::UpdateParticle(float delta_time, ParticleFire& part
 
 
 	// search for collisions
-	if (particle.player_ownership)
+	if (particle.player_ownership && update_data.enemies_broadphase != nullptr)
 	{
-		size_t count = update_data.enemies.size();
-		for (size_t i = 0 ; i < count ; ++i)
+		bool destroy_particle = false;
+
+		update_data.enemies_broadphase->ForEachCollision(particle.bounding_box, [&](chaos::ParticleBroadphaseEntry const & entry)
 		{
-			ParticleEnemy * enemy = update_data.enemies[i];
-			if (enemy->enemy_health > 0.0f)
+			if (destroy_particle)
+				return;
+
+			ParticleEnemy * enemy = update_data.enemies_layer->FindParticle<ParticleEnemy>(entry.handle);
+			if (enemy != nullptr && enemy->enemy_health > 0.0f)
 			{
 				chaos::box2 b1 = particle.bounding_box;
 				chaos::box2 b2 = enemy->bounding_box;
@@ -303,21 +293,19 @@ bool ParticleFireLayerTrait::UpdateParticle(float delta_time, ParticleFire& part
 				b1.half_size *= COLLISION_FIRE_TWEAK;
 				b2.half_size *= COLLISION_FIRE_TWEAK;
 
-
 				if (chaos::Collide(b1, b2))
 				{
-
-
 					particle.damage -= OnCollisionWithEnemy(enemy, particle.damage, game, false, enemy->bounding_box);
 
 					// kill bullet ?
-					if (particle.damage <= 0.0f)
-						return true;
-					if (!particle.trample)
-						return true;
+					if (particle.damage <= 0.0f || !particle.trample)
+						destroy_particle = true;
 				}
 			}
-		}
+		});
+
+		if (destroy_particle)
+			return true;
 	}
 
 
@@ -173,8 +173,10 @@ public:
 
 	/** the camera box */
 	chaos::box2 camera_box;
-	/** all the enemies */
-	std::vector<ParticleEnemy*> enemies;
+	/** the layer of the enemies */
+	chaos::ParticleLayerBase * enemies_layer = nullptr;
+	/** the index of the enemies */
+	chaos::ParticleBroadphase const * enemies_broadphase = nullptr;
 	/** the main player */
 	class LudumPlayer * player = nullptr;
 };
@@ -0,0 +1,154 @@
+#include "chaos/Chaos.h"
+
+// XXX : compare the loading of an atlas
+//
+//       - JSON index + PNG pages (Atlas::LoadAtlas(...)): parse the JSON, decode the PNG
+//       - binary atlas (AtlasBinary::LoadAtlas(...)): map the file, rebuild the folders from the flat tables
+//
+//       the atlas is generated from random bitmaps. For the binary atlas, all pages are read (as the upload would do)
+//       the upload itself is not measured (no GPU context), but note that the JSON path still has to convert pixels and to generate mipmaps on GPU
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	FIBITMAP* GenerateBitmap(int width, int height)
+	{
+		glm::vec4 color1 = { chaos::MathTools::RandFloat(), chaos::MathTools::RandFloat(), chaos::MathTools::RandFloat(), 1.0f };
+		glm::vec4 color2 = { chaos::MathTools::RandFloat(), chaos::MathTools::RandFloat(), chaos::MathTools::RandFloat(), 0.5f };
+
+		return chaos::ImageTools::GenFreeImage<chaos::PixelBGRA>(width, height, [color1, color2](chaos::ImageDescription& desc)
+		{
+			chaos::ImagePixelAccessor<chaos::PixelBGRA> accessor(desc);
+
+			for (int j = 0; j < desc.height; ++j)
+			{
+				for (int i = 0; i < desc.width; ++i)
+				{
+					float t = float(i + j) / float(desc.width + desc.height);
+					glm::vec4 color = (1.0f - t) * color1 + t * color2;
+
+					chaos::PixelBGRA& pixel = accessor(i, j);
+					pixel.R = (unsigned char)(255.0f * color.r);
+					pixel.G = (unsigned char)(255.0f * color.g);
+					pixel.B = (unsigned char)(255.0f * color.b);
+					pixel.A = (unsigned char)(255.0f * color.a);
+				}
+			}
+		});
+	}
+
+	bool GenerateAtlas(chaos::Atlas& atlas, int bitmap_count)
+	{
+		chaos::AtlasInput input;
+
+		chaos::AtlasFolderInfoInput* folder_input = input.AddFolder("sprites", 0);
+		for (int i = 0; i < bitmap_count; ++i)
+		{
+			FIBITMAP* bitmap = GenerateBitmap(16 + rand() % 112, 16 + rand() % 112);
+			if (bitmap == nullptr)
+				return false;
+
+			char name[32];
+			sprintf_s(name, "sprite_%d", i);
+			if (folder_input->AddBitmap(bitmap, true, name, 0) == nullptr)
+			{
+				FreeImage_Unload(bitmap);
+				return false;
+			}
+		}
+
+		chaos::AtlasGenerator generator;
+		return generator.ComputeResult(input, atlas, chaos::AtlasGeneratorParams(1024, 1024, 2, chaos::PixelFormatMergeParams()));
+	}
+
+	template<typename FUNC>
+	void RunBenchmark(char const* title, int iterations, FUNC func)
+	{
+		size_t result = 0; // prevent the compiler from removing the loop
+
+		auto start_time = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i)
+			result += func();
+		auto end_time = std::chrono::steady_clock::now();
+
+		double duration = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+		chaos::Log::Message("%-24s : %8.2f ms per load [%d]", title, duration / double(iterations), int(result));
+	}
+
+	static uintmax_t GetDirectorySize(boost::filesystem::path const& path)
+	{
+		uintmax_t result = 0;
+		for (boost::filesystem::directory_entry const& entry : boost::filesystem::directory_iterator(path))
+			if (boost::filesystem::is_regular_file(entry.path()))
+				result += boost::filesystem::file_size(entry.path());
+		return result;
+	}
+
+	virtual int Main() override
+	{
+		int const bitmap_count = 1000;
+		int const iterations = 10;
+
+		if (!CreateApplicationTemporaryDirectory())
+			return -1;
+
+		boost::filesystem::path json_path = GetApplicationTemporaryPath() / "JSON" / "MyAtlas.json";
+		boost::filesystem::path binary_path = GetApplicationTemporaryPath() / "MyAtlas.bin";
+
+		// generate the atlas and save it in both formats
+		srand(0);
+		chaos::Atlas atlas;
+		if (!GenerateAtlas(atlas, bitmap_count))
+			return -1;
+		if (!atlas.SaveAtlas(json_path))
+			return -1;
+		if (!chaos::AtlasBinary::SaveAtlas(atlas, binary_path))
+			return -1;
+
+		chaos::Log::Message("%d bitmaps, %d pages", bitmap_count, int(atlas.GetBitmapCount()));
+		chaos::Log::Message("JSON + PNG size         : %8.2f MB", double(GetDirectorySize(json_path.parent_path())) / (1024.0 * 1024.0));
+		chaos::Log::Message("binary size (+ mipmaps) : %8.2f MB", double(boost::filesystem::file_size(binary_path)) / (1024.0 * 1024.0));
+
+		RunBenchmark("JSON + PNG", iterations, [&json_path]()
+		{
+			chaos::Atlas loaded_atlas;
+			if (!loaded_atlas.LoadAtlas(json_path))
+				return size_t(0);
+			return loaded_atlas.GetBitmapCount();
+		});
+
+		RunBenchmark("binary", iterations, [&binary_path]()
+		{
+			chaos::AtlasBinary loaded_atlas;
+			if (!loaded_atlas.LoadAtlas(binary_path))
+				return size_t(0);
+
+			// touch all pages (the mapping is lazy)
+			size_t result = 0;
+			for (int i = 0; i < int(loaded_atlas.GetBitmapCount()); ++i)
+			{
+				for (int level = 0; level < loaded_atlas.GetMipmapCount(); ++level)
+				{
+					chaos::ImageDescription image = loaded_atlas.GetPageImage(i, level);
+					char const* data = (char const*)image.data;
+					for (int offset = 0; offset < image.pitch_size * image.height; offset += 4096)
+						result += size_t(data[offset]);
+				}
+			}
+			return loaded_atlas.GetBitmapCount() + (result & 1);
+		});
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "chaos/Chaos.h"
+
+// XXX : measure the class lookup/inheritance tests that are done for each particle accessor
+//
+//       - FindCPPClass<T>() (cached for the default manager)
+//       - InheritsFrom(...) (interval test) against a parent walk
+//       - GetParticleAccessor<T>() (both of them)
+
+class Level0 {};
+class Level1 : public Level0 {};
+class Level2 : public Level1 {};
+class Level3 : public Level2 {};
+class Level4 : public Level3 {};
+class Level5 : public Level4 {};
+class Level6 : public Level5 {};
+class Level7 : public Level6 {};
+
+CHAOS_REGISTER_CLASS(Level0);
+CHAOS_REGISTER_CLASS(Level1, Level0);
+CHAOS_REGISTER_CLASS(Level2, Level1);
+CHAOS_REGISTER_CLASS(Level3, Level2);
+CHAOS_REGISTER_CLASS(Level4, Level3);
+CHAOS_REGISTER_CLASS(Level5, Level4);
+CHAOS_REGISTER_CLASS(Level6, Level5);
+CHAOS_REGISTER_CLASS(Level7, Level6);
+
+// the former implementation of InheritsFrom(...)
+static chaos::InheritanceType InheritsFromParentWalk(chaos::Class const* child_class, chaos::Class const* parent_class)
+{
+	for (chaos::Class const* p = child_class; p != nullptr; p = p->GetParentClass())
+	{
+		if (p == parent_class)
+			return chaos::InheritanceType::Yes;
+		if (!p->IsDeclared())
+			return chaos::InheritanceType::Unknown;
+	}
+	return chaos::InheritanceType::No;
+}
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	template<typename FUNC>
+	void RunBenchmark(char const* title, int iterations, FUNC func)
+	{
+		size_t result = 0; // prevent the compiler from removing the loop
+
+		auto start_time = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i)
+			result += func(i);
+		auto end_time = std::chrono::steady_clock::now();
+
+		double duration = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+		chaos::Log::Message("%-36s : %8.2f ms (%.2f ns per call) [%d]", title, duration, 1000000.0 * duration / double(iterations), int(result));
+	}
+
+	virtual int Main() override
+	{
+		int const iterations = 10000000;
+
+		chaos::ClassManager* manager = chaos::ClassManager::GetDefaultInstance();
+
+		chaos::Class const* root_class = manager->FindCPPClass<Level0>();
+		chaos::Class const* leaf_class = manager->FindCPPClass<Level7>();
+		chaos::Class const* particle_class = manager->FindCPPClass<chaos::ParticleDefault>();
+
+		assert(chaos::Class::InheritsFrom(leaf_class, root_class) == chaos::InheritanceType::Yes);
+		assert(chaos::Class::InheritsFrom(root_class, leaf_class) == chaos::InheritanceType::No);
+		assert(chaos::Class::InheritsFrom(leaf_class, particle_class) == chaos::InheritanceType::No);
+
+		RunBenchmark("FindCPPClass", iterations, [manager](int i)
+		{
+			return (manager->FindCPPClass<Level7>() != nullptr) ? 1 : 0;
+		});
+
+		RunBenchmark("InheritsFrom (parent walk)", iterations, [leaf_class, root_class](int i)
+		{
+			return (InheritsFromParentWalk(leaf_class, root_class) == chaos::InheritanceType::Yes) ? 1 : 0;
+		});
+
+		RunBenchmark("InheritsFrom (intervals)", iterations, [leaf_class, root_class](int i)
+		{
+			return (leaf_class->InheritsFrom(root_class) == chaos::InheritanceType::Yes) ? 1 : 0;
+		});
+
+		// the accessor path (as TMTileCollisionIteratorBase does for each particle)
+		chaos::shared_ptr<chaos::ParticleLayerBase> layer = new chaos::ParticleLayer<chaos::ParticleDefaultLayerTrait>();
+		chaos::ParticleAllocationBase* allocation = layer->SpawnParticles(16);
+		if (allocation == nullptr)
+			return -1;
+
+		RunBenchmark("GetParticleAccessor<ParticleDefault>", iterations, [allocation](int i)
+		{
+			return allocation->GetParticleAccessor<chaos::ParticleDefault>().GetDataCount();
+		});
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
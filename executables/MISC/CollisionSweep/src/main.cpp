@@ -0,0 +1,268 @@
+#include "chaos/Chaos.h"
+
+// XXX : compare the CPU cost of the discrete collisions (sub-stepped to avoid tunnelling) against the swept collisions
+//       the world is a grid of solid tiles. The edges shared by 2 solid tiles are ignored (as NEIGHBOUR flags do)
+
+class SweepWorld
+{
+public:
+
+	SweepWorld(int in_width, int in_height, float in_tile_size, float solid_ratio) :
+		width(in_width),
+		height(in_height),
+		tile_size(in_tile_size)
+	{
+		solid.resize(size_t(width * height), false);
+		for (int y = 0; y < height; ++y)
+			for (int x = 0; x < width; ++x)
+				if (x == 0 || y == 0 || x == width - 1 || y == height - 1 || chaos::MathTools::RandFloat() < solid_ratio)
+					solid[size_t(x + y * width)] = true;
+	}
+
+	bool IsSolid(int x, int y) const
+	{
+		if (x < 0 || y < 0 || x >= width || y >= height)
+			return false;
+		return solid[size_t(x + y * width)];
+	}
+
+	chaos::box_corners2 GetTileCorners(int x, int y) const
+	{
+		chaos::box_corners2 result;
+		result.min = glm::vec2(float(x), float(y)) * tile_size;
+		result.max = result.min + glm::vec2(tile_size, tile_size);
+		return result;
+	}
+
+	bool IsCollisionEdge(int x, int y, chaos::Edge edge) const
+	{
+		switch (edge)
+		{
+		case chaos::Edge::Left: return !IsSolid(x - 1, y);
+		case chaos::Edge::Right: return !IsSolid(x + 1, y);
+		case chaos::Edge::Bottom: return !IsSolid(x, y - 1);
+		case chaos::Edge::Top: return !IsSolid(x, y + 1);
+		}
+		return false;
+	}
+
+	template<typename FUNC>
+	void ForEachSolidTile(chaos::box2 const& box, FUNC func) const
+	{
+		chaos::box_corners2 corners = chaos::GetBoxCorners(box);
+		int x1 = std::max(int(std::floor(corners.min.x / tile_size)), 0);
+		int y1 = std::max(int(std::floor(corners.min.y / tile_size)), 0);
+		int x2 = std::min(int(std::floor(corners.max.x / tile_size)), width - 1);
+		int y2 = std::min(int(std::floor(corners.max.y / tile_size)), height - 1);
+		for (int y = y1; y <= y2; ++y)
+			for (int x = x1; x <= x2; ++x)
+				if (IsSolid(x, y))
+					func(x, y);
+	}
+
+	bool IsInsideSolid(glm::vec2 const& position) const
+	{
+		return IsSolid(int(std::floor(position.x / tile_size)), int(std::floor(position.y / tile_size)));
+	}
+
+public:
+
+	int width = 0;
+	int height = 0;
+	float tile_size = 32.0f;
+	std::vector<bool> solid;
+};
+
+class SweepPawn
+{
+public:
+
+	chaos::box2 box;
+
+	glm::vec2 velocity = { 0.0f, 0.0f };
+};
+
+static chaos::Edge const all_edges[] = { chaos::Edge::Left, chaos::Edge::Right, chaos::Edge::Bottom, chaos::Edge::Top };
+
+// same as TileCollisionComputer::ComputeReaction(...)
+static chaos::box2 DiscreteStep(SweepWorld const& world, chaos::box2 const& src_box, glm::vec2 const& displacement, glm::vec2 const& extend)
+{
+	chaos::box2 dst_box = src_box;
+	dst_box.position += displacement;
+
+	chaos::box2 region = src_box | dst_box;
+	region.half_size += extend;
+
+	world.ForEachSolidTile(region, [&](int x, int y)
+	{
+		chaos::box_corners2 particle_corners = world.GetTileCorners(x, y);
+
+		glm::vec2 best_position = dst_box.position;
+		float best_distance = std::numeric_limits<float>::max();
+
+		for (chaos::Edge edge : all_edges)
+		{
+			if (!world.IsCollisionEdge(x, y, edge))
+				continue;
+			glm::vec2 new_position = dst_box.position;
+			if (chaos::TileCollisionComputer::ComputeEdgeContact(particle_corners, dst_box, displacement, extend, edge, new_position) == 2)
+			{
+				float distance = glm::length(dst_box.position - new_position);
+				if (distance < best_distance)
+				{
+					best_position = new_position;
+					best_distance = distance;
+				}
+			}
+		}
+		dst_box.position = best_position;
+	});
+	return dst_box;
+}
+
+// same as TileCollisionComputer::RunContinuous(...) without the final discrete pass
+static chaos::box2 SweptStep(SweepWorld const& world, chaos::box2 const& src_box, glm::vec2 displacement, glm::vec2 const& extend)
+{
+	chaos::box2 box = src_box;
+	for (int i = 0; i < 3 && displacement != glm::vec2(0.0f, 0.0f); ++i)
+	{
+		chaos::box2 swept_box = box;
+		swept_box.position += displacement;
+		swept_box = swept_box | box;
+		swept_box.half_size += extend;
+
+		bool hit = false;
+		float best_time = 1.0f;
+		glm::vec2 best_normal = { 0.0f, 0.0f };
+
+		world.ForEachSolidTile(swept_box, [&](int x, int y)
+		{
+			chaos::box_corners2 particle_corners = world.GetTileCorners(x, y);
+			for (chaos::Edge edge : all_edges)
+			{
+				float time_of_impact = 1.0f;
+				if (world.IsCollisionEdge(x, y, edge) && chaos::TileCollisionComputer::SweepEdge(particle_corners, box, displacement, extend, edge, time_of_impact))
+				{
+					if (!hit || time_of_impact < best_time)
+					{
+						hit = true;
+						best_time = time_of_impact;
+						best_normal = chaos::TileCollisionComputer::GetEdgeNormal(edge);
+					}
+				}
+			}
+		});
+
+		box.position += displacement * best_time;
+		if (!hit)
+			break;
+		displacement *= (1.0f - best_time);
+		displacement -= best_normal * glm::dot(displacement, best_normal);
+	}
+	return box;
+}
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	std::vector<SweepPawn> CreatePawns(SweepWorld const& world, size_t count, float max_velocity)
+	{
+		std::vector<SweepPawn> result;
+		while (result.size() < count)
+		{
+			SweepPawn pawn;
+			pawn.box.position = glm::vec2(chaos::MathTools::RandFloat() * float(world.width), chaos::MathTools::RandFloat() * float(world.height)) * world.tile_size;
+			pawn.box.half_size = glm::vec2(world.tile_size * 0.4f, world.tile_size * 0.4f);
+			pawn.velocity = (glm::vec2(chaos::MathTools::RandFloat(), chaos::MathTools::RandFloat()) * 2.0f - glm::vec2(1.0f, 1.0f)) * max_velocity;
+
+			bool free_position = true;
+			world.ForEachSolidTile(pawn.box, [&free_position](int x, int y) { free_position = false; });
+			if (free_position)
+				result.push_back(pawn);
+		}
+		return result;
+	}
+
+	template<typename STEP_FUNC>
+	void RunBenchmark(char const* title, SweepWorld const& world, std::vector<SweepPawn> pawns, int tick_count, float delta_time, STEP_FUNC step_func)
+	{
+		glm::vec2 extend = { 1.0f, 1.0f };
+
+		size_t tunnelling_count = 0;
+
+		auto start_time = std::chrono::steady_clock::now();
+		for (int tick = 0; tick < tick_count; ++tick)
+		{
+			for (SweepPawn& pawn : pawns)
+			{
+				glm::vec2 displacement = pawn.velocity * delta_time;
+				chaos::box2 new_box = step_func(world, pawn.box, displacement, extend);
+
+				// bounce whenever the pawn has been blocked along an axis
+				glm::vec2 moved = new_box.position - pawn.box.position;
+				for (int axis = 0; axis < 2; ++axis)
+					if (std::abs(moved[axis]) < std::abs(displacement[axis]) * 0.5f)
+						pawn.velocity[axis] = -pawn.velocity[axis];
+
+				pawn.box = new_box;
+				if (world.IsInsideSolid(pawn.box.position))
+					++tunnelling_count;
+			}
+		}
+		auto end_time = std::chrono::steady_clock::now();
+
+		double duration = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+		chaos::Log::Message("%-28s : %8.2f ms (%.3f us per pawn update) %d pawns inside walls", title, duration, 1000.0 * duration / double(pawns.size() * size_t(tick_count)), int(tunnelling_count));
+	}
+
+	virtual int Main() override
+	{
+		chaos::MathTools::ResetRandSeed();
+
+		SweepWorld world(128, 128, 32.0f, 0.15f);
+
+		size_t const pawn_count = 2000;
+		int const tick_count = 300;
+		float const max_velocity = 2000.0f; // up to 2 tiles per tick at 30Hz
+
+		for (float delta_time : {1.0f / 120.0f, 1.0f / 60.0f, 1.0f / 30.0f})
+		{
+			chaos::Log::Message("Tick %.1f Hz, max %.1f tiles per tick", 1.0f / delta_time, max_velocity * delta_time / world.tile_size);
+
+			std::vector<SweepPawn> pawns = CreatePawns(world, pawn_count, max_velocity);
+
+			RunBenchmark("discrete (no sub-step)", world, pawns, tick_count, delta_time, [](SweepWorld const& world, chaos::box2 const& box, glm::vec2 const& displacement, glm::vec2 const& extend)
+			{
+				return DiscreteStep(world, box, displacement, extend);
+			});
+
+			RunBenchmark("discrete (sub-stepped)", world, pawns, tick_count, delta_time, [](SweepWorld const& world, chaos::box2 const& box, glm::vec2 const& displacement, glm::vec2 const& extend)
+			{
+				// sub-step so that a step never exceeds a quarter of a tile
+				int step_count = std::max(1, int(std::ceil(glm::length(displacement) / (world.tile_size * 0.25f))));
+				chaos::box2 result = box;
+				for (int i = 0; i < step_count; ++i)
+					result = DiscreteStep(world, result, displacement / float(step_count), extend);
+				return result;
+			});
+
+			RunBenchmark("swept", world, pawns, tick_count, delta_time, [](SweepWorld const& world, chaos::box2 const& box, glm::vec2 const& displacement, glm::vec2 const& extend)
+			{
+				return SweptStep(world, box, displacement, extend);
+			});
+		}
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
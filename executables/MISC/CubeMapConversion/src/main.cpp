@@ -117,6 +117,76 @@ void TestDoubleConversion(boost::filesystem::path const & dst_p, boost::filesyst
 	}
 }
 
+// ====================================================================================
+// Take 1 image, convert it into an equirectangular image and back into a cubemap. Save both into Temp
+// ====================================================================================
+
+void TestEquirectangular(boost::filesystem::path const & dst_p, boost::filesystem::path const & p, char const * dst_filename)
+{
+	chaos::CubeMapImages single_image = chaos::CubeMapTools::LoadSingleCubeMap(p);
+	if (single_image.IsSingleImage())
+	{
+		int size = single_image.GetCubeMapSize();
+
+		auto start_time = std::chrono::steady_clock::now();
+		chaos::bitmap_ptr equirectangular_image(chaos::CubeMapTools::CubeMapToEquirectangular(single_image, 4 * size, 2 * size));
+		auto equirectangular_time = std::chrono::steady_clock::now();
+		if (equirectangular_image != nullptr)
+		{
+			chaos::CubeMapImages multiple_image = chaos::CubeMapTools::EquirectangularToCubeMap(equirectangular_image.get(), size);
+			auto cubemap_time = std::chrono::steady_clock::now();
+
+			chaos::Log::Message("%s : cube -> equirectangular %.2f ms, equirectangular -> cube %.2f ms",
+				dst_filename,
+				std::chrono::duration<double, std::milli>(equirectangular_time - start_time).count(),
+				std::chrono::duration<double, std::milli>(cubemap_time - equirectangular_time).count());
+
+			FreeImage_Save(FIF_PNG, equirectangular_image.get(), (dst_p / chaos::StringTools::Printf("%s_Equirectangular.png", dst_filename)).string().c_str(), 0);
+
+			chaos::CubeMapImages single_image_back = multiple_image.ToSingleImage(chaos::CubeMapSingleImageLayoutType::Horizontal, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), chaos::PixelFormatMergeParams());
+			if (FIBITMAP * image = single_image_back.GetImage(chaos::CubeMapImageType::ImageSingle))
+				FreeImage_Save(FIF_PNG, image, (dst_p / chaos::StringTools::Printf("%s_CubeMap.png", dst_filename)).string().c_str(), 0);
+		}
+	}
+}
+
+// ====================================================================================
+// Take 1 image, generate its GGX prefiltered levels and save them as a single file. Reload it and save each level into Temp
+// ====================================================================================
+
+void TestPrefilteredMipChain(boost::filesystem::path const & dst_p, boost::filesystem::path const & p, char const * dst_filename)
+{
+	chaos::CubeMapImages single_image = chaos::CubeMapTools::LoadSingleCubeMap(p);
+	if (single_image.IsSingleImage())
+	{
+		chaos::CubeMapMipChain mip_chain;
+		if (!mip_chain.InitializeFromCubeMap(single_image))
+			return;
+
+		auto start_time = std::chrono::steady_clock::now();
+		if (!mip_chain.GenerateGGXMipChain(6, 64))
+			return;
+		auto end_time = std::chrono::steady_clock::now();
+
+		chaos::Log::Message("%s : GGX mip chain (%d levels) %.2f ms", dst_filename, mip_chain.GetLevelCount(), std::chrono::duration<double, std::milli>(end_time - start_time).count());
+
+		boost::filesystem::path mip_chain_path = dst_p / chaos::StringTools::Printf("%s.cmip", dst_filename);
+		if (!mip_chain.SaveToFile(mip_chain_path))
+			return;
+
+		chaos::CubeMapMipChain loaded_mip_chain;
+		if (!loaded_mip_chain.LoadFromFile(mip_chain_path))
+			return;
+
+		for (int level = 0; level < loaded_mip_chain.GetLevelCount(); ++level)
+		{
+			chaos::bitmap_ptr image(loaded_mip_chain.ToEquirectangular(level, 512, 256, chaos::PixelFormat::BGR));
+			if (image != nullptr)
+				FreeImage_Save(FIF_PNG, image.get(), (dst_p / chaos::StringTools::Printf("%s_Level%d.png", dst_filename, level)).string().c_str(), 0);
+		}
+	}
+}
+
 class MyApplication : public chaos::Application
 {
 	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
@@ -139,6 +209,10 @@ protected:
 			TestDoubleConversion(dst_p, rp / "violentdays_large.jpg", "DoubleConversionViolent.png");
 			TestDoubleConversion(dst_p, rp / "originalcubecross.png", "DoubleConversionOriginalCube.png");
 
+			TestEquirectangular(dst_p, rp / "violentdays_large.jpg", "EquirectangularViolent");
+
+			TestPrefilteredMipChain(dst_p, rp / "violentdays_large.jpg", "PrefilteredViolent");
+
 			chaos::WinTools::ShowFile(dst_p);
 		}
 
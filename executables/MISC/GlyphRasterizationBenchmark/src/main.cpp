@@ -0,0 +1,129 @@
+#include "chaos/Chaos.h"
+
+// XXX : measure the glyph rasterization done when a font is added into an atlas
+//
+//       - sequential : GetBitmapGlyph(...) + GenerateImage(...) for each character (one FIBITMAP per glyph)
+//       - arena      : RasterizeGlyphs(...) (worker threads with their own FT_Face, a single buffer for all glyphs)
+//
+//       every character of the font is rasterized, at several sizes. Both results are compared pixel per pixel
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	/** get all characters the font has a glyph for */
+	std::vector<uint32_t> GetFontCharacters(FT_Face face)
+	{
+		std::vector<uint32_t> result;
+
+		FT_UInt glyph_index = 0;
+		for (FT_ULong charcode = FT_Get_First_Char(face, &glyph_index); glyph_index != 0; charcode = FT_Get_Next_Char(face, charcode, &glyph_index))
+			result.push_back(uint32_t(charcode));
+		result.push_back(0);
+
+		std::sort(result.begin(), result.end());
+		result.erase(std::unique(result.begin(), result.end()), result.end());
+		return result;
+	}
+
+	/** compare the FIBITMAP of a glyph with the corresponding pixels in the arena */
+	bool IsSameGlyph(FIBITMAP* bitmap, chaos::ImageDescription const& arena_desc)
+	{
+		if (bitmap == nullptr)
+			return (arena_desc.data == nullptr);
+
+		chaos::ImageDescription bitmap_desc = chaos::ImageTools::GetImageDescription(bitmap);
+		if (bitmap_desc.width != arena_desc.width || bitmap_desc.height != arena_desc.height)
+			return false;
+
+		for (int y = 0; y < bitmap_desc.height; ++y)
+		{
+			char const* bitmap_line = (char const*)bitmap_desc.data + y * bitmap_desc.pitch_size;
+			char const* arena_line = (char const*)arena_desc.data + y * arena_desc.pitch_size;
+			if (memcmp(bitmap_line, arena_line, size_t(bitmap_desc.line_size)) != 0)
+				return false;
+		}
+		return true;
+	}
+
+	void RunBenchmark(FT_Face face, int glyph_size, std::vector<uint32_t> const& characters)
+	{
+		if (FT_Set_Pixel_Sizes(face, glyph_size, glyph_size) != 0)
+			return;
+
+		// sequential path
+		auto start_time = std::chrono::steady_clock::now();
+
+		std::vector<chaos::bitmap_ptr> bitmaps;
+		bitmaps.reserve(characters.size());
+		for (uint32_t charcode : characters)
+		{
+			FT_BitmapGlyph bitmap_glyph = chaos::FontTools::GetBitmapGlyph(face, charcode, false);
+			if (bitmap_glyph == nullptr)
+				continue;
+			bitmaps.emplace_back(chaos::FontTools::GenerateImage(bitmap_glyph->bitmap, chaos::PixelFormat::Gray));
+			FT_Done_Glyph((FT_Glyph)bitmap_glyph);
+		}
+		auto sequential_time = std::chrono::steady_clock::now();
+
+		// arena path
+		chaos::FontTools::GlyphArena glyph_arena;
+		chaos::FontTools::RasterizeGlyphs(face, characters, glyph_arena);
+
+		auto arena_time = std::chrono::steady_clock::now();
+
+		// compare
+		bool identical = (bitmaps.size() == glyph_arena.glyphs.size());
+		for (size_t i = 0; i < bitmaps.size() && identical; ++i)
+			identical = IsSameGlyph(bitmaps[i].get(), glyph_arena.GetImageDescription(glyph_arena.glyphs[i]));
+
+		double sequential_duration = std::chrono::duration<double>(sequential_time - start_time).count();
+		double arena_duration = std::chrono::duration<double>(arena_time - sequential_time).count();
+
+		chaos::Log::Message("size %3d, %5d glyphs : sequential %10.0f glyphs/s, arena %10.0f glyphs/s (x%.2f) [%s]",
+			glyph_size,
+			int(glyph_arena.glyphs.size()),
+			double(bitmaps.size()) / sequential_duration,
+			double(glyph_arena.glyphs.size()) / arena_duration,
+			sequential_duration / arena_duration,
+			identical ? "identical" : "DIFFERENT");
+	}
+
+	virtual int Main() override
+	{
+		boost::filesystem::path font_path = GetResourcesPath() / "AgreloyS1.ttf";
+
+		chaos::Buffer<char> buffer = chaos::FileTools::LoadFile(font_path);
+		if (buffer == nullptr)
+			return -1;
+
+		FT_Library library = nullptr;
+		if (FT_Init_FreeType(&library) != 0)
+			return -1;
+		chaos::library_ptr library_owner(library);
+
+		FT_Face face = nullptr;
+		if (FT_New_Memory_Face(library, (FT_Byte const*)buffer.data, (FT_Long)buffer.bufsize, 0, &face) != 0)
+			return -1;
+		chaos::face_ptr face_owner(face);
+
+		std::vector<uint32_t> characters = GetFontCharacters(face);
+
+		chaos::Log::Message("%d characters, %d worker threads", int(characters.size()), int(chaos::ThreadPool::GetDefaultInstance()->GetThreadCount()));
+
+		for (int glyph_size : {16, 32, 64, 128})
+			RunBenchmark(face, glyph_size, characters);
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
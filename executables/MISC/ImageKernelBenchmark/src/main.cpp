@@ -0,0 +1,146 @@
+#include "chaos/Chaos.h"
+
+// XXX : measure the throughput of the image kernels used by the atlas processors
+//
+//       - ColorFilter: one call per pixel against a whole row at once (results must be identical)
+//       - box and gaussian blurs
+//       - shadow, glow and outline processors
+//
+//       the resulting images are saved in a temporary directory
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	/** generate some discs with soft borders */
+	FIBITMAP* GenerateSourceImage(int width, int height)
+	{
+		return chaos::ImageTools::GenFreeImage<chaos::PixelBGRA>(width, height, [width, height](chaos::ImageDescription const& desc)
+		{
+			chaos::ImagePixelAccessor<chaos::PixelBGRA> accessor(desc);
+			for (int y = 0; y < height; ++y)
+			{
+				for (int x = 0; x < width; ++x)
+				{
+					// a grid of discs
+					float cx = float(x % 64) - 32.0f;
+					float cy = float(y % 64) - 32.0f;
+					float alpha = std::clamp(24.0f - std::sqrt(cx * cx + cy * cy), 0.0f, 1.0f);
+
+					chaos::PixelBGRA& p = accessor(x, y);
+					p.R = (unsigned char)(x * 255 / width);
+					p.G = (unsigned char)(y * 255 / height);
+					p.B = 128;
+					p.A = (unsigned char)(alpha * 255.0f);
+				}
+			}
+		});
+	}
+
+	template<typename FUNC>
+	void RunBenchmark(char const* title, size_t pixel_count, int iterations, FUNC func)
+	{
+		auto start_time = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i)
+			func();
+		auto end_time = std::chrono::steady_clock::now();
+
+		double duration = std::chrono::duration<double, std::milli>(end_time - start_time).count() / double(iterations);
+		chaos::Log::Message("%-28s : %8.2f ms (%8.2f Mpixels/s)", title, duration, double(pixel_count) / (1000.0 * duration));
+	}
+
+	void RunProcessorBenchmark(boost::filesystem::path const& dst_p, char const* title, chaos::ImageProcessor const& processor, chaos::ImageDescription const& src_desc, int iterations)
+	{
+		chaos::bitmap_ptr result;
+		RunBenchmark(title, size_t(src_desc.width) * size_t(src_desc.height), iterations, [&]()
+		{
+			result.reset(processor.ProcessImage(src_desc));
+		});
+
+		if (result != nullptr)
+			FreeImage_Save(FIF_PNG, result.get(), (dst_p / chaos::StringTools::Printf("%s.png", title)).string().c_str(), 0);
+		else
+			chaos::Log::Error("%s : processing failed", title);
+	}
+
+	void TestColorFilter(chaos::ImageDescription const& src_desc, int iterations)
+	{
+		chaos::ColorFilter color_filter;
+		color_filter.distance = 0.5f;
+
+		size_t pixel_count = size_t(src_desc.width) * size_t(src_desc.height);
+		chaos::ImagePixelAccessor<chaos::PixelBGRA> accessor(src_desc);
+
+		std::vector<unsigned char> per_pixel_results(pixel_count);
+		RunBenchmark("ColorFilter (per pixel)", pixel_count, iterations, [&]()
+		{
+			for (int y = 0; y < src_desc.height; ++y)
+				for (int x = 0; x < src_desc.width; ++x)
+					per_pixel_results[size_t(x) + size_t(y) * size_t(src_desc.width)] = color_filter.Filter(accessor(x, y)) ? 1 : 0;
+		});
+
+		std::vector<unsigned char> row_results(pixel_count);
+		RunBenchmark("ColorFilter (rows)", pixel_count, iterations, [&]()
+		{
+			for (int y = 0; y < src_desc.height; ++y)
+				color_filter.FilterRow(&accessor(0, y), size_t(src_desc.width), row_results.data() + size_t(y) * size_t(src_desc.width));
+		});
+
+		if (per_pixel_results != row_results)
+			chaos::Log::Error("ColorFilter : per pixel and row results differ");
+	}
+
+	virtual int Main() override
+	{
+		int const iterations = 10;
+
+		chaos::bitmap_ptr source(GenerateSourceImage(1024, 1024));
+		if (source == nullptr)
+			return -1;
+		chaos::ImageDescription src_desc = chaos::ImageTools::GetImageDescription(source.get());
+
+		chaos::Log::Message("%d x %d image, %d threads", src_desc.width, src_desc.height, int(chaos::ThreadPool::GetDefaultInstance()->GetThreadCount()));
+
+		TestColorFilter(src_desc, iterations);
+
+		boost::filesystem::path dst_p;
+		if (!chaos::FileTools::CreateTemporaryDirectory("ImageKernelBenchmark", dst_p))
+			return -1;
+
+		chaos::shared_ptr<chaos::ImageProcessorBlur> box_blur = new chaos::ImageProcessorBlur;
+		box_blur->kernel_type = chaos::BlurKernelType::Box;
+		box_blur->radius = 4;
+		RunProcessorBenchmark(dst_p, "BoxBlur", *box_blur, src_desc, iterations);
+
+		chaos::shared_ptr<chaos::ImageProcessorBlur> gaussian_blur = new chaos::ImageProcessorBlur;
+		gaussian_blur->kernel_type = chaos::BlurKernelType::Gaussian;
+		gaussian_blur->radius = 8;
+		RunProcessorBenchmark(dst_p, "GaussianBlur", *gaussian_blur, src_desc, iterations);
+
+		chaos::shared_ptr<chaos::ImageProcessorShadow> shadow = new chaos::ImageProcessorShadow;
+		shadow->radius = 6;
+		shadow->offset = { 4, -4 };
+		RunProcessorBenchmark(dst_p, "Shadow", *shadow, src_desc, iterations);
+
+		chaos::shared_ptr<chaos::ImageProcessorGlow> glow = new chaos::ImageProcessorGlow;
+		glow->radius = 6;
+		glow->color = { 1.0f, 0.8f, 0.2f, 1.0f };
+		RunProcessorBenchmark(dst_p, "Glow", *glow, src_desc, iterations);
+
+		chaos::shared_ptr<chaos::ImageProcessorOutline> outline = new chaos::ImageProcessorOutline;
+		outline->distance = 2;
+		RunProcessorBenchmark(dst_p, "Outline", *outline, src_desc, iterations);
+
+		chaos::WinTools::ShowFile(dst_p);
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+-- =============================================================================
+-- ROOT_PATH/executables/MISC/ImageKernelBenchmark
+-- =============================================================================
+
+local project = build:WindowedApp()
+project:DependOnLib("chaos")
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "chaos/Chaos.h"
+
+// XXX : build a packed archive from a resources directory
+//
+//       PackResources <resources directory> <archive path> [-Compress]
+//
+//       copy the archive as "resources.pak" next to an executable: its resources directory is then mounted on the archive
+//       the archive is immediately reloaded and compared with the source files
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	bool CheckArchive(boost::filesystem::path const& archive_path, boost::filesystem::path const& resources_path)
+	{
+		chaos::PackedArchive archive;
+		if (!archive.Open(archive_path, resources_path))
+			return false;
+
+		for (chaos::PackedArchiveEntry const& entry : archive.GetEntries())
+		{
+			chaos::Buffer<char> archived_content = archive.LoadEntry(&entry);
+			chaos::Buffer<char> file_content = chaos::FileTools::LoadFile(resources_path / entry.path, chaos::LoadFileFlag::NoErrorTrace);
+
+			if (archived_content.bufsize != file_content.bufsize || memcmp(archived_content.data, file_content.data, file_content.bufsize) != 0)
+			{
+				chaos::Log::Error("[%s] content mismatch", entry.path.c_str());
+				return false;
+			}
+		}
+		return true;
+	}
+
+	virtual bool MountResourceArchives() override
+	{
+		return false; // the archive must be compared with the real files
+	}
+
+	virtual int Main() override
+	{
+		// parse the arguments
+		std::vector<std::string> parameters;
+		bool compress = false;
+		for (size_t i = 1; i < arguments.size(); ++i)
+		{
+			if (chaos::StringTools::Stricmp(arguments[i], "-Compress") == 0)
+				compress = true;
+			else if (arguments[i].length() > 0 && arguments[i][0] != '-')
+				parameters.push_back(arguments[i]);
+		}
+
+		if (parameters.size() != 2)
+		{
+			chaos::Log::Message("usage: PackResources <resources directory> <archive path> [-Compress]");
+			return -1;
+		}
+
+		boost::filesystem::path resources_path = parameters[0];
+		boost::filesystem::path archive_path = parameters[1];
+
+		// build the archive
+		auto start_time = std::chrono::steady_clock::now();
+
+		chaos::PackedArchiveBuilder builder;
+		if (compress)
+			builder.SetCompression(CHAOS_USE_ZSTD ? chaos::PackedArchiveCompression::ZStd : chaos::PackedArchiveCompression::ZLib);
+		if (!builder.AddDirectory(resources_path))
+			return -1;
+		if (!builder.Save(archive_path))
+			return -1;
+
+		auto end_time = std::chrono::steady_clock::now();
+
+		chaos::Log::Message("[%s] : %d files, %d bytes, %.2f ms",
+			archive_path.string().c_str(),
+			int(builder.GetFileCount()),
+			int(boost::filesystem::file_size(archive_path)),
+			std::chrono::duration<double, std::milli>(end_time - start_time).count());
+
+		// check the result
+		if (!CheckArchive(archive_path, resources_path))
+			return -1;
+		chaos::Log::Message("archive checked");
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
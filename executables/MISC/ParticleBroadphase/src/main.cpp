@@ -0,0 +1,119 @@
+#include "chaos/Chaos.h"
+
+// XXX : simulate a shooter where lots of bullets are tested against the enemies each frame
+//
+//       - brute force: each bullet is tested against each enemy (O(bullets x enemies))
+//       - broadphase:  the grid of the enemies is built once per frame, and each bullet queries it
+//
+//       both methods must find the same number of collisions
+
+static constexpr float WORLD_SIZE = 4096.0f;
+
+// the enemies move each frame (the broadphase is built again)
+class EnemyLayerTrait : public chaos::ParticleLayerTrait<chaos::ParticleDefault, chaos::VertexDefault>
+{
+public:
+
+	bool UpdateParticle(float delta_time, chaos::ParticleDefault& particle) const
+	{
+		particle.bounding_box.position.x = std::fmod(particle.bounding_box.position.x + 600.0f * delta_time, WORLD_SIZE);
+		return false;
+	}
+};
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	template<typename TRAIT>
+	chaos::ParticleLayerBase* CreateLayer(size_t particle_count, float min_half_size, float max_half_size)
+	{
+		chaos::ParticleLayerBase* result = new chaos::ParticleLayer<TRAIT>();
+		if (result == nullptr)
+			return nullptr;
+
+		chaos::ParticleAllocationBase* allocation = result->SpawnParticles(particle_count);
+		if (allocation == nullptr)
+			return nullptr;
+
+		for (chaos::ParticleDefault& particle : allocation->GetParticleAccessor<chaos::ParticleDefault>())
+		{
+			float half_size = min_half_size + chaos::MathTools::RandFloat() * (max_half_size - min_half_size);
+			particle.bounding_box.position = chaos::GLMTools::RandVec2() * WORLD_SIZE;
+			particle.bounding_box.half_size = { half_size, half_size };
+		}
+		return result;
+	}
+
+	virtual int Main() override
+	{
+		size_t const bullet_count = 10000;
+		size_t const enemy_count = 1000;
+		int const frame_count = 100;
+
+		srand(0);
+		chaos::shared_ptr<chaos::ParticleLayerBase> bullets = CreateLayer<chaos::ParticleDefaultLayerTrait>(bullet_count, 2.0f, 4.0f);
+		chaos::shared_ptr<chaos::ParticleLayerBase> enemies = CreateLayer<EnemyLayerTrait>(enemy_count, 8.0f, 32.0f);
+		if (bullets == nullptr || enemies == nullptr)
+			return -1;
+		enemies->EnableBroadphase(64.0f);
+
+		chaos::ParticleAccessor<chaos::ParticleDefault> bullet_particles = bullets->GetAllocation(0)->GetParticleAccessor<chaos::ParticleDefault>();
+
+		chaos::Log::Message("%d bullets against %d enemies, %d frames", int(bullet_count), int(enemy_count), frame_count);
+
+		double brute_force_duration = 0.0;
+		double build_duration = 0.0;
+		double query_duration = 0.0;
+		size_t brute_force_collisions = 0;
+		size_t broadphase_collisions = 0;
+
+		for (int frame = 0; frame < frame_count; ++frame)
+		{
+			enemies->Tick(1.0f / 60.0f);
+
+			// brute force
+			auto start_time = std::chrono::steady_clock::now();
+			chaos::ParticleAccessor<chaos::ParticleDefault> enemy_particles = enemies->GetAllocation(0)->GetParticleAccessor<chaos::ParticleDefault>();
+			for (chaos::ParticleDefault const& bullet : bullet_particles)
+				for (chaos::ParticleDefault const& enemy : enemy_particles)
+					if (chaos::Collide(bullet.bounding_box, enemy.bounding_box))
+						++brute_force_collisions;
+			auto brute_force_time = std::chrono::steady_clock::now();
+
+			// broadphase
+			chaos::ParticleBroadphase const* broadphase = enemies->GetBroadphase();
+			auto build_time = std::chrono::steady_clock::now();
+			for (chaos::ParticleDefault const& bullet : bullet_particles)
+				broadphase->ForEachCollision(bullet.bounding_box, [&broadphase_collisions](chaos::ParticleBroadphaseEntry const& entry)
+				{
+					++broadphase_collisions;
+				});
+			auto query_time = std::chrono::steady_clock::now();
+
+			brute_force_duration += std::chrono::duration<double, std::milli>(brute_force_time - start_time).count();
+			build_duration += std::chrono::duration<double, std::milli>(build_time - brute_force_time).count();
+			query_duration += std::chrono::duration<double, std::milli>(query_time - build_time).count();
+		}
+
+		chaos::Log::Message("brute force : %8.3f ms per frame (%d collisions)",
+			brute_force_duration / double(frame_count), int(brute_force_collisions));
+		chaos::Log::Message("broadphase  : %8.3f ms per frame (build %.3f ms, queries %.3f ms) (%d collisions)",
+			(build_duration + query_duration) / double(frame_count), build_duration / double(frame_count), query_duration / double(frame_count), int(broadphase_collisions));
+
+		if (brute_force_collisions != broadphase_collisions)
+			chaos::Log::Error("the broadphase does not find the same collisions");
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "chaos/Chaos.h"
+
+// XXX : simulate a game that spawns and destroys lots of short-lived effects
+//
+//       - a fixed number of allocations are alive
+//       - each frame, some of them die (their owner releases them) and are replaced by new ones
+//       - the layer is ticked
+//
+//       the test is run with and without recycling of the allocations
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	void RunBenchmark(char const* title, size_t max_recycled_count, size_t live_count, size_t churn_count, int frame_count)
+	{
+		chaos::shared_ptr<chaos::ParticleLayerBase> layer = new chaos::ParticleLayer<chaos::ParticleDefaultLayerTrait>();
+		layer->SetMaxRecycledAllocationCount(max_recycled_count);
+
+		std::vector<chaos::shared_ptr<chaos::ParticleAllocationBase>> effects;
+		effects.reserve(live_count);
+		while (effects.size() < live_count)
+			effects.emplace_back(layer->SpawnParticles(4));
+
+		double churn_duration = 0.0;
+		double tick_duration = 0.0;
+
+		for (int frame = 0; frame < frame_count; ++frame)
+		{
+			// some effects die, others are spawned
+			auto start_time = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < churn_count; ++i)
+			{
+				size_t index = size_t(rand()) % effects.size();
+				effects[index] = layer->SpawnParticles(4); // the previous allocation is removed from the layer
+			}
+			auto churn_time = std::chrono::steady_clock::now();
+
+			// the tick loop
+			layer->Tick(1.0f / 60.0f);
+			auto tick_time = std::chrono::steady_clock::now();
+
+			churn_duration += std::chrono::duration<double, std::milli>(churn_time - start_time).count();
+			tick_duration += std::chrono::duration<double, std::milli>(tick_time - churn_time).count();
+		}
+
+		chaos::Log::Message("%-20s : churn %8.2f ms (%.3f us per spawn/despawn), tick %8.2f ms (%.3f ms per frame)",
+			title,
+			churn_duration, 1000.0 * churn_duration / double(churn_count * size_t(frame_count)),
+			tick_duration, tick_duration / double(frame_count));
+	}
+
+	virtual int Main() override
+	{
+		size_t const churn_count = 1000;
+		int const frame_count = 300;
+
+		for (size_t live_count : {1000, 10000, 50000})
+		{
+			chaos::Log::Message("%d live allocations, %d spawn/despawn per frame", int(live_count), int(churn_count));
+
+			srand(0);
+			RunBenchmark("without recycling", 0, live_count, churn_count, frame_count);
+			srand(0);
+			RunBenchmark("with recycling", churn_count, live_count, churn_count, frame_count);
+		}
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
@@ -3,11 +3,14 @@
 -- =============================================================================
 
 build:ProcessSubPremake("Atlas")
+build:ProcessSubPremake("AtlasBinaryBenchmark")
 build:ProcessSubPremake("BufferPolicy")
 build:ProcessSubPremake("CRC32")
+build:ProcessSubPremake("ClassBenchmark")
 build:ProcessSubPremake("ClassManager")
 build:ProcessSubPremake("ClassRefactor")
 build:ProcessSubPremake("ClientServer")
+build:ProcessSubPremake("CollisionSweep")
 build:ProcessSubPremake("ConfigurationTest")
 build:ProcessSubPremake("CubeMapConversion")
 build:ProcessSubPremake("CubeMapLoading")
@@ -15,6 +18,8 @@ build:ProcessSubPremake("CutWord")
 build:ProcessSubPremake("FadeVortexImage")
 build:ProcessSubPremake("FreeTypeTest")
 build:ProcessSubPremake("GenerateTexture")
+build:ProcessSubPremake("GlyphRasterizationBenchmark")
+build:ProcessSubPremake("ImageKernelBenchmark")
 build:ProcessSubPremake("JSONTest")
 build:ProcessSubPremake("MergeAtlas")
 build:ProcessSubPremake("MergeCubeMap")
@@ -24,6 +29,9 @@ build:ProcessSubPremake("MyZLib")
 build:ProcessSubPremake("OVR")
 build:ProcessSubPremake("OpenCV")
 build:ProcessSubPremake("OpenFileMap")
+build:ProcessSubPremake("PackResources")
+build:ProcessSubPremake("ParticleBroadphase")
+build:ProcessSubPremake("ParticleChurn")
 build:ProcessSubPremake("RedirectOutput_Console")
 build:ProcessSubPremake("ResourceFiles")
 build:ProcessSubPremake("Screenshot")
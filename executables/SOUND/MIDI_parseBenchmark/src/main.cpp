@@ -0,0 +1,182 @@
+#include "chaos/Chaos.h"
+
+// XXX : measure the parsing of a 50MB MIDI corpus
+//
+//       - the corpus is generated in a temporary directory (notes with and without running status, meta and system exclusive events)
+//       - the files are read into a heap buffer then parsed, or memory mapped and parsed in place
+//
+//       in both cases, the chunks and the event payloads are views inside the file content (no copy)
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	static void WriteBigEndian32(std::vector<char>& result, uint32_t value)
+	{
+		for (int shift = 24; shift >= 0; shift -= 8)
+			result.push_back(char((value >> shift) & 0xFF));
+	}
+
+	static void WriteBigEndian16(std::vector<char>& result, uint16_t value)
+	{
+		result.push_back(char((value >> 8) & 0xFF));
+		result.push_back(char(value & 0xFF));
+	}
+
+	static void WriteVariableLength(std::vector<char>& result, uint32_t value)
+	{
+		char bytes[4];
+		int count = 0;
+		do
+		{
+			bytes[count++] = char(value & 0x7F);
+			value >>= 7;
+		}
+		while (value != 0 && count < 4);
+
+		while (count > 1)
+			result.push_back(char(bytes[--count] | 0x80));
+		result.push_back(bytes[0]);
+	}
+
+	std::vector<char> GenerateTrack(size_t wanted_size, int channel)
+	{
+		std::vector<char> result;
+		result.reserve(wanted_size + 64);
+
+		// track name (meta event)
+		char const* name = "generated track";
+		WriteVariableLength(result, 0);
+		result.push_back(char(0xFF));
+		result.push_back(char(0x03));
+		WriteVariableLength(result, uint32_t(strlen(name)));
+		result.insert(result.end(), name, name + strlen(name));
+
+		// a system exclusive event (GM reset)
+		unsigned char const sysex[] = { 0x7E, 0x7F, 0x09, 0x01, 0xF7 };
+		WriteVariableLength(result, 0);
+		result.push_back(char(0xF0));
+		WriteVariableLength(result, uint32_t(sizeof(sysex)));
+		result.insert(result.end(), sysex, sysex + sizeof(sysex));
+
+		// notes: a new status every 16 events, running status otherwise
+		for (int i = 0; result.size() < wanted_size; ++i)
+		{
+			WriteVariableLength(result, uint32_t((i % 3) * 60));
+			if ((i % 16) == 0)
+				result.push_back(char(0x90 | channel));
+			result.push_back(char(36 + (i * 7) % 48)); // key
+			result.push_back(char((i & 1) ? 0 : 100)); // velocity (0 for note end)
+		}
+
+		// end of track
+		WriteVariableLength(result, 0);
+		result.push_back(char(0xFF));
+		result.push_back(char(0x2F));
+		result.push_back(char(0x00));
+		return result;
+	}
+
+	bool GenerateCorpus(boost::filesystem::path const& dst_p, int file_count, int track_count, size_t track_size, std::vector<boost::filesystem::path>& result)
+	{
+		for (int i = 0; i < file_count; ++i)
+		{
+			std::vector<char> content;
+			content.insert(content.end(), { 'M', 'T', 'h', 'd' });
+			WriteBigEndian32(content, 6);
+			WriteBigEndian16(content, 1); // FORMAT_MULTIPLE_TRACK
+			WriteBigEndian16(content, uint16_t(track_count));
+			WriteBigEndian16(content, 480);
+
+			for (int j = 0; j < track_count; ++j)
+			{
+				std::vector<char> track = GenerateTrack(track_size, j % 16);
+				content.insert(content.end(), { 'M', 'T', 'r', 'k' });
+				WriteBigEndian32(content, uint32_t(track.size()));
+				content.insert(content.end(), track.begin(), track.end());
+			}
+
+			boost::filesystem::path path = dst_p / chaos::StringTools::Printf("corpus_%02d.mid", i);
+			std::ofstream stream(path.string().c_str(), std::ios::binary);
+			if (!stream.write(content.data(), std::streamsize(content.size())))
+				return false;
+			result.push_back(path);
+		}
+		return true;
+	}
+
+	template<typename FUNC>
+	void RunBenchmark(char const* title, std::vector<boost::filesystem::path> const& corpus, size_t corpus_size, int iterations, FUNC func)
+	{
+		size_t event_count = 0;
+		bool success = true;
+
+		auto start_time = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i)
+		{
+			for (boost::filesystem::path const& path : corpus)
+			{
+				chaos::MidiLoader loader;
+				if (!func(loader, path))
+				{
+					success = false;
+					continue;
+				}
+				for (auto const& track : loader.GetTracks())
+					event_count += track->events.size();
+			}
+		}
+		auto end_time = std::chrono::steady_clock::now();
+
+		double duration = std::chrono::duration<double, std::milli>(end_time - start_time).count() / double(iterations);
+		chaos::Log::Message("%-24s : %8.2f ms (%7.2f MB/s, %d events)%s",
+			title, duration, double(corpus_size) / (1024.0 * 1024.0) / (duration / 1000.0), int(event_count / size_t(iterations)), success ? "" : " [FAILURE]");
+	}
+
+	virtual int Main() override
+	{
+		int const file_count = 50;
+		int const track_count = 4;
+		size_t const track_size = 256 * 1024; // 1MB per file
+		int const iterations = 3;
+
+		boost::filesystem::path dst_p;
+		if (!chaos::FileTools::CreateTemporaryDirectory("MIDI_parseBenchmark", dst_p))
+			return -1;
+
+		std::vector<boost::filesystem::path> corpus;
+		if (!GenerateCorpus(dst_p, file_count, track_count, track_size, corpus))
+		{
+			chaos::Log::Error("fails to generate the corpus");
+			return -1;
+		}
+
+		size_t corpus_size = 0;
+		for (boost::filesystem::path const& path : corpus)
+			corpus_size += size_t(boost::filesystem::file_size(path));
+		chaos::Log::Message("corpus: %d files, %.2f MB", int(corpus.size()), double(corpus_size) / (1024.0 * 1024.0));
+
+		RunBenchmark("LoadFile + LoadBuffer", corpus, corpus_size, iterations, [](chaos::MidiLoader& loader, boost::filesystem::path const& path)
+		{
+			chaos::Buffer<char> buffer = chaos::FileTools::LoadFile(path);
+			return (buffer != nullptr) && loader.LoadBuffer(buffer);
+		});
+
+		RunBenchmark("memory mapped", corpus, corpus_size, iterations, [](chaos::MidiLoader& loader, boost::filesystem::path const& path)
+		{
+			return loader.LoadFile(path);
+		});
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
@@ -6,6 +6,7 @@ build:ProcessSubPremake("IRRKLANG_Drum")
 build:ProcessSubPremake("IRRKLANG_Manager")
 build:ProcessSubPremake("MIDI_in")
 build:ProcessSubPremake("MIDI_out")
+build:ProcessSubPremake("MIDI_parseBenchmark")
 build:ProcessSubPremake("MIDI_readFile")
 build:ProcessSubPremake("MIDI_repeat")
 build:ProcessSubPremake("Sound3D")
@@ -0,0 +1,82 @@
+#include "chaos/Chaos.h"
+
+// XXX : usage : TiledMapBaker [file.tmx | directory]...
+//
+//       - bake all given TMX files (directories are searched recursively)
+//       - compare the loading time of the TMX against the baked file
+
+class MyApplication : public chaos::Application
+{
+	CHAOS_DECLARE_OBJECT_CLASS(MyApplication, chaos::Application);
+
+protected:
+
+	void CollectMapPaths(boost::filesystem::path const& path, std::vector<boost::filesystem::path>& result)
+	{
+		if (boost::filesystem::is_directory(path))
+		{
+			for (boost::filesystem::recursive_directory_iterator it(path), end; it != end; ++it)
+				if (chaos::FileTools::IsTypedFile(it->path(), ".tmx"))
+					result.push_back(it->path());
+		}
+		else if (chaos::FileTools::IsTypedFile(path, ".tmx"))
+		{
+			result.push_back(path);
+		}
+	}
+
+	double MeasureLoadingTime(boost::filesystem::path const& path, bool use_baked_maps, int iterations)
+	{
+		chaos::shared_ptr<chaos::TiledMap::Manager> manager = new chaos::TiledMap::Manager;
+		manager->use_baked_maps = use_baked_maps;
+
+		// the first load is not measured (tilesets are cached in the manager)
+		chaos::shared_ptr<chaos::TiledMap::Map> map = manager->LoadMap(path, false);
+		if (map == nullptr)
+			return -1.0;
+
+		auto start_time = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i)
+			map = manager->LoadMap(path, false);
+		auto end_time = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double, std::milli>(end_time - start_time).count() / double(iterations);
+	}
+
+	virtual int Main() override
+	{
+		std::vector<boost::filesystem::path> map_paths;
+
+		std::vector<std::string> const& arguments = GetArguments();
+		for (size_t i = 1; i < arguments.size(); ++i) // argument 0 is the executable
+			if (arguments[i].length() > 0 && arguments[i][0] != '-') // skip the global variables
+				CollectMapPaths(arguments[i], map_paths);
+
+		if (map_paths.size() == 0)
+		{
+			chaos::Log::Message("TiledMapBaker: no TMX file to bake");
+			return 0;
+		}
+
+		int const iterations = 10;
+
+		for (boost::filesystem::path const& path : map_paths)
+		{
+			chaos::shared_ptr<chaos::TiledMap::Manager> manager = new chaos::TiledMap::Manager;
+			if (!manager->BakeMap(path))
+				continue;
+
+			double tmx_time = MeasureLoadingTime(path, false, iterations);
+			double baked_time = MeasureLoadingTime(path, true, iterations);
+
+			chaos::Log::Message("TiledMapBaker [%s] : tmx %.2f ms, baked %.2f ms", path.string().c_str(), tmx_time, baked_time);
+		}
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::ApplicationData application_data;
+	return chaos::RunApplication<MyApplication>(argc, argv, env, &application_data);
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+-- =============================================================================
+-- ROOT_PATH/executables/TOOLS/TiledMapBaker
+-- =============================================================================
+
+local project = build:WindowedApp()
+project:DependOnLib("chaos")
\ No newline at end of file
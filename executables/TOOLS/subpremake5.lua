@@ -5,3 +5,4 @@
 build:ProcessSubPremake("AnalyticMatrix")
 build:ProcessSubPremake("ResizeAtlas")
 build:ProcessSubPremake("AtlasBuilder")
+build:ProcessSubPremake("TiledMapBaker")
@@ -253,6 +253,9 @@ namespace chaos
 			}
 		}
 
+		/** fill a case insensitive name => bitmap table (same precedence as GetBitmapInfo(...): first match in depth-first order wins) */
+		void CollectBitmapNameIndex(std::unordered_map<std::string, AtlasBitmapInfo const*>& result) const;
+
 	protected:
 
 		void DoCollectEntries(std::vector<AtlasBitmapInfo>& result);
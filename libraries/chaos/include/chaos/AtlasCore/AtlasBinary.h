@@ -0,0 +1,70 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class AtlasBinary;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// XXX : a binary atlas is a single file that contains both the index and the pixels of the atlas
+	//
+	//       [header] [strings] [folders] [bitmaps] [fonts] [characters] [animations] [mipmaps] [pixels]
+	//
+	//       - the tables are arrays of fixed size records (all names are offsets in the string table)
+	//       - the folders are stored in depth-first order (each folder references its parent and a range in the bitmap/font tables)
+	//       - the pages are stored in their upload pixel format (rows aligned on 4 bytes) with their whole mipmap chain
+	//
+	//       the file is memory mapped. Loading the pages is nothing more than giving pointers inside the mapping (no image decoding)
+
+	/**
+	* AtlasBinary : an atlas loaded from a binary file. Its pages can be uploaded as is to the GPU
+	*/
+
+	class CHAOS_API AtlasBinary : public AtlasBase
+	{
+		friend class GPUAtlasGenerator;
+
+	public:
+
+		/** the identifier at the beginning of the file */
+		static constexpr uint32_t MAGIC = 0x42414843; // "CHAB"
+		/** the version of the format */
+		static constexpr uint32_t VERSION = 1;
+
+		/** the clearing method */
+		virtual void Clear() override;
+
+		/** load the atlas (the file is memory mapped) */
+		bool LoadAtlas(FilePathParam const& path);
+		/** convert an atlas into a binary file (pages are converted into the upload format and their mipmaps are computed) */
+		static bool SaveAtlas(Atlas const& atlas, FilePathParam const& path, bool generate_mipmaps = true);
+
+		/** get the pixel format of the pages */
+		PixelFormat GetPixelFormat() const { return pixel_format; }
+		/** get the number of mipmap levels stored for each page */
+		int GetMipmapCount() const { return mipmap_count; }
+		/** get the pixels of a page for a given mipmap level (points inside the mapped file) */
+		ImageDescription GetPageImage(int page, int mipmap_level = 0) const;
+
+	protected:
+
+		/** read the content of the file */
+		bool DoLoadAtlas(char const* data, size_t size);
+
+	protected:
+
+		/** the mapped file */
+		shared_ptr<MemoryMappedFile> mapped_file;
+		/** the content of the file when it is inside an archive */
+		Buffer<char> buffer;
+		/** the pixel format of the pages */
+		PixelFormat pixel_format = PixelFormat::Unknown;
+		/** the number of mipmap levels */
+		int mipmap_count = 0;
+		/** the pixels for each page and mipmap level (page * mipmap_count + level) */
+		std::vector<ImageDescription> page_images;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
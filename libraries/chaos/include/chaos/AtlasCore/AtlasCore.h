@@ -1,4 +1,5 @@
 #include "chaos/AtlasCore/Atlas.h"
+#include "chaos/AtlasCore/AtlasBinary.h"
 #include "chaos/AtlasCore/AtlasInput.h"
 #include "chaos/AtlasCore/AtlasInputFilter.h"
 #include "chaos/AtlasCore/AtlasGenerator.h"
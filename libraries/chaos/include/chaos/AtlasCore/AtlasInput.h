@@ -58,6 +58,8 @@ namespace chaos
 		void RegisterResource(FT_Library library, bool release);
 		/** register face */
 		void RegisterResource(FT_Face face, bool release);
+		/** register a buffer (pixels shared by several inputs) */
+		void RegisterResource(Buffer<char> buffer);
 
 	public:
 
@@ -291,6 +293,8 @@ namespace chaos
 		void RegisterResource(FT_Library library, bool release);
 		/** register face */
 		void RegisterResource(FT_Face face, bool release);
+		/** register a buffer (pixels shared by several inputs) */
+		void RegisterResource(Buffer<char> buffer);
 
 	protected:
 
@@ -302,6 +306,8 @@ namespace chaos
 		std::vector<library_ptr> libraries; // XXX : order declaration of 'libraries' and 'faces' is important
 		/** the ft_faces to destroy */      //       'faces' have to be destroyed first. So it must be declared last
 		std::vector<face_ptr> faces;
+		/** the buffers to keep alive */
+		std::vector<Buffer<char>> buffers;
 	};
 
 
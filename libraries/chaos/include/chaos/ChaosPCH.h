@@ -38,6 +38,7 @@
 #include <vector>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <tuple>
 #include <array>
 #include <cstdlib>
@@ -62,13 +63,24 @@
 #endif
 
 #include <fcntl.h>
+#if __linux__
+#	include <unistd.h>
+#	include <fcntl.h>
+#	include <sys/stat.h>
+#	include <sys/mman.h>
+#	include <sys/inotify.h>
+#endif
 #include <thread>
 #include <future>
 #include <chrono>
 #include <compare>
 #include <forward_list>
+#include <deque>
 #include <type_traits>
 #include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
 #include <nmmintrin.h>
 
 // boost is full of #pragma comment(lib, ...)
@@ -190,6 +202,16 @@ static_assert(BOOST_PP_IS_EMPTY(), "/Zc:preprocessor flag is required for window
 
 #include <zlib.h>
 
+#if __linux__
+#	define CHAOS_USE_ZSTD 1
+#else
+#	define CHAOS_USE_ZSTD 0 // zstd is not part of the windows installation yet
+#endif
+
+#if CHAOS_USE_ZSTD
+#	include <zstd.h>
+#endif
+
 #include <tinyxml2.h>
 
 #include <FreeImage.h>
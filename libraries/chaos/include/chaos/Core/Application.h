@@ -122,6 +122,8 @@ namespace chaos
 		bool CreateApplicationUserLocalDirectory() const;
 		/** create the application temporary directory */
 		bool CreateApplicationTemporaryDirectory() const;
+		/** mount the archive of the resources (if any) */
+		virtual bool MountResourceArchives();
 
 		/** check whether the given application data is correct */
 		virtual bool IsApplicationDataValid(ApplicationData const * in_application_data) const;
@@ -7,16 +7,42 @@ namespace chaos
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	// XXX : the reader is a view on a memory it does not own (a Buffer, a memory mapped file ...). Copying a reader is cheap
+	//       and does not copy the data. The memory must outlive the reader and all the views given by it
+	//
+	//       all reads are bounds-checked. A failed read does not change the position
+
 	class CHAOS_API BufferReader
 	{
 	public:
 
+		/** default constructor (empty view) */
+		BufferReader() = default;
+		/** constructor */
+		BufferReader(Buffer<char> const& in_buffer) : data(in_buffer.data), size(in_buffer.bufsize) {}
 		/** constructor */
-		BufferReader(Buffer<char> const& in_buffer) : buffer(in_buffer) {}
+		BufferReader(char const* in_data, size_t in_size) : data(in_data), size(in_size) {}
+
 		/** test whether eof is reached */
-		bool IsEOF() const { return position >= buffer.bufsize; }
+		bool IsEOF() const { return position >= size; }
 		/** returns true whether there is enough data in buffer to read wanted value */
-		bool IsEnoughData(size_t size) const { return (buffer.bufsize - position) >= size; }
+		bool IsEnoughData(size_t count) const { return (size - position) >= count; }
+
+		/** get the position in the buffer */
+		size_t GetPosition() const { return position; }
+		/** get the size of the buffer */
+		size_t GetSize() const { return size; }
+		/** get the number of bytes after the position */
+		size_t GetRemainingSize() const { return size - position; }
+		/** change the position (fails if outside the buffer) */
+		bool Seek(size_t in_position)
+		{
+			if (in_position > size)
+				return false;
+			position = in_position;
+			return true;
+		}
+
 		/** read data for one POD object */
 		template<typename T>
 		bool Read(T& result)
@@ -27,30 +53,115 @@ namespace chaos
 		template<typename T>
 		bool ReadN(T* result, size_t count = 1)
 		{
-			if (!IsEnoughData(sizeof(T) * count))
+			if (count > GetRemainingSize() / sizeof(T))
 				return false;
-			memcpy(result, &buffer[position], sizeof(T) * count);
+			memcpy(result, data + position, sizeof(T) * count);
 			position += sizeof(T) * count;
 			return true;
 		}
+		/** read data for one POD object without moving the position */
+		template<typename T>
+		bool Peek(T& result) const
+		{
+			if (!IsEnoughData(sizeof(T)))
+				return false;
+			memcpy(&result, data + position, sizeof(T));
+			return true;
+		}
+
+		/** read a value stored in big endian */
+		template<typename T>
+		bool ReadBigEndian(T& result)
+		{
+			return ReadNBigEndian(&result, 1);
+		}
+		/** read values stored in big endian */
+		template<typename T>
+		bool ReadNBigEndian(T* result, size_t count);
+		/** read a value stored in little endian */
+		template<typename T>
+		bool ReadLittleEndian(T& result)
+		{
+			return ReadNLittleEndian(&result, 1);
+		}
+		/** read values stored in little endian */
+		template<typename T>
+		bool ReadNLittleEndian(T* result, size_t count);
+
+		/** get a pointer on the next values without copying them (fails if the data is not aligned for T) */
+		template<typename T>
+		bool ReadView(T const*& result, size_t count = 1)
+		{
+			if (count > GetRemainingSize() / sizeof(T))
+				return false;
+			if ((uintptr_t(data + position) % alignof(T)) != 0)
+				return false;
+			result = (T const*)(data + position);
+			position += sizeof(T) * count;
+			return true;
+		}
+		/** get a reader on the next bytes without copying them */
+		bool ReadSubReader(size_t count, BufferReader& result)
+		{
+			if (!IsEnoughData(count))
+				return false;
+			result = BufferReader(data + position, count);
+			position += count;
+			return true;
+		}
+		/** skip some bytes */
+		bool Skip(size_t count)
+		{
+			if (!IsEnoughData(count))
+				return false;
+			position += count;
+			return true;
+		}
+
 		/** get a pointer on the current buffer at position */
-		char const* GetCurrentPosition() const { return &buffer.data[position]; }
+		char const* GetCurrentPosition() const { return data + position; }
 
 		/** advance current pointer */
 		void Advance(size_t offset)
 		{
 			position += offset;
-			assert(position <= buffer.bufsize);
+			assert(position <= size);
 		}
 
 	protected:
 
+		/** the beginning of the data */
+		char const* data = nullptr;
+		/** the size of the data */
+		size_t size = 0;
 		/** the position in the buffer */
 		size_t position = 0;
-		/** the reference of the buffer where to stream data */
-		Buffer<char> const& buffer;
 	};
 
+#else
+
+	template<typename T>
+	bool BufferReader::ReadNBigEndian(T* result, size_t count)
+	{
+		if (!ReadN(result, count))
+			return false;
+		if (EndianTools::IsHostLittleEndian())
+			for (size_t i = 0; i < count; ++i)
+				result[i] = EndianTools::EndianSwap(result[i]);
+		return true;
+	}
+
+	template<typename T>
+	bool BufferReader::ReadNLittleEndian(T* result, size_t count)
+	{
+		if (!ReadN(result, count))
+			return false;
+		if (EndianTools::IsHostBigEndian())
+			for (size_t i = 0; i < count; ++i)
+				result[i] = EndianTools::EndianSwap(result[i]);
+		return true;
+	}
+
 #endif
 
 }; // namespace chaos
\ No newline at end of file
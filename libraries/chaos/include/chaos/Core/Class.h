@@ -48,7 +48,7 @@ namespace chaos
 		using create_instance_on_stack_function_type = std::function<void(LightweightFunction<void(Object*)>)>;
 
 		/** destructor */
-		virtual ~Class() = default;
+		virtual ~Class();
 
 		/** gets the class size */
 		size_t GetClassSize() const { return class_size; }
@@ -104,6 +104,11 @@ namespace chaos
 		/** set the short name */
 		void SetShortName(std::string in_short_name);
 
+		/** called whenever a class is declared, or its parent changes (the hierarchy numbering must be recomputed) */
+		static void InvalidateHierarchyNumbering();
+		/** recompute the pre-order intervals of all classes if necessary */
+		static void UpdateHierarchyNumbering();
+
 	protected:
 
 		/** the parent of the class */
@@ -124,6 +129,13 @@ namespace chaos
 		std::type_info const* info = nullptr;
 		/** the manager for this class */
 		ClassManager* manager = nullptr;
+
+		/** the pre-order index of the class in the hierarchy forest */
+		int hierarchy_first = -1;
+		/** the greatest pre-order index in the sub-tree of the class (descendants are in [hierarchy_first, hierarchy_last]) */
+		int hierarchy_last = -1;
+		/** whether the class and all its ancestors are declared (intervals can be trusted) */
+		bool hierarchy_declared = false;
 	};
 
 #else
@@ -76,6 +76,7 @@ namespace chaos
 				result->class_size = sizeof(CLASS_TYPE);
 				result->declared = true;
 				result->info = &typeid(CLASS_TYPE);
+				Class::InvalidateHierarchyNumbering();
 
 				// instance constructible only if derives from Object
 				if constexpr (std::is_base_of_v<Object, CLASS_TYPE>)
@@ -107,29 +108,18 @@ namespace chaos
 		template<typename CLASS_TYPE>
 		Class* FindOrCreateCPPClassInstance(bool search_manager_hierarchy)
 		{
-			std::type_info const& info = typeid(CLASS_TYPE);
-
-			// search if the class as already been registered in manager chain
-			ClassManager* manager = this;
-			while (manager != nullptr)
-			{
-				for (Class* cls : manager->classes)
-					if (cls->info != nullptr && *cls->info == info)
-						return cls;
-				if (!search_manager_hierarchy)
-					break;
-				manager = manager->parent_manager.get();
-			}
-			// register the class
-			if (Class* result = new Class(std::string())) // do not name the class yet
+			// the default manager has no parent and never removes C++ classes: the result for a given type never changes and can be cached
+			if (this == GetDefaultInstance())
 			{
-				result->info = &info;
-				InsertClass(result);
-				return result;
+				static Class* default_manager_class = DoFindOrCreateCPPClassInstance(typeid(CLASS_TYPE), false);
+				return default_manager_class;
 			}
-			return nullptr;
+			return DoFindOrCreateCPPClassInstance(typeid(CLASS_TYPE), search_manager_hierarchy);
 		}
 
+		/** return the class of a class with its given info (search in the manager chain and create the class if necessary) */
+		Class* DoFindOrCreateCPPClassInstance(std::type_info const& info, bool search_manager_hierarchy);
+
 	protected:
 
 		/* the parent class manager */
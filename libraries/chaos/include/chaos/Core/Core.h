@@ -18,15 +18,18 @@
 #include "chaos/Core/BoolTag.h"
 #include "chaos/Core/BitTools.h"
 #include "chaos/Core/StringTools.h"
+#include "chaos/Core/InternedString.h"
 #include "chaos/Core/EnumTools.h"
 #include "chaos/Core/STLTools.h"
 #include "chaos/Core/MyBase64.h"
 #include "chaos/Core/MyZLib.h"
+#include "chaos/Core/MyZStd.h"
 #include "chaos/Core/SparseWriteBuffer.h"
 #include "chaos/Core/FilePathParam.h"
 #include "chaos/Core/FileTools.h"
 #include "chaos/Core/PathTools.h"
 #include "chaos/Core/JSONRecursiveLoader.h"
+#include "chaos/Core/Snapshot.h"
 #include "chaos/Core/JSONSerializableInterface.h"
 #include "chaos/Core/AutoCast.h"
 #include "chaos/Core/SmartPointers.h"
@@ -49,6 +52,9 @@
 #include "chaos/Core/ClassLoader.h"
 #include "chaos/Core/Log.h"
 #include "chaos/Core/FileResource.h"
+#include "chaos/Core/FileWatcher.h"
+#include "chaos/Core/MemoryMappedFile.h"
+#include "chaos/Core/PackedArchive.h"
 #include "chaos/Core/Tag.h"
 #include "chaos/Core/NameFilter.h"
 #include "chaos/Core/GlobalVariables.h"
@@ -63,4 +69,6 @@
 #include "chaos/Core/PriorityQueue.h"
 #include "chaos/Core/NestedIterator.h"
 #include "chaos/Core/ObjectPool.h"
-#include "chaos/Core/ObjectPool64.h"
\ No newline at end of file
+#include "chaos/Core/ObjectPool64.h"
+#include "chaos/Core/SlotMap.h"
+#include "chaos/Core/ThreadPool.h"
\ No newline at end of file
@@ -19,12 +19,19 @@ namespace chaos
 		/** get the file last write time */
 		std::time_t GetFileTimestamp() const { return file_timestamp; }
 
+		/** get the other files the object is built from (shader sources ...) */
+		std::vector<boost::filesystem::path> const& GetDependentPaths() const { return dependent_paths; }
+		/** add a file the object is built from */
+		void AddDependentPath(boost::filesystem::path const& in_path);
+
 	protected:
 
 		/** the path of the object */
 		boost::filesystem::path path;
 		/** the file timestamp */
 		std::time_t file_timestamp = 0;
+		/** the other files the object is built from */
+		std::vector<boost::filesystem::path> dependent_paths;
 	};
 
 #endif
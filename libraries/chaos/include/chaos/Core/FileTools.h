@@ -50,7 +50,7 @@ namespace chaos
 		/** loading a whole file into memory */
 		CHAOS_API Buffer<char> LoadFile(FilePathParam const& path, LoadFileFlag flags = LoadFileFlag::None);
 
-		/** try path redirection and call func (until it returns true) */
+		/** try path redirection and call func (until it returns true). XXX : the path may be inside a mounted archive (not on disk) */
 		CHAOS_API bool WithFile(FilePathParam const& path, LightweightFunction<bool(boost::filesystem::path const& p)> func);
 		/** iterate over all entries in all possible directories (until func returns true) */
 		CHAOS_API bool WithDirectoryContent(FilePathParam const& path, LightweightFunction<bool(boost::filesystem::path const& p)> func);
@@ -69,6 +69,15 @@ namespace chaos
 		/** redirect any access (under conditions) to the direct resources path of the project (not the build directory) */
 		CHAOS_API boost::filesystem::path GetRedirectedPath(boost::filesystem::path const& p);
 
+		/** mount a packed archive on a directory (the files of this directory are first searched inside the archive, except in development builds where files on disk override it) */
+		CHAOS_API bool MountArchive(FilePathParam const& path, FilePathParam const& mount_point);
+		/** unmount all archives */
+		CHAOS_API void UnmountAllArchives();
+		/** whether a file is inside a mounted archive */
+		CHAOS_API bool IsArchivedFile(FilePathParam const& path);
+		/** whether a directory is inside a mounted archive */
+		CHAOS_API bool IsArchivedDirectory(FilePathParam const& path);
+
 	}; // namespace FileTools
 
 #else
@@ -0,0 +1,94 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class FileWatcher;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	CHAOS_DEFINE_LOG(FileWatcherLog, "FileWatcher")
+
+	/**
+	* FileWatcher : detects modifications of a set of files
+	*/
+
+	// XXX : on linux, the directories of the watched files are registered to inotify and the events are read without blocking
+	//       on other platforms, the write time of the files are checked at regular interval
+	//
+	//       editors often write a file in several steps (truncate, write, rename...). a change is only reported once the file
+	//       has not been modified for a while (debounce_duration)
+	//
+	//       file redirection is handled (in _DEBUG the source file is watched instead of the build copy)
+
+	class CHAOS_API FileWatcher
+	{
+	protected:
+
+		/** the state of a watched file */
+		class WatchedFile
+		{
+		public:
+
+			/** the last known write time */
+			std::time_t write_time = 0;
+			/** the time when a modification has been detected (0 if none) */
+			double change_time = 0.0;
+		};
+
+	public:
+
+		/** constructor */
+		FileWatcher();
+		/** destructor */
+		~FileWatcher();
+
+		/** start watching a file (returns false if the file does not exist) */
+		bool WatchFile(FilePathParam const& path);
+		/** stop watching all files */
+		void Clear();
+		/** whether the file is watched */
+		bool IsWatchedFile(FilePathParam const& path) const;
+
+		/** get the files whose modification is complete (each change is reported once) */
+		std::vector<boost::filesystem::path> PollChanges();
+
+		/** get the number of watched files */
+		size_t GetWatchedFileCount() const { return watched_files.size(); }
+
+		/** change the delay between the last modification of a file and its notification */
+		void SetDebounceDuration(double in_debounce_duration) { debounce_duration = in_debounce_duration; }
+		/** change the interval between 2 checks of the write times (platforms without notification only) */
+		void SetPollingInterval(double in_polling_interval) { polling_interval = in_polling_interval; }
+
+		/** get the path used to identify a file */
+		static boost::filesystem::path GetWatchedPath(FilePathParam const& path);
+
+	protected:
+
+		/** read the notifications from the system (or check the write times) */
+		void DetectChanges(double current_time);
+		/** get the write time of a file (0 on failure) */
+		static std::time_t GetWriteTime(boost::filesystem::path const& p);
+
+	protected:
+
+		/** the watched files */
+		std::map<boost::filesystem::path, WatchedFile> watched_files;
+		/** the delay between the last modification of a file and its notification */
+		double debounce_duration = 0.1;
+		/** the interval between 2 checks of the write times */
+		double polling_interval = 0.5;
+		/** the last time the write times have been checked */
+		double last_polling_time = 0.0;
+
+#if __linux__
+		/** the inotify instance */
+		int inotify_fd = -1;
+		/** the watched directories (by watch descriptor) */
+		std::map<int, boost::filesystem::path> watched_directories;
+#endif
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -0,0 +1,91 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class InternedStringEntry;
+	class InternedString;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// XXX : an interned string is a pointer on an entry of a global table. There is a single entry per string
+	//
+	//       - comparing 2 interned strings is comparing 2 pointers
+	//       - each entry has an integer ID (stable for the whole execution) and a pointer on the entry of its lowercase version
+	//         (case insensitive comparisons are pointer comparisons too)
+	//       - entries are never destroyed: the table should only contain static sets of names (tags, render passes, uniforms ...), not arbitrary text
+	//         nor names generated at runtime (object names are only interned when explicitly given as InternedString)
+	//
+	//       the table is thread safe. Interning a string requires a lock (and a hash), so intern names once and keep the result
+
+	/**
+	* InternedStringEntry : an entry in the interning table
+	*/
+
+	class CHAOS_API InternedStringEntry
+	{
+	public:
+
+		/** the string */
+		std::string str;
+		/** the ID of the string (0 is for the empty string) */
+		uint32_t id = 0;
+		/** the entry for the lowercase version of the string (may be this) */
+		InternedStringEntry const* lowercase_entry = nullptr;
+	};
+
+	/**
+	* InternedString : a handle on a string of the interning table
+	*/
+
+	class CHAOS_API InternedString
+	{
+	public:
+
+		/** constructor (empty string) */
+		InternedString() = default;
+		/** copy constructor */
+		InternedString(InternedString const& src) = default;
+		/** constructor (intern the string) */
+		InternedString(char const* str);
+		/** constructor (intern the string) */
+		InternedString(std::string const& str);
+
+		/** get the string */
+		char const* c_str() const { return (entry != nullptr) ? entry->str.c_str() : ""; }
+		/** get the length of the string */
+		size_t size() const { return (entry != nullptr) ? entry->str.size() : 0; }
+		/** whether the string is empty */
+		bool empty() const { return (entry == nullptr); }
+
+		/** get the ID of the string (0 for the empty string) */
+		uint32_t GetID() const { return (entry != nullptr) ? entry->id : 0; }
+		/** get the ID of the lowercase version of the string (same IDs for strings that only differ by case) */
+		uint32_t GetCaseInsensitiveID() const { return (entry != nullptr) ? entry->lowercase_entry->id : 0; }
+
+		/** case insensitive comparison */
+		bool IsSameCaseInsensitive(InternedString const& src) const { return GetLowercaseEntry() == src.GetLowercaseEntry(); }
+
+		/** assignment */
+		InternedString& operator = (InternedString const& src) = default;
+		/** comparison (case sensitive) */
+		bool operator == (InternedString const& src) const { return (entry == src.entry); }
+
+		/** search a string without inserting it (returns the empty string if it has never been interned) */
+		static InternedString Find(char const* str);
+		/** get the number of interned strings */
+		static size_t GetInternedCount();
+
+	protected:
+
+		/** get the entry for the lowercase version */
+		InternedStringEntry const* GetLowercaseEntry() const { return (entry != nullptr) ? entry->lowercase_entry : nullptr; }
+
+	protected:
+
+		/** the entry in the table (nullptr for empty string) */
+		InternedStringEntry const* entry = nullptr;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
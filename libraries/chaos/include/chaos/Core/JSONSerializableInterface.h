@@ -14,6 +14,11 @@ namespace chaos
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const;
 		/** the processor may save its configuration from a JSON file */
 		virtual bool SerializeFromJSON(JSONReadConfiguration config);
+
+		/** the object may save its state into a binary snapshot (values must be read back in the same order) */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const;
+		/** the object may load its state from a binary snapshot */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader);
 	};
 
 #endif
@@ -0,0 +1,53 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class MemoryMappedFile;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* MemoryMappedFile : give access to the content of a file without reading it. the pages are loaded by the system on demand
+	*/
+
+	// XXX : the mapping is copy-on-write. the content may be modified in memory but this is never written back to the file
+
+	class CHAOS_API MemoryMappedFile : public Object
+	{
+		CHAOS_DECLARE_OBJECT_CLASS(MemoryMappedFile, Object);
+
+	public:
+
+		/** destructor */
+		virtual ~MemoryMappedFile();
+
+		/** map a file */
+		bool Open(FilePathParam const& path);
+		/** release the mapping */
+		void Close();
+
+		/** whether a file is mapped */
+		bool IsOpened() const { return (data != nullptr); }
+		/** get the content of the file */
+		char* GetData() const { return data; }
+		/** get the size of the file */
+		size_t GetSize() const { return size; }
+
+	protected:
+
+		/** the content of the file */
+		char* data = nullptr;
+		/** the size of the file */
+		size_t size = 0;
+
+#if _WIN32
+		/** the file */
+		HANDLE file_handle = INVALID_HANDLE_VALUE;
+		/** the mapping object */
+		HANDLE mapping_handle = NULL;
+#endif
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -18,6 +18,11 @@ namespace chaos
 		/** decoding method */
 		Buffer<char> Decode(char const* src);
 
+		/** single pass decoding into an existing buffer (whitespaces are skipped, stops at '=' or at the end of the input). returns false on invalid input or too small output */
+		static bool Decode(char const* src, size_t src_size, char* dst, size_t dst_size, size_t& decoded_size);
+		/** get an upper bound of the decoded size for an input */
+		static size_t GetMaxDecodedSize(size_t src_size) { return ((src_size + 3) / 4) * 3; }
+
 		/** returns true whether the input is a valid character */
 		static bool IsBase64(unsigned char c);
 
@@ -14,6 +14,8 @@ namespace chaos
 		Buffer<char> Encode(Buffer<char> const& src);
 		/** decoding method */
 		Buffer<char> Decode(Buffer<char> const& src);
+		/** decoding method into an existing buffer (zlib and gzip streams are accepted). returns false on error or too small output */
+		bool Decode(char const* src, size_t src_size, char* dst, size_t dst_size, size_t& decoded_size);
 	};
 
 #endif
@@ -0,0 +1,28 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class MyZStd;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// XXX : zstd is only available when CHAOS_USE_ZSTD is set (see ChaosPCH.h). Otherwise all methods log an error and fail
+	//       (callers fall back to uncompressed data when encoding, see PackedArchiveBuilder)
+	class CHAOS_API MyZStd
+	{
+	public:
+
+		/** whether zstd is available on this platform */
+		static constexpr bool IsAvailable() { return CHAOS_USE_ZSTD != 0; }
+
+		/** encoding method */
+		Buffer<char> Encode(Buffer<char> const& src);
+		/** decoding method */
+		Buffer<char> Decode(Buffer<char> const& src);
+		/** decoding method into an existing buffer. returns false on error or too small output */
+		bool Decode(char const* src, size_t src_size, char* dst, size_t dst_size, size_t& decoded_size);
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
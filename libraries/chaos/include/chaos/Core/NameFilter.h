@@ -37,6 +37,8 @@ namespace chaos
 
 		/** check whether the name passes the filter */
 		bool IsNameEnabled(char const* name) const;
+		/** check whether the name passes the filter (no string comparison) */
+		bool IsNameEnabled(InternedString name) const;
 
 	public:
 
@@ -45,12 +47,21 @@ namespace chaos
 		/** utility method to remove names from the enabled/disabled array  (separated with ',') */
 		static void RemoveNames(char const* names, std::vector<std::string>& target_list, char separator = name_separator);
 
+	protected:
+
+		/** update the interned versions of the lists */
+		void UpdateInternedNames();
+
 	protected:
 
 		/** the list of enabled names */
 		std::vector<std::string> enabled_names;
 		/** the list of disabled names */
 		std::vector<std::string> disabled_names;
+		/** the list of enabled names (interned) */
+		std::vector<InternedString> enabled_interned_names;
+		/** the list of disabled names (interned) */
+		std::vector<InternedString> disabled_interned_names;
 	};
 
 
@@ -13,11 +13,15 @@ namespace chaos
 
 		/** get the name of the object */
 		char const* GetName() const { return name.c_str(); }
+		/** get the interned name of the object (empty if the name has not been given as an interned string) */
+		InternedString GetInternedName() const { return interned_name; }
 		/** get the Tag of the object */
 		TagType GetTag() const { return tag; }
 
 		/** change the name of the object */
 		void SetName(char const* in_name);
+		/** change the name of the object (names given this way are compared by pointers) */
+		void SetName(InternedString in_name);
 		/** change the tag of the object */
 		void SetTag(TagType in_tag) { tag = in_tag; }
 
@@ -28,6 +32,8 @@ namespace chaos
 
 		/** the name of the object */
 		std::string name;
+		/** the interned name of the object (only for names explicitly given as interned strings: runtime names are not interned) */
+		InternedString interned_name;
 		/** the tag of the object */
 		TagType tag = 0;
 	};
@@ -41,6 +47,8 @@ namespace chaos
 		/** special method to have access to NamedInterface static utility functions */
 		char const* GetName() const { return object->GetName(); }
 		/** special method to have access to NamedInterface static utility functions */
+		InternedString GetInternedName() const { return object->GetInternedName(); }
+		/** special method to have access to NamedInterface static utility functions */
 		TagType GetTag() const { return object->GetTag(); }
 
 	public:
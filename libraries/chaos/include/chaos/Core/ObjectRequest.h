@@ -44,6 +44,13 @@ namespace chaos
 			if (StringTools::IsEmpty(name))
 				request_type = ObjectRequestType::None;
 		}
+		/** constructor (names are compared by pointers instead of strings) */
+		ObjectRequest(InternedString in_name) :
+			name(in_name.c_str()), interned_name(in_name), request_type(ObjectRequestType::String)
+		{
+			if (in_name.empty())
+				request_type = ObjectRequestType::None;
+		}
 		/** constructor */
 		ObjectRequest(TagType in_tag) :
 			tag(in_tag), request_type(ObjectRequestType::Tag)
@@ -74,6 +81,12 @@ namespace chaos
 			return (request_type == ObjectRequestType::Tag);
 		}
 
+		/** get the name of the request as an interned string (empty if the request has not been constructed from an interned string) */
+		InternedString GetInternedName() const
+		{
+			return interned_name;
+		}
+
 		/** returns a request that accept anything */
 		static ObjectRequest Any()
 		{
@@ -99,7 +112,18 @@ namespace chaos
 			if (IsAnyRequest())
 				return true;
 			if (IsStringRequest())
+			{
+				if constexpr (requires { object.GetInternedName(); })
+				{
+					if (!interned_name.empty())
+					{
+						InternedString object_name = object.GetInternedName();
+						if (!object_name.empty()) // only names explicitly interned can be compared by pointers
+							return interned_name.IsSameCaseInsensitive(object_name);
+					}
+				}
 				return (StringTools::Stricmp(object.GetName(), name) == 0);
+			}
 			if (IsTagRequest())
 				return (object.GetTag() == tag);
 			return false;
@@ -175,6 +199,8 @@ namespace chaos
 
 		/** the name for the request */
 		char const* name = nullptr;
+		/** the interned name for the request (if constructed from an interned string) */
+		InternedString interned_name;
 		/** the tag for the request */
 		TagType tag = 0;
 		/** the kind of request of interrest */
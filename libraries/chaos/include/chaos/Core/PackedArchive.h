@@ -0,0 +1,159 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	enum class PackedArchiveCompression : uint32_t;
+
+	class PackedArchiveEntry;
+	class PackedArchive;
+	class PackedArchiveBuilder;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	CHAOS_DEFINE_LOG(PackedArchiveLog, "PackedArchive")
+
+	// XXX : a packed archive is a single file that contains many resource files
+	//
+	//       [header] [entry 0] [padding] [entry 1] [padding] ... [index]
+	//
+	//       - the header gives the position of the index
+	//       - the index gives, for each entry, its path (relative to the archive root), its position and how it is stored
+	//       - each entry starts on a 4K boundary and is followed by at least one zero (so that the text files are null terminated)
+	//
+	//       the archive is memory mapped. uncompressed entries are given as buffers that directly point into the mapping (no copy)
+	//       the archive is mounted on a directory (typically the resources directory). FileTools::LoadFile(...) searches the mounted
+	//       archives before the real files
+
+	/** how an entry is stored */
+	enum class PackedArchiveCompression : uint32_t
+	{
+		None = 0,
+		ZLib = 1,
+		ZStd = 2
+	};
+
+	/**
+	* PackedArchiveEntry : a file inside an archive
+	*/
+
+	class CHAOS_API PackedArchiveEntry
+	{
+	public:
+
+		/** the path of the entry relative to the archive root ('/' separators, lowercase on windows) */
+		std::string path;
+		/** the position of the data in the archive */
+		uint64_t offset = 0;
+		/** the size of the data in the archive */
+		uint64_t stored_size = 0;
+		/** the size of the file */
+		uint64_t size = 0;
+		/** how the data is stored */
+		PackedArchiveCompression compression = PackedArchiveCompression::None;
+	};
+
+	/**
+	* PackedArchive : a mounted archive
+	*/
+
+	class CHAOS_API PackedArchive : public Object
+	{
+		CHAOS_DECLARE_OBJECT_CLASS(PackedArchive, Object);
+
+	public:
+
+		/** the identifier at the beginning of the file */
+		static constexpr uint32_t MAGIC = 0x4B504843; // "CHPK"
+		/** the version of the format */
+		static constexpr uint32_t VERSION = 1;
+		/** the alignment of the entries */
+		static constexpr uint64_t ALIGNMENT = 4096;
+
+		/** open the archive and mount it on a directory */
+		bool Open(FilePathParam const& path, boost::filesystem::path const& in_mount_point);
+		/** close the archive (buffers that are still in use remain valid) */
+		void Close();
+
+		/** get the directory the archive is mounted on */
+		boost::filesystem::path const& GetMountPoint() const { return mount_point; }
+		/** get all the entries (sorted by path) */
+		std::vector<PackedArchiveEntry> const& GetEntries() const { return entries; }
+
+		/** search the entry corresponding to a file path */
+		PackedArchiveEntry const* FindEntry(boost::filesystem::path const& path) const;
+		/** search an entry by its path inside the archive */
+		PackedArchiveEntry const* FindEntryByArchivePath(std::string const& archive_path) const;
+		/** whether a path is a directory inside the archive */
+		bool IsDirectory(boost::filesystem::path const& path) const;
+
+		/** get the content of an entry (a view on the mapping for uncompressed entries) */
+		Buffer<char> LoadEntry(PackedArchiveEntry const* entry, LoadFileFlag flags = LoadFileFlag::None) const;
+
+		/** call func for the files directly inside a directory (until func returns true) */
+		bool ForEachFileInDirectory(boost::filesystem::path const& directory_path, LightweightFunction<bool(boost::filesystem::path const&)> func) const;
+
+		/** convert a path into a path relative to the archive root (returns false if the path is outside the mount point) */
+		bool GetArchivePath(boost::filesystem::path const& path, std::string& result) const;
+		/** normalize a path inside an archive */
+		static std::string NormalizeArchivePath(std::string path);
+
+	protected:
+
+		/** the mapped file */
+		shared_ptr<MemoryMappedFile> file;
+		/** the directory the archive is mounted on */
+		boost::filesystem::path mount_point;
+		/** the entries sorted by path */
+		std::vector<PackedArchiveEntry> entries;
+	};
+
+	/**
+	* PackedArchiveBuilder : create an archive from a set of files
+	*/
+
+	class CHAOS_API PackedArchiveBuilder
+	{
+	protected:
+
+		/** a file to add */
+		class InputFile
+		{
+		public:
+
+			/** the path of the file on disk */
+			boost::filesystem::path path;
+			/** the path inside the archive */
+			std::string archive_path;
+		};
+
+	public:
+
+		/** add a file */
+		void AddFile(boost::filesystem::path const& path, std::string archive_path);
+		/** add all files of a directory recursively (archive paths are relative to the directory) */
+		bool AddDirectory(boost::filesystem::path const& directory_path, std::string const& archive_prefix = {});
+
+		/** enable or disable the compression */
+		void SetCompression(PackedArchiveCompression in_compression) { compression = in_compression; }
+		/** entries are only compressed if their size is reduced by at least this ratio */
+		void SetMinCompressionGain(float in_min_compression_gain) { min_compression_gain = in_min_compression_gain; }
+
+		/** write the archive */
+		bool Save(FilePathParam const& path) const;
+
+		/** get the number of files */
+		size_t GetFileCount() const { return files.size(); }
+
+	protected:
+
+		/** the files to add */
+		std::vector<InputFile> files;
+		/** the compression for the entries */
+		PackedArchiveCompression compression = PackedArchiveCompression::None;
+		/** the minimum ratio of the size to be gained by the compression */
+		float min_compression_gain = 0.1f;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -43,6 +43,8 @@ namespace chaos
 		mutable std::string resource_name;
 		/** the path of currently loaded resource (the very first path encoutered in loading call chain is the good) */
 		mutable boost::filesystem::path resolved_path;
+		/** the other files encountered in the loading call chain */
+		mutable std::vector<boost::filesystem::path> dependent_paths;
 	};
 
 	/**
@@ -0,0 +1,234 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class SlotMapHandle;
+
+	template<typename T>
+	class SlotMap;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// XXX : a slot map stores its values contiguously (iteration without indirection) and gives stable handles on them
+	//
+	//       - values:         [ A  B  C  D ]           dense storage. removal swaps the last value into the hole
+	//       - dense_to_slot:  [ 2  0  3  1 ]           the slot for each value
+	//       - slots:          [ {1,g} {3,g} {0,g} {2,g} {free} ... ]   the dense index of the value + a generation
+	//
+	//       a handle is a slot index + a generation. whenever a value is removed, the generation of its slot is incremented
+	//       so that older handles are detected as invalid (the slot is recycled with a free list)
+
+	/**
+	* SlotMapHandle : a weak reference on a value inside a slot map
+	*/
+
+	class CHAOS_API SlotMapHandle
+	{
+	public:
+
+		/** whether the handle has been given by a slot map (the value may have been removed since) */
+		bool IsValid() const { return (generation != 0); }
+
+		/** comparison operator */
+		bool operator == (SlotMapHandle const& src) const = default;
+
+	public:
+
+		/** the index of the slot */
+		uint32_t index = 0;
+		/** the generation of the slot when the handle was given (0 for invalid handles) */
+		uint32_t generation = 0;
+	};
+
+	/**
+	* SlotMap : O(1) insertion, removal and lookup. values are contiguous
+	*/
+
+	template<typename T>
+	class SlotMap
+	{
+	protected:
+
+		/** an entry in the indirection table */
+		class Slot
+		{
+		public:
+
+			/** the index of the value (or the next free slot) */
+			uint32_t dense_index = 0;
+			/** the generation of the slot (odd when the slot is used) */
+			uint32_t generation = 0;
+		};
+
+		static constexpr uint32_t NO_FREE_SLOT = std::numeric_limits<uint32_t>::max();
+
+	public:
+
+		using value_type = T;
+		using iterator = typename std::vector<T>::iterator;
+		using const_iterator = typename std::vector<T>::const_iterator;
+
+		/** insert a value and get a handle on it */
+		SlotMapHandle Insert(T value)
+		{
+			// get a free slot
+			uint32_t slot_index = free_slot;
+			if (slot_index != NO_FREE_SLOT)
+			{
+				free_slot = slots[slot_index].dense_index;
+			}
+			else
+			{
+				slot_index = uint32_t(slots.size());
+				slots.emplace_back();
+			}
+			// insert the value
+			Slot& slot = slots[slot_index];
+			slot.dense_index = uint32_t(values.size());
+			++slot.generation; // odd: used
+
+			values.push_back(std::move(value));
+			dense_to_slot.push_back(slot_index);
+
+			return { slot_index, slot.generation };
+		}
+
+		/** remove the value referenced by the handle (the last value is moved into the hole). returns the removed value */
+		std::optional<T> Remove(SlotMapHandle handle)
+		{
+			if (!Contains(handle))
+				return {};
+
+			Slot& slot = slots[handle.index];
+			uint32_t dense_index = slot.dense_index;
+			uint32_t last_index = uint32_t(values.size() - 1);
+
+			// extract the value (it is destroyed by the caller, once the map is in a coherent state)
+			std::optional<T> result = std::move(values[dense_index]);
+			if (dense_index != last_index)
+			{
+				values[dense_index] = std::move(values[last_index]);
+				dense_to_slot[dense_index] = dense_to_slot[last_index];
+				slots[dense_to_slot[dense_index]].dense_index = dense_index;
+			}
+			values.pop_back();
+			dense_to_slot.pop_back();
+
+			// release the slot
+			++slot.generation; // even: free
+			slot.dense_index = free_slot;
+			free_slot = handle.index;
+
+			return result;
+		}
+
+		/** remove the value referenced by the handle (the following values are shifted: O(n), the order is preserved). returns the removed value */
+		std::optional<T> RemoveOrdered(SlotMapHandle handle)
+		{
+			if (!Contains(handle))
+				return {};
+
+			Slot& slot = slots[handle.index];
+			uint32_t dense_index = slot.dense_index;
+
+			// extract the value (it is destroyed by the caller, once the map is in a coherent state)
+			std::optional<T> result = std::move(values[dense_index]);
+			values.erase(values.begin() + dense_index);
+			dense_to_slot.erase(dense_to_slot.begin() + dense_index);
+			for (size_t i = dense_index; i < values.size(); ++i)
+				slots[dense_to_slot[i]].dense_index = uint32_t(i);
+
+			// release the slot
+			++slot.generation; // even: free
+			slot.dense_index = free_slot;
+			free_slot = handle.index;
+
+			return result;
+		}
+
+		/** whether the handle references a value in the map */
+		bool Contains(SlotMapHandle handle) const
+		{
+			return (handle.IsValid() && handle.index < slots.size() && slots[handle.index].generation == handle.generation);
+		}
+
+		/** get the value referenced by the handle (nullptr if removed) */
+		T* Find(SlotMapHandle handle)
+		{
+			if (!Contains(handle))
+				return nullptr;
+			return &values[slots[handle.index].dense_index];
+		}
+
+		/** get the value referenced by the handle (nullptr if removed) */
+		T const* Find(SlotMapHandle handle) const
+		{
+			if (!Contains(handle))
+				return nullptr;
+			return &values[slots[handle.index].dense_index];
+		}
+
+		/** get the handle of a value from its dense index */
+		SlotMapHandle GetHandle(size_t dense_index) const
+		{
+			assert(dense_index < values.size());
+			uint32_t slot_index = dense_to_slot[dense_index];
+			return { slot_index, slots[slot_index].generation };
+		}
+
+		/** get the index of a value in the dense storage (handle must be valid) */
+		size_t GetDenseIndex(SlotMapHandle handle) const
+		{
+			assert(Contains(handle));
+			return slots[handle.index].dense_index;
+		}
+
+		/** remove all values (all handles become invalid) */
+		void Clear()
+		{
+			while (values.size() > 0)
+				Remove(GetHandle(values.size() - 1));
+		}
+
+		/** reserve memory */
+		void Reserve(size_t count)
+		{
+			values.reserve(count);
+			dense_to_slot.reserve(count);
+			slots.reserve(count);
+		}
+
+		/** get the number of values */
+		size_t size() const { return values.size(); }
+		/** whether there is no value */
+		bool empty() const { return values.empty(); }
+
+		/** get a value by its dense index */
+		T& operator [](size_t dense_index) { return values[dense_index]; }
+		/** get a value by its dense index */
+		T const& operator [](size_t dense_index) const { return values[dense_index]; }
+
+		/** iteration over the values */
+		iterator begin() { return values.begin(); }
+		/** iteration over the values */
+		iterator end() { return values.end(); }
+		/** iteration over the values */
+		const_iterator begin() const { return values.begin(); }
+		/** iteration over the values */
+		const_iterator end() const { return values.end(); }
+
+	protected:
+
+		/** the values */
+		std::vector<T> values;
+		/** the slot for each value */
+		std::vector<uint32_t> dense_to_slot;
+		/** the indirection table */
+		std::vector<Slot> slots;
+		/** the first free slot */
+		uint32_t free_slot = NO_FREE_SLOT;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -0,0 +1,212 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class SnapshotWriter;
+	class SnapshotReader;
+	class SnapshotRingBuffer;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	CHAOS_DEFINE_LOG(SnapshotLog, "Snapshot")
+
+	// XXX : a snapshot is a binary image of the state of some objects. this is an alternative to JSON for per frame saves
+	//
+	//       - the data of an object is stored inside a chunk: [tag (4 bytes)] [size (4 bytes)] [data ...]
+	//         the tag describes the content and is checked at loading. the size allows to skip unread data
+	//       - inside a chunk, values are stored in the order they are written (no key)
+	//       - the writer buffer is reused from one snapshot to the next: no allocation once the buffer is big enough
+
+	/** make a tag for a chunk from 4 characters */
+	constexpr uint32_t MakeSnapshotTag(char const (&tag)[5])
+	{
+		return uint32_t(uint8_t(tag[0])) | (uint32_t(uint8_t(tag[1])) << 8) | (uint32_t(uint8_t(tag[2])) << 16) | (uint32_t(uint8_t(tag[3])) << 24);
+	}
+
+	/**
+	* SnapshotWriter : write values into a reusable buffer
+	*/
+
+	class CHAOS_API SnapshotWriter
+	{
+	public:
+
+		/** remove the content (the memory is kept) */
+		void Reset() { buffer.clear(); }
+
+		/** write a value */
+		template<typename T>
+		void Write(T const& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			WriteBytes(&value, sizeof(T));
+		}
+		/** write a string */
+		void WriteString(std::string const& value);
+		/** write raw bytes */
+		void WriteBytes(void const* data, size_t size);
+
+		/** start a chunk (returns a value to give to EndChunk) */
+		size_t BeginChunk(uint32_t tag);
+		/** end a chunk */
+		void EndChunk(size_t chunk_position);
+
+		/** write an object into a chunk */
+		bool WriteObject(uint32_t tag, JSONSerializableInterface const& object);
+
+		/** get the content */
+		std::vector<char> const& GetBuffer() const { return buffer; }
+
+	protected:
+
+		/** the content */
+		std::vector<char> buffer;
+	};
+
+	/**
+	* SnapshotReader : read the values of a snapshot
+	*/
+
+	class CHAOS_API SnapshotReader
+	{
+	public:
+
+		/** constructor */
+		SnapshotReader(char const* in_data, size_t in_size);
+		/** constructor */
+		SnapshotReader(std::vector<char> const& in_buffer);
+
+		/** read a value */
+		template<typename T>
+		bool Read(T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			return ReadBytes(&value, sizeof(T));
+		}
+		/** read a string */
+		bool ReadString(std::string& value);
+		/** read raw bytes */
+		bool ReadBytes(void* data, size_t size);
+
+		/** start reading a chunk (fails if the tag does not match). returns a value to give to EndChunk */
+		bool BeginChunk(uint32_t tag, size_t& chunk_end);
+		/** end a chunk (unread data is skipped) */
+		bool EndChunk(size_t chunk_end);
+		/** skip a chunk */
+		bool SkipChunk(uint32_t tag);
+
+		/** read an object from a chunk */
+		bool ReadObject(uint32_t tag, JSONSerializableInterface& object);
+
+		/** whether an error has been encountered */
+		bool HasError() const { return error; }
+		/** whether the whole snapshot has been read */
+		bool IsAtEnd() const { return position >= size; }
+		/** get the number of bytes that are still to be read */
+		size_t GetRemainingSize() const { return (position < size) ? size - position : 0; }
+
+	protected:
+
+		/** the data */
+		char const* data = nullptr;
+		/** the size of the data */
+		size_t size = 0;
+		/** the read position */
+		size_t position = 0;
+		/** whether an error has been encountered (next reads fail) */
+		bool error = false;
+	};
+
+	/**
+	* SnapshotDelta : encode a snapshot as the difference with the previous one
+	*/
+
+	// XXX : the bytes of both snapshots are XOR-ed. the result is mostly made of zeros (unchanged values) and is stored as a list of
+	//       [zero count (varint)] [literal count (varint)] [literal bytes]
+	//       the base snapshot is required for decoding
+
+	namespace SnapshotDelta
+	{
+		/** compute the delta between 2 snapshots */
+		CHAOS_API void Encode(std::vector<char> const& base, std::vector<char> const& snapshot, std::vector<char>& result);
+		/** rebuild a snapshot from its base and its delta */
+		CHAOS_API bool Decode(std::vector<char> const& base, std::vector<char> const& delta, std::vector<char>& result);
+
+	}; // namespace SnapshotDelta
+
+	/**
+	* SnapshotRingBuffer : keeps the last snapshots in a bounded amount of memory
+	*/
+
+	// XXX : a full snapshot (keyframe) is stored at regular interval. other snapshots are stored as a delta with the previous one
+	//       when the memory budget is exceeded, the oldest group of snapshots (a keyframe and its deltas) is removed
+	//       the storage of removed entries is recycled
+
+	class CHAOS_API SnapshotRingBuffer
+	{
+	protected:
+
+		/** a stored snapshot */
+		class Entry
+		{
+		public:
+
+			/** whether this is a full snapshot */
+			bool keyframe = false;
+			/** the full snapshot or the delta with the previous one */
+			std::vector<char> data;
+		};
+
+	public:
+
+		/** constructor */
+		SnapshotRingBuffer(size_t in_max_memory = 16 * 1024 * 1024, size_t in_keyframe_interval = 30);
+
+		/** add a snapshot */
+		void Push(std::vector<char> const& snapshot);
+		/** rebuild a snapshot (0 is the oldest) */
+		bool GetSnapshot(size_t index, std::vector<char>& result) const;
+		/** remove the snapshots after a given count (to replay from a previous frame) */
+		void Truncate(size_t count);
+		/** remove all snapshots */
+		void Clear();
+
+		/** get the number of snapshots */
+		size_t GetSnapshotCount() const { return entries.size(); }
+		/** get the memory reserved by the snapshots (the recycled storage included) */
+		size_t GetMemoryUsage() const { return memory_usage; }
+		/** get the maximum memory */
+		size_t GetMaxMemory() const { return max_memory; }
+
+	protected:
+
+		/** get a storage for a new entry */
+		Entry GetFreeEntry();
+		/** keep the storage of a removed entry for a further push (or release it) */
+		void RecycleEntry(Entry&& entry);
+		/** release the recycled storages while the memory budget is exceeded */
+		void ShrinkFreeEntries();
+		/** remove the oldest group of snapshots */
+		void RemoveOldestGroup();
+
+	protected:
+
+		/** the maximum memory for the snapshots */
+		size_t max_memory = 0;
+		/** the number of snapshots between 2 keyframes */
+		size_t keyframe_interval = 1;
+		/** the snapshots */
+		std::deque<Entry> entries;
+		/** the storage of removed entries (one group at most) */
+		std::vector<Entry> free_entries;
+		/** the last pushed snapshot (base for the next delta) */
+		std::vector<char> last_snapshot;
+		/** the number of snapshots since the last keyframe */
+		size_t snapshots_since_keyframe = 0;
+		/** the memory reserved by the entries and the free entries */
+		size_t memory_usage = 0;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -9,7 +9,7 @@ namespace chaos
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
-	/** function to generate a TagType from a name (XXX : not thread safe) */
+	/** function to generate a TagType from a name (the address of the interned string) */
 	CHAOS_API TagType DeclareTag(char const* name);
 
 #endif
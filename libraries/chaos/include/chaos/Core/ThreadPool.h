@@ -0,0 +1,117 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ThreadPool;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// XXX : a fixed set of worker threads consuming a FIFO of tasks
+	//
+	//       - a pool with a single thread executes its tasks in order (usefull for sequential file writes)
+	//       - ParallelFor(...) splits a range into batches. The calling thread works as well and, while waiting, executes
+	//         the pending tasks of the pool, so that a ParallelFor(...) inside a task does not dead lock
+	//
+	//       tasks must not throw
+
+	/**
+	* ThreadPool : execute tasks on worker threads
+	*/
+
+	class CHAOS_API ThreadPool
+	{
+	public:
+
+		/** constructor (0 for as many threads as cores, minus the calling one) */
+		ThreadPool(size_t thread_count = 0);
+		/** destructor (pending tasks are executed first) */
+		~ThreadPool();
+
+		/** get the pool shared by the whole application */
+		static ThreadPool* GetDefaultInstance();
+
+		/** get the number of worker threads */
+		size_t GetThreadCount() const { return threads.size(); }
+		/** get the number of tasks that are queued or being executed */
+		size_t GetPendingTaskCount() const;
+
+		/** push a task into the queue */
+		void AddTask(std::function<void()> task);
+		/** wait until all tasks are executed */
+		void WaitIdle();
+
+		/** call func(index) for each index in [0, count) on the workers and on the calling thread. returns when all calls are done */
+		template<typename FUNC>
+		void ParallelFor(size_t count, FUNC const& func, size_t batch_size = 1)
+		{
+			if (count == 0)
+				return;
+			batch_size = std::max(batch_size, size_t(1));
+
+			size_t batch_count = (count + batch_size - 1) / batch_size;
+			size_t task_count = std::min(threads.size(), batch_count - 1); // the calling thread processes batches too
+			if (task_count == 0)
+			{
+				for (size_t i = 0; i < count; ++i)
+					func(i);
+				return;
+			}
+
+			std::atomic<size_t> next_index = 0;
+			std::atomic<size_t> remaining_tasks = task_count;
+
+			auto process_batches = [&next_index, &func, count, batch_size]()
+			{
+				for (size_t start = next_index.fetch_add(batch_size); start < count; start = next_index.fetch_add(batch_size))
+				{
+					size_t end = std::min(start + batch_size, count);
+					for (size_t i = start; i < end; ++i)
+						func(i);
+				}
+			};
+
+			for (size_t i = 0; i < task_count; ++i)
+			{
+				AddTask([&process_batches, &remaining_tasks]()
+				{
+					process_batches();
+					--remaining_tasks;
+				});
+			}
+			process_batches();
+
+			// help the workers while the last batches are executed (the tasks reference the local variables)
+			while (remaining_tasks > 0)
+				if (!ExecuteOneTask())
+					std::this_thread::yield();
+		}
+
+	protected:
+
+		/** the function of the worker threads */
+		void WorkerMain();
+		/** execute a pending task on the calling thread (returns false if there is none) */
+		bool ExecuteOneTask();
+
+	protected:
+
+		/** the worker threads */
+		std::vector<std::thread> threads;
+		/** the pending tasks */
+		std::deque<std::function<void()>> tasks;
+		/** the number of tasks being executed */
+		size_t running_task_count = 0;
+		/** whether the threads are to be stopped */
+		bool stopping = false;
+
+		/** protect the queue */
+		mutable std::mutex mutex;
+		/** signaled whenever a task is added or when the pool is destroyed */
+		std::condition_variable task_condition;
+		/** signaled whenever a task is finished */
+		std::condition_variable idle_condition;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -1 +1,2 @@
-#include "chaos/Debug/DebugTools.h"
\ No newline at end of file
+#include "chaos/Debug/DebugTools.h"
+#include "chaos/Debug/Profiler.h"
\ No newline at end of file
@@ -0,0 +1,170 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ProfilerZone;
+	class ProfilerFrame;
+	class Profiler;
+	class ProfilerScopedZone;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	 * CHAOS_PROFILE_ZONE : macros to record a zone for the whole scope (NAME must be a string with static lifetime)
+	 */
+
+#ifndef CHAOS_PROFILER_ENABLED
+#	define CHAOS_PROFILER_ENABLED 1
+#endif
+
+#if CHAOS_PROFILER_ENABLED
+#	define CHAOS_PROFILE_ZONE(NAME) chaos::ProfilerScopedZone BOOST_PP_CAT(profiler_zone_, __LINE__)(NAME)
+#	define CHAOS_PROFILE_FUNCTION() CHAOS_PROFILE_ZONE(__FUNCTION__)
+#else
+#	define CHAOS_PROFILE_ZONE(NAME)
+#	define CHAOS_PROFILE_FUNCTION()
+#endif
+
+	/**
+	 * ProfilerZone : a timed and named portion of a frame
+	 */
+
+	class CHAOS_API ProfilerZone
+	{
+	public:
+
+		/** get the duration of the zone */
+		double GetDuration() const { return end_time - start_time; }
+
+	public:
+
+		/** the name of the zone (static lifetime) */
+		char const* name = nullptr;
+		/** the time when the zone starts (in seconds) */
+		double start_time = 0.0;
+		/** the time when the zone ends (in seconds) */
+		double end_time = 0.0;
+		/** the number of parents of this zone */
+		int depth = 0;
+	};
+
+	/**
+	 * ProfilerFrame : all zones of a frame
+	 */
+
+	class CHAOS_API ProfilerFrame
+	{
+	public:
+
+		/** get the duration of the frame */
+		double GetDuration() const { return end_time - start_time; }
+
+	public:
+
+		/** the index of the frame */
+		uint64_t frame_index = 0;
+		/** the time when the frame starts (in seconds) */
+		double start_time = 0.0;
+		/** the time when the frame ends (in seconds) */
+		double end_time = 0.0;
+		/** the CPU zones */
+		std::vector<ProfilerZone> cpu_zones;
+		/** the GPU zones (they are received a few frames later) */
+		std::vector<ProfilerZone> gpu_zones;
+	};
+
+	/**
+	 * Profiler : records the zones of the last frames
+	 */
+
+	// XXX : zones are only recorded for the thread that calls BeginFrame(...) (the main thread). Other threads are ignored
+
+	class CHAOS_API Profiler : public Singleton<Profiler>
+	{
+	public:
+
+		/** constructor */
+		Profiler();
+
+		/** get the current time (in seconds) */
+		double GetTime() const;
+
+		/** enable or disable the recording */
+		void SetEnabled(bool in_enabled);
+		/** whether the recording is enabled */
+		bool IsEnabled() const { return enabled; }
+
+		/** start a new frame */
+		void BeginFrame();
+		/** end the current frame */
+		void EndFrame();
+		/** get the index of the current frame */
+		uint64_t GetCurrentFrameIndex() const { return frame_counter; }
+
+		/** start a zone (returns -1 if not recorded) */
+		int BeginZone(char const* name);
+		/** end a zone */
+		void EndZone(int zone_index);
+
+		/** add GPU zones to a frame (ignored if the frame is no longer in the history) */
+		void AddGPUZones(uint64_t frame_index, std::vector<ProfilerZone> const& zones);
+
+		/** get the recorded frames */
+		boost::circular_buffer<ProfilerFrame> const& GetFrames() const { return frames; }
+		/** remove all recorded frames */
+		void ClearFrames();
+
+		/** export the recorded frames into a Chrome trace JSON file (chrome://tracing or Perfetto) */
+		bool ExportChromeTrace(FilePathParam const& path) const;
+
+	protected:
+
+		/** whether the recording is enabled */
+		bool enabled = false;
+		/** whether a frame is being recorded */
+		bool frame_started = false;
+		/** the thread for which zones are recorded */
+		std::thread::id frame_thread_id;
+		/** the depth of the next zone */
+		int current_depth = 0;
+		/** the counter of frames */
+		uint64_t frame_counter = 0;
+		/** the frame being recorded */
+		ProfilerFrame current_frame;
+		/** the last recorded frames */
+		boost::circular_buffer<ProfilerFrame> frames;
+		/** the reference for time */
+		std::chrono::steady_clock::time_point reference_time;
+	};
+
+	/**
+	 * ProfilerScopedZone : record a zone for the lifetime of the object
+	 */
+
+	class CHAOS_API ProfilerScopedZone
+	{
+	public:
+
+		/** constructor */
+		ProfilerScopedZone(char const* name)
+		{
+			Profiler* profiler = Profiler::GetInstance();
+			if (profiler->IsEnabled())
+				zone_index = profiler->BeginZone(name);
+		}
+		/** destructor */
+		~ProfilerScopedZone()
+		{
+			if (zone_index >= 0)
+				Profiler::GetInstance()->EndZone(zone_index);
+		}
+
+	protected:
+
+		/** the index of the zone in the frame */
+		int zone_index = -1;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
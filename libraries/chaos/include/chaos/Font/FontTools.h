@@ -13,6 +13,8 @@ namespace chaos
 	{
 		class CharacterMetrics;
 		class CharacterBitmapGlyph;
+		class ArenaGlyph;
+		class GlyphArena;
 
 	}; // namespace FontTools
 
@@ -114,6 +116,33 @@ namespace chaos
 			FT_BitmapGlyph bitmap_glyph = nullptr;
 		};
 
+		/** A glyph rasterized into a GlyphArena */
+		class CHAOS_API ArenaGlyph : public CharacterMetrics
+		{
+		public:
+
+			/** the character */
+			uint32_t charcode = 0;
+			/** the position of the pixels in the arena */
+			size_t offset = 0;
+		};
+
+		/** The 8-bit bitmaps of many glyphs in a single buffer (lines from bottom to top, as FreeImage) */
+		class CHAOS_API GlyphArena
+		{
+		public:
+
+			/** get the description of the pixels of a glyph (empty for glyphs without pixels) */
+			ImageDescription GetImageDescription(ArenaGlyph const& glyph) const;
+
+		public:
+
+			/** the glyphs (in the order of the characters) */
+			std::vector<ArenaGlyph> glyphs;
+			/** the pixels of all glyphs */
+			Buffer<char> pixels;
+		};
+
 		/** get an image description from a FT_Bitmap object */
 		CHAOS_API ImageDescription GetImageDescription(FT_Bitmap const& bitmap);
 
@@ -130,6 +159,13 @@ namespace chaos
 		/** generate a cache with all glyph required for a string */
 		CHAOS_API std::map<uint32_t, CharacterBitmapGlyph> GetGlyphCacheForString(FT_Face face, char const* str);
 
+		/** get the characters required for a string (sorted, without duplicates, with 0 for missing glyphs), as GetGlyphCacheForString(...) does */
+		CHAOS_API std::vector<uint32_t> GetCharactersForString(char const* str);
+		/** rasterize glyphs on several threads into an arena (the bitmaps are the same than GetBitmapGlyph(...) ones) */
+		CHAOS_API bool RasterizeGlyphs(FT_Face face, std::vector<uint32_t> const& charcodes, GlyphArena& result);
+		/** copy (and convert) the pixels of a glyph, with the same conversion than GenerateImage(...) */
+		CHAOS_API void CopyGlyphPixels(ImageDescription const& src_desc, ImageDescription& dst_desc);
+
 	}; // namespace FontTools
 
 #endif
@@ -3,6 +3,7 @@
 #include "chaos/GPU/GLTextureTools.h"
 #include "chaos/GPU/GPUVertexAndIndexMappedBuffers.h"
 #include "chaos/GPU/Primitive.h"
+#include "chaos/GPU/GPUInstancingInfo.h"
 #include "chaos/GPU/GPUDrawPrimitive.h"
 #include "chaos/GPU/GPUDeviceResourceInterface.h"
 #include "chaos/GPU/GPUResource.h"
@@ -13,7 +14,6 @@
 #include "chaos/GPU/GPUTexturePool.h"
 #include "chaos/GPU/GPUDevice.h"
 #include "chaos/GPU/GPURenderContextResourceInterface.h"
-#include "chaos/GPU/GPUInstancingInfo.h"
 #include "chaos/GPU/GPUTextureLoader.h"
 #include "chaos/GPU/GPUAtlasGenerator.h"
 #include "chaos/GPU/GPUQuery.h"
@@ -40,6 +40,7 @@
 #include "chaos/GPU/GPURenderMaterialLoader.h"
 #include "chaos/GPU/GPURenderParams.h"
 #include "chaos/GPU/GPURenderContextStats.h"
+#include "chaos/GPU/GPUProfiler.h"
 #include "chaos/GPU/GPURenderContext.h"
 #include "chaos/GPU/GPURenderable.h"
 #include "chaos/GPU/GPURenderableFilter.h"
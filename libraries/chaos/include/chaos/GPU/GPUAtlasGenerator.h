@@ -25,14 +25,26 @@ namespace chaos
 		GPUAtlas* GenerateAtlas(Atlas const & in_atlas) const;
 		/** generate a GPUAtlas from a standard atlas (+ move) */
 		GPUAtlas* GenerateAtlas(Atlas&& in_atlas) const;
+		/** generate a GPUAtlas from a binary atlas (no image decoding, pages and mipmaps are uploaded as is) */
+		GPUAtlas* GenerateAtlas(AtlasBinary const& in_atlas) const;
+		/** generate a GPUAtlas from a binary atlas (+ move) */
+		GPUAtlas* GenerateAtlas(AtlasBinary&& in_atlas) const;
+		/** load a binary atlas file and generate a GPUAtlas */
+		GPUAtlas* LoadBinaryAtlas(FilePathParam const& path) const;
 
 		/** fill a GPUAtlas from standard atlas */
 		bool FillAtlasContent(GPUAtlas* result, Atlas const & in_atlas) const;
 		/** fill a GPUAtlas from standard atlas (+ move) */
 		bool FillAtlasContent(GPUAtlas* result, Atlas&& in_atlas) const;
+		/** fill a GPUAtlas from binary atlas */
+		bool FillAtlasContent(GPUAtlas* result, AtlasBinary const& in_atlas) const;
+		/** fill a GPUAtlas from binary atlas (+ move) */
+		bool FillAtlasContent(GPUAtlas* result, AtlasBinary&& in_atlas) const;
 
 		/** generate a texture from a standard atlas */
 		GPUTexture* CreateTextureFromAtlas(Atlas const & in_atlas) const;
+		/** generate a texture from a binary atlas */
+		GPUTexture* CreateTextureFromAtlas(AtlasBinary const& in_atlas) const;
 
 	protected:
 
@@ -25,6 +25,8 @@ namespace chaos
 		int    start = 0;
 		/** for indexed rendering, this is an offset applied to each index */
 		int    base_vertex_index = 0;
+		/** for instanced primitives (an instance_count of 0 means the instancing of the GPURenderParams is used) */
+		GPUInstancingInfo instancing;
 	};
 
 #endif
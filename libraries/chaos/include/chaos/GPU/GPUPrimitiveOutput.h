@@ -183,6 +183,13 @@ namespace chaos
             size_t vertex_count = primitive_count * 4;
             return { GeneratePrimitiveAndConstruct(vertex_size, vertex_count, PrimitiveType::Quad), vertex_size, vertex_count };
         }
+        /** insert some instanced quads (one vertex per quad, the vertex declaration must be per instance) */
+        InstancedQuadPrimitive<vertex_type> AddInstancedQuads(size_t primitive_count = 1)
+        {
+            assert(vertex_declaration != nullptr && vertex_declaration->IsPerInstance());
+            size_t vertex_count = primitive_count * 1;
+            return { GeneratePrimitiveAndConstruct(vertex_size, vertex_count, PrimitiveType::InstancedQuad), vertex_size, vertex_count };
+        }
         /** insert some triangles */
         TrianglePrimitive<vertex_type> AddTriangles(size_t primitive_count = 1)
         {
@@ -0,0 +1,126 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class GPUProfiler;
+	class GPUProfilerScopedZone;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	 * CHAOS_GPU_PROFILE_ZONE : record a GPU zone for the whole scope (NAME must be a string with static lifetime)
+	 */
+
+#if CHAOS_PROFILER_ENABLED
+#	define CHAOS_GPU_PROFILE_ZONE(RENDER_CONTEXT, NAME) chaos::GPUProfilerScopedZone BOOST_PP_CAT(gpu_profiler_zone_, __LINE__)(RENDER_CONTEXT, NAME)
+#else
+#	define CHAOS_GPU_PROFILE_ZONE(RENDER_CONTEXT, NAME)
+#endif
+
+	/**
+	 * GPUProfiler : measure GPU zones with timestamp queries and send them to the Profiler
+	 */
+
+	// XXX : the results of the queries are read only when they are available (a few frames later) so that the CPU never waits for the GPU
+	//       the queries are recycled in a pool
+
+	class CHAOS_API GPUProfiler
+	{
+		friend class GPURenderContext;
+
+	protected:
+
+		/** a zone whose queries are not read yet */
+		class PendingZone
+		{
+		public:
+
+			/** the name of the zone */
+			char const* name = nullptr;
+			/** the number of parents of the zone */
+			int depth = 0;
+			/** the query for the start of the zone */
+			shared_ptr<GPUQuery> begin_query;
+			/** the query for the end of the zone */
+			shared_ptr<GPUQuery> end_query;
+		};
+
+		/** a frame whose queries are not read yet */
+		class PendingFrame
+		{
+		public:
+
+			/** the index of the frame in the Profiler */
+			uint64_t frame_index = 0;
+			/** the offset to convert GPU time into Profiler time (in seconds) */
+			double time_offset = 0.0;
+			/** the zones of the frame */
+			std::vector<PendingZone> zones;
+		};
+
+	public:
+
+		/** constructor */
+		GPUProfiler(GPURenderContext* in_render_context);
+
+		/** start a zone (returns -1 if not recorded) */
+		int BeginZone(char const* name);
+		/** end a zone */
+		void EndZone(int zone_index);
+
+	protected:
+
+		/** called whenever a new frame is started */
+		void OnBeginRenderingFrame();
+		/** called whenever a new frame is finished */
+		void OnEndRenderingFrame();
+		/** release all queries */
+		void Destroy();
+
+		/** read the results of the finished frames */
+		void ReadPendingFrames();
+		/** get a query from the pool (or create a new one) */
+		shared_ptr<GPUQuery> GetQuery();
+		/** give back the queries of a frame to the pool */
+		void ReleaseFrameQueries(PendingFrame& frame);
+
+	protected:
+
+		/** the render context */
+		GPURenderContext* render_context = nullptr;
+		/** whether a frame is being recorded */
+		bool frame_started = false;
+		/** the depth of the next zone */
+		int current_depth = 0;
+		/** the frame being recorded */
+		PendingFrame current_frame;
+		/** the frames waiting for their results */
+		std::deque<PendingFrame> pending_frames;
+		/** the unused queries */
+		std::vector<shared_ptr<GPUQuery>> query_pool;
+	};
+
+	/**
+	 * GPUProfilerScopedZone : record a GPU zone for the lifetime of the object
+	 */
+
+	class CHAOS_API GPUProfilerScopedZone
+	{
+	public:
+
+		/** constructor */
+		GPUProfilerScopedZone(GPURenderContext* in_render_context, char const* name);
+		/** destructor */
+		~GPUProfilerScopedZone();
+
+	protected:
+
+		/** the render context */
+		GPURenderContext* render_context = nullptr;
+		/** the index of the zone in the frame */
+		int zone_index = -1;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -17,8 +17,8 @@ namespace chaos
 	{
 	public:
 
-		/** self descriptive */
-		std::string name;
+		/** self descriptive (interned: providers compare it by pointer) */
+		InternedString name;
 		/** self descriptive */
 		GLint  array_size = 0;
 		/** self descriptive */
@@ -88,6 +88,8 @@ namespace chaos
 
 		/** find an uniform */
 		GPUUniformInfo const* FindUniform(char const* name) const;
+		/** find an uniform */
+		GPUUniformInfo const* FindUniform(InternedString name) const;
 
 		/** set an uniform by its name */
 		template<typename T>
@@ -41,6 +41,8 @@ namespace chaos
 
 		/** the main method : returns true whether the action has been handled (even if failed) */
 		bool ProcessAction(char const* name, GPUProgramAction& action) const;
+		/** the main method : returns true whether the action has been handled (even if failed) */
+		bool ProcessAction(InternedString name, GPUProgramAction& action) const;
 
 		/** utility function that deserve to set uniform */
 		bool BindUniform(GPUUniformInfo const& uniform) const;
@@ -55,6 +57,8 @@ namespace chaos
 
 	protected:
 
+		/** run the explicit, deduced and fallback passes */
+		bool ProcessAction(GPUProgramProviderExecutionData& execution_data) const;
 		/** the main method : returns true whether that action has been successfully handled */
 		virtual bool DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const;
 	};
@@ -86,7 +90,7 @@ namespace chaos
 		/** the main method */
 		virtual bool DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const override
 		{
-			if (execution_data.Match(handled_name.c_str(), pass_type))
+			if (execution_data.Match(handled_name, pass_type))
 				return execution_data.Process(value, this);
 			return false;
 		}
@@ -94,7 +98,7 @@ namespace chaos
 	protected:
 
 		/** the name of the uniform handled */
-		std::string handled_name;
+		InternedString handled_name;
 		/** the value of the uniform */
 		MEMBER_TYPE value;
 		/** the type of this provider */
@@ -123,7 +127,7 @@ namespace chaos
 	protected:
 
 		/** the name of the uniform handled */
-		std::string handled_name;
+		InternedString handled_name;
 		/** the value of the uniform */
 		shared_ptr<GPUTexture> value;
 		/** the type of this provider */
@@ -33,6 +33,8 @@ namespace chaos
 
 		/** constructor */
 		GPUProgramProviderExecutionData(char const* in_searched_name, GPUProgramAction& in_action, GPUProgramProviderExecutionData const* base_execution = nullptr);
+		/** constructor (the names of the providers are compared by pointer) */
+		GPUProgramProviderExecutionData(InternedString in_searched_name, GPUProgramAction& in_action, GPUProgramProviderExecutionData const* base_execution = nullptr);
 
 		/** check for name and return a lock */
 		GPUProgramProviderDeduceLock CanDeduce(char const* searched_name) const;
@@ -49,6 +51,8 @@ namespace chaos
 
 		/** returns whether the proposed name + type match the initial request */
 		bool Match(char const* other_name, GPUProgramProviderPassType in_pass_type = GPUProgramProviderPassType::Explicit) const;
+		/** returns whether the proposed name + type match the initial request */
+		bool Match(InternedString other_name, GPUProgramProviderPassType in_pass_type = GPUProgramProviderPassType::Explicit) const;
 
 		/** gets the pass type */
 		GPUProgramProviderPassType GetPassType() const { return pass_type; }
@@ -75,6 +79,8 @@ namespace chaos
 		mutable std::vector<char const*> internal_deduced_searches;
 		/** the name searched */
 		char const* searched_name = nullptr;
+		/** the name searched (if interned) */
+		InternedString searched_interned_name;
 		/** the action to trigger */
 		GPUProgramAction& action;
 	};
@@ -55,6 +55,9 @@ namespace chaos
 		/** constructor */
 		GPUProgramFileSourceGenerator(FilePathParam const& path);
 
+		/** get the path of the source file */
+		boost::filesystem::path const& GetPath() const { return source_path; }
+
 		/** returns generated code */
 		virtual Buffer<char> GenerateSource(std::map<std::string, int> const& definitions) override
 		{
@@ -65,6 +68,8 @@ namespace chaos
 
 		/** this is the cached source code */
 		Buffer<char> buffer;
+		/** the path of the source file */
+		boost::filesystem::path source_path;
 	};
 
 #endif
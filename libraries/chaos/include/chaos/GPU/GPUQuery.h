@@ -43,6 +43,8 @@ namespace chaos
 		bool BeginQuery();
 		/** end the query */
 		bool EndQuery();
+		/** record the GPU time once all previous commands are executed (GL_TIMESTAMP queries only) */
+		bool QueryCounter();
 
 		/** returns true whether the query is started */
 		bool IsStarted() const { return query_started; }
@@ -39,6 +39,8 @@ namespace chaos
 
 		/** get the rendering statistics */
 		GPURenderContextStats const & GetStats() const { return stats; }
+		/** get the GPU profiler */
+		GPUProfiler& GetProfiler() { return profiler; }
 
 		/** get the owning window */
 		Window* GetWindow() const { return window.get(); }
@@ -81,6 +83,8 @@ namespace chaos
 
 		/** the rendering statistics */
 		GPURenderContextStats stats;
+		/** the GPU profiler */
+		GPUProfiler profiler;
 	};
 
 #endif
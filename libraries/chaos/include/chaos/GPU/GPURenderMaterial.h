@@ -41,7 +41,7 @@ namespace chaos
 	{
 	public:
 
-		virtual bool OnRenderMaterial(GPURenderMaterial const* render_material, GPURenderMaterialInfo const* material_info, char const* renderpass_name)
+		virtual bool OnRenderMaterial(GPURenderMaterial const* render_material, GPURenderMaterialInfo const* material_info, InternedString renderpass_name)
 		{
 			return false; // continue traversal
 		}
@@ -125,7 +125,7 @@ namespace chaos
 		GPUProgramProvider const& GetUniformProvider() const;
 
 		/** traverse method entry point */
-		bool Traverse(GPURenderMaterialInfoTraverseFunc& traverse_func, char const* renderpass_name) const;
+		bool Traverse(GPURenderMaterialInfoTraverseFunc& traverse_func, InternedString renderpass_name) const;
 
 		/** create a RenderMaterial from a simple program */
 		static GPURenderMaterial* GenRenderMaterialObject(GPUProgram* program, bool default_program_material = false);
@@ -136,7 +136,7 @@ namespace chaos
 	protected:
 
 		/** traversal method implementation */
-		static bool TraverseImpl(GPURenderMaterial const* render_material, GPURenderMaterialInfo const* material_info, GPURenderMaterialInfoTraverseFunc& traverse_func, char const* renderpass_name);
+		static bool TraverseImpl(GPURenderMaterial const* render_material, GPURenderMaterialInfo const* material_info, GPURenderMaterialInfoTraverseFunc& traverse_func, InternedString renderpass_name);
 		/** search some cycles throught parent_material (returning true is an error) */
 		static bool SearchRenderMaterialCycle(GPURenderMaterialInfo const* material_info, GPURenderMaterial const* searched_material);
 
@@ -27,10 +27,12 @@ namespace chaos
 		shared_ptr<GPUMaterialProvider> material_provider;
 		/** some filters */
 		shared_ptr<GPURenderableFilter> object_filter;
-		/** material specialization */
-		std::string renderpass_name;
+		/** material specialization (interned: compared by pointer during material traversal) */
+		InternedString renderpass_name;
 		/** the instancing information */
 		GPUInstancingInfo instancing;
+		/** the blend factor between the two last simulation steps (fixed step mode) */
+		float interpolation_alpha = 1.0f;
 	};
 
 #endif
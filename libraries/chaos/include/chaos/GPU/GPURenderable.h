@@ -40,7 +40,7 @@ namespace chaos
 		void RemoveDisabledRenderPasses(char const* renderpass_names);
 
 		/** check whether the renderable can be displayed by the name */
-		bool IsRenderPassEnabled(char const* renderpass_name) const;
+		bool IsRenderPassEnabled(InternedString renderpass_name) const;
 
 	protected:
 
@@ -128,6 +128,15 @@ namespace chaos
 		/** override */
 		virtual void OnDrawImGuiMenu(Window* window, ImGuiMenuBuilder const & menu_builder) override;
 
+		/** enable or disable the watching of the resource files */
+		void SetHotReloadEnabled(bool enabled);
+		/** whether the resource files are watched */
+		bool IsHotReloadEnabled() const { return (file_watcher != nullptr); }
+		/** reload the resources whose files have been modified (to be called between 2 frames) */
+		bool ProcessFileChanges();
+		/** reload only the resources that depend on some files */
+		bool ReloadResourcesFromFiles(std::vector<boost::filesystem::path> const& paths);
+
 	protected:
 
 		/** override */
@@ -161,6 +170,9 @@ namespace chaos
 		/** merge all resources with incomming manager */
 		virtual bool RefreshGPUResources(GPUResourceManager* other_gpu_manager);
 
+		/** register the files of all resources to the watcher */
+		void WatchResourceFiles();
+
 	protected:
 
 		/** the textures */
@@ -174,6 +186,11 @@ namespace chaos
 		shared_ptr<GPUMesh> quad_mesh;
 		/** the quad to triangle_pair index rendering */
 		shared_ptr<GPUBuffer> quad_index_buffer;
+
+		/** the watcher of the resource files (hot reload) */
+		std::unique_ptr<FileWatcher> file_watcher;
+		/** the number of resources whose files are watched */
+		size_t watched_resource_count = 0;
 	};
 
 #endif
@@ -34,6 +34,8 @@ namespace chaos
 		virtual GPUTexture* GenTextureObject(FIBITMAP* image, GenTextureParameters const& parameters = {}) const;
 		/** Generate a cube texture from a cubemap */
 		virtual GPUTexture* GenTextureObject(CubeMapImages const* cubemap, PixelFormatMergeParams const& merge_params = {}, GenTextureParameters const& parameters = {}) const;
+		/** Generate a cube texture with all its levels from a prefiltered mip chain */
+		virtual GPUTexture* GenTextureObject(CubeMapMipChain const* mip_chain, GenTextureParameters const& parameters = {}) const;
 
 		/** Generate a texture from lambda */
 		template<typename T, typename GENERATOR>
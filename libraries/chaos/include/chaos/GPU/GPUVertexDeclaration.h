@@ -107,6 +107,11 @@ namespace chaos
 		/** set the effective vertex size (for data that would not be declared) */
 		void SetEffectiveVertexSize(size_t in_effective_size);
 
+		/** change whether the data are read once per instance (instead of once per vertex) */
+		void SetPerInstance(bool in_per_instance);
+		/** whether the data are read once per instance (instead of once per vertex) */
+		bool IsPerInstance() const { return per_instance; }
+
 		/** returns the number of elements for a given semantic */
 		size_t GetSemanticCount(VertexAttributeSemantic semantic) const;
 		/** returns the number of position */
@@ -137,6 +142,8 @@ namespace chaos
 
 		/** all the entries of the declaration */
 		std::vector<GPUVertexDeclarationEntry> entries;
+		/** whether the data are read once per instance */
+		bool per_instance = false;
 		/** the effective size of the vertex */
 		mutable std::optional<size_t> effective_size;
 		/** the vertex size */
@@ -21,6 +21,11 @@ namespace chaos
     //     +------+
     //    0,3     1
     //
+    // INSTANCED QUAD
+    // --------------
+    //
+    //     one "vertex" per quad, read once per instance. The vertex shader generates the 6 vertices of the quad from gl_VertexID
+    //
 
     /**
      * PrimitiveType : the type of primitives that can be rendered
@@ -37,7 +42,8 @@ namespace chaos
         TriangleFan,
         Line,
         LineStrip,
-        LineLoop
+        LineLoop,
+        InstancedQuad
     };
 
     template<typename VERTEX_TYPE>
@@ -51,6 +57,7 @@ namespace chaos
     template<typename VERTEX_TYPE> using TrianglePrimitive = TypedPrimitive<VERTEX_TYPE, PrimitiveType::Triangle>;
     template<typename VERTEX_TYPE> using TrianglePairPrimitive = TypedPrimitive<VERTEX_TYPE, PrimitiveType::TrianglePair>;
     template<typename VERTEX_TYPE> using QuadPrimitive = TypedPrimitive<VERTEX_TYPE, PrimitiveType::Quad>;
+    template<typename VERTEX_TYPE> using InstancedQuadPrimitive = TypedPrimitive<VERTEX_TYPE, PrimitiveType::InstancedQuad>;
 
     template<typename VERTEX_TYPE> using TriangleStripPrimitive = TypedPrimitive<VERTEX_TYPE, PrimitiveType::TriangleStrip>;
     template<typename VERTEX_TYPE> using TriangleFanPrimitive = TypedPrimitive<VERTEX_TYPE, PrimitiveType::TriangleFan>;
@@ -199,6 +206,8 @@ namespace chaos
                 vertices_per_primitive = 4;
             else if constexpr (PRIMITIVE_TYPE == PrimitiveType::Line)
                 vertices_per_primitive = 2;
+            else if constexpr (PRIMITIVE_TYPE == PrimitiveType::InstancedQuad)
+                vertices_per_primitive = 1;
             else
                 assert(0); // no meaning for strips, fan, strip_lines ... because they have infinite number of vertices
 
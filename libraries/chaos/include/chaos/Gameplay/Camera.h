@@ -48,8 +48,8 @@ namespace chaos
 		/** initialization method */
 		bool Initialize(LevelInstance* in_level_instance);
 
-		/** set the camera box */
-		void SetCameraBox(box2 const& in_box) { camera_box = in_box; }
+		/** set the camera box (a teleport discards the previous simulation step box) */
+		void SetCameraBox(box2 const& in_box, bool teleport = false);
 
 		/** get the camera box */
 		box2  GetCameraBox(bool apply_modifiers = true) const;
@@ -72,10 +72,19 @@ namespace chaos
 		/** apply the safe zone the the camera box */
 		box2 GetSafeCameraBox(bool apply_modifiers = true) const;
 
+		/** temporarily move the camera to its box blended between the 2 last simulation steps for rendering */
+		void BeginRenderInterpolation(float alpha);
+		/** restore the simulated camera box once rendering is over */
+		void EndRenderInterpolation();
+
 		/** the processor may save its configuration into a JSON file */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
 		/** the processor may save its configuration from a JSON file */
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
+		/** the object may save its state into a binary snapshot */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** the object may load its state from a binary snapshot */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 		/** Camera is a CameraComponent owner */
 		CHAOS_DECLARE_COMPONENT_OWNER(CameraComponent, Component, components)
@@ -89,6 +98,10 @@ namespace chaos
 
 		/** the camera bounding box */
 		box2 camera_box;
+		/** the camera box at the previous simulation step */
+		std::optional<box2> previous_camera_box;
+		/** the simulated camera box, stored while the camera is displayed at its blended box */
+		std::optional<box2> simulated_camera_box;
 		/** the initial camera obox (at level startup) */
 		obox2 initial_camera_obox;
 		/** the safe zone of the camera */
@@ -208,6 +208,14 @@ namespace chaos
 		/** internal  method to display the HUD */
 		virtual void DoDisplayHUD(GPURenderContext* render_context, GPUProgramProviderInterface const * uniform_provider, GPURenderParams const& render_params);
 
+		// XXX : only the pawns and the camera are blended. The other particles are displayed at their simulated state and move at the simulation rate
+		//       override these methods to blend other entities (see GameEntity::BeginRenderInterpolation(...))
+
+		/** place the pawns and the camera between their 2 last simulation steps before rendering */
+		virtual void BeginRenderInterpolation(float alpha);
+		/** restore the simulated pawns and camera once rendering is over */
+		virtual void EndRenderInterpolation();
+
 		/** initialization from the config file */
 		virtual bool OnInitialize(JSONReadConfiguration config);
 		/** initialize some resources */
@@ -80,6 +80,9 @@ namespace chaos
 		nlohmann::json main_clock_save;
 		/** the game state encoded into a JSON */
 		nlohmann::json game_clock_save;
+
+		/** the whole state encoded into a binary snapshot (used instead of the JSON saves when not empty) */
+		std::vector<char> snapshot;
 	};
 
 #endif
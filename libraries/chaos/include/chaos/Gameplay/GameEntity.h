@@ -24,10 +24,10 @@ namespace chaos
 		virtual glm::vec2 GetPosition() const;
 		/** Get the bounding box of the entity */
 		virtual box2 GetBoundingBox() const;
-		/** Set the position of the entity */
-		virtual void SetPosition(glm::vec2 const& in_position);
-		/** Set the bounding box of the entity */
-		virtual void SetBoundingBox(box2 const& in_bounding_box);
+		/** Set the position of the entity (a teleport discards the previous simulation step box) */
+		virtual void SetPosition(glm::vec2 const& in_position, bool teleport = false);
+		/** Set the bounding box of the entity (a teleport discards the previous simulation step box) */
+		virtual void SetBoundingBox(box2 const& in_bounding_box, bool teleport = false);
 
 
 		// shu47
@@ -42,6 +42,20 @@ namespace chaos
 		/** Set the rotation of the entity */
 		virtual void SetRotation(float in_rotation);
 
+		/** store the current box so that rendering may blend between 2 simulation steps (to be called at the beginning of a step) */
+		void SavePreviousBoundingBox();
+		/** forget the previous simulation step box (no blending until next step) */
+		void ClearPreviousBoundingBox();
+		/** get the bounding box blended between the previous simulation step and the current one */
+		box2 GetInterpolatedBoundingBox(float alpha) const;
+		/** get the position blended between the previous simulation step and the current one */
+		glm::vec2 GetInterpolatedPosition(float alpha) const;
+
+		/** temporarily move the entity (and its particle) to its blended box for rendering (to be called every frame) */
+		void BeginRenderInterpolation(float alpha);
+		/** restore the simulated box once rendering is over */
+		void EndRenderInterpolation();
+
 
 		// shu47
 
@@ -83,6 +97,10 @@ namespace chaos
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
 		/** the processor may save its configuration from a JSON file */
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
+		/** the object may save its state into a binary snapshot */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** the object may load its state from a binary snapshot */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 		/** copy the bounding box from particle to entity or the opposite */
 		void SynchronizeData(bool particle_to_entity);
@@ -109,6 +127,12 @@ namespace chaos
 		bool is_particle_master = false;
 		/** the box for the entity */
 		box2 bounding_box;
+		/** the box for the entity at the previous simulation step */
+		std::optional<box2> previous_bounding_box;
+		/** the simulated box, stored while the entity is displayed at its blended box */
+		std::optional<box2> simulated_bounding_box;
+		/** whether the GPU buffer of the particle layer still contains the blended box */
+		bool gpu_buffer_interpolated = false;
 		/** the allocation for the entity */
 		shared_ptr<ParticleAllocationBase> allocations;
 	};
@@ -63,6 +63,22 @@ namespace chaos
 		/** restart from the respawn checkpoint */
 		bool RestartFromRespawnCheckpoint();
 
+		/** save the level, the player and optionally the clocks into a binary snapshot */
+		bool SaveIntoSnapshot(SnapshotWriter & writer, bool with_clocks) const;
+		/** load the level, the player and optionally the clocks from a binary snapshot */
+		bool LoadFromSnapshot(SnapshotReader & reader, bool with_clocks);
+
+		/** enable or disable the recording of a snapshot each tick */
+		void SetRewindEnabled(bool in_enabled);
+		/** whether a snapshot is recorded each tick */
+		bool IsRewindEnabled() const { return rewind_enabled; }
+		/** get the number of frames that can be rewound */
+		size_t GetRewindFrameCount() const;
+		/** go back in time (the more recent frames are discarded) */
+		bool Rewind(size_t frame_count);
+		/** get the buffer that stores the recent frames */
+		SnapshotRingBuffer const & GetRewindBuffer() const { return rewind_buffer; }
+
 		/** returns the sound category */
 		SoundCategory* GetSoundCategory();
 		/** returns the sound category */
@@ -70,6 +86,9 @@ namespace chaos
 
 	protected:
 
+		/** the version of the snapshots */
+		static constexpr uint32_t SNAPSHOT_VERSION = 1;
+
 		/** override */
 		virtual bool DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const override;
 
@@ -149,6 +168,15 @@ namespace chaos
 
 		/** respawn checkpoint */
 		shared_ptr<GameCheckpoint> respawn_checkpoint;
+
+		/** whether a snapshot is recorded each tick */
+		bool rewind_enabled = false;
+		/** the recent frames */
+		SnapshotRingBuffer rewind_buffer;
+		/** the writer used to record the frames (its memory is reused) */
+		SnapshotWriter rewind_writer;
+		/** the buffer used to decode the frames (its memory is reused) */
+		std::vector<char> rewind_snapshot;
 	};
 
 #endif
@@ -77,6 +77,10 @@ namespace chaos
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
 		/** the processor may save its configuration from a JSON file */
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
+		/** the object may save its state into a binary snapshot */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** the object may load its state from a binary snapshot */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 	protected:
 
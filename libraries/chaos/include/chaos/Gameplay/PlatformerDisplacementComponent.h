@@ -64,6 +64,8 @@ namespace chaos
 		bool discrete_stick_mode = true;
 		/** the box extend for collision */
 		glm::vec2 pawn_extend = glm::vec2(1.0f, 1.0f);
+		/** whether the pawn is swept against the tiles (no tunnelling at high speed or with long ticks) */
+		bool continuous_collision = false;
 		/** clamping the velocity in both direction */
 		glm::vec2 max_pawn_velocity = glm::vec2(250.0f, 500.0f);
 		/** a factor to apply to max_velocity.x whenever pawn is running */
@@ -0,0 +1,134 @@
+namespace chaos
+{
+#if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// =====================================
+	// TMChunkStreamer : build the particles of a tile layer chunk per chunk, around the camera
+	// =====================================
+
+	// XXX : for STREAMED tile layers (infinite maps), only the chunks near the camera are resident
+	//
+	//       - the chunks within STREAMING_RADIUS of the camera are requested
+	//       - a task of the thread pool decodes the tiles and builds the particles (no allocation, no log, no object creation)
+	//       - on the main thread, the particles are copied into a new allocation of the layer and finalized
+	//       - the chunks out of range are evicted, the farthest first, as long as the resident particles exceed STREAMING_MEMORY_BUDGET (in KB)
+	//         the chunks in range are never evicted
+	//       - a chunk whose particles have been changed by the gameplay (particles or allocation destroyed) is never evicted nor rebuilt
+	//         (it would be rebuilt from the map data). Only a level restart (with autoclean_particles) rebuilds it (see Reset())
+	//
+	//       the tiles that create a TMObject (see TMLevel::GetObjectFactory(...)) are skipped by the workers : their objects are created
+	//       once for all when the layer is initialized (see TMLayerInstance::CreateStreamedTileObjects(...)), whatever the camera
+	//       this requires all chunks to be decoded once at initialization, as soon as the tilesets have such tiles (the particles are still streamed)
+	//       only the resident chunks have particles, and so collisions
+	//
+	//       the tasks read the tables of the level instance : the level destroys the streamers of its layers (see ~TMLevelInstance())
+
+	class CHAOS_API TMChunkStreamer
+	{
+		CHAOS_GAMEPLAY_TM_ALL_FRIENDS;
+
+		/** the maximum number of chunks being built at the same time */
+		static size_t const MAX_PENDING_BUILD_COUNT = 8;
+
+	protected:
+
+		/** the output of a build task */
+		class BuildResult
+		{
+		public:
+
+			/** the particles of the chunk */
+			std::vector<TMParticle> particles;
+			/** whether the task is finished */
+			std::atomic<bool> finished = false;
+		};
+
+		/** the streaming state of a chunk */
+		class StreamedChunk
+		{
+		public:
+
+			/** the chunk in the tiled layer */
+			TiledMap::TileLayerChunk const* chunk = nullptr;
+			/** the extent of the chunk (layer coordinates) */
+			box2 bounding_box;
+			/** the build in progress */
+			std::shared_ptr<BuildResult> build;
+			/** whether the particles have been created */
+			bool resident = false;
+			/** whether the allocation failed (the chunk is never requested again) */
+			bool failed = false;
+			/** whether the gameplay changed the particles (the chunk is never evicted nor rebuilt) */
+			bool modified = false;
+			/** the number of particles when the chunk has been built */
+			size_t particle_count = 0;
+			/** the particles of the chunk */
+			weak_ptr<ParticleAllocationBase> allocation;
+			/** the memory used by the particles */
+			size_t memory_size = 0;
+		};
+
+	public:
+
+		/** destructor (wait for the pending tasks) */
+		~TMChunkStreamer();
+
+		/** initialize the streamer */
+		bool Initialize(TMLayerInstance* in_layer_instance, TiledMap::TileLayer const* in_tile_layer);
+		/** request, finalize or evict chunks according to the camera (layer coordinates) */
+		void Tick(box2 const& camera_box);
+		/** evict all chunks, modified or not (they are rebuilt from the map data) */
+		void Reset();
+		/** wait until no task references the streamer anymore */
+		void WaitPendingBuilds();
+
+		/** get the extent of all chunks (layer coordinates) */
+		box2 GetBoundingBox() const;
+		/** get the number of resident chunks */
+		size_t GetResidentChunkCount() const;
+		/** get the memory used by the particles of the resident chunks */
+		size_t GetResidentMemorySize() const { return resident_memory_size; }
+
+	protected:
+
+		/** returns true whether the chunk is within the streaming radius */
+		bool IsInRange(StreamedChunk const& streamed_chunk, box2 const& streaming_box) const;
+		/** start the build of a chunk on the thread pool */
+		void StartBuild(StreamedChunk& streamed_chunk);
+		/** decode the tiles of a chunk and build its particles (any thread) */
+		void BuildChunkParticles(TiledMap::TileLayerChunk const& chunk, std::vector<TMParticle>& particles) const;
+		/** create the allocation for a finished build */
+		bool CompleteBuild(StreamedChunk& streamed_chunk);
+		/** destroy the particles of a chunk */
+		void EvictChunk(StreamedChunk& streamed_chunk);
+		/** returns true whether the gameplay changed the particles of a resident chunk */
+		bool CheckModified(StreamedChunk& streamed_chunk);
+
+	protected:
+
+		/** the layer instance owning the streamer */
+		TMLayerInstance* layer_instance = nullptr;
+		/** the tiled layer */
+		TiledMap::TileLayer const* tile_layer = nullptr;
+		/** the gid => atlas table of the level */
+		TMTileAtlasTable const* tile_atlas_table = nullptr;
+		/** the gid of the tiles that create objects */
+		std::unordered_set<int> object_gids;
+
+		/** all the chunks of the layer */
+		std::vector<StreamedChunk> chunks;
+		/** the distance around the camera where chunks are required */
+		float streaming_radius = 512.0f;
+		/** the memory that the resident chunks may use before out of range chunks are evicted */
+		size_t memory_budget = 16 * 1024 * 1024;
+		/** the memory used by the resident chunks */
+		size_t resident_memory_size = 0;
+		/** whether the visible chunks are still to be built synchronously */
+		bool initial_tick = true;
+		/** the number of tasks in the thread pool */
+		std::atomic<size_t> pending_build_count = 0;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -210,7 +210,7 @@ namespace chaos
 										cached_result.layer_instance = &(*this->li_iterator);
 										cached_result.allocation = allocation;
 										cached_result.particle = particle;
-										cached_result.tile_info = this->level_instance->GetTiledMap()->FindTileInfo(particle->gid);
+										cached_result.tile_info = this->level_instance->GetTileAtlasTable().FindTileInfo(particle->gid);
 										return;
 									}
 									ignore_first = false;
@@ -2,6 +2,26 @@ namespace chaos
 {
 #if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	// =====================================
+	// TileSweepResult : the first edge hit by a moving box
+	// =====================================
+
+	class CHAOS_API TileSweepResult
+	{
+	public:
+
+		/** whether an edge has been hit */
+		bool hit = false;
+		/** the fraction of the displacement before the impact [0..1] */
+		float time_of_impact = 1.0f;
+		/** the normal of the contact (pointing from the tile toward the moving box) */
+		glm::vec2 normal = { 0.0f, 0.0f };
+		/** the edge of the tile that has been hit */
+		Edge edge = Edge::Top;
+		/** the tile that has been hit */
+		TileCollisionInfo collision_info;
+	};
+
 	// =====================================
 	// TileCollisionComputer
 	// =====================================
@@ -27,10 +47,22 @@ namespace chaos
 
 		/** the entry point for the whole computation */
 		box2 Run(LightweightFunction<void(TileCollisionInfo const& collision_info)> func);
+		/** the entry point for the continuous computation : the box slides from src_box along the edges it hits, then func is called as for Run(...) around the final position */
+		box2 RunContinuous(LightweightFunction<void(TileCollisionInfo const& collision_info)> func);
 
 		/** compute reaction for a a particle */
 		void ComputeReaction(TileCollisionInfo const& collision_info, LightweightFunction<bool(TileCollisionInfo const&, Edge)> func);
 
+		/** search the first edge hit by a box along a displacement */
+		TileSweepResult Sweep(box2 const& box, glm::vec2 const& displacement);
+
+		/** discrete test of a box against one edge of a tile : returns 0 (no contact), 1 (ZONE 2 : touch) or 2 (ZONE 1 : touch + new_position to push the box away) */
+		static int ComputeEdgeContact(box_corners2 const& particle_corners, box2 const& dst_box, glm::vec2 const& delta_position, glm::vec2 const& box_extend, Edge edge, glm::vec2& new_position);
+		/** continuous test of a moving box against one edge of a tile : the box stops at the limit of ZONE 1/ZONE 2 */
+		static bool SweepEdge(box_corners2 const& particle_corners, box2 const& box, glm::vec2 const& displacement, glm::vec2 const& box_extend, Edge edge, float& time_of_impact);
+		/** get the normal of the contact with an edge */
+		static glm::vec2 GetEdgeNormal(Edge edge);
+
 	public:
 
 		/** the level instance used */
@@ -50,6 +82,17 @@ namespace chaos
 
 		/** the difference of position between src_box and dst_box before any reaction is computed */
 		glm::vec2 delta_position = { 0.0f, 0.0f };
+		/** the maximum number of edges the box can slide along during a RunContinuous(...) */
+		int max_sweep_iterations = 3;
+
+	protected:
+
+		/** call func for all particles colliding a box */
+		void DoRun(box2 const& box, LightweightFunction<void(TileCollisionInfo const& collision_info)> func);
+		/** get the wang tile for a particle (returns false whether the particle cannot collide) */
+		bool GetWangTile(TileCollisionInfo const& collision_info, TiledMap::WangTile& result);
+		/** check whether an edge of a particle can collide */
+		bool IsCollisionEdge(TileCollisionInfo const& collision_info, TiledMap::WangTile const& wangtile, Edge edge) const;
 
 	protected:
 
@@ -139,6 +139,14 @@ namespace chaos
 		/** get the particle layer */
 		ParticleLayerBase const* GetParticleLayer() const { return particle_layer.get(); }
 
+		/** get the streamer of the chunks (nullptr if the layer is not streamed) */
+		TMChunkStreamer* GetChunkStreamer() { return chunk_streamer.get(); }
+		/** get the streamer of the chunks (nullptr if the layer is not streamed) */
+		TMChunkStreamer const* GetChunkStreamer() const { return chunk_streamer.get(); }
+
+		/** get the camera as seen by this layer (the displacement ratio is applied) */
+		obox2 GetLayerCameraOBox() const;
+
 		/** returns the number of objects */
 		size_t GetObjectCount() const;
 		/** returns an object by its index */
@@ -169,6 +177,10 @@ namespace chaos
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** override */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** override */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 	protected:
 
@@ -199,6 +211,11 @@ namespace chaos
 		/** create an object in an object layer */
 		TMObjectFactory GetObjectFactory(TiledMap::TypedObject const * in_typed_object);
 
+		/** create the object of a tile whose gid has a factory */
+		void CreateTileObject(glm::ivec2 const& tile_coord, int gid, box2 const& particle_box, TiledMap::TileInfo const& tile_info, TMObjectFactory const& factory, TMObjectReferenceSolver& reference_solver, TMParticlePopulator& particle_populator);
+		/** create the objects of the tiles of a streamed layer (the chunk streamer only builds particles) */
+		bool CreateStreamedTileObjects(TiledMap::TileLayer const* tile_layer, TMObjectReferenceSolver& reference_solver);
+
 		/** create an object in an object layer */
 		void CreateObjectParticles(TiledMap::GeometricObject const * in_geometric_object, TMObject* object, TMParticlePopulator& particle_populator);
 		/** returns whether a particle should be created for object instance */
@@ -242,6 +259,8 @@ namespace chaos
 		TiledMap::LayerBase const* layer = nullptr;
 		/** the particle layer */
 		shared_ptr<ParticleLayerBase> particle_layer;
+		/** the streamer for STREAMED tile layers */
+		std::unique_ptr<TMChunkStreamer> chunk_streamer;
 		/** the objects */
 		std::vector<shared_ptr<TMObject>> objects;
 
@@ -33,6 +33,9 @@ namespace chaos
 
 	public:
 
+		/** destructor */
+		virtual ~TMLevelInstance();
+
 		/** get the tiled map */
 		TiledMap::Map* GetTiledMap();
 		/** get the tiled map */
@@ -104,6 +107,9 @@ namespace chaos
 			return layer_instance->GetParticleSpawner(std::forward<PARAMS>(params)...);
 		}
 
+		/** get the gid => atlas resolution tables */
+		TMTileAtlasTable const& GetTileAtlasTable() const { return tile_atlas_table; }
+
 		/** get the bounding box for the level (in worls system obviously) */
 		virtual box2 GetBoundingBox() const override;
 
@@ -124,6 +130,10 @@ namespace chaos
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** override */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** override */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 
 
@@ -171,6 +181,14 @@ namespace chaos
 		/** create the main camera components */
 		virtual void CreateCameraComponents(Camera* camera, TMCameraTemplate* camera_template);
 
+		/** build the gid => atlas resolution tables (before any layer instance creation) */
+		virtual bool CreateTileAtlasTable();
+		/** build the particles of a tile layer on the thread pool (just before the layer instance consumes them) */
+		void PrepareTileParticles(TiledMap::TileLayer const* tile_layer);
+		/** build the particles for the non empty tiles of a chunk (any thread, no log) */
+		static bool PrepareTileChunkParticles(TiledMap::TileLayer const* tile_layer, TiledMap::TileLayerChunk const& chunk, TMTileAtlasTable const& tile_atlas_table, std::vector<TMParticle>& particles);
+		/** build the particles for the non empty tiles of a range of a chunk (any thread, no log) */
+		static void DoPrepareTileParticles(TiledMap::TileLayer const* tile_layer, TiledMap::TileLayerChunk const& chunk, std::vector<TiledMap::Tile> const& tiles, size_t begin, size_t end, TMTileAtlasTable const& tile_atlas_table, std::vector<TMParticle>& particles);
 		/** create the layers instances */
 		virtual bool CreateLayerInstances(Game* in_game, TMObjectReferenceSolver &reference_solver);
 		/** create the layers instances */
@@ -202,6 +220,11 @@ namespace chaos
 		/** the layer of reference for displacement */
 		shared_ptr<TMLayerInstance> reference_layer;
 
+		/** the gid => atlas resolution tables */
+		TMTileAtlasTable tile_atlas_table;
+		/** the particles of the chunks of the tile layer being created (one particle per tile with a known gid) */
+		std::unordered_map<TiledMap::TileLayerChunk const*, std::vector<TMParticle>> prepared_tile_particles;
+
 		/** the layers */
 		std::vector<shared_ptr<TMLayerInstance>> layer_instances;
 		/** the previous frame trigger collision */
@@ -40,6 +40,10 @@ namespace chaos
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** override */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** override */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 	protected:
 
@@ -115,6 +119,10 @@ namespace chaos
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** override */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** override */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 	protected:
 
@@ -151,6 +159,10 @@ namespace chaos
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** override */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** override */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 	protected:
 
@@ -190,6 +202,10 @@ namespace chaos
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** override */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** override */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 	protected:
 
@@ -251,6 +267,10 @@ namespace chaos
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** override */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** override */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 	protected:
 
@@ -299,6 +319,10 @@ namespace chaos
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
 		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** override */
+		virtual bool SerializeIntoSnapshot(SnapshotWriter & writer) const override;
+		/** override */
+		virtual bool SerializeFromSnapshot(SnapshotReader & reader) override;
 
 	protected:
 
@@ -3,8 +3,6 @@ namespace chaos
 
 #if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
-	CHAOS_DEFINE_LOG(ParticleLog, "Particle")
-
 	// =====================================
 	// TMParticlePopulator : utility class to generate particles for a layer with a cache
 	// =====================================
@@ -24,6 +22,10 @@ namespace chaos
 		bool Initialize(TMLayerInstance* in_layer_instance);
 		/** insert a new particle */
 		bool AddParticle(char const* bitmap_name, Hotpoint hotpoint, box2 particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid, bool keep_aspect_ratio);
+		/** insert a new particle for an already resolved tile (no name lookup) */
+		bool AddParticle(TMTileAtlasEntry const& tile_entry, Hotpoint hotpoint, box2 particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid, bool keep_aspect_ratio);
+		/** insert a particle built with MakeParticle(...) (its box is used as is for the bounding box, so it must not be rotated) */
+		bool AddParticle(TMParticle const& particle);
 		/** flush remaining particles */
 		bool FlushParticles();
 
@@ -31,14 +33,23 @@ namespace chaos
 		box2 const& GetBoundingBox() const { return bounding_box; }
 		/** get the particle allocation */
 		ParticleAllocationBase* GetParticleAllocation() { return allocation; }
+		/** get the level tables used for the lookups (nullptr if the folder differs) */
+		TMTileAtlasTable const* GetTileAtlasTable() const { return tile_atlas_table; }
 
 		/** copy operator (do not copy cached particles) */
 		TMParticlePopulator& operator = (TMParticlePopulator const& src);
 
+		/** compute the final box of a particle (default size, aspect ratio) */
+		static box2 ComputeParticleBox(AtlasBitmapLayout const& layout, box2 particle_box, int particle_flags, bool keep_aspect_ratio);
+		/** build a particle whose box has been computed (no allocation, can be called from any thread) */
+		static TMParticle MakeParticle(AtlasBitmapInfo const* bitmap_info, AtlasBitmapLayout const& layout, Hotpoint hotpoint, box2 const& particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid);
+
 	protected:
 
 		/** 'copy' the cached particle into the allocation (with type conversion) */
 		bool FlushCachedParticlesToAllocation();
+		/** insert a new particle once the bitmap has been resolved */
+		bool DoAddParticle(AtlasBitmapInfo const* bitmap_info, AtlasBitmapLayout const& layout, Hotpoint hotpoint, box2 particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid, bool keep_aspect_ratio);
 
 	protected:
 
@@ -51,6 +62,8 @@ namespace chaos
 		GPUAtlas const* texture_atlas = nullptr;
 		/** the folder containing the bitmaps */
 		AtlasFolderInfo const* folder_info = nullptr;
+		/** the level gid => atlas tables (only if built upon the same folder) */
+		TMTileAtlasTable const* tile_atlas_table = nullptr;
 
 		/** the allocation for all those particles */
 		ParticleAllocationBase* allocation = nullptr;
@@ -0,0 +1,62 @@
+namespace chaos
+{
+#if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// =====================================
+	// TMTileAtlasEntry : the resolved atlas information for a gid
+	// =====================================
+
+	class CHAOS_API TMTileAtlasEntry
+	{
+	public:
+
+		/** the tile information (tileset, tiledata) */
+		TiledMap::TileInfo tile_info;
+		/** the bitmap in the atlas (nullptr if the atlas_key is unknown) */
+		AtlasBitmapInfo const* bitmap_info = nullptr;
+		/** the layout of the bitmap, animation removed (frame 0) */
+		AtlasBitmapLayout layout;
+	};
+
+	// =====================================
+	// TMTileAtlasTable : dense gid => atlas tables built once for all tilesets of a map
+	// =====================================
+
+	// XXX : building a tile layer requires, for each tile, a gid => TileData => atlas_key => AtlasBitmapInfo resolution
+	//       doing that with string comparisons on every tile is far too costly for large layers
+	//       the resolution is done once per tile of each tileset and stored into a table indexed by gid
+
+	class CHAOS_API TMTileAtlasTable
+	{
+	public:
+
+		/** build the tables (in_folder_info may be null : no bitmap is resolved then) */
+		bool Initialize(TiledMap::Map const* in_tiled_map, AtlasFolderInfo const* in_folder_info);
+		/** clear the tables */
+		void Clear();
+
+		/** get the entry for a gid (nullptr if the gid is unknown) */
+		TMTileAtlasEntry const* FindEntry(int gid) const;
+		/** get the tile information for a gid */
+		TiledMap::TileInfo FindTileInfo(int gid) const;
+		/** search a bitmap in the folder by its name (case insensitive) */
+		AtlasBitmapInfo const* FindBitmapInfo(char const* bitmap_name) const;
+
+		/** get the folder used to build the tables */
+		AtlasFolderInfo const* GetFolderInfo() const { return folder_info; }
+
+	protected:
+
+		/** the folder used to build the tables */
+		AtlasFolderInfo const* folder_info = nullptr;
+		/** the smallest gid in the table */
+		int min_gid = 0;
+		/** the entries indexed by (gid - min_gid) */
+		std::vector<TMTileAtlasEntry> entries;
+		/** the bitmaps of the folder indexed by their lower case name */
+		std::unordered_map<std::string, AtlasBitmapInfo const*> bitmap_index;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
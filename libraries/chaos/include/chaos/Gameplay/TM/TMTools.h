@@ -27,6 +27,40 @@ namespace chaos
 			}
 		}
 
+		/** serialize layers into a snapshot */
+		template<typename U>
+		bool SerializeLayersIntoSnapshot(U const& layer_instances, SnapshotWriter& writer)
+		{
+			writer.Write(uint32_t(layer_instances.size()));
+			for (auto const& layer : layer_instances)
+			{
+				writer.Write(layer->GetLayerID());
+				if (!writer.WriteObject(MakeSnapshotTag("LAYR"), *layer))
+					return false;
+			}
+			return true;
+		}
+
+		/** serialize layers from a snapshot */
+		template<typename T>
+		bool SerializeLayersFromSnapshot(T* object, SnapshotReader& reader)
+		{
+			uint32_t count = 0;
+			if (!reader.Read(count))
+				return false;
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				int layer_id = 0;
+				if (!reader.Read(layer_id))
+					return false;
+				if (TMLayerInstance* layer_instance = object->FindLayerInstanceByID(layer_id))
+					reader.ReadObject(MakeSnapshotTag("LAYR"), *layer_instance);
+				else
+					reader.SkipChunk(MakeSnapshotTag("LAYR"));
+			}
+			return !reader.HasError();
+		}
+
 		/** search a layer inside an object by ID */
 		template<typename T, typename U>
 		auto FindLayerInstanceByID(T* object, U& layer_instances, int in_id, bool recursive) -> decltype(layer_instances[0].get())
@@ -23,4 +23,5 @@
 #include "chaos/ImGuiCore/ImGuiLogObject.h"
 #include "chaos/ImGuiCore/ImGuiManager.h"
 #include "chaos/ImGuiCore/ImGuiRenderingStatsObject.h"
+#include "chaos/ImGuiCore/ImGuiProfilerObject.h"
 #include "chaos/ImGuiCore/ImGuiImPlotDemoObject.h"
\ No newline at end of file
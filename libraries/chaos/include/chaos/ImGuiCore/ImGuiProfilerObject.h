@@ -0,0 +1,37 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ImGuiProfilerObject;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* ImGuiProfilerObject: display the zones recorded by the Profiler as a flame graph
+	*/
+
+	class ImGuiProfilerObject : public ImGuiObject
+	{
+	public:
+
+		CHAOS_DECLARE_OBJECT_CLASS(ImGuiProfilerObject, ImGuiObject);
+
+	protected:
+
+		/** override */
+		virtual void OnDrawImGuiContent(Window* window) override;
+
+		/** draw the zones of a track (returns the height of the track) */
+		float DrawTrack(char const* title, std::vector<ProfilerZone> const& zones, double start_time, double duration, ImVec2 const& position, float width);
+		/** export the recorded frames */
+		void ExportChromeTrace();
+
+	protected:
+
+		/** the index of the displayed frame in the history (-1 for the latest) */
+		int selected_frame = -1;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -27,6 +27,33 @@ namespace chaos
 			return Filter((glm::vec4)c);
 		}
 
+		/** filter a whole row of colors (results[i] is 1 for kept colors, 0 otherwise) */
+		void FilterRow(glm::vec4 const* colors, size_t count, unsigned char* results) const;
+
+		/** filter a whole row of pixels (results[i] is 1 for kept pixels, 0 otherwise) */
+		template<typename T>
+		void FilterRow(T const* pixels, size_t count, unsigned char* results) const
+		{
+			// convert the pixels by small batches so that the filtering itself works on contiguous colors
+			glm::vec4 colors[FILTER_BATCH_SIZE];
+			for (size_t start = 0; start < count; start += FILTER_BATCH_SIZE)
+			{
+				size_t batch_count = std::min(FILTER_BATCH_SIZE, count - start);
+				for (size_t i = 0; i < batch_count; ++i)
+				{
+					PixelRGBAFloat c;
+					PixelConverter::Convert(c, pixels[start + i]);
+					colors[i] = (glm::vec4)c;
+				}
+				FilterRow(colors, batch_count, results + start);
+			}
+		}
+
+	protected:
+
+		/** the number of colors converted at once by FilterRow(...) */
+		static constexpr size_t FILTER_BATCH_SIZE = 256;
+
 	public:
 
 		/** distance to reference color */
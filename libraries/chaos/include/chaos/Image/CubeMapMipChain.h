@@ -0,0 +1,99 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class CubeMapMipLevel;
+	class CubeMapMipChain;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// XXX : faces are stored in OpenGL order (CubeMapFaceType) and their rows from bottom to top (as FreeImage does)
+	//       so that a face can be uploaded as is and that sampling a direction gives the same texel than the GPU would
+	//
+	// XXX : sampling is bilinear inside a face. Texels at the border of a face are clamped (there is no filtering across faces)
+	//
+	// XXX : the GGX filtering uses the split sum approximation (N = V = R). Level i is filtered with a roughness of i / (level_count - 1)
+	//       samples are taken on a box downsampled version of the source, at a lod that depends on the solid angle of each sample
+	//       (filtered importance sampling) so that few samples are enough
+
+	/**
+	* CubeMapMipLevel : the 6 faces of one level of a mip chain (RGBA float)
+	*/
+
+	class CHAOS_API CubeMapMipLevel
+	{
+	public:
+
+		/** get the description of a face */
+		ImageDescription GetFaceDescription(CubeMapFaceType face) const;
+		/** get the color of a texel */
+		glm::vec4 const& GetTexel(CubeMapFaceType face, int x, int y) const { return faces[size_t(face)][size_t(x) + size_t(y) * size_t(size)]; }
+		/** bilinear sampling in a given direction */
+		glm::vec4 Sample(glm::vec3 const& direction) const;
+
+	public:
+
+		/** the size of the faces */
+		int size = 0;
+		/** the pixels of each face */
+		std::array<std::vector<glm::vec4>, 6> faces;
+	};
+
+	/**
+	* CubeMapMipChain : a cubemap with all its prefiltered levels. Can be saved and loaded as a single file
+	*/
+
+	class CHAOS_API CubeMapMipChain
+	{
+	public:
+
+		/** remove all levels */
+		void Release();
+		/** whether there is no level */
+		bool IsEmpty() const { return levels.size() == 0; }
+
+		/** get the number of levels */
+		int GetLevelCount() const { return int(levels.size()); }
+		/** get the size of the faces for a level */
+		int GetCubeMapSize(int level = 0) const;
+		/** get a level */
+		CubeMapMipLevel const& GetLevel(int level) const { return levels[size_t(level)]; }
+		/** get the description of a face */
+		ImageDescription GetFaceDescription(int level, CubeMapFaceType face) const;
+
+		/** bilinear sampling of a level in a given direction */
+		glm::vec4 Sample(glm::vec3 const& direction, int level = 0) const;
+
+		/** initialize the first level from a cubemap (single or multiple images) */
+		bool InitializeFromCubeMap(CubeMapImages const& cubemap);
+		/** initialize the first level from an equirectangular (latitude/longitude) image */
+		bool InitializeFromEquirectangular(ImageDescription const& image_description, int size);
+
+		/** replace the levels after the first one with GGX prefiltered levels (0 for a complete chain) */
+		bool GenerateGGXMipChain(int level_count = 0, int sample_count = 64);
+
+		/** get a level as 6 images */
+		CubeMapImages ToCubeMapImages(int level, PixelFormat pixel_format) const;
+		/** get a level as an equirectangular image */
+		FIBITMAP* ToEquirectangular(int level, int width, int height, PixelFormat pixel_format) const;
+
+		/** save the whole chain into a file */
+		bool SaveToFile(FilePathParam const& path) const;
+		/** load a whole chain from a file */
+		bool LoadFromFile(FilePathParam const& path);
+		/** load a whole chain from a buffer */
+		bool LoadFromBuffer(char const* data, size_t size);
+		/** whether a buffer contains a mip chain */
+		static bool IsMipChainBuffer(char const* data, size_t size);
+		/** get the number of levels of a complete chain (down to 1x1) */
+		static int GetMaxLevelCount(int size);
+
+	protected:
+
+		/** the levels (the first one is the source) */
+		std::vector<CubeMapMipLevel> levels;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -174,6 +174,8 @@ namespace chaos
 	* CubeMapTools : deserve to load cubemap files
 	*/
 
+	// XXX : equirectangular images are centered on -Z (OpenGL forward), with +Y up. The left border is +Z (longitude -PI)
+
 	class CHAOS_API CubeMapTools
 	{
 	public:
@@ -183,6 +185,23 @@ namespace chaos
 		/** load a cubemap from a multiple files */
 		static CubeMapImages LoadMultipleCubeMap(FilePathParam const& left_image, FilePathParam const& right_image, FilePathParam const& top_image, FilePathParam const& bottom_image, FilePathParam const& front_image, FilePathParam const& back_image);
 
+		/** convert an equirectangular (latitude/longitude) image into a six images cubemap */
+		static CubeMapImages EquirectangularToCubeMap(FIBITMAP* image, int size);
+		/** convert a cubemap into an equirectangular (latitude/longitude) image */
+		static FIBITMAP* CubeMapToEquirectangular(CubeMapImages const& cubemap, int width, int height);
+
+		/** get the OpenGL face an image is uploaded into */
+		static CubeMapFaceType GetCubeMapFaceType(CubeMapImageType image_type);
+		/** get the direction for a position on a face (texture coordinates in [0, 1], as OpenGL does) */
+		static glm::vec3 GetFaceDirection(CubeMapFaceType face, glm::vec2 const& texcoord);
+		/** get the face and the texture coordinates (in [0, 1]) for a direction */
+		static CubeMapFaceType GetDirectionFace(glm::vec3 const& direction, glm::vec2& texcoord);
+
+		/** get the direction for a position in an equirectangular image (texture coordinates in [0, 1], Y from bottom to top) */
+		static glm::vec3 GetEquirectangularDirection(glm::vec2 const& texcoord);
+		/** get the position in an equirectangular image for a direction */
+		static glm::vec2 GetEquirectangularTexcoord(glm::vec3 const& direction);
+
 	protected:
 
 		/** utility function to load a file into one image. Incrementaly test for compatibility with previsous image */
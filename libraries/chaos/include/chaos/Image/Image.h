@@ -8,7 +8,11 @@
 #include "chaos/Image/ImageAnimationDescription.h"
 #include "chaos/Image/ImagePointer.h"
 #include "chaos/Image/ImageTools.h"
+#include "chaos/Image/ImageFilterTools.h"
 #include "chaos/Image/ImageProcessor.h"
 #include "chaos/Image/ImageProcessorAddAlpha.h"
 #include "chaos/Image/ImageProcessorOutline.h"
-#include "chaos/Image/CubeMapTools.h"
\ No newline at end of file
+#include "chaos/Image/ImageProcessorBlur.h"
+#include "chaos/Image/ImageProcessorShadow.h"
+#include "chaos/Image/CubeMapTools.h"
+#include "chaos/Image/CubeMapMipChain.h"
\ No newline at end of file
@@ -0,0 +1,72 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	enum class BlurKernelType;
+
+	class ImageFilterTools;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	 * BlurKernelType : the weights of a blur kernel
+	 */
+
+	enum class BlurKernelType : int
+	{
+		Box,
+		Gaussian
+	};
+
+	CHAOS_DECLARE_ENUM_METHOD(BlurKernelType, CHAOS_API);
+
+	/**
+	 * ImageFilterTools : separable kernels working on float images
+	 */
+
+	// XXX : the working images are arrays of floats (channel_count floats per pixel, rows are contiguous, no padding)
+	//
+	//       - the horizontal pass copies each row into a zero padded array so that each weight is applied with a single contiguous loop
+	//       - the vertical pass accumulates whole rows
+	//
+	//       there is no intrinsic: the inner loops are plain multiply/add over contiguous floats that the compiler vectorizes.
+	//       rows are processed in parallel on the default ThreadPool
+
+	class CHAOS_API ImageFilterTools
+	{
+	public:
+
+		/** the number of rows processed by a single task */
+		static constexpr int ROW_BATCH = 16;
+
+		/** get a normalized kernel of (2 * radius + 1) weights */
+		static std::vector<float> GetBlurKernel(BlurKernelType kernel_type, int radius);
+		/** apply a separable kernel horizontally then vertically (pixels outside the image are 0) */
+		static bool SeparableConvolution(float* pixels, int width, int height, int channel_count, std::vector<float> const& kernel);
+
+		/** copy an image into a RGBA float buffer at a given position (the buffer is expected to be initialized) */
+		static void CopyToRGBAFloat(ImageDescription const& src_desc, glm::vec4* dst, int dst_width, int dst_height, int dst_x, int dst_y);
+		/** create an image from a RGBA float buffer */
+		static FIBITMAP* GenFreeImageFromRGBAFloat(glm::vec4 const* src, int width, int height, PixelFormat pixel_format);
+
+		/** premultiply the colors by their alpha */
+		static void PremultiplyAlpha(glm::vec4* pixels, size_t count);
+		/** divide the colors by their alpha (transparent pixels become black) */
+		static void UnpremultiplyAlpha(glm::vec4* pixels, size_t count);
+
+		/** call func(start_y, end_y) for bands of rows in parallel */
+		template<typename FUNC>
+		static void ParallelForRows(int height, FUNC const& func)
+		{
+			size_t band_count = size_t((height + ROW_BATCH - 1) / ROW_BATCH);
+			ThreadPool::GetDefaultInstance()->ParallelFor(band_count, [height, &func](size_t index)
+			{
+				int start_y = int(index) * ROW_BATCH;
+				func(start_y, std::min(start_y + ROW_BATCH, height));
+			});
+		}
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -0,0 +1,39 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ImageProcessorBlur;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* ImageProcessorBlur : blur an image with a separable box or gaussian kernel
+	*/
+
+	class CHAOS_API ImageProcessorBlur : public ImageProcessor
+	{
+		CHAOS_DECLARE_OBJECT_CLASS(ImageProcessorBlur, ImageProcessor);
+
+	public:
+
+		/** the image processing method to override */
+		virtual FIBITMAP* ProcessImage(ImageDescription const& src_desc) const override;
+
+		/** the processor may save its configuration into a JSON file */
+		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** the processor may save its configuration from a JSON file */
+		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
+
+	public:
+
+		/** the weights of the kernel */
+		BlurKernelType kernel_type = BlurKernelType::Gaussian;
+		/** the radius of the kernel */
+		int radius = 2;
+		/** whether the image is grown by the radius so that the blur is not clipped */
+		bool expand = true;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
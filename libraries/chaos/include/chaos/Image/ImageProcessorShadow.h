@@ -0,0 +1,71 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ImageProcessorShadow;
+	class ImageProcessorGlow;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* ImageProcessorShadow : put a blurred and colored copy of the image under it
+	*/
+
+	// XXX : the mask is the alpha of the pixels accepted by the color filter. The result is always BGRA and is grown
+	//       on each side by (radius + |offset|) so that the shadow is not clipped
+
+	class CHAOS_API ImageProcessorShadow : public ImageProcessor
+	{
+		CHAOS_DECLARE_OBJECT_CLASS(ImageProcessorShadow, ImageProcessor);
+
+	public:
+
+		/** the image processing method to override */
+		virtual FIBITMAP* ProcessImage(ImageDescription const& src_desc) const override;
+
+		/** the processor may save its configuration into a JSON file */
+		virtual bool SerializeIntoJSON(nlohmann::json * json) const override;
+		/** the processor may save its configuration from a JSON file */
+		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
+
+	protected:
+
+		/** generate the blurred mask and compose it with the source (under the source or added to it) */
+		FIBITMAP* DoProcessShadow(ImageDescription const& src_desc, bool additive) const;
+
+	public:
+
+		/** the weights of the kernel */
+		BlurKernelType kernel_type = BlurKernelType::Gaussian;
+		/** the radius of the kernel */
+		int radius = 4;
+		/** the offset of the shadow in pixels (y goes up) */
+		glm::ivec2 offset = { 2, -2 };
+		/** filter to check pixel that cast a shadow */
+		ColorFilter color_filter;
+		/** the shadow color */
+		glm::vec4 color = { 0.0f, 0.0f, 0.0f, 1.0f };
+		/** a factor applied to the blurred mask */
+		float intensity = 1.0f;
+	};
+
+	/**
+	* ImageProcessorGlow : add a blurred and colored copy of the image to it
+	*/
+
+	class CHAOS_API ImageProcessorGlow : public ImageProcessorShadow
+	{
+		CHAOS_DECLARE_OBJECT_CLASS(ImageProcessorGlow, ImageProcessorShadow);
+
+	public:
+
+		/** constructor */
+		ImageProcessorGlow();
+
+		/** the image processing method to override */
+		virtual FIBITMAP* ProcessImage(ImageDescription const& src_desc) const override;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
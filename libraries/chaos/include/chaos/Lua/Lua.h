@@ -1,3 +1,3 @@
-#include "chaos/Lua/LuaBinding.h"
 #include "chaos/Lua/LuaTools.h"
 #include "chaos/Lua/LuaState.h"
+#include "chaos/Lua/LuaBinding.h"
\ No newline at end of file
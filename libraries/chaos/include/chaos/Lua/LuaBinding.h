@@ -1,6 +1,17 @@
 namespace chaos
 {
-#if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	template<typename FUNC>
+	class LuaFunctionTraits;
+
+	class LuaObjectUserData;
+	class LuaBinding;
+
+	template<typename T>
+	class LuaClassBinding;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
 	// ===================
 	// Notes on LuaBinding
@@ -82,139 +93,286 @@ namespace chaos
 	//       TOMT[ Unique<T>() ]
 	//
 	//
+	//	// Implementation
+	// --------------
 	//
+	//   - the unique ID of a class is its chaos::Class (see ClassManager). It is used as a LIGHTUSERDATA key in the TOMT
 	//
-	// Argument testing and inheritance:
-	// --------------------------------
-	//
-	// Take a class hierarchy chain :
-	//
-	//   class A : public B {};
-	//
-	// In a function that require an argument of type B, an argument of type A is good as well
-	//
-	// So, if we consider a binding functions:
-	//
-	//  int MyFuncBinding(lua_State * state)
-	//  {
-	//    arg_mt      = lua_getmetatable(index = -1);
-	//
-	//    expected_mt = TOMT[ Unique<B>() ]
-	//
-	//    ...
-	//  }
-	//
-	// => we cannot test    (arg_mt == expected_mt)      because if argument is an instance of A, this should work too
-	//
+	//   - the MT of a class is created the first time it is required and kept in the TOMT (no string lookup afterward)
 	//
-	// SOLUTION :
-	// --------
+	//       MT.__index        = MT           (the methods are stored in the MT itself)
+	//       MT.__gc           = release the reference on the object
+	//       MT[CLASS_KEY]     = Class*       (a LIGHTUSERDATA to know the class of an argument)
+	//       metatable(MT)     = MT of the parent class (inherited methods are found by lua itself)
 	//
-	//   - the unique key ID by class is given by the ANYOBJECT singleton address method
+	//   - an object is a USERDATA that holds a shared_ptr<Object> (a LIGHTUSERDATA can not have its own MT)
+	//     the USERDATA are kept in a weak table indexed by a LIGHTUSERDATA (the address of the object) so that an object pushed
+	//     several times (each frame for an update script) reuses the same USERDATA without allocation
 	//
-	//   - ANYOBJECT could be any types (even integers, as soon as its address is unique)
+	//   - argument testing is an interval test: Class::InheritsFrom(...)
 	//
-	//   - we defines ANYOBJECT has    std::pair<void *, void *>
+	//   - the binding functions are generated with the address of the C++ function as a template parameter:
 	//
-	//   - ID->first  == ID     (explained later => obsolete choice ?)
+	//       binding.AddFunction<&MyFunction>("MyFunction");
+	//       binding.AddClass<MyClass>("MyClass").AddMethod<&MyClass::Method>("Method");
 	//
-	//   - ID->second == PARENT_ID
-	//
-	//   As soon as we have an ID, this is an address that give us access to PARENT_ID and so on ...
-	//   We can now know if two ID's comes from an inheritance chain.
-	//
-	//        obsolete XXX : why  ID.first == &ID ???
-	//
-	//              => because if we make the call
-	//
-	//                   std::pair<void *, void *> copy_of_ID = UniqueID<A>()
-	//
-	//                 the address of ID is not relevant because it is a local copy of the singleton ID. that why we store the address
-	//                 of the singleton inside ID.first. We can now make any test we want
-	//
-	//  - when we call    arg_mt = lua_getmetatable(index = -1);
-	//
-	//    we get the MT of the ARGUMENT, not its ID
-	//
-	//    we can simply store the ID inside the MT with  lua_rawset/lua_rawget methods (...)
-	//
-	//
-	//
-	// XXX : while ANYOBJECT is a pointer, we can simply use it as a LIGHTUSERDATA. Indexation in a table becomes simple
+	//     each binding is a plain lua_CFunction (no upvalue, no closure)
 	//
+	// XXX : lua errors (bad arguments) are raised with longjmp (if lua is compiled as C). C++ destructors of the binding frame would be skipped
+	//       that's why arguments are decoded into types without destructor (prefer char const* and std::string_view to std::string)
+
+	/**
+	* LuaFunctionTraits : decomposition of a function/method type
+	*/
 
-#if 0
+	template<typename RET, typename ...PARAMS>
+	class LuaFunctionTraits<RET(*)(PARAMS...)>
+	{
+	public:
 
-		/**
-		* LuaBinding a class to help generate binding between C++ and LUA
-		*/
+		using result_type = RET;
+		using class_type = void;
+		using argument_types = std::tuple<std::remove_cvref_t<PARAMS>...>;
+	};
 
-class LuaBinding : public LuaState
-{
+	template<typename T, typename RET, typename ...PARAMS>
+	class LuaFunctionTraits<RET(T::*)(PARAMS...)>
+	{
+	public:
 
-protected:
+		using result_type = RET;
+		using class_type = T;
+		using argument_types = std::tuple<std::remove_cvref_t<PARAMS>...>;
+	};
 
-	/** constant string of indexing the REGISTRY */
-	static char const* TOMT_KEY;
-	/** constant string of indexing the MT */
-	static char const* ID_KEY;
+	template<typename T, typename RET, typename ...PARAMS>
+	class LuaFunctionTraits<RET(T::*)(PARAMS...) const>
+	{
+	public:
 
-public:
+		using result_type = RET;
+		using class_type = T;
+		using argument_types = std::tuple<std::remove_cvref_t<PARAMS>...>;
+	};
 
-	/** initialization constructor */
-	LuaBinding(lua_State* in_state) : LuaState(in_state) { assert(in_state != nullptr); }
-	/** copy constructor */
-	LuaBinding(LuaBinding const& other) : LuaState(other.state) {}
+	/**
+	* LuaObjectUserData : the content of the USERDATA for an object
+	*/
 
-	/** create the binding for a given function and register it into the table with given index */
-	template<typename RET>
-	void AddFunction(char const* name, RET(*func)(), int index = 0)
+	class CHAOS_API LuaObjectUserData
 	{
-		lua_pushstring(state, name);
-		lua_pushcfunction(state, FunctionBinding(func));
-		lua_settable(state, index);
-	}
-
+	public:
 
+		/** the object */
+		shared_ptr<Object> object;
+	};
 
+	/**
+	* LuaBinding : a class to help generate binding between C++ and LUA
+	*/
 
-	/*
-	template<typename BASE, typename PARENT>
-	ClassBinding AddClass(char const * name, int index)
+	class CHAOS_API LuaBinding : public LuaState
 	{
+	public:
 
-	}
-	*/
+		/** initialization constructor */
+		LuaBinding(lua_State* in_state) : LuaState(in_state) { assert(in_state != nullptr); }
 
+		/** create the binding for a function and register it into the table at given index (0 for global) */
+		template<auto FUNC>
+		void AddFunction(char const* name, int index = 0)
+		{
+			assert(name != nullptr);
+			if (index == 0)
+			{
+				lua_pushcfunction(state, &FunctionBinding<FUNC>);
+				lua_setglobal(state, name);
+			}
+			else
+			{
+				index = lua_absindex(state, index);
+				lua_pushcfunction(state, &FunctionBinding<FUNC>);
+				lua_setfield(state, index, name);
+			}
+		}
 
+		/** create the MT for a class, register it as a global (if name is not null) and get an object to bind its methods */
+		template<typename T>
+		LuaClassBinding<T> AddClass(char const* name = nullptr)
+		{
+			Class const* cls = ClassManager::GetDefaultInstance()->FindCPPClass<T>();
+			assert(cls != nullptr); // the class must be registered in the ClassManager
+			if (name != nullptr)
+				RegisterClassGlobal(state, cls, name);
+			return LuaClassBinding<T>(state);
+		}
 
+		/** push an object (nil for nullptr) */
+		static void PushObject(lua_State* state, Object const* object);
+		/** get the object at given index if it inherits from required_class (nullptr otherwise) */
+		static Object* ToObject(lua_State* state, int index, Class const* required_class);
 
-protected:
+		/** get an object argument (raise a lua error if the argument is neither nil nor an instance of T) */
+		template<typename T>
+		static T* CheckObject(lua_State* state, int index)
+		{
+			if (lua_isnoneornil(state, index))
+				return nullptr;
+			// XXX : a null class would accept any object of the binding (and the static_cast would be wrong)
+			Class const* cls = ClassManager::GetDefaultInstance()->FindCPPClass<T>();
+			assert(cls != nullptr); // the class must be registered in the ClassManager
+			if (cls == nullptr)
+				luaL_error(state, "unregistered class for argument %d", index);
+			Object* object = ToObject(state, index, cls);
+			if (object == nullptr)
+				luaL_argerror(state, index, "wrong object type");
+			return static_cast<T*>(object);
+		}
 
-	/** generate a binding function */
-	template<typename RET>
-	lua_CFunction FunctionBinding(RET(*func)())
-	{
+		/** push a C++ value */
+		template<typename T>
+		static void PushValue(lua_State* state, T const& value)
+		{
+			if constexpr (std::is_same_v<T, bool>)
+				lua_pushboolean(state, value ? 1 : 0);
+			else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+				lua_pushinteger(state, lua_Integer(value));
+			else if constexpr (std::is_floating_point_v<T>)
+				lua_pushnumber(state, lua_Number(value));
+			else if constexpr (std::is_same_v<T, char const*> || std::is_same_v<T, char*>)
+				lua_pushstring(state, value);
+			else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+				lua_pushlstring(state, value.data(), value.size());
+			else if constexpr (std::is_pointer_v<T> && std::is_base_of_v<Object, std::remove_cv_t<std::remove_pointer_t<T>>>)
+				PushObject(state, value);
+			else if constexpr (requires(T const& v) { v.get(); })
+				PushObject(state, value.get()); // shared_ptr and weak_ptr (on objects)
+			else
+				static_assert(!sizeof(T), "LuaBinding::PushValue(...): unsupported type");
+		}
 
-		return nullptr;
-	}
+		/** get a C++ value from an argument (raise a lua error if the type is wrong) */
+		template<typename T>
+		static T CheckValue(lua_State* state, int index)
+		{
+			if constexpr (std::is_same_v<T, bool>)
+				return (lua_toboolean(state, index) != 0);
+			else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+				return T(luaL_checkinteger(state, index));
+			else if constexpr (std::is_floating_point_v<T>)
+				return T(luaL_checknumber(state, index));
+			else if constexpr (std::is_same_v<T, char const*>)
+				return luaL_checkstring(state, index);
+			else if constexpr (std::is_same_v<T, std::string_view>) // not std::string : its destructor would be skipped by a later lua error
+			{
+				size_t len = 0;
+				char const* str = luaL_checklstring(state, index, &len);
+				return T(str, len);
+			}
+			else if constexpr (std::is_pointer_v<T> && std::is_base_of_v<Object, std::remove_cv_t<std::remove_pointer_t<T>>>)
+				return CheckObject<std::remove_cv_t<std::remove_pointer_t<T>>>(state, index);
+			else
+				static_assert(!sizeof(T), "LuaBinding::CheckValue(...): unsupported type");
+		}
 
-protected:
+		/** the lua_CFunction generated for a function or a method (the object is the first argument) */
+		template<auto FUNC>
+		static int FunctionBinding(lua_State* state)
+		{
+			using traits = LuaFunctionTraits<decltype(FUNC)>;
+			return InvokeFunction<FUNC>(state, std::make_index_sequence<std::tuple_size_v<typename traits::argument_types>>());
+		}
 
-	/** create (if necessary) and get (result on the stack) the TOMT */
-	void GetTOMT();
-	/** create an empty MT and register it in the TOMT that is on the stack (result is put on the stack */
-	void CreateEmptyMT(InheritanceIntrospection::ClassRuntimeID ID, int tomt_index);
-	/** get the MT from a ClassID : result put on the stack */
-	void GetMT(InheritanceIntrospection::ClassRuntimeID ID);
-	/** return the ClassID of a MT on the stack */
-	InheritanceIntrospection::ClassRuntimeID GetClassRuntimeIDFromMT(int mt_index);
-	/** return the ClassID of a user data on the stack */
-	InheritanceIntrospection::ClassRuntimeID GetClassRuntimeID(int index);
-};
+	protected:
 
-#endif
+		/** decode the arguments, call the function and push the result */
+		template<auto FUNC, size_t ...INDICES>
+		static int InvokeFunction(lua_State* state, std::index_sequence<INDICES...>)
+		{
+			using traits = LuaFunctionTraits<decltype(FUNC)>;
+			using class_type = typename traits::class_type;
+			using result_type = typename traits::result_type;
+			using argument_types = typename traits::argument_types;
+
+			if constexpr (std::is_void_v<class_type>)
+			{
+				if constexpr (std::is_void_v<result_type>)
+				{
+					FUNC(CheckValue<std::tuple_element_t<INDICES, argument_types>>(state, int(INDICES) + 1)...);
+					return 0;
+				}
+				else
+				{
+					PushValue<std::remove_cvref_t<result_type>>(state, FUNC(CheckValue<std::tuple_element_t<INDICES, argument_types>>(state, int(INDICES) + 1)...));
+					return 1;
+				}
+			}
+			else
+			{
+				class_type* self = CheckObject<class_type>(state, 1);
+				if (self == nullptr)
+					luaL_argerror(state, 1, "object expected");
+
+				if constexpr (std::is_void_v<result_type>)
+				{
+					(self->*FUNC)(CheckValue<std::tuple_element_t<INDICES, argument_types>>(state, int(INDICES) + 2)...);
+					return 0;
+				}
+				else
+				{
+					PushValue<std::remove_cvref_t<result_type>>(state, (self->*FUNC)(CheckValue<std::tuple_element_t<INDICES, argument_types>>(state, int(INDICES) + 2)...));
+					return 1;
+				}
+			}
+		}
+
+	public:
+
+		/** push the MT of a class (created if necessary) */
+		static void PushClassMetatable(lua_State* state, Class const* cls);
+
+	protected:
+
+		/** set the MT of the class as a global (with a New function if the class can be instanciated) */
+		static void RegisterClassGlobal(lua_State* state, Class const* cls, char const* name);
+		/** push a table stored in the registry (created if necessary) */
+		static void PushRegistryTable(lua_State* state, void const* key, char const* mode);
+
+		/** the __gc function of the objects */
+		static int ObjectGCFunction(lua_State* state);
+		/** the New function of the classes (the class is an upvalue) */
+		static int ObjectNewFunction(lua_State* state);
+	};
+
+	/**
+	* LuaClassBinding : register the methods of a class
+	*/
+
+	template<typename T>
+	class LuaClassBinding
+	{
+	public:
+
+		/** constructor */
+		LuaClassBinding(lua_State* in_state) : state(in_state) {}
+
+		/** create the binding for a method (or a function whose first argument is the object) */
+		template<auto FUNC>
+		LuaClassBinding& AddMethod(char const* name)
+		{
+			assert(name != nullptr);
+			LuaBinding::PushClassMetatable(state, ClassManager::GetDefaultInstance()->FindCPPClass<T>());
+			lua_pushcfunction(state, &LuaBinding::FunctionBinding<FUNC>);
+			lua_setfield(state, -2, name);
+			lua_pop(state, 1);
+			return *this;
+		}
+
+	protected:
 
+		/** the lua state */
+		lua_State* state = nullptr;
+	};
 
 #endif
 
@@ -265,7 +265,7 @@ namespace chaos
 			return src;
 		}
 
-		/** a function to reset rand() function */
+		/** a function to reset rand() function (uses the seed of the InputRecorder while recording or replaying) */
 		CHAOS_API void ResetRandSeed();
 
 		/** returns a random float between [0..1] */
@@ -14,9 +14,9 @@ namespace chaos
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
 	/**
-	* MidiChunk : this is a chunk of memory that contains MIDI data
+	* MidiChunk : this is a chunk of memory that contains MIDI data (a view inside the loaded buffer)
 	*/
-	class CHAOS_API MidiChunk : public Buffer<char>
+	class CHAOS_API MidiChunk
 	{
 	public:
 
@@ -30,6 +30,8 @@ namespace chaos
 	public:
 		/** the name for the chunk */
 		char chunk_name[5] = { 0, 0, 0, 0, 0 };
+		/** the content of the chunk */
+		BufferReader content;
 	};
 
 	/**
@@ -51,6 +53,8 @@ namespace chaos
 
 		/** the signature of the event */
 		unsigned char signature = 0;
+		/** the time since the previous event (in ticks) */
+		uint32_t delta_time = 0;
 	};
 
 	/**
@@ -65,6 +69,11 @@ namespace chaos
 		MidiSystemExclusiveEvent(unsigned char in_signature) : MidiEvent(in_signature) {}
 
 		virtual bool InitializeEventFromChunk(BufferReader& reader) override;
+
+	public:
+
+		/** the content of the message (a view inside the loaded buffer) */
+		BufferReader data;
 	};
 
 	/**
@@ -79,8 +88,19 @@ namespace chaos
 		MidiMetaEvent(unsigned char in_signature) : MidiEvent(in_signature) {}
 
 		virtual bool InitializeEventFromChunk(BufferReader& reader) override;
+
+	public:
+
+		/** the type of the meta event */
+		unsigned char meta_type = 0;
+		/** the content of the event (a view inside the loaded buffer) */
+		BufferReader data;
 	};
 
+	/**
+	* MidiCommandEvent : an event in MIDI file
+	*/
+
 	class CHAOS_API MidiCommandEvent : public MidiEvent
 	{
 	public:
@@ -89,6 +109,11 @@ namespace chaos
 		MidiCommandEvent(unsigned char in_signature) : MidiEvent(in_signature) {}
 
 		virtual bool InitializeEventFromChunk(BufferReader& reader) override;
+
+	public:
+
+		/** the command */
+		MIDICommand command;
 	};
 
 	/**
@@ -144,8 +169,18 @@ namespace chaos
 		/** destructor */
 		virtual ~MidiLoader() = default;
 
-		/** the entry point for reading a MIDI file */
-		bool LoadBuffer(Buffer<char> const& buffer);
+		/** the entry point for reading a MIDI file (the buffer is kept alive by the loader) */
+		bool LoadBuffer(Buffer<char> const& in_buffer);
+		/** read a MIDI file (the file is memory mapped) */
+		bool LoadFile(FilePathParam const& path);
+
+		/** get the header */
+		MidiHeader const& GetHeader() const { return header; }
+		/** get the tracks */
+		std::vector<std::unique_ptr<MidiTrack>> const& GetTracks() const { return tracks; }
+
+		/** read a variable length quantity in stream */
+		static bool ReadVariableLength(BufferReader& reader, uint32_t& result);
 
 	protected:
 
@@ -155,13 +190,9 @@ namespace chaos
 		bool DoLoadBuffer(BufferReader& reader);
 
 		/** read a sub chunk of data */
-		MidiChunk const ReadChunk(BufferReader& reader);
-		/** read the header chunk */
-		MidiChunk const ReadHeaderChunk(BufferReader& reader);
+		bool ReadChunk(BufferReader& reader, MidiChunk& result);
 		/** initialize the track from data contained in the chunk */
 		bool InitializeTrackFromChunk(MidiTrack* track, MidiChunk const& track_chunk);
-		/** read a variable length time in stream */
-		bool ReadVLTime(BufferReader& reader, uint32_t& result);
 		/** convert the header chunk into a header structure */
 		bool GetHeaderFromChunk(MidiChunk const& chunk, MidiHeader& result);
 
@@ -171,6 +202,10 @@ namespace chaos
 		MidiHeader header;
 		/** the tracks */
 		std::vector<std::unique_ptr<MidiTrack>> tracks;
+		/** the events reference this memory */
+		Buffer<char> buffer;
+		/** the mapped file (the events reference this memory) */
+		shared_ptr<MemoryMappedFile> mapped_file;
 	};
 
 
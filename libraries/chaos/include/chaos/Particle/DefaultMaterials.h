@@ -7,9 +7,13 @@ namespace chaos
 
 	class DefaultParticleProgramSource;
 	class DefaultScreenSpaceProgramGenerator;
+	class DefaultParticleComputeProgramSource;
+	class DefaultParticleInstanceProgramSource;
 
 	using DefaultParticleProgram = DefaultMaterialBase<DefaultParticleProgramSource>;
 	using DefaultScreenSpaceProgram = DefaultMaterialBase<DefaultScreenSpaceProgramGenerator>;
+	using DefaultParticleComputeProgram = DefaultMaterialBase<DefaultParticleComputeProgramSource>;
+	using DefaultParticleInstanceProgram = DefaultMaterialBase<DefaultParticleInstanceProgramSource>;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
@@ -103,6 +107,48 @@ namespace chaos
 		static char const* fragment_shader_source;
 	};
 
+	/**
+	 * DefaultParticleComputeProgramSource : generator for particles stored in a shader storage buffer (see ParticleComputeLayer)
+	 */
+
+	class CHAOS_API DefaultParticleComputeProgramSource
+	{
+	public:
+
+		/** get the sources */
+		void GetSources(GPUProgramGenerator& program_generator);
+
+	public:
+
+		/** the declaration of the particle structure and of the storage buffer (shared with the update kernel) */
+		static char const* particle_buffer_source;
+		/** the main function of the update compute shader (calls the kernel UpdateParticle(...) function) */
+		static char const* update_shader_source;
+		/** the vertex shader source */
+		static char const* vertex_shader_source;
+		/** the pixel shader source */
+		static char const* fragment_shader_source;
+	};
+
+	/**
+	 * DefaultParticleInstanceProgramSource : generator for particles rendered with one instance per quad (see QuadInstanceDefault)
+	 */
+
+	class CHAOS_API DefaultParticleInstanceProgramSource
+	{
+	public:
+
+		/** get the sources */
+		void GetSources(GPUProgramGenerator& program_generator);
+
+	public:
+
+		/** the vertex shader source */
+		static char const* vertex_shader_source;
+		/** the pixel shader source */
+		static char const* fragment_shader_source;
+	};
+
 #endif
 
 
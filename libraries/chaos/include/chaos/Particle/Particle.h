@@ -119,7 +119,9 @@ namespace chaos
 #include "chaos/Particle/ParticleAccessor.h"
 #include "chaos/Particle/ParticleTraitTools.h"
 #include "chaos/Particle/ParticleAllocation.h"
+#include "chaos/Particle/ParticleBroadphase.h"
 #include "chaos/Particle/ParticleLayer.h"
+#include "chaos/Particle/ParticleComputeLayer.h"
 #include "chaos/Particle/ParticleManager.h"
 #include "chaos/Particle/ParticleSpawner.h"
 #include "chaos/Particle/ParticleTextGenerator.h"
@@ -62,6 +62,8 @@ namespace chaos
 
 		/** remove the allocation from its layer */
 		void RemoveFromLayer();
+		/** get the handle of the allocation inside its layer */
+		SlotMapHandle GetLayerHandle() const { return layer_handle; }
 
 		/** returns true whether the class required is compatible with the one store in the buffer */
 		template<typename PARTICLE_TYPE>
@@ -138,6 +140,13 @@ namespace chaos
 		/** require the layer to update the GPU buffer */
 		void ConditionalRequireGPUUpdate(bool skip_if_invisible, bool skip_if_empty);
 
+		/** whether the only reference on the allocation is the one from the layer (the object can be reused) */
+		bool IsRecyclable() const;
+		/** reset the allocation so that it can be reused by a further spawn (returns false if not possible) */
+		virtual bool Recycle() { return false; }
+		/** reset all per-instance states of the base allocation (a recycled allocation must not inherit anything from its previous usage) */
+		void ResetAllocationState();
+
 	protected:
 
 		/** the particle layer that contains the range */
@@ -148,6 +157,8 @@ namespace chaos
 		bool visible = true;
 		/** a callback called whenever the allocation becomes empty */
 		bool destroy_when_empty = false;
+		/** the handle of the allocation inside its layer */
+		SlotMapHandle layer_handle;
 	};
 
 
@@ -418,6 +429,22 @@ namespace chaos
 				ParticleToPrimitives(particle, output, std::forward<PARAMS>(params)...);
 		}
 
+		/** override */
+		virtual bool Recycle() override
+		{
+			if constexpr (std::is_copy_assignable_v<allocation_trait_type>)
+			{
+				particles.clear(); // keep the memory for the next usage
+				this->data = allocation_trait_type{};
+				ResetAllocationState();
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
 	protected:
 
 		/** the particles buffer */
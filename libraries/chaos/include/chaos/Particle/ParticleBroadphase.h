@@ -0,0 +1,170 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ParticleBroadphaseHandle;
+	class ParticleBroadphaseEntry;
+	class ParticleBroadphase;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// XXX : a uniform grid over the bounding boxes of the particles of one layer (the particle class must inherit ParticleDefault)
+	//
+	//       - cells:  [ (cell0, e3) (cell0, e7) (cell1, e3) (cell5, e1) ... ]   (cell, entry) pairs sorted by cell (x major, y minor)
+	//
+	//       a query walks the columns of cells it overlaps. Each column is a contiguous range found with a single binary search
+	//       an entry overlapping several cells is only reported once: in the first cell shared by the entry and the query
+	//
+	//       handles are valid until the layer is ticked again (dead particles are removed and the other ones moved)
+
+	/**
+	* ParticleBroadphaseHandle : a reference on a particle (its allocation in the layer + its index in the allocation)
+	*/
+
+	class CHAOS_API ParticleBroadphaseHandle
+	{
+	public:
+
+		/** comparison operator */
+		bool operator == (ParticleBroadphaseHandle const& src) const = default;
+
+	public:
+
+		/** the allocation in the layer */
+		SlotMapHandle allocation;
+		/** the index of the particle in the allocation */
+		uint32_t particle_index = 0;
+	};
+
+	/**
+	* ParticleBroadphaseEntry : a particle indexed in the grid
+	*/
+
+	class CHAOS_API ParticleBroadphaseEntry
+	{
+	public:
+
+		/** the bounding box of the particle (when the grid has been built) */
+		box2 bounding_box;
+		/** the particle */
+		ParticleBroadphaseHandle handle;
+	};
+
+	/**
+	* ParticleBroadphase : an index to find the particles of a layer that collide a box
+	*/
+
+	class CHAOS_API ParticleBroadphase
+	{
+	protected:
+
+		/** the first cell of an entry (or the first cell of a query) */
+		using cell_coord = glm::ivec2;
+
+		/** a cell and one entry it contains */
+		using cell_entry = std::pair<uint64_t, uint32_t>;
+
+		/** entries overlapping more cells than this are tested against every query */
+		static constexpr int MAX_CELLS_PER_ENTRY = 64;
+		/** the cell coordinates are clamped to [-MAX_CELL_COORD, MAX_CELL_COORD] (the size of a range fits in an int) */
+		static constexpr int MAX_CELL_COORD = 1 << 29;
+
+	public:
+
+		/** constructor */
+		ParticleBroadphase(float in_cell_size = 32.0f);
+
+		/** change the size of the cells (the grid must be built again) */
+		void SetCellSize(float in_cell_size);
+		/** get the size of the cells */
+		float GetCellSize() const { return cell_size; }
+
+		/** index all the particles of a layer (returns false if the particles do not inherit ParticleDefault) */
+		bool Build(ParticleLayerBase const* layer);
+		/** remove all entries */
+		void Clear();
+
+		/** get the number of indexed particles */
+		size_t GetEntryCount() const { return entries.size(); }
+		/** get an entry */
+		ParticleBroadphaseEntry const& GetEntry(size_t index) const { return entries[index]; }
+
+		/** call func(ParticleBroadphaseEntry const&) for each particle whose bounding box collides the box */
+		template<typename FUNC>
+		void ForEachCollision(box2 const& box, FUNC const& func) const
+		{
+			if (IsGeometryEmpty(box) || entries.size() == 0)
+				return;
+
+			// the oversized entries
+			for (uint32_t entry_index : oversized_entries)
+				if (Collide(entries[entry_index].bounding_box, box))
+					func(entries[entry_index]);
+
+			// the cells overlapped by the query (only those that may contain entries)
+			cell_coord query_min, query_max;
+			GetCellRange(box, query_min, query_max);
+			query_min = glm::max(query_min, grid_min_cell);
+			query_max = glm::min(query_max, grid_max_cell);
+
+			for (int x = query_min.x; x <= query_max.x; ++x)
+			{
+				uint64_t first_key = GetCellKey({ x, query_min.y });
+				uint64_t last_key = GetCellKey({ x, query_max.y });
+
+				auto it = std::lower_bound(cells.begin(), cells.end(), first_key, [](cell_entry const& c, uint64_t key) { return c.first < key; });
+				for (; it != cells.end() && it->first <= last_key; ++it)
+				{
+					// report the entry in the first cell it shares with the query only
+					cell_coord const& entry_min = entry_min_cells[it->second];
+					if (x != std::max(entry_min.x, query_min.x))
+						continue;
+					if (GetCellY(it->first) != std::max(entry_min.y, query_min.y))
+						continue;
+
+					ParticleBroadphaseEntry const& entry = entries[it->second];
+					if (Collide(entry.bounding_box, box))
+						func(entry);
+				}
+			}
+		}
+
+		/** get all the particles whose bounding box collides the box (returns the number of particles added) */
+		size_t Query(box2 const& box, std::vector<ParticleBroadphaseHandle>& result) const;
+
+	protected:
+
+		/** get the range of cells overlapped by a box */
+		void GetCellRange(box2 const& box, cell_coord& min_cell, cell_coord& max_cell) const;
+		/** get the key of a cell (sorting the keys sorts the cells by x and then by y) */
+		static uint64_t GetCellKey(cell_coord const& cell)
+		{
+			return (uint64_t(uint32_t(cell.x) ^ 0x80000000u) << 32) | uint64_t(uint32_t(cell.y) ^ 0x80000000u);
+		}
+		/** get the y coordinate of a cell from its key */
+		static int GetCellY(uint64_t key)
+		{
+			return int(uint32_t(key & 0xFFFFFFFFu) ^ 0x80000000u);
+		}
+
+	protected:
+
+		/** the size of the cells */
+		float cell_size = 32.0f;
+		/** the indexed particles */
+		std::vector<ParticleBroadphaseEntry> entries;
+		/** the first cell of each entry */
+		std::vector<cell_coord> entry_min_cells;
+		/** the (cell, entry) pairs, sorted */
+		std::vector<cell_entry> cells;
+		/** the entries that are too big to be put in the cells */
+		std::vector<uint32_t> oversized_entries;
+		/** the range of the cells that contain entries (empty range if none) */
+		cell_coord grid_min_cell = cell_coord(std::numeric_limits<int>::max());
+		/** the range of the cells that contain entries (empty range if none) */
+		cell_coord grid_max_cell = cell_coord(std::numeric_limits<int>::min());
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
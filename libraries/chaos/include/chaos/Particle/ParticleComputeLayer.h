@@ -0,0 +1,210 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ParticleCompute;
+	class ParticleComputeDefaultLayerTrait;
+	class ParticleComputeLayerBase;
+
+	template<typename LAYER_TRAIT>
+	class ParticleComputeLayer;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// XXX : a particle layer whose simulation is done on the GPU
+	//
+	//       - the particles live in a shader storage buffer (binding 0) used as a ring buffer
+	//       - the CPU only uploads the newly emitted particles
+	//       - a compute shader updates the particles. The trait provides the update kernel (GLSL)
+	//
+	//         bool UpdateParticle(inout ParticleCompute particle, float delta_time); => returns true whether the particle must be destroyed
+	//
+	//       - the vertex shader expands each particle into a quad (6 vertices generated from gl_VertexID, no vertex buffer)
+	//
+	//       the particles are never read back: a destroyed particle keeps its slot (and is rendered as a degenerated quad) until a new one overrides it
+
+	// function detection
+	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(AddKernelUniforms);
+
+	// ==============================================================
+	// ParticleCompute
+	// ==============================================================
+
+	/** ParticleCompute : the particle stored in GPU memory (the layout matches the std430 GLSL structure) */
+	class CHAOS_API ParticleCompute
+	{
+	public:
+
+		/** the center of the particle */
+		glm::vec2 position = { 0.0f, 0.0f };
+		/** the velocity of the particle */
+		glm::vec2 velocity = { 0.0f, 0.0f };
+		/** the half size of the particle */
+		glm::vec2 half_size = { 1.0f, 1.0f };
+		/** the orientation of the particle */
+		float rotation = 0.0f;
+		/** the whole lifetime of the particle (0 for infinite) */
+		float lifetime = 0.0f;
+		/** the color of the particle */
+		glm::vec4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		/** the texture coordinates (bottomleft, topright) */
+		ParticleCorners texcoords = { { 0.0f, 0.0f }, { 1.0f, 1.0f } };
+		/** the layer in the atlas texture (-1 for no texture) */
+		int bitmap_index = -1;
+		/** some flags (only ParticleFlags::EIGHT_BITS_MODE is used by the default program) */
+		int flags = 0;
+		/** the time before the particle is destroyed (negative: the whole lifetime, set when the particle is sent to the GPU) */
+		float remaining_time = -1.0f;
+		/** whether the particle is alive (reset by the GPU) */
+		int alive = 1;
+	};
+
+	static_assert(sizeof(ParticleCompute) == 80); // must match the std430 layout
+
+	CHAOS_REGISTER_CLASS(ParticleCompute);
+
+	// ==============================================================
+	// ParticleComputeDefaultLayerTrait
+	// ==============================================================
+
+	/** ParticleComputeDefaultLayerTrait : particles moving with a constant acceleration */
+	class CHAOS_API ParticleComputeDefaultLayerTrait : public ParticleLayerTraitBase
+	{
+	public:
+
+		/** get the GLSL update kernel */
+		char const* GetUpdateKernelSource() const;
+		/** give the uniforms to the kernel */
+		void AddKernelUniforms(GPUProgramProvider& uniform_provider) const;
+
+	public:
+
+		/** the acceleration applied to all particles */
+		glm::vec2 acceleration = { 0.0f, 0.0f };
+	};
+
+	// ==============================================================
+	// ParticleComputeLayerBase
+	// ==============================================================
+
+	class CHAOS_API ParticleComputeLayerBase : public ParticleLayerBase
+	{
+	public:
+
+		/** constructor */
+		ParticleComputeLayerBase(size_t in_max_particle_count);
+
+		/** override */
+		virtual size_t GetParticleSize() const override { return sizeof(ParticleCompute); }
+		/** override (the number of used slots, including the particles destroyed by the GPU) */
+		virtual size_t GetParticleCount() const override;
+		/** override */
+		virtual Class const* GetParticleClass() const override;
+		/** override (an empty declaration: vertices are generated from gl_VertexID) */
+		virtual GPUVertexDeclaration* GetVertexDeclaration() const override;
+
+		/** get the number of slots in the GPU buffer */
+		size_t GetMaxParticleCount() const { return max_particle_count; }
+
+		/** add particles to the layer (the oldest slots are reused). The span is valid until the next call */
+		std::span<ParticleCompute> EmitParticles(size_t count);
+		/** destroy all particles */
+		void ClearParticles();
+
+	protected:
+
+		/** get the GLSL update kernel */
+		virtual char const* GetUpdateKernelSource() const { return nullptr; }
+		/** give the uniforms to the kernel */
+		virtual void AddKernelUniforms(GPUProgramProvider& uniform_provider) const {}
+
+		/** override */
+		virtual bool DoTick(float delta_time) override;
+		/** override */
+		virtual int DoDisplay(GPURenderContext* render_context, GPUProgramProviderInterface const* uniform_provider, GPURenderParams const& render_params) override;
+		/** override */
+		virtual bool DoUpdateGPUResources(GPURenderContext* render_context) override;
+
+		/** create the buffer and the update program */
+		bool CreateGPUResources(GPURenderContext* render_context);
+		/** run the update kernel */
+		void DispatchUpdate(GPURenderContext* render_context, float delta_time);
+		/** copy the emitted particles into the GPU buffer */
+		void UploadEmittedParticles(GPURenderContext* render_context);
+
+	protected:
+
+		/** the number of slots in the GPU buffer */
+		size_t max_particle_count = 0;
+		/** the number of particles emitted since the last clear */
+		size_t emitted_count = 0;
+		/** the particles waiting for being uploaded */
+		std::vector<ParticleCompute> pending_particles;
+		/** whether the GPU buffer must be cleared */
+		bool clear_requested = false;
+		/** the time to simulate at next update */
+		float pending_delta_time = 0.0f;
+
+		/** the particles */
+		shared_ptr<GPUBuffer> particle_buffer;
+		/** the program that updates the particles */
+		shared_ptr<GPUProgram> update_program;
+		/** whether the update program could not be generated (do not try every frame) */
+		bool update_program_failure = false;
+	};
+
+	// ==============================================================
+	// ParticleComputeLayer
+	// ==============================================================
+
+	template<typename LAYER_TRAIT>
+	class ParticleComputeLayer : public ParticleComputeLayerBase, public DataOwner<LAYER_TRAIT>
+	{
+		static_assert(std::is_base_of_v<ParticleLayerTraitBase, LAYER_TRAIT>);
+
+	public:
+
+		using layer_trait_type = LAYER_TRAIT;
+
+		/** constructor */
+		ParticleComputeLayer(size_t in_max_particle_count = 65536, layer_trait_type const& in_layer_trait = {}) :
+			ParticleComputeLayerBase(in_max_particle_count),
+			DataOwner<layer_trait_type>(in_layer_trait)
+		{
+		}
+
+		/** override */
+		virtual bool AreParticlesDynamic() const override { return this->data.dynamic_particles; }
+		/** override */
+		virtual AutoCastable<ParticleLayerTraitBase> GetLayerTrait() override { return &this->data; }
+		/** override */
+		virtual AutoConstCastable<ParticleLayerTraitBase> GetLayerTrait() const override { return &this->data; }
+
+	protected:
+
+		/** override */
+		virtual char const* GetUpdateKernelSource() const override
+		{
+			return this->data.GetUpdateKernelSource();
+		}
+
+		/** override */
+		virtual void AddKernelUniforms(GPUProgramProvider& uniform_provider) const override
+		{
+			if constexpr (check_method_AddKernelUniforms_v<layer_trait_type const, GPUProgramProvider&>)
+				this->data.AddKernelUniforms(uniform_provider);
+		}
+
+		/** override */
+		virtual void UpdateRenderingStates(GPURenderContext* render_context, bool begin) const override
+		{
+			if constexpr (check_method_UpdateRenderingStates_v<layer_trait_type const, GPURenderContext*, bool>)
+				this->data.UpdateRenderingStates(render_context, begin);
+			else
+				ParticleComputeLayerBase::UpdateRenderingStates(render_context, begin);
+		}
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -6,9 +6,12 @@ namespace chaos
 	class ParticleTexcoords;
 	class ParticleDefault;
 	class VertexDefault;
+	class QuadInstanceDefault;
 
 	/** ParticleTrait : the default trait */
 	using ParticleDefaultLayerTrait = ParticleLayerTrait<ParticleDefault, VertexDefault>;
+	/** ParticleTrait : the default trait with one instance per particle (requires DefaultParticleInstanceProgram) */
+	using ParticleDefaultInstancedLayerTrait = ParticleLayerTrait<ParticleDefault, QuadInstanceDefault>;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
@@ -92,6 +95,30 @@ namespace chaos
 		int flags = 0;
 	};
 
+	// XXX : QuadInstanceDefault is read once per instance (60 bytes instead of 4 x 40 bytes for VertexDefault)
+	//       the vertex shader generates the 6 vertices of the quad (rotation and texture symetries included)
+
+	/** QuadInstanceDefault : per instance data for default particle */
+	class CHAOS_API QuadInstanceDefault
+	{
+	public:
+
+		/** the center of the quad */
+		glm::vec2 position;
+		/** the half size of the quad */
+		glm::vec2 half_size;
+		/** the texcoords of the quad (bottomleft.xy, topright.zw) */
+		glm::vec4 texcoord;
+		/** the color of the quad */
+		glm::vec4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		/** the orientation of the quad */
+		float rotation = 0.0f;
+		/** the bitmap index (-1 for no texturing) */
+		int bitmap_index = -1;
+		/** the particle flags */
+		int flags = 0;
+	};
+
 	/** output primitive */
 	template<typename VERTEX_TYPE>
 	void ParticleToPrimitives(ParticleDefault const& particle, GPUPrimitiveOutput<VERTEX_TYPE>& output);
@@ -101,6 +128,8 @@ namespace chaos
 	/** generates 1 triangle pair from one particle */
 	template<typename VERTEX_TYPE>
 	void ParticleToPrimitive(ParticleDefault const& particle, TrianglePairPrimitive<VERTEX_TYPE>& primitive);
+	/** output primitive (one instance per particle) */
+	CHAOS_API void ParticleToPrimitives(ParticleDefault const& particle, GPUPrimitiveOutput<QuadInstanceDefault>& output);
 
 	/** utility method to have position for a quad (in order BL, BR, TR, TL) */
 	CHAOS_API void GenerateVertexPositionAttributes(box2 const& bounding_box, float rotation, glm::vec2* vertex_positions);
@@ -111,6 +140,8 @@ namespace chaos
 
 	/** the default vertex declaration */
 	CHAOS_API void GetTypedVertexDeclaration(GPUVertexDeclaration* result, boost::mpl::identity<VertexDefault>);
+	/** the default instance declaration */
+	CHAOS_API void GetTypedVertexDeclaration(GPUVertexDeclaration* result, boost::mpl::identity<QuadInstanceDefault>);
 
 
 #else
@@ -2,6 +2,8 @@ namespace chaos
 {
 #if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	CHAOS_DEFINE_LOG(ParticleLog, "Particle")
+
 	// ==============================================================
 	// ParticleLayerBase
 	// ==============================================================
@@ -82,9 +84,38 @@ namespace chaos
 		ParticleAllocationBase* GetAllocation(size_t index);
 		/** get the allocation by index */
 		ParticleAllocationBase const* GetAllocation(size_t index) const;
+		/** get the allocation by handle (nullptr if it has been removed) */
+		ParticleAllocationBase* FindAllocation(SlotMapHandle handle);
+		/** get the allocation by handle (nullptr if it has been removed) */
+		ParticleAllocationBase const* FindAllocation(SlotMapHandle handle) const;
 		/** clear all allocations */
 		void ClearAllAllocations();
 
+		/** get a particle from a broadphase handle (nullptr if its allocation has been removed or the particle is out of range) */
+		template<typename PARTICLE_TYPE>
+		PARTICLE_TYPE* FindParticle(ParticleBroadphaseHandle const& handle)
+		{
+			ParticleAllocationBase* allocation = FindAllocation(handle.allocation);
+			if (allocation == nullptr)
+				return nullptr;
+			ParticleAccessor<PARTICLE_TYPE> accessor = allocation->GetParticleAccessor<PARTICLE_TYPE>();
+			if (handle.particle_index >= accessor.GetDataCount())
+				return nullptr;
+			return &accessor[handle.particle_index];
+		}
+
+		/** index the bounding boxes of the particles in a grid (the particle class must inherit ParticleDefault) */
+		void EnableBroadphase(float cell_size = 32.0f);
+		/** destroy the broadphase */
+		void DisableBroadphase();
+		/** get the broadphase, built again if the particles have changed since (nullptr if not enabled) */
+		ParticleBroadphase const* GetBroadphase();
+
+		/** change the maximum number of removed allocations kept for further spawns */
+		void SetMaxRecycledAllocationCount(size_t in_count);
+		/** get the maximum number of removed allocations kept for further spawns */
+		size_t GetMaxRecycledAllocationCount() const { return max_recycled_allocation_count; }
+
 		/** get the vertex declaration */
 		virtual GPUVertexDeclaration* GetVertexDeclaration() const { return nullptr; }
 
@@ -93,8 +124,10 @@ namespace chaos
 		/** get the trait */
 		virtual AutoConstCastable<ParticleLayerTraitBase> GetLayerTrait() const { return nullptr; }
 
-		/** force GPU buffer update */
-		void SetGPUBufferDirty() { require_GPU_update = true; }
+		/** force GPU buffer update (the particles may have moved: the broadphase is updated too) */
+		void SetGPUBufferDirty() { require_GPU_update = true; require_broadphase_update = true; }
+		/** force GPU buffer update only (the simulated particles did not move: see GameEntity::BeginRenderInterpolation(...)) */
+		void SetGPUVerticesDirty() { require_GPU_update = true; }
 
 		/** getter on the extra data */
 		template<typename T>
@@ -128,6 +161,8 @@ namespace chaos
 		/** internal method to remove a range from the layer */
 		void RemoveParticleAllocation(ParticleAllocationBase* allocation);
 
+		/** get an allocation from the recycled ones or create a new one */
+		shared_ptr<ParticleAllocationBase> CreateParticleAllocation();
 		/** creation of an allocation */
 		virtual ParticleAllocationBase* DoCreateParticleAllocation() { return nullptr; }
 
@@ -156,8 +191,12 @@ namespace chaos
 		ParticleManager* particle_manager = nullptr;
 		/** the texture atlas */
 		shared_ptr<GPUAtlas> atlas;
-		/** particles allocations */
-		std::vector<shared_ptr<ParticleAllocationBase>> particles_allocations;
+		/** particles allocations (contiguous, the order changes whenever an allocation is removed) */
+		SlotMap<shared_ptr<ParticleAllocationBase>> particles_allocations;
+		/** allocations that have been removed and can be reused by a further spawn */
+		std::vector<shared_ptr<ParticleAllocationBase>> recycled_allocations;
+		/** the maximum number of recycled allocations */
+		size_t max_recycled_allocation_count = 256;
 
 		/** the material used to render the layer */
 		shared_ptr<GPURenderMaterial> render_material;
@@ -168,6 +207,11 @@ namespace chaos
 		shared_ptr<GPUMesh> mesh;
 		/** whether there was changes in particles, and a vertex array need to be recomputed */
 		bool require_GPU_update = false;
+
+		/** the index used for collisions with the particles */
+		std::unique_ptr<ParticleBroadphase> broadphase;
+		/** whether there was changes in particles, and the broadphase need to be built again */
+		bool require_broadphase_update = false;
 };
 
 	// ==============================================================
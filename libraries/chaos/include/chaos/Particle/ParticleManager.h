@@ -56,6 +56,18 @@ namespace chaos
 			return result;
 		}
 
+		/** templated method to add a layer simulated on GPU (a null material means the default one) */
+		template<typename LAYER_TRAIT, typename ...PARAMS>
+		ParticleComputeLayer<LAYER_TRAIT> * AddComputeLayer(int render_order, ObjectRequest layer_id, GPURenderMaterial * render_material, PARAMS && ...params)
+		{
+			ParticleComputeLayer<LAYER_TRAIT> * result = new ParticleComputeLayer<LAYER_TRAIT>(std::forward<PARAMS>(params)...);
+			if (result == nullptr)
+				return nullptr;
+			result->SetRenderMaterial(render_material);
+			DoAddLayer(result, render_order, layer_id);
+			return result;
+		}
+
         /** create a particle spawner */
         template<typename ...PARAMS>
         ParticleSpawner* CreateParticleSpawner(ObjectRequest layer_name, PARAMS && ...params)
@@ -37,6 +37,9 @@
 (TileSet) \
 (TileSetData)\
 (Map) \
+(BakedProperty) \
+(BakedTileLayer) \
+(BakedMap) \
 (Manager)
 
 // forward declaration
@@ -67,4 +70,5 @@ namespace chaos
 #include "chaos/TiledMap/TiledMapObjectTypeSet.h"
 #include "chaos/TiledMap/TiledMapTileSet.h"
 #include "chaos/TiledMap/TiledMapMap.h"
+#include "chaos/TiledMap/TiledMapBakedMap.h"
 #include "chaos/TiledMap/TiledMapManager.h"
\ No newline at end of file
@@ -0,0 +1,103 @@
+namespace chaos
+{
+	namespace TiledMap
+	{
+#if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+		// ==========================================
+		// BakedMap
+		// ==========================================
+
+		// XXX : a baked map is a binary companion of a TMX file (same name, .tmb extension). It contains
+		//
+		//         - the files the map depends on (the TMX and the external TSX) with their stamps (size + write time)
+		//         - the XML document of the map where the content of tile layers and the properties have been removed (very fast to parse)
+		//         - the properties, already typed. Each <properties> element is replaced by a baked_properties attribute on its parent (the index of the block)
+		//         - the tiles of each layer, already decoded and processed (TILE_FLAG_PROCESSORS already applied)
+		//
+		//       whenever a dependency changes, the baked file is considered as stale and the TMX file is used instead
+		//       the objects, layers and tilesets are still built from the (stripped) XML : only their attributes remain to be parsed
+		//
+		// Format (native endianness):
+		//
+		//   BakedMapHeader
+		//   dependency_count x { uint32 path_size, char path[path_size], uint64 file_size, int64 write_time }  (path relative to the TMX directory)
+		//   char xml[xml_size]
+		//   property_block_count x { uint32 property_count, property_count x { uint32 name_size, char name[name_size], int32 type, value } }
+		//     (value : int32 for int, bool and object, float, vec4 for color, { uint32 size, char str[size] } for string)
+		//   tile_layer_count x { int32 layer_id, uint32 chunk_count, chunk_count x { ivec2 size, ivec2 offset, uint32 tile_count, Tile tiles[tile_count] } }
+
+		class CHAOS_API BakedProperty
+		{
+		public:
+
+			/** the name of the property */
+			std::string name;
+			/** the type of the property */
+			PropertyType type = PropertyType::Any;
+			/** the value for int, bool and object properties */
+			int int_value = 0;
+			/** the value for float properties */
+			float float_value = 0.0f;
+			/** the value for color properties */
+			glm::vec4 color_value = { 1.0f, 1.0f, 1.0f, 1.0f };
+			/** the value for string properties */
+			std::string string_value;
+		};
+
+		class CHAOS_API BakedTileLayer
+		{
+		public:
+
+			/** the ID of the layer */
+			int layer_id = 0;
+			/** the decoded chunks */
+			std::vector<TileLayerChunk> tile_chunks;
+		};
+
+		class CHAOS_API BakedMap
+		{
+			CHAOS_TILEDMAP_ALL_FRIENDS
+
+		public:
+
+			/** the current version of the format */
+			static constexpr uint32_t FORMAT_VERSION = 2;
+
+			/** get the path of the baked file for a given TMX */
+			static boost::filesystem::path GetBakedPath(boost::filesystem::path const& map_path);
+
+			/** load the baked file corresponding to a TMX (fails whenever the baked file is missing or stale) */
+			bool Load(FilePathParam const& map_path);
+			/** save a baked file for a map (doc is the source XML document. It is modified) */
+			static bool Save(Map const* map, tinyxml2::XMLDocument* doc, FilePathParam const& baked_path);
+
+			/** get the XML document (without tile data) */
+			tinyxml2::XMLDocument const* GetDocument() const { return doc.get(); }
+			/** find the tiles for a layer */
+			BakedTileLayer* FindTileLayer(int layer_id);
+			/** create the properties of a block on their owner */
+			bool CreateProperties(int block_index, PropertyOwner* owner) const;
+
+		protected:
+
+			/** read the content of the baked file */
+			bool DoLoad(BufferReader reader, boost::filesystem::path const& map_directory, boost::filesystem::path const& baked_path);
+			/** read a block of properties */
+			bool DoLoadPropertyBlock(BufferReader& reader, std::vector<BakedProperty>& result);
+
+		protected:
+
+			/** the XML document */
+			std::unique_ptr<tinyxml2::XMLDocument> doc;
+			/** the blocks of properties (referenced by the baked_properties attributes) */
+			std::vector<std::vector<BakedProperty>> property_blocks;
+			/** the tile layers */
+			std::vector<BakedTileLayer> tile_layers;
+		};
+
+#endif
+
+	}; // namespace TiledMap
+
+}; // namespace chaos
\ No newline at end of file
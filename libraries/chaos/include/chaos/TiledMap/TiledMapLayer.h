@@ -140,10 +140,12 @@ namespace chaos
 		{
 		public:
 
-			/** get the tile at given position */
+			/** get the tile at given position (empty tile, with a warning, for a chunk that is not decoded) */
 			Tile GetTile(glm::ivec2 pos) const;
 			/** returns true whether wanted tile is in this chunk */
 			bool ContainTile(glm::ivec2 const& pos) const;
+			/** returns true whether the tiles are available (streamed chunks keep their encoded data instead) */
+			bool IsDecoded() const { return encoded_tiles.empty(); }
 
 		public:
 
@@ -153,6 +155,8 @@ namespace chaos
 			glm::ivec2 offset = { 0, 0 };
 			/** the indices for this chunk */
 			std::vector<Tile> tile_indices;
+			/** the encoded text of the tiles (only for streamed layers) */
+			std::string encoded_tiles;
 		};
 
 		// ==========================================
@@ -177,6 +181,11 @@ namespace chaos
 			/** get the chunk for a given tile */
 			TileLayerChunk const* GetTileChunk(glm::ivec2 const& pos) const;
 
+			/** returns true whether the chunks are decoded on demand */
+			bool IsStreamed() const { return streamed; }
+			/** get the tiles of a chunk (decode them for streamed layers). Does not log, can be called from any thread */
+			bool DecodeTileChunk(TileLayerChunk const& chunk, std::vector<Tile>& result) const;
+
 		protected:
 
 			/** constructor */
@@ -189,10 +198,14 @@ namespace chaos
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
 			/** the loading method */
 			bool DoLoadTileBuffer(tinyxml2::XMLElement const* element);
-			/** load all chunks of tiles */
-			bool DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression);
-			/** loading buffer method */
-			std::vector<Tile> DoLoadTileChunkFromBuffer(Buffer<char> const& buffer, glm::ivec2 const& chunk_size);
+			/** load all chunks of tiles (compressed_buffer is a working buffer shared by all chunks) */
+			bool DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression, std::vector<char>& compressed_buffer, bool stream_chunk);
+			/** decode a csv or base64 text into the tiles (ID's and flags are decoded) */
+			bool DoLoadTileChunkFromText(char const* txt, char const* encoding, char const* compression, size_t count, std::vector<Tile>& tiles, std::vector<char>& compressed_buffer) const;
+			/** decode a base64 (and possibly compressed) text directly into the tiles */
+			bool DoLoadTileChunkFromBase64(char const* txt, char const* compression, size_t count, std::vector<Tile>& tiles, std::vector<char>& compressed_buffer) const;
+			/** returns true whether the chunks of the layer can be kept encoded until required */
+			bool CanStreamTileChunks(char const* encoding, char const* compression) const;
 			/** add some flags to tiles */
 			virtual void ComputeTileFlags();
 
@@ -204,6 +217,12 @@ namespace chaos
 			std::vector<TileLayerChunk> tile_chunks;
 			/** cache the tile size for better performance (see TileMap) */
 			glm::ivec2 tile_size = { 0, 0 };
+			/** whether the chunks keep their encoded data until they are required (STREAMED property) */
+			bool streamed = false;
+			/** the encoding of the chunks (for streamed layers) */
+			std::string encoding;
+			/** the compression of the chunks (for streamed layers) */
+			std::string compression;
 		};
 
 		// ==========================================
@@ -4,6 +4,8 @@ namespace chaos
 	{
 #if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+		CHAOS_DEFINE_LOG(TiledMapLog, "TiledMap")
+
 		// ==========================================
 		// Manager : container for maps and tileset
 		// ==========================================
@@ -24,6 +26,9 @@ namespace chaos
 			/** load a tiled map set */
 			Map * LoadMap(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object = true);
 
+			/** load a map from its TMX and write the corresponding baked file */
+			bool BakeMap(FilePathParam const & path);
+
 			/** load a tiled map */
 			TileSet * LoadTileSet(FilePathParam const & path, bool store_object = true);
 			/** load a tiled map */
@@ -82,6 +87,8 @@ namespace chaos
 			Map * DoLoadMap(FilePathParam const & path, Buffer<char> buffer, bool store_object);
 			/** internal method to load a tiled map set (with no search for exisiting items) */
 			Map * DoLoadMap(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object);
+			/** internal method to load a tiled map set from its baked data (with no search for exisiting items) */
+			Map * DoLoadMap(FilePathParam const & path, BakedMap & baked_map, bool store_object);
 
 			/** internal method to load a tiled map (with no search for exisiting items) */
 			TileSet * DoLoadTileSet(FilePathParam const & path, bool store_object);
@@ -99,6 +106,9 @@ namespace chaos
 
 		public:
 
+			/** whether maps are loaded from their baked file when it is up to date */
+			bool use_baked_maps = true;
+
 			/** the maps */
 			std::vector<shared_ptr<Map>> maps;
 			/** the assets */
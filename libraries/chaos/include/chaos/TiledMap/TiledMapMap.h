@@ -173,6 +173,11 @@ namespace chaos
 
 			/** the map layers */
 			std::vector<shared_ptr<LayerBase>> layers;
+
+		protected:
+
+			/** the baked data the map is being loaded from (only valid during loading) */
+			BakedMap* baked_map = nullptr;
 		};
 
 #endif
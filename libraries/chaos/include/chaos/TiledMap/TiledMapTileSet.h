@@ -265,6 +265,8 @@ namespace chaos
 			int min_tile_id = 0;
 			/** internal members to faster tile access */
 			int max_tile_id = 0;
+			/** dense table indexed by (id - min_tile_id) for constant time access (nullptr for holes) */
+			std::vector<TileData const*> tile_lookup;
 		};
 
 
@@ -43,6 +43,8 @@ namespace chaos
 		int depth_bits = 24;
 		/** self description */
 		int stencil_bits = 8;
+		/** whether the windows are invisible and the contexts created with OSMesa (when available). For benchmarks on CI */
+		bool headless = false;
 	};
 
 	CHAOS_API bool DoSaveIntoJSON(nlohmann::json * json, GLFWHints const& src);
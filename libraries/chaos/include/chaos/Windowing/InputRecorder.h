@@ -0,0 +1,227 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	enum class InputRecorderMode;
+	enum class InputRecordEventType;
+
+	class InputRecordEvent;
+	class InputRecordGamepad;
+	class InputRecordFrame;
+	class InputReplayStats;
+	class InputRecorder;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	CHAOS_DEFINE_LOG(InputRecorderLog, "InputRecorder")
+
+	// XXX : the recorder captures, for each frame of the message loop:
+	//
+	//       - the duration of the frame
+	//       - the GLFW input callbacks (keys, chars, mouse) in their order of arrival
+	//       - the state of the present gamepads
+	//
+	//       during a replay, real events are ignored. The recorded callbacks are sent to the windows again, the gamepads are read
+	//       from the record and the frame time follows the recorded durations (the replay runs as fast as possible)
+	//       the rand() seed is stored as well so that the sessions are deterministic
+	//
+	//       command line (global variables):
+	//
+	//       --RecordInputs=path    record the session
+	//       --ReplayInputs=path    replay a session and quit (the profiler is enabled)
+	//       --ReplayReport=path    write the replay statistics in a JSON file
+	//       --Headless             create the contexts without window (see GLFWHints::headless)
+
+	/**
+	* InputRecorderMode : what the recorder is doing
+	*/
+
+	enum class InputRecorderMode : int
+	{
+		None,
+		Record,
+		Replay
+	};
+
+	/**
+	* InputRecordEventType : the GLFW callback that has been recorded
+	*/
+
+	enum class InputRecordEventType : int
+	{
+		Key,
+		Char,
+		MouseButton,
+		MouseMove,
+		MouseWheel
+	};
+
+	/**
+	* InputRecordEvent : the parameters of a GLFW callback
+	*/
+
+	class CHAOS_API InputRecordEvent
+	{
+	public:
+
+		/** the callback */
+		InputRecordEventType type = InputRecordEventType::Key;
+		/** the integer parameters (keycode, scancode, action, modifiers ...) */
+		int values[4] = { 0, 0, 0, 0 };
+		/** the position or the scroll */
+		glm::dvec2 position = { 0.0, 0.0 };
+	};
+
+	/**
+	* InputRecordGamepad : the state of a gamepad
+	*/
+
+	class CHAOS_API InputRecordGamepad
+	{
+	public:
+
+		/** the physical index of the gamepad */
+		int physical_index = 0;
+		/** the state given by GLFW */
+		GLFWgamepadstate state;
+	};
+
+	/**
+	* InputRecordFrame : all the inputs of a frame
+	*/
+
+	class CHAOS_API InputRecordFrame
+	{
+	public:
+
+		/** the duration of the frame */
+		float delta_time = 0.0f;
+		/** the callbacks */
+		std::vector<InputRecordEvent> events;
+		/** the present gamepads */
+		std::vector<InputRecordGamepad> gamepads;
+	};
+
+	/**
+	* InputReplayStats : the performance measured during a replay
+	*/
+
+	class CHAOS_API InputReplayStats
+	{
+	public:
+
+		/** remove all measures */
+		void Clear();
+		/** get a percentile of the frame durations (in ms) */
+		double GetFrameDurationPercentile(double percentile) const;
+
+		/** output the stats into the log */
+		void Log() const;
+		/** output the stats into a JSON file */
+		bool SaveToFile(FilePathParam const& path) const;
+
+	public:
+
+		/** the CPU duration of the frames (in ms) */
+		std::vector<double> frame_durations;
+		/** the CPU time spent in the profiler zones (in ms) */
+		std::map<std::string, double, std::less<>> zone_durations;
+		/** the number of draw calls */
+		uint64_t drawcall_count = 0;
+		/** the number of vertices */
+		uint64_t vertex_count = 0;
+	};
+
+	/**
+	* InputRecorder : record the inputs of a session or replay them
+	*/
+
+	class CHAOS_API InputRecorder : public Singleton<InputRecorder>
+	{
+	public:
+
+		/** start the record or the replay required on the command line */
+		bool StartFromGlobalVariables();
+
+		/** start recording (the file is written when the recording is stopped) */
+		bool StartRecording(FilePathParam const& path);
+		/** start replaying a file */
+		bool StartReplay(FilePathParam const& path);
+		/** stop the recording (write the file) or the replay (output the stats) */
+		bool Stop();
+
+		/** get the mode */
+		InputRecorderMode GetMode() const { return mode; }
+		/** whether the inputs are being recorded */
+		bool IsRecording() const { return (mode == InputRecorderMode::Record); }
+		/** whether the inputs are being replayed */
+		bool IsReplaying() const { return (mode == InputRecorderMode::Replay); }
+
+		/** get the seed given to srand() (the one of the record during a replay) */
+		uint32_t GetRandomSeed() const { return random_seed; }
+
+		/** get the number of frames of the record */
+		size_t GetFrameCount() const { return frames.size(); }
+		/** get the index of the current frame */
+		size_t GetFrameIndex() const { return frame_index; }
+
+		/** get the stats of the replay */
+		InputReplayStats const& GetReplayStats() const { return replay_stats; }
+
+		/** called before the events are polled */
+		void BeginRecordFrame();
+		/** called after the events are polled */
+		void EndRecordFrame(float real_delta_time);
+		/** dispatch the events of the next recorded frame (returns false at the end of the record) */
+		bool ReplayFrame(float& real_delta_time);
+		/** called at the end of each frame of the message loop (collect the stats of a replay) */
+		void EndFrame();
+
+		/** called from the GLFW callbacks: returns false whether the event is to be ignored (real event during a replay) */
+		bool OnGLFWEvent(InputRecordEvent const& event);
+
+		/** get whether a gamepad is present (from the record during a replay) */
+		static bool IsGamepadPresent(int physical_index);
+		/** get the state of a gamepad (from the record during a replay) */
+		static bool GetGamepadState(int physical_index, GLFWgamepadstate& result);
+
+	protected:
+
+		/** find the gamepad state for the current frame */
+		InputRecordGamepad const* FindGamepad(int physical_index) const;
+		/** send a recorded event to the windows */
+		void DispatchEvent(InputRecordEvent const& event);
+
+		/** write the record */
+		bool SaveRecord(FilePathParam const& path) const;
+		/** read a record */
+		bool LoadRecord(FilePathParam const& path);
+
+	protected:
+
+		/** the mode */
+		InputRecorderMode mode = InputRecorderMode::None;
+		/** the file to write for a record */
+		boost::filesystem::path record_path;
+		/** the seed given to srand() */
+		uint32_t random_seed = 0;
+		/** the recorded frames */
+		std::vector<InputRecordFrame> frames;
+		/** the current frame during a replay */
+		size_t frame_index = 0;
+		/** the frame time during a replay */
+		double replay_time = 0.0;
+		/** whether a recorded event is being dispatched */
+		bool dispatching_event = false;
+
+		/** the stats of the replay */
+		InputReplayStats replay_stats;
+		/** the time when the replayed frame started */
+		std::chrono::steady_clock::time_point replay_frame_start;
+		/** the last frame whose draw calls have been counted (for each render context) */
+		std::map<GPURenderContext const*, uint64_t> counted_rendering_timestamps;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
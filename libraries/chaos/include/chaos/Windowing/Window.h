@@ -70,6 +70,7 @@ namespace chaos
 	class CHAOS_API Window : public Object, public WindowInterface, public ConfigurationUserInterface, public NamedInterface, public ImGuiObjectOwnerInterface
 	{
 		friend class WindowApplication;
+		friend class InputRecorder;
 
 		CHAOS_DECLARE_OBJECT_CLASS(Window, Object);
 
@@ -120,8 +121,14 @@ namespace chaos
 		/** get visibility status */
 		bool IsWindowVisible() const;
 
-		/** require a screen capture */
+		/** require a screen capture (the file is written asynchronously) */
 		bool ScreenCapture();
+		/** start capturing all frames into the captures directory */
+		bool StartVideoCapture(WindowVideoCaptureMode mode = WindowVideoCaptureMode::ImageSequence);
+		/** stop capturing the frames */
+		void StopVideoCapture();
+		/** whether a video is being captured */
+		bool IsCapturingVideo() const { return window_capture.IsCapturingVideo(); }
 
 		/** getting the required viewport for given window */
 		virtual aabox2 GetRequiredViewport(glm::ivec2 const& size) const;
@@ -434,6 +441,8 @@ namespace chaos
 
 		/** the ImGui/Implot context */
 		WindowImGuiContext window_imgui_context;
+		/** the asynchronous screen and video captures */
+		WindowCapture window_capture;
 
 		/** the window in GLFW library */
 		GLFWwindow* glfw_window = nullptr;
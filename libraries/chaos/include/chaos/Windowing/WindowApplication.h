@@ -165,6 +165,13 @@ namespace chaos
 		/** used to force for one frame the duration of tick function to 0 : usefull for function that are long and would block the game for some time */
 		void FreezeNextFrameTickDuration();
 
+		/** whether the simulation is ticked with a fixed time step */
+		bool IsFixedTickEnabled() const { return fixed_tick_enabled; }
+		/** get the duration of a fixed simulation step */
+		float GetFixedTickDuration() const { return fixed_tick_duration; }
+		/** get the blend factor between the two last simulation steps for rendering (1.0 without fixed step) */
+		float GetInterpolationAlpha() const { return interpolation_alpha; }
+
 		/** reload all GPU resources */
 		virtual bool ReloadGPUResources();
 
@@ -280,6 +287,8 @@ namespace chaos
 
 		/** update the delta_time according to context */
 		float ComputeEffectiveDeltaTime(float real_delta_time) const;
+		/** accumulate the frame time and get the number of fixed steps to run this frame (update the interpolation alpha) */
+		int ComputeFixedTickCount(float delta_time);
 
 		/** create an invisible window to share its context with all other windows */
 		bool CreateSharedContext(JSONReadConfiguration config);
@@ -433,6 +442,17 @@ namespace chaos
 		/** whether the delta time is forced to 0 for one frame (usefull for long operations like screen capture or GPU resource reloading) */
 		mutable bool forced_zero_tick_duration = false;
 
+		/** whether the simulation is ticked with a fixed time step (the rendering is still done once per frame) */
+		bool fixed_tick_enabled = false;
+		/** the duration of a fixed simulation step */
+		float fixed_tick_duration = 1.0f / 60.0f;
+		/** the maximum number of fixed steps per frame (the remaining time is dropped to avoid the spiral of death) */
+		int max_fixed_tick_count = 5;
+		/** the time not consumed yet by fixed steps */
+		float fixed_tick_accumulator = 0.0f;
+		/** the blend factor between the two last simulation steps */
+		float interpolation_alpha = 1.0f;
+
 		/** the imgui menu mode */
 		bool imgui_menu_enabled = false;
 
@@ -0,0 +1,128 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	enum class WindowVideoCaptureMode;
+
+	class WindowCapture;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	CHAOS_DEFINE_LOG(WindowCaptureLog, "WindowCapture")
+
+	// XXX : the captures are done without stalling the main thread
+	//
+	//       - once the frame is rendered (before the swap), the back buffer is read into a PBO (asynchronous transfer) and a fence is pushed
+	//       - the PBOs are in a ring. A PBO is mapped a few frames later, when its fence is signaled
+	//       - the pixels are then given to worker threads for encoding
+	//
+	//       in video mode, a frame is never dropped: when the ring is full, the oldest transfer is waited for
+	//       the raw video file is a sequence of frames: [width (uint32)] [height (uint32)] [pixels (BGRA, bottom-up)]
+
+	/**
+	* WindowVideoCaptureMode : how the frames of a video are written
+	*/
+
+	enum class WindowVideoCaptureMode : int
+	{
+		ImageSequence, // one PNG per frame in a directory
+		RawVideo       // all raw frames in a single file
+	};
+
+	/**
+	* WindowCapture : asynchronous screenshots and videos of a window
+	*/
+
+	class CHAOS_API WindowCapture
+	{
+	public:
+
+		/** the number of PBOs in the ring */
+		static constexpr size_t RING_SIZE = 3;
+
+		/** destructor */
+		~WindowCapture();
+
+		/** capture the next rendered frame into a PNG file */
+		bool RequireScreenCapture(boost::filesystem::path const& path);
+		/** start capturing all the frames (path is a directory for image sequences, a file for raw videos) */
+		bool StartVideoCapture(boost::filesystem::path const& path, WindowVideoCaptureMode mode);
+		/** stop capturing the frames (the pending frames are still written) */
+		void StopVideoCapture();
+		/** whether a video is being captured */
+		bool IsCapturingVideo() const { return video_capture; }
+
+		/** called once the frame is rendered into the back buffer (the GL context must be current) */
+		void OnFrameRendered(glm::ivec2 const& framebuffer_size);
+		/** read all pending transfers (blocking) and wait for the encoding */
+		void Flush();
+		/** destroy the GL resources (the GL context must be current) */
+		void Release();
+
+	protected:
+
+		/** an entry in the ring */
+		class Slot
+		{
+		public:
+
+			/** the PBO */
+			GLuint buffer_id = 0;
+			/** the size of the PBO */
+			size_t buffer_size = 0;
+			/** the size of the frame being transfered */
+			glm::ivec2 size = { 0, 0 };
+			/** the fence signaled once the transfer is done (nullptr if the slot is free) */
+			shared_ptr<GPUFence> fence;
+			/** where to write the screen capture (empty if none) */
+			boost::filesystem::path screen_capture_path;
+			/** whether the frame belongs to the video */
+			bool video_frame = false;
+			/** the index of the frame in the video */
+			uint64_t video_frame_index = 0;
+		};
+
+		/** map a PBO whose transfer is over and give its content to the encoders (returns false if not ready) */
+		bool ReadSlot(Slot& slot, bool wait);
+		/** give an encoding to a thread pool (the encodings of the capture are counted) */
+		void AddEncodingTask(ThreadPool* thread_pool, std::function<void()> task);
+		/** wait until the number of pending encodings is acceptable (no frame drop) */
+		void LimitPendingEncodings();
+
+		/** encode a frame into a PNG file (called on worker threads) */
+		static bool SavePNG(Buffer<char> const& pixels, glm::ivec2 const& size, boost::filesystem::path const& path);
+
+	protected:
+
+		/** the ring of PBOs */
+		Slot slots[RING_SIZE];
+		/** the next slot to use */
+		size_t next_slot = 0;
+
+		/** the screen capture required for next frame */
+		boost::filesystem::path pending_screen_capture_path;
+
+		/** whether a video is being captured */
+		bool video_capture = false;
+		/** the mode of the video */
+		WindowVideoCaptureMode video_mode = WindowVideoCaptureMode::ImageSequence;
+		/** the directory for image sequence */
+		boost::filesystem::path video_path;
+		/** the number of frames captured for the video */
+		uint64_t video_frame_count = 0;
+		/** the raw video file (only used by the writer thread) */
+		std::shared_ptr<std::ofstream> video_stream;
+		/** a single thread so that the raw frames are written in order */
+		std::unique_ptr<ThreadPool> video_writer;
+
+		/** the number of encodings given to the threads and not finished yet */
+		size_t pending_encoding_count = 0;
+		/** protect the number of pending encodings */
+		std::mutex pending_encoding_mutex;
+		/** signaled each time an encoding is finished */
+		std::condition_variable pending_encoding_condition;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
@@ -16,6 +16,8 @@ namespace chaos
 	public:
 		/** the viewport */
 		aabox2 viewport;
+		/** the blend factor between the two last simulation steps (fixed step mode) */
+		float interpolation_alpha = 1.0f;
 	};
 
 	// ========================================================
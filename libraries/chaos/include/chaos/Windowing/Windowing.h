@@ -1,10 +1,12 @@
 #include "chaos/Windowing/GLFWHints.h"
+#include "chaos/Windowing/InputRecorder.h"
 #include "chaos/Windowing/Padding.h"
 #include "chaos/Windowing/WindowInterface.h"
 #include "chaos/Windowing/WindowCreateParams.h"
 #include "chaos/Windowing/WindowPlacementInfo.h"
 #include "chaos/Windowing/WindowFrameSizeInfo.h"
 #include "chaos/Windowing/WindowImGuiContext.h"
+#include "chaos/Windowing/WindowCapture.h"
 #include "chaos/Windowing/Window.h"
 #include "chaos/Windowing/WindowClient.h"
 #include "chaos/Windowing/WidgetLayout.h"
@@ -252,6 +252,18 @@ namespace chaos
 	// AtlasFolderInfo functions
 	// ========================================================================
 
+	void AtlasFolderInfo::CollectBitmapNameIndex(std::unordered_map<std::string, AtlasBitmapInfo const*>& result) const
+	{
+		// XXX : emplace(...) does not override existing entries => the first bitmap found is the one kept (as for ObjectRequest searches)
+		size_t count = bitmaps.size();
+		for (size_t i = 0; i < count; ++i)
+			result.emplace(boost::algorithm::to_lower_copy(std::string(bitmaps[i].GetName())), &bitmaps[i]);
+		// recursive search
+		size_t folder_count = folders.size();
+		for (size_t i = 0; i < folder_count; ++i)
+			folders[i]->CollectBitmapNameIndex(result);
+	}
+
 	void AtlasFolderInfo::DoCollectEntries(std::vector<AtlasBitmapInfo>& result)
 	{
 		size_t count = bitmaps.size();
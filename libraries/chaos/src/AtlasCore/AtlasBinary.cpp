@@ -0,0 +1,727 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================================================
+	// File layout
+	// =====================================================================
+
+	// XXX : the records are read directly from the mapping. All sections start on a 16 bytes boundary
+
+	static constexpr uint64_t ATLAS_BINARY_ALIGNMENT = 16;
+
+	class AtlasBinaryHeader
+	{
+	public:
+
+		uint32_t magic = AtlasBinary::MAGIC;
+		uint32_t version = AtlasBinary::VERSION;
+		int32_t  pixel_format = 0;
+		int32_t  page_count = 0;
+		int32_t  page_width = 0;
+		int32_t  page_height = 0;
+		int32_t  mipmap_count = 0;
+		uint32_t folder_count = 0;
+		uint32_t bitmap_count = 0;
+		uint32_t font_count = 0;
+		uint32_t character_count = 0;
+		uint32_t animation_count = 0;
+		uint64_t string_offset = 0;
+		uint64_t string_size = 0;
+		uint64_t folder_offset = 0;
+		uint64_t bitmap_offset = 0;
+		uint64_t font_offset = 0;
+		uint64_t character_offset = 0;
+		uint64_t animation_offset = 0;
+		uint64_t mipmap_offset = 0;
+	};
+
+	class AtlasBinaryLayout
+	{
+	public:
+
+		int32_t bitmap_index = -1;
+		int32_t x = 0;
+		int32_t y = 0;
+		int32_t width = 0;
+		int32_t height = 0;
+		float   bottomleft_texcoord[2] = { 0.0f, 0.0f };
+		float   topright_texcoord[2] = { 0.0f, 0.0f };
+	};
+
+	class AtlasBinaryFolder
+	{
+	public:
+
+		uint64_t tag = 0;
+		uint32_t name = 0;
+		int32_t  parent = -1; // folders are stored in depth-first order: the parent is always before its children
+		uint32_t first_bitmap = 0;
+		uint32_t bitmap_count = 0;
+		uint32_t first_font = 0;
+		uint32_t font_count = 0;
+	};
+
+	class AtlasBinaryBitmap
+	{
+	public:
+
+		uint64_t tag = 0;
+		uint32_t name = 0;
+		int32_t  animation = -1;
+		AtlasBinaryLayout layout;
+		uint32_t reserved = 0;
+	};
+
+	class AtlasBinaryFont
+	{
+	public:
+
+		uint64_t tag = 0;
+		uint32_t name = 0;
+		int32_t  glyph_width = 0;
+		int32_t  glyph_height = 0;
+		int32_t  ascender = 0;
+		int32_t  descender = 0;
+		int32_t  face_height = 0;
+		uint32_t first_character = 0;
+		uint32_t character_count = 0;
+	};
+
+	class AtlasBinaryCharacter
+	{
+	public:
+
+		uint64_t tag = 0;
+		uint32_t name = 0;
+		int32_t  advance_x = 0;
+		int32_t  advance_y = 0;
+		int32_t  bitmap_left = 0;
+		int32_t  bitmap_top = 0;
+		AtlasBinaryLayout layout;
+	};
+
+	class AtlasBinaryAnimation
+	{
+	public:
+
+		int32_t  grid_size[2] = { 0, 0 };
+		int32_t  skip_lasts = 0;
+		int32_t  child_frame_count = 0;
+		float    frame_duration = -1.0f;
+		float    anim_duration = -1.0f;
+		int32_t  default_wrap_mode = 0;
+		uint32_t reserved = 0;
+	};
+
+	class AtlasBinaryMipmap
+	{
+	public:
+
+		uint64_t offset = 0;
+		int32_t  width = 0;
+		int32_t  height = 0;
+		int32_t  pitch = 0;
+		uint32_t reserved = 0;
+	};
+
+	static_assert(sizeof(AtlasBinaryHeader) == 112);
+	static_assert(sizeof(AtlasBinaryLayout) == 36);
+	static_assert(sizeof(AtlasBinaryFolder) == 32);
+	static_assert(sizeof(AtlasBinaryBitmap) == 56);
+	static_assert(sizeof(AtlasBinaryFont) == 40);
+	static_assert(sizeof(AtlasBinaryCharacter) == 64);
+	static_assert(sizeof(AtlasBinaryAnimation) == 32);
+	static_assert(sizeof(AtlasBinaryMipmap) == 24);
+
+	static uint64_t AlignAtlasBinaryOffset(uint64_t offset)
+	{
+		return (offset + ATLAS_BINARY_ALIGNMENT - 1) & ~(ATLAS_BINARY_ALIGNMENT - 1);
+	}
+
+	static void WriteAtlasBinaryPadding(std::ostream& stream, uint64_t& position, uint64_t wanted_position)
+	{
+		static char const zeros[ATLAS_BINARY_ALIGNMENT] = { 0 };
+		while (position < wanted_position)
+		{
+			uint64_t write_count = std::min(wanted_position - position, ATLAS_BINARY_ALIGNMENT);
+			stream.write(zeros, std::streamsize(write_count));
+			position += write_count;
+		}
+	}
+
+	template<typename T>
+	static void WriteAtlasBinaryTable(std::ostream& stream, uint64_t& position, uint64_t offset, std::vector<T> const& table)
+	{
+		WriteAtlasBinaryPadding(stream, position, offset);
+		stream.write((char const*)table.data(), std::streamsize(table.size() * sizeof(T)));
+		position += table.size() * sizeof(T);
+	}
+
+	static void CopyAtlasBinaryLayout(AtlasBinaryLayout& dst, AtlasBitmapLayout const& src)
+	{
+		dst.bitmap_index = src.bitmap_index;
+		dst.x = src.x;
+		dst.y = src.y;
+		dst.width = src.width;
+		dst.height = src.height;
+		dst.bottomleft_texcoord[0] = src.bottomleft_texcoord.x;
+		dst.bottomleft_texcoord[1] = src.bottomleft_texcoord.y;
+		dst.topright_texcoord[0] = src.topright_texcoord.x;
+		dst.topright_texcoord[1] = src.topright_texcoord.y;
+	}
+
+	static void CopyAtlasBinaryLayout(AtlasBitmapLayout& dst, AtlasBinaryLayout const& src)
+	{
+		dst.bitmap_index = src.bitmap_index;
+		dst.x = src.x;
+		dst.y = src.y;
+		dst.width = src.width;
+		dst.height = src.height;
+		dst.bottomleft_texcoord = { src.bottomleft_texcoord[0], src.bottomleft_texcoord[1] };
+		dst.topright_texcoord = { src.topright_texcoord[0], src.topright_texcoord[1] };
+	}
+
+	// =====================================================================
+	// Mipmaps
+	// =====================================================================
+
+	/** 2x2 box filter (the last row/column is repeated for odd sizes) */
+	template<typename T>
+	static void DownsampleAtlasPage(ImageDescription const& src, ImageDescription& dst, int component_count)
+	{
+		for (int y = 0; y < dst.height; ++y)
+		{
+			T const* src_row0 = (T const*)((char const*)src.data + std::min(2 * y, src.height - 1) * src.pitch_size);
+			T const* src_row1 = (T const*)((char const*)src.data + std::min(2 * y + 1, src.height - 1) * src.pitch_size);
+			T* dst_row = (T*)((char*)dst.data + y * dst.pitch_size);
+
+			for (int x = 0; x < dst.width; ++x)
+			{
+				int x0 = std::min(2 * x, src.width - 1) * component_count;
+				int x1 = std::min(2 * x + 1, src.width - 1) * component_count;
+
+				for (int c = 0; c < component_count; ++c)
+				{
+					if constexpr (std::is_integral_v<T>)
+						dst_row[x * component_count + c] = T((int(src_row0[x0 + c]) + int(src_row0[x1 + c]) + int(src_row1[x0 + c]) + int(src_row1[x1 + c]) + 2) / 4);
+					else
+						dst_row[x * component_count + c] = (src_row0[x0 + c] + src_row0[x1 + c] + src_row1[x0 + c] + src_row1[x1 + c]) * T(0.25);
+				}
+			}
+		}
+	}
+
+	static bool DownsampleAtlasPage(ImageDescription const& src, ImageDescription& dst)
+	{
+		PixelDescription pixel_description = GetPixelDescription(src.pixel_format);
+		if (pixel_description.component_type == PixelComponentType::UnsignedChar)
+			DownsampleAtlasPage<unsigned char>(src, dst, pixel_description.component_count);
+		else if (pixel_description.component_type == PixelComponentType::Float)
+			DownsampleAtlasPage<float>(src, dst, pixel_description.component_count);
+		else
+			return false;
+		return true;
+	}
+
+	// =====================================================================
+	// AtlasBinaryIndexWriter : flatten the folder hierarchy into tables
+	// =====================================================================
+
+	class AtlasBinaryIndexWriter
+	{
+	public:
+
+		/** constructor */
+		AtlasBinaryIndexWriter()
+		{
+			strings.push_back(0); // offset 0 is the empty string
+		}
+
+		/** add a string into the string table */
+		uint32_t AddString(char const* str)
+		{
+			if (str == nullptr || str[0] == 0)
+				return 0;
+			uint32_t result = uint32_t(strings.size());
+			strings.insert(strings.end(), str, str + strlen(str) + 1);
+			return result;
+		}
+
+		/** add an animation into the table */
+		int32_t AddAnimation(AtlasBitmapAnimationInfo const* animation_info)
+		{
+			if (animation_info == nullptr)
+				return -1;
+			AtlasBinaryAnimation record;
+			record.grid_size[0] = animation_info->grid_data.grid_size.x;
+			record.grid_size[1] = animation_info->grid_data.grid_size.y;
+			record.skip_lasts = animation_info->grid_data.skip_lasts;
+			record.child_frame_count = animation_info->child_frame_count;
+			record.frame_duration = animation_info->frame_duration;
+			record.anim_duration = animation_info->anim_duration;
+			record.default_wrap_mode = int32_t(animation_info->default_wrap_mode);
+			animations.push_back(record);
+			return int32_t(animations.size() - 1);
+		}
+
+		/** add a folder and all its children (depth-first) */
+		void AddFolder(AtlasFolderInfo const* folder_info, int32_t parent)
+		{
+			AtlasBinaryFolder record;
+			record.tag = uint64_t(folder_info->GetTag());
+			record.name = AddString(folder_info->GetName());
+			record.parent = parent;
+
+			// the bitmaps
+			record.first_bitmap = uint32_t(bitmaps.size());
+			record.bitmap_count = uint32_t(folder_info->bitmaps.size());
+			for (AtlasBitmapInfo const& bitmap_info : folder_info->bitmaps)
+			{
+				AtlasBinaryBitmap bitmap_record;
+				bitmap_record.tag = uint64_t(bitmap_info.GetTag());
+				bitmap_record.name = AddString(bitmap_info.GetName());
+				bitmap_record.animation = AddAnimation(bitmap_info.animation_info.get());
+				CopyAtlasBinaryLayout(bitmap_record.layout, bitmap_info);
+				bitmaps.push_back(bitmap_record);
+			}
+
+			// the fonts
+			record.first_font = uint32_t(fonts.size());
+			record.font_count = uint32_t(folder_info->fonts.size());
+			for (AtlasFontInfo const& font_info : folder_info->fonts)
+			{
+				AtlasBinaryFont font_record;
+				font_record.tag = uint64_t(font_info.GetTag());
+				font_record.name = AddString(font_info.GetName());
+				font_record.glyph_width = font_info.glyph_width;
+				font_record.glyph_height = font_info.glyph_height;
+				font_record.ascender = font_info.ascender;
+				font_record.descender = font_info.descender;
+				font_record.face_height = font_info.face_height;
+				font_record.first_character = uint32_t(characters.size());
+				font_record.character_count = uint32_t(font_info.elements.size());
+				for (AtlasCharacterInfo const& character_info : font_info.elements)
+				{
+					AtlasBinaryCharacter character_record;
+					character_record.tag = uint64_t(character_info.GetTag());
+					character_record.name = AddString(character_info.GetName());
+					character_record.advance_x = int32_t(character_info.advance.x);
+					character_record.advance_y = int32_t(character_info.advance.y);
+					character_record.bitmap_left = character_info.bitmap_left;
+					character_record.bitmap_top = character_info.bitmap_top;
+					CopyAtlasBinaryLayout(character_record.layout, character_info);
+					characters.push_back(character_record);
+				}
+				fonts.push_back(font_record);
+			}
+
+			// the folder, then its children
+			int32_t folder_index = int32_t(folders.size());
+			folders.push_back(record);
+			for (auto const& child_folder : folder_info->folders)
+				if (child_folder != nullptr)
+					AddFolder(child_folder.get(), folder_index);
+		}
+
+	public:
+
+		std::vector<char> strings;
+		std::vector<AtlasBinaryFolder> folders;
+		std::vector<AtlasBinaryBitmap> bitmaps;
+		std::vector<AtlasBinaryFont> fonts;
+		std::vector<AtlasBinaryCharacter> characters;
+		std::vector<AtlasBinaryAnimation> animations;
+	};
+
+	// =====================================================================
+	// AtlasBinary
+	// =====================================================================
+
+	void AtlasBinary::Clear()
+	{
+		AtlasBase::Clear();
+		pixel_format = PixelFormat::Unknown;
+		mipmap_count = 0;
+		page_images.clear();
+		// release the data after the images that point inside it
+		buffer = Buffer<char>();
+		mapped_file = nullptr;
+	}
+
+	ImageDescription AtlasBinary::GetPageImage(int page, int mipmap_level) const
+	{
+		if (page < 0 || page >= atlas_count || mipmap_level < 0 || mipmap_level >= mipmap_count)
+			return {};
+		return page_images[size_t(page) * size_t(mipmap_count) + size_t(mipmap_level)];
+	}
+
+	bool AtlasBinary::LoadAtlas(FilePathParam const& path)
+	{
+		Clear();
+
+		bool result = FileTools::WithFile(path, [this](boost::filesystem::path const& p)
+		{
+			if (FileTools::IsArchivedFile(p))
+			{
+				// the archive already gives a view on its own mapping
+				buffer = FileTools::LoadFile(p, LoadFileFlag::NoErrorTrace);
+				if (buffer == nullptr)
+					return false;
+				if (!DoLoadAtlas(buffer.data, buffer.bufsize))
+				{
+					Clear();
+					return false;
+				}
+				return true;
+			}
+
+			if (!boost::filesystem::is_regular_file(p))
+				return false;
+			mapped_file = new MemoryMappedFile;
+			if (!mapped_file->Open(p) || !DoLoadAtlas(mapped_file->GetData(), mapped_file->GetSize()))
+			{
+				Clear();
+				return false;
+			}
+			return true;
+		});
+
+		if (!result)
+			BitmapAtlasLog::Error("AtlasBinary::LoadAtlas: fail to load [%s]", path.GetResolvedPath().string().c_str());
+		return result;
+	}
+
+	bool AtlasBinary::DoLoadAtlas(char const* data, size_t size)
+	{
+		// the records are accessed in place
+		BufferReader reader(data, size);
+
+		AtlasBinaryHeader const* header_record = nullptr;
+		if (data == nullptr || !reader.ReadView(header_record))
+			return false;
+
+		AtlasBinaryHeader const& header = *header_record;
+		if (header.magic != MAGIC)
+		{
+			BitmapAtlasLog::Error("AtlasBinary::DoLoadAtlas: not a binary atlas");
+			return false;
+		}
+		if (header.version != VERSION)
+		{
+			BitmapAtlasLog::Error("AtlasBinary::DoLoadAtlas: unsupported version");
+			return false;
+		}
+
+		// get a view on a table (fails whenever the table is not inside the file)
+		auto get_table = [&reader, size](uint64_t offset, uint64_t count, auto const*& result)
+		{
+			return (offset % ATLAS_BINARY_ALIGNMENT) == 0 && offset <= size && reader.Seek(size_t(offset)) && count <= SIZE_MAX && reader.ReadView(result, size_t(count));
+		};
+
+		uint64_t page_mipmap_count = uint64_t(std::max(header.page_count, 0)) * uint64_t(std::max(header.mipmap_count, 0));
+
+		char const* strings = nullptr;
+		AtlasBinaryFolder const* folder_records = nullptr;
+		AtlasBinaryBitmap const* bitmap_records = nullptr;
+		AtlasBinaryFont const* font_records = nullptr;
+		AtlasBinaryCharacter const* character_records = nullptr;
+		AtlasBinaryAnimation const* animation_records = nullptr;
+		AtlasBinaryMipmap const* mipmap_records = nullptr;
+
+		if (!get_table(header.string_offset, header.string_size, strings) ||
+			!get_table(header.folder_offset, header.folder_count, folder_records) ||
+			!get_table(header.bitmap_offset, header.bitmap_count, bitmap_records) ||
+			!get_table(header.font_offset, header.font_count, font_records) ||
+			!get_table(header.character_offset, header.character_count, character_records) ||
+			!get_table(header.animation_offset, header.animation_count, animation_records) ||
+			!get_table(header.mipmap_offset, page_mipmap_count, mipmap_records) ||
+			header.string_size == 0 || strings[header.string_size - 1] != 0 ||
+			header.folder_count == 0 || header.page_count < 0 || (header.page_count > 0 && header.mipmap_count <= 0))
+		{
+			BitmapAtlasLog::Error("AtlasBinary::DoLoadAtlas: corrupted file");
+			return false;
+		}
+
+		auto get_string = [strings, &header](uint32_t offset)
+		{
+			return (offset < header.string_size) ? strings + offset : "";
+		};
+
+		// rebuild the folder hierarchy
+		std::vector<AtlasFolderInfo*> folders;
+		folders.reserve(header.folder_count);
+
+		for (uint32_t i = 0; i < header.folder_count; ++i)
+		{
+			AtlasBinaryFolder const& folder_record = folder_records[i];
+
+			if (uint64_t(folder_record.first_bitmap) + folder_record.bitmap_count > header.bitmap_count ||
+				uint64_t(folder_record.first_font) + folder_record.font_count > header.font_count ||
+				(i == 0) != (folder_record.parent < 0) ||
+				folder_record.parent >= int32_t(i))
+			{
+				BitmapAtlasLog::Error("AtlasBinary::DoLoadAtlas: corrupted folder table");
+				return false;
+			}
+
+			AtlasFolderInfo* folder_info = &root_folder;
+			if (i > 0)
+			{
+				folder_info = new AtlasFolderInfo;
+				folders[folder_record.parent]->folders.push_back(std::unique_ptr<AtlasFolderInfo>(folder_info));
+			}
+			folder_info->SetName(get_string(folder_record.name));
+			folder_info->SetTag(TagType(folder_record.tag));
+			folders.push_back(folder_info);
+
+			// the bitmaps
+			folder_info->bitmaps.resize(folder_record.bitmap_count);
+			for (uint32_t j = 0; j < folder_record.bitmap_count; ++j)
+			{
+				AtlasBinaryBitmap const& bitmap_record = bitmap_records[folder_record.first_bitmap + j];
+
+				AtlasBitmapInfo& bitmap_info = folder_info->bitmaps[j];
+				bitmap_info.SetName(get_string(bitmap_record.name));
+				bitmap_info.SetTag(TagType(bitmap_record.tag));
+				CopyAtlasBinaryLayout(bitmap_info, bitmap_record.layout);
+
+				if (bitmap_record.animation >= 0 && uint32_t(bitmap_record.animation) < header.animation_count)
+				{
+					AtlasBinaryAnimation const& animation_record = animation_records[bitmap_record.animation];
+
+					bitmap_info.animation_info = new AtlasBitmapAnimationInfo;
+					bitmap_info.animation_info->grid_data.grid_size = { animation_record.grid_size[0], animation_record.grid_size[1] };
+					bitmap_info.animation_info->grid_data.skip_lasts = animation_record.skip_lasts;
+					bitmap_info.animation_info->child_frame_count = animation_record.child_frame_count;
+					bitmap_info.animation_info->frame_duration = animation_record.frame_duration;
+					bitmap_info.animation_info->anim_duration = animation_record.anim_duration;
+					bitmap_info.animation_info->default_wrap_mode = WrapMode(animation_record.default_wrap_mode);
+				}
+			}
+
+			// the fonts
+			folder_info->fonts.resize(folder_record.font_count);
+			for (uint32_t j = 0; j < folder_record.font_count; ++j)
+			{
+				AtlasBinaryFont const& font_record = font_records[folder_record.first_font + j];
+				if (uint64_t(font_record.first_character) + font_record.character_count > header.character_count)
+				{
+					BitmapAtlasLog::Error("AtlasBinary::DoLoadAtlas: corrupted font table");
+					return false;
+				}
+
+				AtlasFontInfo& font_info = folder_info->fonts[j];
+				font_info.SetName(get_string(font_record.name));
+				font_info.SetTag(TagType(font_record.tag));
+				font_info.glyph_width = font_record.glyph_width;
+				font_info.glyph_height = font_record.glyph_height;
+				font_info.ascender = font_record.ascender;
+				font_info.descender = font_record.descender;
+				font_info.face_height = font_record.face_height;
+
+				font_info.elements.resize(font_record.character_count);
+				for (uint32_t k = 0; k < font_record.character_count; ++k)
+				{
+					AtlasBinaryCharacter const& character_record = character_records[font_record.first_character + k];
+
+					AtlasCharacterInfo& character_info = font_info.elements[k];
+					character_info.SetName(get_string(character_record.name));
+					character_info.SetTag(TagType(character_record.tag));
+					character_info.advance.x = character_record.advance_x;
+					character_info.advance.y = character_record.advance_y;
+					character_info.bitmap_left = character_record.bitmap_left;
+					character_info.bitmap_top = character_record.bitmap_top;
+					CopyAtlasBinaryLayout(character_info, character_record.layout);
+				}
+			}
+		}
+
+		// the pages (pointers inside the data)
+		PixelFormat format = PixelFormat(header.pixel_format);
+		if (header.page_count > 0 && (!IsColorFormat(format) || header.page_width <= 0 || header.page_height <= 0))
+		{
+			BitmapAtlasLog::Error("AtlasBinary::DoLoadAtlas: invalid pages");
+			return false;
+		}
+
+		page_images.reserve(size_t(page_mipmap_count));
+		for (uint64_t i = 0; i < page_mipmap_count; ++i)
+		{
+			AtlasBinaryMipmap const& mipmap_record = mipmap_records[i];
+
+			int line_size = mipmap_record.width * GetPixelSize(format);
+			char const* pixels = nullptr;
+			if (mipmap_record.width <= 0 || mipmap_record.height <= 0 ||
+				mipmap_record.pitch < line_size || (mipmap_record.pitch % 4) != 0 ||
+				!get_table(mipmap_record.offset, uint64_t(mipmap_record.height) * uint64_t(mipmap_record.pitch), pixels))
+			{
+				BitmapAtlasLog::Error("AtlasBinary::DoLoadAtlas: invalid pages");
+				return false;
+			}
+			page_images.emplace_back((void*)pixels, mipmap_record.width, mipmap_record.height, format, mipmap_record.pitch - line_size);
+		}
+
+		pixel_format = format;
+		mipmap_count = (header.page_count > 0) ? header.mipmap_count : 0;
+		atlas_count = header.page_count;
+		dimension = { header.page_width, header.page_height };
+
+		return true;
+	}
+
+	bool AtlasBinary::SaveAtlas(Atlas const& atlas, FilePathParam const& path, bool generate_mipmaps)
+	{
+		boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+
+		std::vector<bitmap_ptr> const& bitmaps = atlas.GetBitmaps();
+
+		// the pixel format used for upload (the same than GPUTextureArrayGenerator)
+		PixelFormatMerger pixel_format_merger;
+		glm::ivec2 page_size = { 0, 0 };
+		for (bitmap_ptr const& bitmap : bitmaps)
+		{
+			ImageDescription image_description = ImageTools::GetImageDescription(bitmap.get());
+			if (!image_description.IsValid(false) || (page_size.x != 0 && (page_size.x != image_description.width || page_size.y != image_description.height)))
+			{
+				BitmapAtlasLog::Error("AtlasBinary::SaveAtlas: invalid page");
+				return false;
+			}
+			page_size = { image_description.width, image_description.height };
+			pixel_format_merger.Merge(image_description.pixel_format);
+		}
+
+		PixelFormat format = pixel_format_merger.GetResult();
+		if (bitmaps.size() > 0 && !IsColorFormat(format))
+		{
+			BitmapAtlasLog::Error("AtlasBinary::SaveAtlas: unsupported pixel format");
+			return false;
+		}
+
+		// the number of levels (as glGenerateMipmap(...) would do)
+		int page_mipmap_count = 1;
+		if (generate_mipmaps)
+			for (int s = std::max(page_size.x, page_size.y); s > 1; s /= 2)
+				++page_mipmap_count;
+
+		// flatten the hierarchy
+		AtlasBinaryIndexWriter index_writer;
+		index_writer.AddFolder(atlas.GetRootFolder(), -1);
+
+		// compute the layout of the file
+		AtlasBinaryHeader header;
+		header.pixel_format = int32_t(format);
+		header.page_count = int32_t(bitmaps.size());
+		header.page_width = page_size.x;
+		header.page_height = page_size.y;
+		header.mipmap_count = page_mipmap_count;
+		header.folder_count = uint32_t(index_writer.folders.size());
+		header.bitmap_count = uint32_t(index_writer.bitmaps.size());
+		header.font_count = uint32_t(index_writer.fonts.size());
+		header.character_count = uint32_t(index_writer.characters.size());
+		header.animation_count = uint32_t(index_writer.animations.size());
+
+		uint64_t offset = sizeof(AtlasBinaryHeader);
+		auto reserve_section = [&offset](uint64_t size)
+		{
+			uint64_t result = AlignAtlasBinaryOffset(offset);
+			offset = result + size;
+			return result;
+		};
+
+		header.string_size = index_writer.strings.size();
+		header.string_offset = reserve_section(header.string_size);
+		header.folder_offset = reserve_section(index_writer.folders.size() * sizeof(AtlasBinaryFolder));
+		header.bitmap_offset = reserve_section(index_writer.bitmaps.size() * sizeof(AtlasBinaryBitmap));
+		header.font_offset = reserve_section(index_writer.fonts.size() * sizeof(AtlasBinaryFont));
+		header.character_offset = reserve_section(index_writer.characters.size() * sizeof(AtlasBinaryCharacter));
+		header.animation_offset = reserve_section(index_writer.animations.size() * sizeof(AtlasBinaryAnimation));
+
+		std::vector<AtlasBinaryMipmap> mipmaps;
+		mipmaps.reserve(bitmaps.size() * size_t(page_mipmap_count));
+		header.mipmap_offset = reserve_section(bitmaps.size() * size_t(page_mipmap_count) * sizeof(AtlasBinaryMipmap));
+
+		int pixel_size = GetPixelSize(format);
+		for (size_t i = 0; i < bitmaps.size(); ++i)
+		{
+			glm::ivec2 level_size = page_size;
+			for (int level = 0; level < page_mipmap_count; ++level)
+			{
+				AtlasBinaryMipmap mipmap;
+				mipmap.width = level_size.x;
+				mipmap.height = level_size.y;
+				mipmap.pitch = (level_size.x * pixel_size + 3) & ~3;
+				mipmap.offset = reserve_section(uint64_t(mipmap.pitch) * uint64_t(mipmap.height));
+				mipmaps.push_back(mipmap);
+
+				level_size = glm::max(level_size / 2, glm::ivec2(1, 1));
+			}
+		}
+
+		// write the file
+		if (resolved_path.has_parent_path() && !boost::filesystem::is_directory(resolved_path.parent_path()))
+			boost::filesystem::create_directories(resolved_path.parent_path());
+
+		std::ofstream stream(resolved_path.string().c_str(), std::ios::binary);
+		if (!stream)
+		{
+			BitmapAtlasLog::Error("AtlasBinary::SaveAtlas: fail to create [%s]", resolved_path.string().c_str());
+			return false;
+		}
+
+		uint64_t position = 0;
+		stream.write((char const*)&header, sizeof(header));
+		position += sizeof(header);
+
+		WriteAtlasBinaryTable(stream, position, header.string_offset, index_writer.strings);
+		WriteAtlasBinaryTable(stream, position, header.folder_offset, index_writer.folders);
+		WriteAtlasBinaryTable(stream, position, header.bitmap_offset, index_writer.bitmaps);
+		WriteAtlasBinaryTable(stream, position, header.font_offset, index_writer.fonts);
+		WriteAtlasBinaryTable(stream, position, header.character_offset, index_writer.characters);
+		WriteAtlasBinaryTable(stream, position, header.animation_offset, index_writer.animations);
+		WriteAtlasBinaryTable(stream, position, header.mipmap_offset, mipmaps);
+
+		// the pages and their mipmaps
+		size_t buffer_size = size_t(ImageTools::GetMemoryRequirementForAlignedTexture(format, page_size.x, page_size.y));
+		std::vector<char> level_buffer(buffer_size);
+		std::vector<char> next_level_buffer(buffer_size);
+
+		for (size_t i = 0; i < bitmaps.size(); ++i)
+		{
+			ImageDescription level_image = ImageTools::ConvertPixels(ImageTools::GetImageDescription(bitmaps[i].get()), format, level_buffer.data());
+
+			for (int level = 0; level < page_mipmap_count; ++level)
+			{
+				AtlasBinaryMipmap const& mipmap = mipmaps[i * size_t(page_mipmap_count) + size_t(level)];
+				assert(mipmap.pitch == level_image.pitch_size && mipmap.height == level_image.height);
+
+				WriteAtlasBinaryPadding(stream, position, mipmap.offset);
+				stream.write((char const*)level_image.data, std::streamsize(level_image.pitch_size) * level_image.height);
+				position += uint64_t(level_image.pitch_size) * uint64_t(level_image.height);
+
+				// compute next level
+				if (level + 1 < page_mipmap_count)
+				{
+					ImageDescription next_level_image = ImageTools::GetImageDescriptionForAlignedTexture(
+						format,
+						std::max(level_image.width / 2, 1),
+						std::max(level_image.height / 2, 1),
+						next_level_buffer.data());
+					if (!DownsampleAtlasPage(level_image, next_level_image))
+						return false;
+					std::swap(level_buffer, next_level_buffer); // the data do not move, only the vectors are swapped
+					level_image = next_level_image;
+				}
+			}
+		}
+
+		if (!stream)
+		{
+			BitmapAtlasLog::Error("AtlasBinary::SaveAtlas: fail to write [%s]", resolved_path.string().c_str());
+			return false;
+		}
+		return true;
+	}
+
+}; // namespace chaos
\ No newline at end of file
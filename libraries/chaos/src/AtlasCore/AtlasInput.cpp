@@ -139,6 +139,11 @@ namespace chaos
 		atlas_input->RegisterResource(face, release);
 	}
 
+	void AtlasInputInfoBase::RegisterResource(Buffer<char> buffer)
+	{
+		atlas_input->RegisterResource(buffer);
+	}
+
 	// ========================================================================
 	// AddFilesToFolderData implementation
 	// ========================================================================
@@ -349,16 +354,70 @@ namespace chaos
 			params.characters.c_str() :
 			DEFAULT_CHARACTERS;
 
-		std::map<uint32_t, FontTools::CharacterBitmapGlyph> glyph_cache = FontTools::GetGlyphCacheForString(face, characters);
+		// rasterize the glyphs (on several threads)
+		FontTools::GlyphArena glyph_arena;
+		FontTools::RasterizeGlyphs(face, FontTools::GetCharactersForString(characters), glyph_arena);
 
-		// transforms each info of the glyph map into a bitmap
-		for (auto& glyph : glyph_cache)
+		// without processor, all glyphs are converted into a single BGRA buffer. Otherwise each glyph requires its own FIBITMAP
+		bool use_processors = (params.image_processors.size() > 0);
+
+		std::vector<ImageDescription> glyph_descriptions(glyph_arena.glyphs.size());
+		if (!use_processors)
 		{
-			int w = glyph.second.bitmap_glyph->bitmap.width;
-			int h = glyph.second.bitmap_glyph->bitmap.rows;
+			size_t buffer_size = 0;
+			for (FontTools::ArenaGlyph const& arena_glyph : glyph_arena.glyphs)
+				if (arena_glyph.width > 0 && arena_glyph.height > 0)
+					buffer_size += size_t(arena_glyph.width) * size_t(arena_glyph.height) * sizeof(PixelBGRA);
 
-			FIBITMAP* bitmap = FontTools::GenerateImage(glyph.second.bitmap_glyph->bitmap, PixelFormat::BGRA);
-			if (bitmap != nullptr || w <= 0 || h <= 0)  // if bitmap is zero sized (whitespace, the allocation failed). The info is still interesting
+			if (buffer_size > 0)
+			{
+				Buffer<char> buffer = SharedBufferPolicy<char>::NewBuffer(buffer_size);
+				if (buffer == nullptr)
+				{
+					delete(result);
+					return nullptr;
+				}
+				RegisterResource(buffer);
+
+				size_t offset = 0;
+				for (size_t i = 0; i < glyph_arena.glyphs.size(); ++i)
+				{
+					FontTools::ArenaGlyph const& arena_glyph = glyph_arena.glyphs[i];
+					if (arena_glyph.width > 0 && arena_glyph.height > 0)
+					{
+						glyph_descriptions[i] = ImageDescription(buffer.data + offset, arena_glyph.width, arena_glyph.height, PixelFormat::BGRA);
+						offset += size_t(arena_glyph.width) * size_t(arena_glyph.height) * sizeof(PixelBGRA);
+					}
+				}
+
+				ThreadPool::GetDefaultInstance()->ParallelFor(glyph_arena.glyphs.size(), [&glyph_arena, &glyph_descriptions](size_t i)
+				{
+					if (glyph_descriptions[i].data != nullptr)
+						FontTools::CopyGlyphPixels(glyph_arena.GetImageDescription(glyph_arena.glyphs[i]), glyph_descriptions[i]);
+				}, 16);
+			}
+		}
+
+		// transforms each glyph of the arena into an input
+		for (size_t i = 0; i < glyph_arena.glyphs.size(); ++i)
+		{
+			FontTools::ArenaGlyph const& arena_glyph = glyph_arena.glyphs[i];
+
+			int w = arena_glyph.width;
+			int h = arena_glyph.height;
+
+			FIBITMAP* bitmap = nullptr;
+			if (use_processors && w > 0 && h > 0)
+			{
+				bitmap = ImageTools::GenFreeImage(PixelFormat::BGRA, w, h);
+				if (bitmap != nullptr)
+				{
+					ImageDescription dst_desc = ImageTools::GetImageDescription(bitmap);
+					FontTools::CopyGlyphPixels(glyph_arena.GetImageDescription(arena_glyph), dst_desc);
+				}
+			}
+
+			if (bitmap != nullptr || glyph_descriptions[i].data != nullptr || w <= 0 || h <= 0)  // if bitmap is zero sized (whitespace, the allocation failed). The info is still interesting
 			{
 				// apply filters (for glyph that have an image)
 				if (bitmap != nullptr)
@@ -371,6 +430,7 @@ namespace chaos
 					}
 					// get the final image for the glyph
 					bitmap = images[0];
+					glyph_descriptions[i] = ImageTools::GetImageDescription(bitmap);
 				}
 
 				AtlasCharacterInfoInput* info = new AtlasCharacterInfoInput;
@@ -378,28 +438,24 @@ namespace chaos
 					continue;
 				info->atlas_input = atlas_input;
 
-				if (glyph.first <= 127) // an 7bit ASCII character
+				if (arena_glyph.charcode <= 127) // an 7bit ASCII character
 				{
 					char name[] = "  ";
-					sprintf_s(name, 2, "%c", glyph.first);
+					sprintf_s(name, 2, "%c", arena_glyph.charcode);
 					info->SetName(name);
 				}
-				info->SetTag(glyph.first);
-				if (bitmap != nullptr)
-					info->description = ImageTools::GetImageDescription(bitmap);
-				info->advance = glyph.second.advance;         // take the FT_Pixel_Size(...) into consideration
-				info->bitmap_left = glyph.second.bitmap_left; // take the FT_Pixel_Size(...) into consideration
-				info->bitmap_top = glyph.second.bitmap_top;   // take the FT_Pixel_Size(...) into consideration
+				info->SetTag(arena_glyph.charcode);
+				if (glyph_descriptions[i].data != nullptr)
+					info->description = glyph_descriptions[i];
+				info->advance = arena_glyph.advance;         // take the FT_Pixel_Size(...) into consideration
+				info->bitmap_left = arena_glyph.bitmap_left; // take the FT_Pixel_Size(...) into consideration
+				info->bitmap_top = arena_glyph.bitmap_top;   // take the FT_Pixel_Size(...) into consideration
 				result->elements.push_back(std::move(std::unique_ptr<AtlasCharacterInfoInput>(info)));
 
 				RegisterResource(bitmap, true);
 			}
 		}
 
-		// release the glyph cache
-		for (auto& glyph : glyph_cache)
-			FT_Done_Glyph((FT_Glyph)glyph.second.bitmap_glyph);
-
 		fonts.push_back(std::move(std::unique_ptr<AtlasFontInfoInput>(result)));
 
 		return result;
@@ -788,6 +844,13 @@ namespace chaos
 		faces.push_back(std::move(face_ptr(face)));
 	}
 
+	void AtlasInput::RegisterResource(Buffer<char> buffer)
+	{
+		if (buffer == nullptr)
+			return;
+		buffers.push_back(std::move(buffer));
+	}
+
 	bool AtlasInput::AddBitmapFilesFromDirectory(FilePathParam const& path, bool recursive)
 	{
 		return root_folder.AddBitmapFilesFromDirectory(path, recursive);
@@ -3,6 +3,11 @@
 
 namespace chaos
 {
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(bool, NoResourceArchive, false);
+	};
+
 	Application * Application::singleton_instance = nullptr;
 
 	Application::Application()
@@ -161,6 +166,8 @@ namespace chaos
 			InitializeLogging();
 			// initialize global variables using parameters (requires logger)
 			InitializeGlobalVariables(argc, argv);
+			// use the packed resources if any
+			MountResourceArchives();
 			// set the application data
 			if (SetApplicationData(in_application_data))
 			{
@@ -176,11 +183,23 @@ namespace chaos
 					Finalize();
 				}
 			}
+			FileTools::UnmountAllArchives();
 			FinalizeStandardLibraries();
 		}
 		return result;
 	}
 
+	bool Application::MountResourceArchives()
+	{
+		if (GlobalVariables::NoResourceArchive.Get())
+			return false;
+		// the archive built from the resources directory (see PackResources tool)
+		boost::filesystem::path archive_path = application_path / "resources.pak";
+		if (!boost::filesystem::is_regular_file(archive_path))
+			return false;
+		return FileTools::MountArchive(archive_path, resources_path);
+	}
+
 	bool Application::InitializeStandardLibraries()
 	{
 		return true;
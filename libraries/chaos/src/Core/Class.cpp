@@ -3,6 +3,83 @@
 
 namespace chaos
 {
+	// ==========================================================
+	// Class hierarchy numbering
+	// ==========================================================
+
+	// XXX : InheritsFrom(...) is on hot paths (each particle accessor checks the class compatibility)
+	//       instead of walking the parents, each class receives an interval [first, last] from a pre-order traversal of the whole forest
+	//       a class inherits from another if its interval is included into the other one's
+	//       the numbering is recomputed lazily whenever the hierarchy changes (declaration, new parent, destruction)
+
+	/** all the existing classes, whatever their manager */
+	static std::vector<Class*>& GetAllClasses()
+	{
+		static std::vector<Class*> result;
+		return result;
+	}
+
+	/** the mutex to protect the list of classes and the numbering */
+	static std::mutex& GetClassHierarchyMutex()
+	{
+		static std::mutex result;
+		return result;
+	}
+
+	/** incremented each time the hierarchy changes */
+	static std::atomic<uint64_t> class_hierarchy_version = 1;
+	/** the version for which the numbering has been computed */
+	static std::atomic<uint64_t> class_numbering_version = 0;
+
+	void Class::InvalidateHierarchyNumbering()
+	{
+		++class_hierarchy_version;
+	}
+
+	void Class::UpdateHierarchyNumbering()
+	{
+		// early exit
+		if (class_numbering_version.load(std::memory_order_acquire) == class_hierarchy_version.load(std::memory_order_acquire))
+			return;
+
+		std::lock_guard<std::mutex> lock(GetClassHierarchyMutex());
+
+		uint64_t version = class_hierarchy_version.load(std::memory_order_acquire);
+		if (class_numbering_version.load(std::memory_order_relaxed) == version) // another thread did the job
+			return;
+
+		// compute the children of each class
+		std::vector<Class*> const& classes = GetAllClasses();
+
+		std::unordered_map<Class const*, std::vector<Class*>> children;
+		std::vector<Class*> roots;
+		for (Class* cls : classes)
+		{
+			if (cls->parent == nullptr)
+				roots.push_back(cls);
+			else
+				children[cls->parent].push_back(cls);
+		}
+
+		// pre-order traversal
+		int index = 0;
+
+		auto number_class = [&children, &index](auto& self, Class* cls, bool parent_declared) -> void
+		{
+			cls->hierarchy_first = index++;
+			cls->hierarchy_declared = parent_declared && cls->declared;
+			auto it = children.find(cls);
+			if (it != children.end())
+				for (Class* child : it->second)
+					self(self, child, cls->hierarchy_declared);
+			cls->hierarchy_last = index - 1;
+		};
+		for (Class* root : roots)
+			number_class(number_class, root, true);
+
+		class_numbering_version.store(version, std::memory_order_release);
+	}
+
 	// ==========================================================
 	// Class functions
 	// ==========================================================
@@ -10,6 +87,19 @@ namespace chaos
 	Class::Class(std::string in_name) :
 		name(std::move(in_name))
 	{
+		std::lock_guard<std::mutex> lock(GetClassHierarchyMutex());
+		GetAllClasses().push_back(this);
+		InvalidateHierarchyNumbering();
+	}
+
+	Class::~Class()
+	{
+		std::lock_guard<std::mutex> lock(GetClassHierarchyMutex());
+		std::vector<Class*>& classes = GetAllClasses();
+		auto it = std::ranges::find(classes, this);
+		if (it != classes.end())
+			classes.erase(it);
+		InvalidateHierarchyNumbering();
 	}
 
 	bool Class::CanCreateInstance() const
@@ -106,6 +196,14 @@ namespace chaos
 		// parent not registered, cannot known result
 		if (parent_class == nullptr || !parent_class->IsDeclared())
 			return InheritanceType::Unknown;
+		// fast path: the whole parent chain is declared, the intervals give the exact answer
+		UpdateHierarchyNumbering();
+		if (hierarchy_declared)
+		{
+			if (parent_class->hierarchy_first <= hierarchy_first && hierarchy_first <= parent_class->hierarchy_last)
+				return InheritanceType::Yes;
+			return InheritanceType::No;
+		}
 		// from top to root in the hierarchy
 		for (Class const* p = parent; p != nullptr; p = p->parent)
 		{
@@ -132,6 +230,7 @@ namespace chaos
 		assert(parent == nullptr);
 
 		parent = in_parent;
+		InvalidateHierarchyNumbering();
 
 #if _DEBUG
 		assert(!HasCyclicParent());
@@ -108,6 +108,7 @@ namespace chaos
 		cls->declared = true;
 		cls->class_size = cls->parent->class_size;
 		cls->info = cls->parent->info;
+		Class::InvalidateHierarchyNumbering();
 		return true;
 	}
 
@@ -136,6 +137,7 @@ namespace chaos
 	{
 		// parent class is MANDATORY for Special objects
 		cls->parent = manager->FindClass(parent_class_name.c_str());
+		Class::InvalidateHierarchyNumbering();
 		if (cls->parent == nullptr)
 		{
 			ClassLog::Error("Class::DoSetSpecialClassParent : special class [%s] has unknown parent class [%s]", cls->name.c_str(), parent_class_name.c_str());
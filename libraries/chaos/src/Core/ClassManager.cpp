@@ -60,6 +60,29 @@ namespace chaos
 		return { nullptr, classes.end(), ClassMatchType::Name }; // empty ClassFindResult result
 	}
 
+	Class* ClassManager::DoFindOrCreateCPPClassInstance(std::type_info const& info, bool search_manager_hierarchy)
+	{
+		// search if the class as already been registered in manager chain
+		ClassManager* manager = this;
+		while (manager != nullptr)
+		{
+			for (Class* cls : manager->classes)
+				if (cls->info != nullptr && *cls->info == info)
+					return cls;
+			if (!search_manager_hierarchy)
+				break;
+			manager = manager->parent_manager.get();
+		}
+		// register the class
+		if (Class* result = new Class(std::string())) // do not name the class yet
+		{
+			result->info = &info;
+			InsertClass(result);
+			return result;
+		}
+		return nullptr;
+	}
+
 	void ClassManager::InsertClass(Class* cls)
 	{
 		assert(cls != nullptr);
@@ -445,6 +445,21 @@ namespace chaos
 		return true;
 	}
 
+	bool Clock::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!JSONSerializableInterface::SerializeIntoSnapshot(writer))
+			return false;
+		writer.Write(clock_time);
+		return true;
+	}
+
+	bool Clock::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!JSONSerializableInterface::SerializeFromSnapshot(reader))
+			return false;
+		return reader.Read(clock_time);
+	}
+
 	void Clock::SetPause(bool in_pause)
 	{
 		if (in_pause)
@@ -24,4 +24,10 @@ namespace chaos
 		path = in_path;
 	}
 
+	void FileResource::AddDependentPath(boost::filesystem::path const& in_path)
+	{
+		if (std::find(dependent_paths.begin(), dependent_paths.end(), in_path) == dependent_paths.end())
+			dependent_paths.push_back(in_path);
+	}
+
 }; // namespace chaos
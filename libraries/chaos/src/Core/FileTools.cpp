@@ -15,6 +15,22 @@ namespace chaos
 #endif
 		};
 
+		/** the mounted archives */
+		static std::vector<shared_ptr<PackedArchive>> mounted_archives;
+		/** protect the mounted archives (loading may happen on several threads) */
+		static std::shared_mutex mounted_archives_mutex;
+
+		/** call func for all mounted archives (last mounted first) until it returns true */
+		template<typename FUNC>
+		static bool ForEachMountedArchive(FUNC const & func)
+		{
+			std::shared_lock<std::shared_mutex> lock(mounted_archives_mutex);
+			for (auto it = mounted_archives.rbegin(); it != mounted_archives.rend(); ++it)
+				if (func(it->get()))
+					return true;
+			return false;
+		}
+
 		static bool DoIsTypedFile(char const* filename, char const* expected_ext)
 		{
 			assert(filename != nullptr);
@@ -142,6 +158,14 @@ namespace chaos
 		{
 			boost::filesystem::path const& resolved_path = path.GetResolvedPath();
 
+			// XXX : in development builds, files on disk override the mounted archives (so that edited files can be hot reloaded)
+#if !_DEBUG
+			// mounted archives
+			if (IsArchivedFile(resolved_path) || IsArchivedDirectory(resolved_path))
+				if (func(resolved_path))
+					return true;
+#endif
+
 			// File Redirection
 #if _DEBUG
 
@@ -170,6 +194,12 @@ namespace chaos
 			if (boost::filesystem::exists(resolved_path))
 				if (func(resolved_path))
 					return true;
+#if _DEBUG
+			// mounted archives
+			if (IsArchivedFile(resolved_path) || IsArchivedDirectory(resolved_path))
+				if (func(resolved_path))
+					return true;
+#endif
 			// failure
 			return false;
 		}
@@ -178,26 +208,43 @@ namespace chaos
 		{
 			std::vector<boost::filesystem::path> filenames;
 
-			auto process_path_func = [&filenames, func](boost::filesystem::path const& p)
+			// XXX : the same directory may be found in several places (file redirection, mounted archives). only the first file with a given name is used
+			auto process_file_func = [&filenames, func](boost::filesystem::path const& path)
+			{
+				boost::filesystem::path filename = path.filename();
+				if (std::find(filenames.begin(), filenames.end(), filename) != filenames.end())
+					return false;
+				filenames.push_back(std::move(filename));
+				return func(path);
+			};
+
+			auto process_path_func = [&process_file_func](boost::filesystem::path const& p)
 			{
-				if (boost::filesystem::is_directory(p))
+				// the files inside the mounted archives
+				auto process_archives = [&p, &process_file_func]()
 				{
-					for (auto it = boost::filesystem::directory_iterator(p) ; it != boost::filesystem::directory_iterator(); ++it)
+					return ForEachMountedArchive([&p, &process_file_func](PackedArchive const* archive)
 					{
-						boost::filesystem::path const& path = it->path();
-
-#if _DEBUG // File Redirection
-
-						boost::filesystem::path filename = path.filename();
-						if (std::find(filenames.begin(), filenames.end(), filename) != filenames.end())
-							continue;
-						filenames.push_back(std::move(filename));
-#endif
-						if (func(path))
-							return true;
+						return archive->ForEachFileInDirectory(p, process_file_func);
+					});
+				};
+				// the files on disk
+				auto process_disk = [&p, &process_file_func]()
+				{
+					if (boost::filesystem::is_directory(p))
+					{
+						for (auto it = boost::filesystem::directory_iterator(p) ; it != boost::filesystem::directory_iterator(); ++it)
+							if (process_file_func(it->path()))
+								return true;
 					}
-				}
-				return false;
+					return false;
+				};
+				// in development builds, files on disk override the mounted archives (see WithFile)
+#if _DEBUG
+				return process_disk() || process_archives();
+#else
+				return process_archives() || process_disk();
+#endif
 			};
 
 			return WithFile(path, process_path_func);
@@ -220,12 +267,76 @@ namespace chaos
 			return DoIsTypedFile(resolved_path.string().c_str(), expected_ext); // use an utility function because path to string give a volatile object
 		}
 
+		bool MountArchive(FilePathParam const& path, FilePathParam const& mount_point)
+		{
+			shared_ptr<PackedArchive> archive = new PackedArchive;
+			if (!archive->Open(path, mount_point.GetResolvedPath()))
+				return false;
+
+			std::unique_lock<std::shared_mutex> lock(mounted_archives_mutex);
+			mounted_archives.push_back(archive);
+
+			FileLog::Message("MountArchive [%s] -> [%s]    entry count = [%d]", path.GetResolvedPath().string().c_str(), archive->GetMountPoint().string().c_str(), int(archive->GetEntries().size()));
+			return true;
+		}
+
+		void UnmountAllArchives()
+		{
+			std::unique_lock<std::shared_mutex> lock(mounted_archives_mutex);
+			mounted_archives.clear(); // the buffers that are still in use keep the mapping alive
+		}
+
+		bool IsArchivedFile(FilePathParam const& path)
+		{
+			boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+			return ForEachMountedArchive([&resolved_path](PackedArchive const* archive)
+			{
+				return (archive->FindEntry(resolved_path) != nullptr);
+			});
+		}
+
+		bool IsArchivedDirectory(FilePathParam const& path)
+		{
+			boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+			return ForEachMountedArchive([&resolved_path](PackedArchive const* archive)
+			{
+				return archive->IsDirectory(resolved_path);
+			});
+		}
+
+		static Buffer<char> DoLoadFileFromArchives(boost::filesystem::path const& resolved_path, LoadFileFlag flags)
+		{
+			Buffer<char> result;
+			ForEachMountedArchive([&result, &resolved_path, flags](PackedArchive const* archive)
+			{
+				if (PackedArchiveEntry const* entry = archive->FindEntry(resolved_path))
+					result = archive->LoadEntry(entry, flags);
+				return (result != nullptr);
+			});
+			return result;
+		}
+
+		static Buffer<char> DoLoadFileFromDiskOrArchives(boost::filesystem::path const& resolved_path, LoadFileFlag flags)
+		{
+			// in development builds, files on disk override the mounted archives (see WithFile)
+#if _DEBUG
+			Buffer<char> result = DoLoadFile(resolved_path, flags);
+			if (result == nullptr)
+				result = DoLoadFileFromArchives(resolved_path, flags);
+#else
+			Buffer<char> result = DoLoadFileFromArchives(resolved_path, flags);
+			if (result == nullptr)
+				result = DoLoadFile(resolved_path, flags);
+#endif
+			return result;
+		}
+
 		Buffer<char> LoadFile(FilePathParam const& path, LoadFileFlag flags)
 		{
 			Buffer<char> result;
 			WithFile(path, [&result, &path, flags](boost::filesystem::path const&p)
 			{
-				result = DoLoadFile(p, flags);
+				result = DoLoadFileFromDiskOrArchives(p, flags);
 #if _DEBUG
 				if (result && GlobalVariables::ShowLoadedFile.Get())
 				{
@@ -0,0 +1,157 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	static double GetFileWatcherTime()
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	FileWatcher::FileWatcher()
+	{
+#if __linux__
+		inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (inotify_fd < 0)
+			FileWatcherLog::Warning("FileWatcher: inotify_init1(...) failure. Files are polled instead");
+#endif
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+		Clear();
+#if __linux__
+		if (inotify_fd >= 0)
+			close(inotify_fd);
+#endif
+	}
+
+	boost::filesystem::path FileWatcher::GetWatchedPath(FilePathParam const& path)
+	{
+		boost::filesystem::path result = FileTools::GetRedirectedPath(path.GetResolvedPath());
+		if (result.empty())
+			result = path.GetResolvedPath();
+		return boost::filesystem::absolute(result).lexically_normal();
+	}
+
+	std::time_t FileWatcher::GetWriteTime(boost::filesystem::path const& p)
+	{
+		boost::system::error_code error;
+		std::time_t result = boost::filesystem::last_write_time(p, error);
+		return (error) ? 0 : result;
+	}
+
+	bool FileWatcher::WatchFile(FilePathParam const& path)
+	{
+		boost::filesystem::path p = GetWatchedPath(path);
+
+		// already watched
+		if (watched_files.find(p) != watched_files.end())
+			return true;
+		if (!boost::filesystem::is_regular_file(p))
+			return false;
+
+		watched_files[p].write_time = GetWriteTime(p);
+
+#if __linux__
+		// watch the directory and not the file itself: editors often replace the file (the watch on the file would be lost)
+		if (inotify_fd >= 0)
+		{
+			boost::filesystem::path directory = p.parent_path();
+
+			int wd = inotify_add_watch(inotify_fd, directory.string().c_str(), IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE);
+			if (wd < 0)
+				FileWatcherLog::Warning("FileWatcher: fails to watch directory [%s]", directory.string().c_str());
+			else
+				watched_directories[wd] = directory; // inotify gives the same descriptor if the directory is already watched
+		}
+#endif
+		return true;
+	}
+
+	void FileWatcher::Clear()
+	{
+#if __linux__
+		if (inotify_fd >= 0)
+			for (auto const& [wd, directory] : watched_directories)
+				inotify_rm_watch(inotify_fd, wd);
+		watched_directories.clear();
+#endif
+		watched_files.clear();
+	}
+
+	bool FileWatcher::IsWatchedFile(FilePathParam const& path) const
+	{
+		return (watched_files.find(GetWatchedPath(path)) != watched_files.end());
+	}
+
+	void FileWatcher::DetectChanges(double current_time)
+	{
+#if __linux__
+		if (inotify_fd >= 0)
+		{
+			alignas(inotify_event) char buffer[4096];
+			for (;;)
+			{
+				ssize_t len = read(inotify_fd, buffer, sizeof(buffer)); // non blocking
+				if (len <= 0)
+					break;
+
+				for (char const* ptr = buffer; ptr < buffer + len; )
+				{
+					inotify_event const* event = reinterpret_cast<inotify_event const*>(ptr);
+					ptr += sizeof(inotify_event) + event->len;
+
+					if (event->len == 0) // an event on the directory itself
+						continue;
+
+					auto directory_it = watched_directories.find(event->wd);
+					if (directory_it == watched_directories.end())
+						continue;
+
+					auto file_it = watched_files.find(directory_it->second / event->name);
+					if (file_it != watched_files.end())
+						file_it->second.change_time = current_time;
+				}
+			}
+			return;
+		}
+#endif
+		// no notification system: compare the write times
+		if (current_time - last_polling_time < polling_interval)
+			return;
+		last_polling_time = current_time;
+
+		for (auto& [p, file] : watched_files)
+		{
+			std::time_t write_time = GetWriteTime(p);
+			if (write_time != file.write_time)
+			{
+				file.write_time = write_time;
+				file.change_time = current_time;
+			}
+		}
+	}
+
+	std::vector<boost::filesystem::path> FileWatcher::PollChanges()
+	{
+		std::vector<boost::filesystem::path> result;
+
+		if (watched_files.size() == 0)
+			return result;
+
+		double current_time = GetFileWatcherTime();
+		DetectChanges(current_time);
+
+		for (auto& [p, file] : watched_files)
+		{
+			if (file.change_time <= 0.0 || current_time - file.change_time < debounce_duration)
+				continue;
+			file.change_time = 0.0;
+			file.write_time = GetWriteTime(p);
+			result.push_back(p);
+		}
+		return result;
+	}
+
+}; // namespace chaos
\ No newline at end of file
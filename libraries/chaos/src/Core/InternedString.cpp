@@ -0,0 +1,111 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================================================
+	// InternedStringTable
+	// =====================================================================
+
+	class InternedStringTable
+	{
+	public:
+
+		/** get the table */
+		static InternedStringTable& GetInstance()
+		{
+			static InternedStringTable result; // never destroyed before the interned strings of static objects (constructed first)
+			return result;
+		}
+
+		/** search an entry (nullptr if not found) */
+		InternedStringEntry const* Find(std::string_view str) const
+		{
+			std::shared_lock<std::shared_mutex> lock(mutex);
+			auto it = entries_by_string.find(str);
+			return (it != entries_by_string.end()) ? it->second : nullptr;
+		}
+
+		/** search or insert an entry */
+		InternedStringEntry const* Intern(std::string_view str)
+		{
+			// most of the time, the string is already there
+			if (InternedStringEntry const* result = Find(str))
+				return result;
+
+			std::unique_lock<std::shared_mutex> lock(mutex);
+			return DoIntern(str);
+		}
+
+		/** get the number of entries */
+		size_t GetCount() const
+		{
+			std::shared_lock<std::shared_mutex> lock(mutex);
+			return entries.size();
+		}
+
+	protected:
+
+		/** search or insert an entry (the lock is already held) */
+		InternedStringEntry const* DoIntern(std::string_view str)
+		{
+			// another thread may have inserted the string in the meantime
+			auto it = entries_by_string.find(str);
+			if (it != entries_by_string.end())
+				return it->second;
+
+			// insert the entry (a deque never moves its elements: the string and its views are stable)
+			InternedStringEntry& entry = entries.emplace_back();
+			entry.str = str;
+			entry.id = uint32_t(entries.size()); // 0 is reserved for the empty string
+			entries_by_string[entry.str] = &entry;
+
+			// the lowercase version
+			std::string lowercase_str = entry.str;
+			for (char& c : lowercase_str)
+				c = char(tolower((unsigned char)c));
+			entry.lowercase_entry = (lowercase_str == entry.str) ? &entry : DoIntern(lowercase_str);
+
+			return &entry;
+		}
+
+	protected:
+
+		/** the mutex for the table */
+		mutable std::shared_mutex mutex;
+		/** the entries */
+		std::deque<InternedStringEntry> entries;
+		/** the entries by string (the views point on the entries' strings) */
+		std::unordered_map<std::string_view, InternedStringEntry*> entries_by_string;
+	};
+
+	// =====================================================================
+	// InternedString
+	// =====================================================================
+
+	InternedString::InternedString(char const* str)
+	{
+		if (!StringTools::IsEmpty(str))
+			entry = InternedStringTable::GetInstance().Intern(str);
+	}
+
+	InternedString::InternedString(std::string const& str)
+	{
+		if (!str.empty())
+			entry = InternedStringTable::GetInstance().Intern(str);
+	}
+
+	InternedString InternedString::Find(char const* str)
+	{
+		InternedString result;
+		if (!StringTools::IsEmpty(str))
+			result.entry = InternedStringTable::GetInstance().Find(str);
+		return result;
+	}
+
+	size_t InternedString::GetInternedCount()
+	{
+		return InternedStringTable::GetInstance().GetCount();
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -16,4 +16,14 @@ namespace chaos
 		return true;
 	}
 
+	bool JSONSerializableInterface::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		return true;
+	}
+
+	bool JSONSerializableInterface::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		return true;
+	}
+
 }; // namespace chaos
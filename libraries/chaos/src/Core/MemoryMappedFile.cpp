@@ -0,0 +1,90 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		Close();
+	}
+
+	bool MemoryMappedFile::Open(FilePathParam const& path)
+	{
+		Close();
+
+		boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+
+#if _WIN32
+
+		file_handle = CreateFileW(resolved_path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file_handle == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER file_size;
+		if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0)
+		{
+			Close();
+			return false;
+		}
+
+		mapping_handle = CreateFileMappingW(file_handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+		if (mapping_handle == NULL)
+		{
+			Close();
+			return false;
+		}
+
+		data = (char*)MapViewOfFile(mapping_handle, FILE_MAP_COPY, 0, 0, 0);
+		if (data == nullptr)
+		{
+			Close();
+			return false;
+		}
+		size = size_t(file_size.QuadPart);
+
+#else
+
+		int fd = open(resolved_path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat file_stat;
+		if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+		{
+			close(fd);
+			return false;
+		}
+
+		void* mapping = mmap(nullptr, size_t(file_stat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		close(fd); // the mapping keeps a reference on the file
+		if (mapping == MAP_FAILED)
+			return false;
+
+		data = (char*)mapping;
+		size = size_t(file_stat.st_size);
+
+#endif
+
+		return true;
+	}
+
+	void MemoryMappedFile::Close()
+	{
+#if _WIN32
+		if (data != nullptr)
+			UnmapViewOfFile(data);
+		if (mapping_handle != NULL)
+			CloseHandle(mapping_handle);
+		if (file_handle != INVALID_HANDLE_VALUE)
+			CloseHandle(file_handle);
+		mapping_handle = NULL;
+		file_handle = INVALID_HANDLE_VALUE;
+#else
+		if (data != nullptr)
+			munmap(data, size);
+#endif
+		data = nullptr;
+		size = 0;
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -11,6 +11,141 @@ namespace chaos
 
 	char const * MyBase64::base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+	// ==========================================
+	// Single pass decoding
+	// ==========================================
+
+	static constexpr uint8_t BASE64_WHITESPACE = 0x40;
+	static constexpr uint8_t BASE64_PADDING = 0x41;
+	static constexpr uint8_t BASE64_INVALID = 0xFF;
+
+	/** the table character => 6 bits value (or one of the values above) */
+	static constexpr std::array<uint8_t, 256> base64_decode_table = []()
+	{
+		std::array<uint8_t, 256> result = {};
+		for (uint8_t& value : result)
+			value = BASE64_INVALID;
+		for (int i = 0; i < 26; ++i)
+		{
+			result['A' + i] = uint8_t(i);
+			result['a' + i] = uint8_t(26 + i);
+		}
+		for (int i = 0; i < 10; ++i)
+			result['0' + i] = uint8_t(52 + i);
+		result['+'] = 62;
+		result['/'] = 63;
+		result['='] = BASE64_PADDING;
+		result[' '] = result['\t'] = result['\n'] = result['\r'] = BASE64_WHITESPACE;
+		return result;
+	}();
+
+#if defined _M_X64 || defined __SSE2__
+
+	// XXX : decode 16 characters into 12 bytes with SSE2 only (no pshufb)
+	//       returns false whether any character is not a base64 digit (whitespace, padding ...) so that the scalar path handles it
+	static bool DecodeBase64Block16(char const* src, char* dst)
+	{
+		__m128i c = _mm_loadu_si128((__m128i const*)src);
+
+		// classify the characters (characters above 127 are negative and never match)
+		__m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('Z' + 1)));
+		__m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('z' + 1)));
+		__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+		__m128i plus  = _mm_cmpeq_epi8(c, _mm_set1_epi8('+'));
+		__m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+
+		__m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(_mm_or_si128(digit, plus), slash));
+		if (_mm_movemask_epi8(valid) != 0xFFFF)
+			return false;
+
+		// translate characters into 6 bits values
+		__m128i offset = _mm_or_si128(
+			_mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-65)), _mm_and_si128(lower, _mm_set1_epi8(-71))),
+			_mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(4)), _mm_or_si128(_mm_and_si128(plus, _mm_set1_epi8(19)), _mm_and_si128(slash, _mm_set1_epi8(16)))));
+		__m128i values = _mm_add_epi8(c, offset);
+
+		// pack 2 x 6 bits into 12 bits (16 bits lanes), then 2 x 12 bits into 24 bits (32 bits lanes)
+		__m128i even = _mm_and_si128(values, _mm_set1_epi16(0x00FF));
+		__m128i odd = _mm_srli_epi16(values, 8);
+		__m128i packed12 = _mm_or_si128(_mm_slli_epi16(even, 6), odd);
+		__m128i packed24 = _mm_madd_epi16(packed12, _mm_set1_epi32(0x00011000));
+
+		alignas(16) uint32_t groups[4];
+		_mm_store_si128((__m128i*)groups, packed24);
+		for (int i = 0; i < 4; ++i)
+		{
+			dst[i * 3 + 0] = char(groups[i] >> 16);
+			dst[i * 3 + 1] = char(groups[i] >> 8);
+			dst[i * 3 + 2] = char(groups[i]);
+		}
+		return true;
+	}
+
+#endif
+
+	bool MyBase64::Decode(char const* src, size_t src_size, char* dst, size_t dst_size, size_t& decoded_size)
+	{
+		assert(src != nullptr || src_size == 0);
+
+		decoded_size = 0;
+
+		uint32_t accumulator = 0;
+		int group_count = 0; // number of 6 bits values in the accumulator
+
+		size_t i = 0;
+		while (i < src_size)
+		{
+#if defined _M_X64 || defined __SSE2__
+			// fast path: full groups of 16 characters
+			if (group_count == 0 && src_size - i >= 16 && dst_size - decoded_size >= 12)
+			{
+				if (DecodeBase64Block16(src + i, dst + decoded_size))
+				{
+					i += 16;
+					decoded_size += 12;
+					continue;
+				}
+			}
+#endif
+			uint8_t value = base64_decode_table[(unsigned char)src[i++]];
+			if (value < 64)
+			{
+				accumulator = (accumulator << 6) | value;
+				if (++group_count == 4)
+				{
+					if (dst_size - decoded_size < 3)
+						return false;
+					dst[decoded_size++] = char(accumulator >> 16);
+					dst[decoded_size++] = char(accumulator >> 8);
+					dst[decoded_size++] = char(accumulator);
+					accumulator = 0;
+					group_count = 0;
+				}
+			}
+			else if (value == BASE64_WHITESPACE)
+				continue;
+			else if (value == BASE64_PADDING)
+				break;
+			else
+				return false;
+		}
+
+		// the last incomplete group
+		if (group_count == 1)
+			return false;
+		if (group_count > 1)
+		{
+			size_t count = size_t(group_count - 1);
+			if (dst_size - decoded_size < count)
+				return false;
+			accumulator <<= 6 * (4 - group_count);
+			dst[decoded_size++] = char(accumulator >> 16);
+			if (count > 1)
+				dst[decoded_size++] = char(accumulator >> 8);
+		}
+		return true;
+	}
+
 	// XXX : explanation
 	//       we split input into groups of 3 bytes [0-255]
 	//       we can see 3 bytes as
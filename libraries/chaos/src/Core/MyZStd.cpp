@@ -0,0 +1,74 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+#if CHAOS_USE_ZSTD
+
+	Buffer<char> MyZStd::Encode(Buffer<char> const & src)
+	{
+		Buffer<char> compressed = SharedBufferPolicy<char>::NewBuffer(ZSTD_compressBound(src.bufsize));
+		if (compressed == nullptr)
+			return Buffer<char>();
+
+		size_t size = ZSTD_compress(compressed.data, compressed.bufsize, src.data, src.bufsize, ZSTD_CLEVEL_DEFAULT);
+		if (ZSTD_isError(size))
+			return Buffer<char>();
+
+		Buffer<char> result = SharedBufferPolicy<char>::NewBuffer(size);
+		if (result != nullptr)
+			memcpy(result.data, compressed.data, size);
+		return result;
+	}
+
+	Buffer<char> MyZStd::Decode(Buffer<char> const & src)
+	{
+		unsigned long long content_size = ZSTD_getFrameContentSize(src.data, src.bufsize);
+		if (content_size == ZSTD_CONTENTSIZE_ERROR || content_size == ZSTD_CONTENTSIZE_UNKNOWN) // XXX : streams without content size are not supported
+			return Buffer<char>();
+
+		Buffer<char> result = SharedBufferPolicy<char>::NewBuffer(size_t(content_size));
+		if (result == nullptr && content_size > 0)
+			return Buffer<char>();
+
+		size_t decoded_size = 0;
+		if (!Decode(src.data, src.bufsize, result.data, result.bufsize, decoded_size))
+			return Buffer<char>();
+		return result;
+	}
+
+	bool MyZStd::Decode(char const* src, size_t src_size, char* dst, size_t dst_size, size_t& decoded_size)
+	{
+		decoded_size = 0;
+
+		size_t result = ZSTD_decompress(dst, dst_size, src, src_size);
+		if (ZSTD_isError(result))
+			return false;
+		decoded_size = result;
+		return true;
+	}
+
+#else // CHAOS_USE_ZSTD
+
+	Buffer<char> MyZStd::Encode(Buffer<char> const & src)
+	{
+		Log::Error("MyZStd::Encode: zstd is not available on this platform");
+		return Buffer<char>();
+	}
+
+	Buffer<char> MyZStd::Decode(Buffer<char> const & src)
+	{
+		Log::Error("MyZStd::Decode: zstd is not available on this platform");
+		return Buffer<char>();
+	}
+
+	bool MyZStd::Decode(char const* src, size_t src_size, char* dst, size_t dst_size, size_t& decoded_size)
+	{
+		Log::Error("MyZStd::Decode: zstd is not available on this platform");
+		decoded_size = 0;
+		return false;
+	}
+
+#endif // CHAOS_USE_ZSTD
+
+}; // namespace chaos
\ No newline at end of file
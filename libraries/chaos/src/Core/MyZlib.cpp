@@ -94,5 +94,27 @@ namespace chaos
 		return result;
 	}
 
+	bool MyZLib::Decode(char const* src, size_t src_size, char* dst, size_t dst_size, size_t& decoded_size)
+	{
+		decoded_size = 0;
+
+		z_stream strm;
+		strm.zalloc = Z_NULL;
+		strm.zfree = Z_NULL;
+		strm.opaque = Z_NULL;
+		strm.avail_in = (uInt)src_size;
+		strm.next_in = (unsigned char*)src;
+		strm.avail_out = (uInt)dst_size;
+		strm.next_out = (unsigned char*)dst;
+
+		if (inflateInit2(&strm, MAX_WBITS + 32) != Z_OK) // +32 : automatic zlib/gzip header detection
+			return false;
+
+		int error = inflate(&strm, Z_FINISH); // the whole input and output are given at once
+		decoded_size = dst_size - strm.avail_out;
+		inflateEnd(&strm);
+
+		return (error == Z_STREAM_END);
+	}
 
 }; // namespace chaos
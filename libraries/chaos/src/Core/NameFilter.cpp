@@ -33,24 +33,50 @@ namespace chaos
 		return true;
 	}
 
+	bool NameFilter::IsNameEnabled(InternedString name) const
+	{
+		// same as above, but names only differing by case have the same lowercase entry
+		for (InternedString const & disabled : disabled_interned_names)
+			if (name.IsSameCaseInsensitive(disabled))
+				return false;
+		if (enabled_interned_names.size() > 0)
+		{
+			for (InternedString const & enabled : enabled_interned_names)
+				if (name.IsSameCaseInsensitive(enabled))
+					return true;
+			return false;
+		}
+		return true;
+	}
+
+	void NameFilter::UpdateInternedNames()
+	{
+		enabled_interned_names.assign(enabled_names.begin(), enabled_names.end());
+		disabled_interned_names.assign(disabled_names.begin(), disabled_names.end());
+	}
+
 	void NameFilter::AddEnabledNames(char const * names)
 	{
 		AddNames(names, enabled_names, name_separator);
+		UpdateInternedNames();
 	}
 
 	void NameFilter::AddDisabledNames(char const * names)
 	{
 		AddNames(names, disabled_names, name_separator);
+		UpdateInternedNames();
 	}
 
 	void NameFilter::RemoveEnabledNames(char const * names)
 	{
 		RemoveNames(names, enabled_names, name_separator);
+		UpdateInternedNames();
 	}
 
 	void NameFilter::RemoveDisabledNames(char const * names)
 	{
 		RemoveNames(names, disabled_names, name_separator);
+		UpdateInternedNames();
 	}
 
 	void NameFilter::AddNames(char const * names, std::vector<std::string> & target_list, char separator)
@@ -162,6 +188,7 @@ namespace chaos
 			}
 			return (enabled_names_found && disabled_names_found); // if both are true, no need to search in other sources
 		});
+		dst.UpdateInternedNames();
 
 		return true;
 	}
@@ -9,12 +9,24 @@ namespace chaos
 			name.clear();
 		else
 			name = in_name;
+		interned_name = {};
+	}
+
+	void NamedInterface::SetName(InternedString in_name)
+	{
+		name = in_name.c_str();
+		interned_name = in_name;
 	}
 
 	void NamedInterface::SetObjectNaming(ObjectRequest request)
 	{
 		if (request.IsStringRequest())
-			SetName(request.name);
+		{
+			if (!request.interned_name.empty())
+				SetName(request.interned_name);
+			else
+				SetName(request.name);
+		}
 		else if (request.IsTagRequest())
 			SetTag(request.tag);
 	}
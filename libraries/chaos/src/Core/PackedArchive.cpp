@@ -0,0 +1,486 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================================================
+	// PackedArchiveBufferPolicy
+	// =====================================================================
+
+	/** a policy for the buffers that point directly into the mapping of an archive (the mapping is kept alive) */
+	class PackedArchiveBufferPolicy : public BufferPolicyBase
+	{
+	public:
+
+		/** constructor */
+		PackedArchiveBufferPolicy(MemoryMappedFile* in_file) :
+			file(in_file),
+			reference_count(1)
+		{
+		}
+
+	protected:
+
+		/** override */
+		virtual void CopyBuffer(BufferBase* dst, BufferBase const* src) override
+		{
+			Buffer<char>* d = (Buffer<char>*)dst;
+			Buffer<char> const* s = (Buffer<char> const*)src;
+
+			d->data = s->data;
+			d->bufsize = s->bufsize;
+			d->SetPolicy(this);
+			++reference_count;
+		}
+
+		/** override */
+		virtual void DestroyBuffer(BufferBase* buf) override
+		{
+			if (--reference_count == 0)
+				delete(this);
+		}
+
+	protected:
+
+		/** the mapping */
+		shared_ptr<MemoryMappedFile> file;
+		/** count the reference on the buffer */
+		std::atomic<int> reference_count;
+	};
+
+	// =====================================================================
+	// Archive layout
+	// =====================================================================
+
+	static constexpr size_t PACKED_ARCHIVE_HEADER_SIZE = 32; // magic, version, entry count, reserved, index offset, index size
+	static constexpr size_t PACKED_ARCHIVE_INDEX_ENTRY_SIZE = 32; // offset, stored size, size, compression, path length (then the path)
+
+	template<typename T>
+	static T ReadArchiveValue(char const* src)
+	{
+		T result;
+		memcpy(&result, src, sizeof(T));
+		return result;
+	}
+
+	template<typename T>
+	static void WriteArchiveValue(std::ostream& stream, T value)
+	{
+		stream.write((char const*)&value, sizeof(T));
+	}
+
+	static void WriteArchivePadding(std::ostream& stream, uint64_t count)
+	{
+		static char const zeros[1024] = { 0 };
+		while (count > 0)
+		{
+			uint64_t write_count = std::min(count, uint64_t(sizeof(zeros)));
+			stream.write(zeros, std::streamsize(write_count));
+			count -= write_count;
+		}
+	}
+
+	// =====================================================================
+	// PackedArchive
+	// =====================================================================
+
+	std::string PackedArchive::NormalizeArchivePath(std::string path)
+	{
+		for (char& c : path)
+		{
+			if (c == '\\')
+				c = '/';
+#if _WIN32
+			c = char(tolower((unsigned char)c)); // paths are not case sensitive on windows
+#endif
+		}
+		return path;
+	}
+
+	bool PackedArchive::Open(FilePathParam const& path, boost::filesystem::path const& in_mount_point)
+	{
+		Close();
+
+		boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+
+		// map the file
+		shared_ptr<MemoryMappedFile> new_file = new MemoryMappedFile;
+		if (!new_file->Open(resolved_path))
+		{
+			PackedArchiveLog::Error("PackedArchive::Open: fails to map [%s]", resolved_path.string().c_str());
+			return false;
+		}
+
+		char const* data = new_file->GetData();
+		size_t size = new_file->GetSize();
+
+		// read the header
+		if (size < PACKED_ARCHIVE_HEADER_SIZE || ReadArchiveValue<uint32_t>(data) != MAGIC)
+		{
+			PackedArchiveLog::Error("PackedArchive::Open: [%s] is not an archive", resolved_path.string().c_str());
+			return false;
+		}
+		if (ReadArchiveValue<uint32_t>(data + 4) != VERSION)
+		{
+			PackedArchiveLog::Error("PackedArchive::Open: [%s] unsupported version", resolved_path.string().c_str());
+			return false;
+		}
+		uint32_t entry_count  = ReadArchiveValue<uint32_t>(data + 8);
+		uint64_t index_offset = ReadArchiveValue<uint64_t>(data + 16);
+		uint64_t index_size   = ReadArchiveValue<uint64_t>(data + 24);
+		if (index_offset > size || index_size > size - index_offset)
+		{
+			PackedArchiveLog::Error("PackedArchive::Open: [%s] corrupted index", resolved_path.string().c_str());
+			return false;
+		}
+
+		// read the index
+		std::vector<PackedArchiveEntry> new_entries;
+		new_entries.reserve(entry_count);
+
+		char const* index = data + index_offset;
+		char const* index_end = index + index_size;
+		for (uint32_t i = 0; i < entry_count; ++i)
+		{
+			if (size_t(index_end - index) < PACKED_ARCHIVE_INDEX_ENTRY_SIZE)
+				break;
+
+			PackedArchiveEntry entry;
+			entry.offset      = ReadArchiveValue<uint64_t>(index);
+			entry.stored_size = ReadArchiveValue<uint64_t>(index + 8);
+			entry.size        = ReadArchiveValue<uint64_t>(index + 16);
+			entry.compression = PackedArchiveCompression(ReadArchiveValue<uint32_t>(index + 24));
+			uint32_t path_length = ReadArchiveValue<uint32_t>(index + 28);
+			index += PACKED_ARCHIVE_INDEX_ENTRY_SIZE;
+
+			if (size_t(index_end - index) < path_length || entry.offset > size || entry.stored_size > size - entry.offset)
+				break;
+			// an uncompressed entry is a view on the mapping: it must be followed by at least one padding byte (null terminator)
+			if (entry.compression == PackedArchiveCompression::None)
+			{
+				if (entry.size != entry.stored_size || entry.stored_size >= size - entry.offset)
+					break;
+			}
+			else if (entry.compression != PackedArchiveCompression::ZLib && entry.compression != PackedArchiveCompression::ZStd)
+				break;
+			entry.path = NormalizeArchivePath(std::string(index, path_length));
+			index += path_length;
+
+			new_entries.push_back(std::move(entry));
+		}
+		if (new_entries.size() != entry_count)
+		{
+			PackedArchiveLog::Error("PackedArchive::Open: [%s] corrupted index", resolved_path.string().c_str());
+			return false;
+		}
+
+		// the builder sorts the entries, but normalization may change the order
+		std::sort(new_entries.begin(), new_entries.end(), [](PackedArchiveEntry const& e1, PackedArchiveEntry const& e2)
+		{
+			return (e1.path < e2.path);
+		});
+
+		// everything is fine
+		file = std::move(new_file);
+		entries = std::move(new_entries);
+		mount_point = (in_mount_point.is_relative()) ?
+			(boost::filesystem::current_path() / in_mount_point).lexically_normal() :
+			in_mount_point.lexically_normal();
+
+		return true;
+	}
+
+	void PackedArchive::Close()
+	{
+		file = nullptr; // the buffers given by LoadEntry(...) keep their own reference on the mapping
+		entries.clear();
+		mount_point.clear();
+	}
+
+	bool PackedArchive::GetArchivePath(boost::filesystem::path const& path, std::string& result) const
+	{
+		if (file == nullptr)
+			return false;
+
+		// work with absolute path
+		boost::filesystem::path p = (path.is_relative()) ?
+			(boost::filesystem::current_path() / path).lexically_normal() :
+			path.lexically_normal();
+
+		// search whether the path is inside the mount point
+		auto it1 = p.begin();
+		auto it2 = mount_point.begin();
+		for (; it2 != mount_point.end(); ++it1, ++it2)
+		{
+			if (*it2 == ".") // trailing separator
+				continue;
+			if (it1 == p.end())
+				return false;
+#if _WIN32
+			if (StringTools::Stricmp(it1->string(), it2->string()) != 0) // because even on windows, this is case sensitive
+#else
+			if (*it1 != *it2)
+#endif
+				return false;
+		}
+
+		// the remaining components
+		result.clear();
+		for (; it1 != p.end(); ++it1)
+		{
+			std::string component = it1->string();
+			if (component == "." || component.empty())
+				continue;
+			if (!result.empty())
+				result += '/';
+			result += component;
+		}
+		result = NormalizeArchivePath(std::move(result));
+		return true;
+	}
+
+	PackedArchiveEntry const* PackedArchive::FindEntryByArchivePath(std::string const& archive_path) const
+	{
+		auto it = std::lower_bound(entries.begin(), entries.end(), archive_path, [](PackedArchiveEntry const& entry, std::string const& p)
+		{
+			return (entry.path < p);
+		});
+		if (it == entries.end() || it->path != archive_path)
+			return nullptr;
+		return &*it;
+	}
+
+	PackedArchiveEntry const* PackedArchive::FindEntry(boost::filesystem::path const& path) const
+	{
+		std::string archive_path;
+		if (!GetArchivePath(path, archive_path))
+			return nullptr;
+		return FindEntryByArchivePath(archive_path);
+	}
+
+	bool PackedArchive::IsDirectory(boost::filesystem::path const& path) const
+	{
+		std::string archive_path;
+		if (!GetArchivePath(path, archive_path))
+			return false;
+		if (archive_path.empty()) // the mount point itself
+			return (entries.size() > 0);
+
+		std::string prefix = archive_path + '/';
+		auto it = std::lower_bound(entries.begin(), entries.end(), prefix, [](PackedArchiveEntry const& entry, std::string const& p)
+		{
+			return (entry.path < p);
+		});
+		return (it != entries.end() && it->path.starts_with(prefix));
+	}
+
+	bool PackedArchive::ForEachFileInDirectory(boost::filesystem::path const& directory_path, LightweightFunction<bool(boost::filesystem::path const&)> func) const
+	{
+		std::string prefix;
+		if (!GetArchivePath(directory_path, prefix))
+			return false;
+		if (!prefix.empty())
+			prefix += '/';
+
+		// the entries of a directory are contiguous
+		auto it = std::lower_bound(entries.begin(), entries.end(), prefix, [](PackedArchiveEntry const& entry, std::string const& p)
+		{
+			return (entry.path < p);
+		});
+		for (; it != entries.end() && it->path.starts_with(prefix); ++it)
+		{
+			if (it->path.find('/', prefix.length()) != std::string::npos) // inside a sub directory
+				continue;
+			if (func(mount_point / it->path))
+				return true;
+		}
+		return false;
+	}
+
+	Buffer<char> PackedArchive::LoadEntry(PackedArchiveEntry const* entry, LoadFileFlag flags) const
+	{
+		if (entry == nullptr || file == nullptr)
+			return {};
+
+		bool ascii = ((flags & LoadFileFlag::Ascii) == LoadFileFlag::Ascii);
+
+		char* src = file->GetData() + entry->offset;
+
+		// uncompressed entry : a view on the mapping (the padding gives the null terminator for ascii files)
+		if (entry->compression == PackedArchiveCompression::None)
+		{
+			assert(entry->size == entry->stored_size && entry->offset + entry->size < file->GetSize()); // checked by Open(...)
+			if (ascii && src[entry->size] != 0)
+			{
+				PackedArchiveLog::Error("PackedArchive::LoadEntry: [%s] is not null terminated", entry->path.c_str());
+				return {};
+			}
+			Buffer<char> result(src, size_t(entry->size) + ((ascii) ? 1 : 0));
+			result.SetPolicy(new PackedArchiveBufferPolicy(file.get()));
+			return result;
+		}
+
+		// compressed entry
+		Buffer<char> result = SharedBufferPolicy<char>::NewBuffer(size_t(entry->size) + ((ascii) ? 1 : 0));
+		if (result == nullptr)
+			return {};
+
+		size_t decoded_size = 0;
+		bool decoded = false;
+		if (entry->compression == PackedArchiveCompression::ZLib)
+			decoded = MyZLib().Decode(src, size_t(entry->stored_size), result.data, size_t(entry->size), decoded_size);
+		else if (entry->compression == PackedArchiveCompression::ZStd)
+			decoded = MyZStd().Decode(src, size_t(entry->stored_size), result.data, size_t(entry->size), decoded_size);
+
+		if (!decoded || decoded_size != entry->size)
+		{
+			PackedArchiveLog::Error("PackedArchive::LoadEntry: fails to decode [%s]", entry->path.c_str());
+			return {};
+		}
+		if (ascii)
+			result.data[entry->size] = 0;
+		return result;
+	}
+
+	// =====================================================================
+	// PackedArchiveBuilder
+	// =====================================================================
+
+	void PackedArchiveBuilder::AddFile(boost::filesystem::path const& path, std::string archive_path)
+	{
+		files.push_back({ path, PackedArchive::NormalizeArchivePath(std::move(archive_path)) });
+	}
+
+	bool PackedArchiveBuilder::AddDirectory(boost::filesystem::path const& directory_path, std::string const& archive_prefix)
+	{
+		boost::system::error_code error;
+		if (!boost::filesystem::is_directory(directory_path, error))
+		{
+			PackedArchiveLog::Error("PackedArchiveBuilder::AddDirectory: [%s] is not a directory", directory_path.string().c_str());
+			return false;
+		}
+
+		for (auto it = boost::filesystem::recursive_directory_iterator(directory_path); it != boost::filesystem::recursive_directory_iterator(); ++it)
+		{
+			if (!boost::filesystem::is_regular_file(it->status()))
+				continue;
+			boost::filesystem::path relative_path = it->path().lexically_relative(directory_path);
+			std::string archive_path = archive_prefix.empty() ?
+				relative_path.generic_string() :
+				archive_prefix + '/' + relative_path.generic_string();
+			AddFile(it->path(), std::move(archive_path));
+		}
+		return true;
+	}
+
+	bool PackedArchiveBuilder::Save(FilePathParam const& path) const
+	{
+		boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+
+		// sort the files by archive path (so that the entries of a directory are contiguous)
+		std::vector<InputFile const*> sorted_files;
+		sorted_files.reserve(files.size());
+		for (InputFile const& input_file : files)
+			sorted_files.push_back(&input_file);
+		std::stable_sort(sorted_files.begin(), sorted_files.end(), [](InputFile const* f1, InputFile const* f2)
+		{
+			return (f1->archive_path < f2->archive_path);
+		});
+		// remove the duplicates
+		auto last = std::unique(sorted_files.begin(), sorted_files.end(), [](InputFile const* f1, InputFile const* f2)
+		{
+			if (f1->archive_path != f2->archive_path)
+				return false;
+			PackedArchiveLog::Warning("PackedArchiveBuilder::Save: [%s] added several times", f1->archive_path.c_str());
+			return true;
+		});
+		sorted_files.erase(last, sorted_files.end());
+
+		std::ofstream stream(resolved_path.string().c_str(), std::ofstream::binary | std::ofstream::trunc);
+		if (!stream)
+		{
+			PackedArchiveLog::Error("PackedArchiveBuilder::Save: fails to create [%s]", resolved_path.string().c_str());
+			return false;
+		}
+
+		// the header is written at the end, once the index position is known
+		WriteArchivePadding(stream, PackedArchive::ALIGNMENT);
+
+		// write the entries (files are loaded one at a time)
+		std::vector<PackedArchiveEntry> entries;
+		entries.reserve(sorted_files.size());
+
+		uint64_t position = PackedArchive::ALIGNMENT;
+		for (InputFile const* input_file : sorted_files)
+		{
+			Buffer<char> content = FileTools::LoadFile(input_file->path, LoadFileFlag::NoErrorTrace);
+			if (content == nullptr && !boost::filesystem::is_regular_file(input_file->path)) // empty files are fine
+			{
+				PackedArchiveLog::Error("PackedArchiveBuilder::Save: fails to read [%s]", input_file->path.string().c_str());
+				return false;
+			}
+
+			PackedArchiveEntry entry;
+			entry.path = input_file->archive_path;
+			entry.offset = position;
+			entry.size = content.bufsize;
+
+			// compress the file if this is worth it
+			Buffer<char> compressed_content;
+			if (compression != PackedArchiveCompression::None && content.bufsize > 0)
+			{
+				if (compression == PackedArchiveCompression::ZLib)
+					compressed_content = MyZLib().Encode(content);
+				else if (compression == PackedArchiveCompression::ZStd)
+					compressed_content = MyZStd().Encode(content);
+
+				if (compressed_content != nullptr && float(compressed_content.bufsize) <= float(content.bufsize) * (1.0f - min_compression_gain))
+					entry.compression = compression;
+			}
+			Buffer<char> const& stored_content = (entry.compression == PackedArchiveCompression::None) ? content : compressed_content;
+			entry.stored_size = stored_content.bufsize;
+
+			stream.write(stored_content.data, std::streamsize(stored_content.bufsize));
+
+			// align the next entry. uncompressed entries are followed by at least one zero (null terminator for ascii loading)
+			uint64_t padding = PackedArchive::ALIGNMENT - (entry.stored_size % PackedArchive::ALIGNMENT);
+			if (padding == PackedArchive::ALIGNMENT && entry.compression != PackedArchiveCompression::None)
+				padding = 0;
+			WriteArchivePadding(stream, padding);
+
+			position += entry.stored_size + padding;
+			entries.push_back(std::move(entry));
+		}
+
+		// write the index
+		uint64_t index_offset = position;
+		for (PackedArchiveEntry const& entry : entries)
+		{
+			WriteArchiveValue(stream, entry.offset);
+			WriteArchiveValue(stream, entry.stored_size);
+			WriteArchiveValue(stream, entry.size);
+			WriteArchiveValue(stream, uint32_t(entry.compression));
+			WriteArchiveValue(stream, uint32_t(entry.path.length()));
+			stream.write(entry.path.c_str(), std::streamsize(entry.path.length()));
+			position += PACKED_ARCHIVE_INDEX_ENTRY_SIZE + entry.path.length();
+		}
+		uint64_t index_size = position - index_offset;
+
+		// write the header
+		stream.seekp(0, std::ios::beg);
+		WriteArchiveValue(stream, PackedArchive::MAGIC);
+		WriteArchiveValue(stream, PackedArchive::VERSION);
+		WriteArchiveValue(stream, uint32_t(entries.size()));
+		WriteArchiveValue(stream, uint32_t(0)); // reserved
+		WriteArchiveValue(stream, index_offset);
+		WriteArchiveValue(stream, index_size);
+
+		if (!stream)
+		{
+			PackedArchiveLog::Error("PackedArchiveBuilder::Save: fails to write [%s]", resolved_path.string().c_str());
+			return false;
+		}
+		return true;
+	}
+
+}; // namespace chaos
\ No newline at end of file
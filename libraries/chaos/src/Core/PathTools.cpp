@@ -21,12 +21,12 @@ namespace chaos
 			{
 				boost::filesystem::file_status status = boost::filesystem::status(p);
 
-				if (status.type() == boost::filesystem::file_type::directory_file)
+				if (status.type() == boost::filesystem::file_type::directory_file || FileTools::IsArchivedDirectory(p))
 				{
 					result = (p / path).lexically_normal().make_preferred();
 					return true;
 				}
-				else if (status.type() == boost::filesystem::file_type::regular_file)
+				else if (status.type() == boost::filesystem::file_type::regular_file || FileTools::IsArchivedFile(p))
 				{
 					boost::filesystem::path parent_path = p.parent_path();
 					result = (parent_path / path).lexically_normal().make_preferred();
@@ -6,9 +6,14 @@ namespace chaos
 
 	bool ResourceManagerLoaderBase::CheckResourcePath(FilePathParam const& path) const
 	{
-		// path already known, nothing to do
+		// path already known, the other file is a dependency (a JSON description that references an image ...)
 		if (!resolved_path.empty())
+		{
+			boost::filesystem::path const& other_path = path.GetResolvedPath();
+			if (other_path != resolved_path)
+				dependent_paths.push_back(other_path);
 			return true;
+		}
 		// path already existing in manager : failure
 		if (IsPathAlreadyUsedInManager(path))
 			return false;
@@ -75,8 +80,11 @@ namespace chaos
 				if (resource->GetPath().empty())
 					resource->SetPath(resolved_path);
 			}
+			for (boost::filesystem::path const& p : dependent_paths)
+				resource->AddDependentPath(p);
 		}
 		resolved_path = boost::filesystem::path(); // reset
+		dependent_paths.clear();
 	}
 
 }; // namespace chaos
@@ -0,0 +1,378 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================================================
+	// SnapshotWriter
+	// =====================================================================
+
+	void SnapshotWriter::WriteBytes(void const* data, size_t size)
+	{
+		char const* src = (char const*)data;
+		buffer.insert(buffer.end(), src, src + size);
+	}
+
+	void SnapshotWriter::WriteString(std::string const& value)
+	{
+		Write(uint32_t(value.length()));
+		WriteBytes(value.data(), value.length());
+	}
+
+	size_t SnapshotWriter::BeginChunk(uint32_t tag)
+	{
+		Write(tag);
+		size_t result = buffer.size();
+		Write(uint32_t(0)); // the size is known at the end of the chunk
+		return result;
+	}
+
+	void SnapshotWriter::EndChunk(size_t chunk_position)
+	{
+		assert(chunk_position + sizeof(uint32_t) <= buffer.size());
+		uint32_t chunk_size = uint32_t(buffer.size() - chunk_position - sizeof(uint32_t));
+		memcpy(&buffer[chunk_position], &chunk_size, sizeof(uint32_t));
+	}
+
+	bool SnapshotWriter::WriteObject(uint32_t tag, JSONSerializableInterface const& object)
+	{
+		size_t chunk_position = BeginChunk(tag);
+		bool result = object.SerializeIntoSnapshot(*this);
+		EndChunk(chunk_position);
+		return result;
+	}
+
+	// =====================================================================
+	// SnapshotReader
+	// =====================================================================
+
+	SnapshotReader::SnapshotReader(char const* in_data, size_t in_size):
+		data(in_data),
+		size(in_size)
+	{
+	}
+
+	SnapshotReader::SnapshotReader(std::vector<char> const& in_buffer):
+		data(in_buffer.data()),
+		size(in_buffer.size())
+	{
+	}
+
+	bool SnapshotReader::ReadBytes(void* dst, size_t count)
+	{
+		if (error || position + count > size)
+		{
+			error = true;
+			return false;
+		}
+		memcpy(dst, data + position, count);
+		position += count;
+		return true;
+	}
+
+	bool SnapshotReader::ReadString(std::string& value)
+	{
+		uint32_t length = 0;
+		if (!Read(length))
+			return false;
+		if (position + length > size)
+		{
+			error = true;
+			return false;
+		}
+		value.assign(data + position, length);
+		position += length;
+		return true;
+	}
+
+	bool SnapshotReader::BeginChunk(uint32_t tag, size_t& chunk_end)
+	{
+		uint32_t chunk_tag = 0;
+		uint32_t chunk_size = 0;
+		if (!Read(chunk_tag) || !Read(chunk_size))
+			return false;
+		if (chunk_tag != tag || position + chunk_size > size)
+		{
+			SnapshotLog::Error("SnapshotReader::BeginChunk: unexpected chunk");
+			error = true;
+			return false;
+		}
+		chunk_end = position + chunk_size;
+		return true;
+	}
+
+	bool SnapshotReader::EndChunk(size_t chunk_end)
+	{
+		if (error || position > chunk_end) // the content of the chunk has been overrun
+		{
+			error = true;
+			return false;
+		}
+		position = chunk_end;
+		return true;
+	}
+
+	bool SnapshotReader::SkipChunk(uint32_t tag)
+	{
+		size_t chunk_end = 0;
+		if (!BeginChunk(tag, chunk_end))
+			return false;
+		return EndChunk(chunk_end);
+	}
+
+	bool SnapshotReader::ReadObject(uint32_t tag, JSONSerializableInterface& object)
+	{
+		size_t chunk_end = 0;
+		if (!BeginChunk(tag, chunk_end))
+			return false;
+		bool result = object.SerializeFromSnapshot(*this);
+		return EndChunk(chunk_end) && result;
+	}
+
+	// =====================================================================
+	// SnapshotDelta
+	// =====================================================================
+
+	namespace SnapshotDelta
+	{
+		static void WriteVarint(std::vector<char>& result, size_t value)
+		{
+			while (value >= 0x80)
+			{
+				result.push_back(char((value & 0x7F) | 0x80));
+				value >>= 7;
+			}
+			result.push_back(char(value));
+		}
+
+		static bool ReadVarint(std::vector<char> const& src, size_t& position, size_t& value)
+		{
+			value = 0;
+			for (int shift = 0; shift < 64; shift += 7)
+			{
+				if (position >= src.size())
+					return false;
+				uint8_t c = uint8_t(src[position++]);
+				value |= size_t(c & 0x7F) << shift;
+				if ((c & 0x80) == 0)
+					return true;
+			}
+			return false;
+		}
+
+		void Encode(std::vector<char> const& base, std::vector<char> const& snapshot, std::vector<char>& result)
+		{
+			result.clear();
+			WriteVarint(result, snapshot.size());
+
+			size_t count = snapshot.size();
+			size_t base_count = base.size();
+
+			auto get_xor = [&](size_t i) -> char
+			{
+				return (i < base_count) ? char(snapshot[i] ^ base[i]) : snapshot[i];
+			};
+
+			size_t i = 0;
+			while (i < count)
+			{
+				// the zeros (unchanged bytes)
+				size_t zero_start = i;
+				while (i < count && get_xor(i) == 0)
+					++i;
+				size_t zero_count = i - zero_start;
+				if (i == count)
+				{
+					WriteVarint(result, zero_count);
+					WriteVarint(result, 0);
+					break;
+				}
+				// the literals (stop when several zeros follow so that short unchanged runs do not cost 2 varints)
+				size_t literal_start = i;
+				while (i < count)
+				{
+					if (get_xor(i) == 0)
+					{
+						size_t j = i;
+						while (j < count && j < i + 4 && get_xor(j) == 0)
+							++j;
+						if (j == count || j == i + 4)
+							break;
+						i = j;
+						continue;
+					}
+					++i;
+				}
+				WriteVarint(result, zero_count);
+				WriteVarint(result, i - literal_start);
+				for (size_t k = literal_start; k < i; ++k)
+					result.push_back(get_xor(k));
+			}
+		}
+
+		bool Decode(std::vector<char> const& base, std::vector<char> const& delta, std::vector<char>& result)
+		{
+			size_t position = 0;
+			size_t count = 0;
+			if (!ReadVarint(delta, position, count))
+				return false;
+
+			result.resize(count);
+			size_t base_count = base.size();
+
+			size_t i = 0;
+			while (i < count)
+			{
+				size_t zero_count = 0;
+				size_t literal_count = 0;
+				if (!ReadVarint(delta, position, zero_count) || !ReadVarint(delta, position, literal_count))
+					return false;
+				if (i + zero_count + literal_count > count || position + literal_count > delta.size())
+					return false;
+
+				for (size_t k = 0; k < zero_count; ++k, ++i)
+					result[i] = (i < base_count) ? base[i] : 0;
+				for (size_t k = 0; k < literal_count; ++k, ++i)
+					result[i] = (i < base_count) ? char(delta[position++] ^ base[i]) : delta[position++];
+			}
+			return true;
+		}
+
+	}; // namespace SnapshotDelta
+
+	// =====================================================================
+	// SnapshotRingBuffer
+	// =====================================================================
+
+	SnapshotRingBuffer::SnapshotRingBuffer(size_t in_max_memory, size_t in_keyframe_interval):
+		max_memory(in_max_memory),
+		keyframe_interval(std::max(in_keyframe_interval, size_t(1)))
+	{
+	}
+
+	SnapshotRingBuffer::Entry SnapshotRingBuffer::GetFreeEntry()
+	{
+		if (free_entries.size() == 0)
+			return {};
+		Entry result = std::move(free_entries.back());
+		free_entries.pop_back();
+		memory_usage -= result.data.capacity(); // counted again once filled
+		result.data.clear(); // keep the memory
+		return result;
+	}
+
+	void SnapshotRingBuffer::RecycleEntry(Entry&& entry)
+	{
+		if (free_entries.size() >= keyframe_interval) // enough storage for a whole group: release the memory
+			return;
+		memory_usage += entry.data.capacity();
+		free_entries.push_back(std::move(entry));
+	}
+
+	void SnapshotRingBuffer::ShrinkFreeEntries()
+	{
+		while (memory_usage > max_memory && free_entries.size() > 0)
+		{
+			memory_usage -= free_entries.back().data.capacity();
+			free_entries.pop_back();
+		}
+	}
+
+	void SnapshotRingBuffer::Push(std::vector<char> const& snapshot)
+	{
+		Entry entry = GetFreeEntry();
+
+		entry.keyframe = (entries.size() == 0 || snapshots_since_keyframe + 1 >= keyframe_interval);
+		if (entry.keyframe)
+		{
+			entry.data = snapshot;
+			snapshots_since_keyframe = 0;
+		}
+		else
+		{
+			SnapshotDelta::Encode(last_snapshot, snapshot, entry.data);
+			++snapshots_since_keyframe;
+		}
+		memory_usage += entry.data.capacity();
+		entries.push_back(std::move(entry));
+		last_snapshot = snapshot;
+
+		// respect the memory budget: release the recycled storages first, then the oldest groups (keep the last group at least)
+		ShrinkFreeEntries();
+		while (memory_usage > max_memory && entries.size() > 1 + snapshots_since_keyframe)
+		{
+			RemoveOldestGroup();
+			ShrinkFreeEntries();
+		}
+	}
+
+	void SnapshotRingBuffer::RemoveOldestGroup()
+	{
+		do
+		{
+			memory_usage -= entries.front().data.capacity();
+			RecycleEntry(std::move(entries.front()));
+			entries.pop_front();
+		}
+		while (entries.size() > 0 && !entries.front().keyframe);
+	}
+
+	bool SnapshotRingBuffer::GetSnapshot(size_t index, std::vector<char>& result) const
+	{
+		if (index >= entries.size())
+			return false;
+
+		// search the keyframe
+		size_t keyframe_index = index;
+		while (!entries[keyframe_index].keyframe)
+		{
+			if (keyframe_index == 0)
+				return false;
+			--keyframe_index;
+		}
+		result = entries[keyframe_index].data;
+
+		// apply the deltas
+		std::vector<char> base;
+		for (size_t i = keyframe_index + 1; i <= index; ++i)
+		{
+			std::swap(base, result);
+			if (!SnapshotDelta::Decode(base, entries[i].data, result))
+				return false;
+		}
+		return true;
+	}
+
+	void SnapshotRingBuffer::Truncate(size_t count)
+	{
+		if (count >= entries.size())
+			return;
+
+		while (entries.size() > count)
+		{
+			memory_usage -= entries.back().data.capacity();
+			RecycleEntry(std::move(entries.back()));
+			entries.pop_back();
+		}
+
+		// the base for the next delta
+		last_snapshot.clear();
+		snapshots_since_keyframe = 0;
+		if (count > 0)
+		{
+			GetSnapshot(count - 1, last_snapshot);
+			for (size_t i = count; i > 0 && !entries[i - 1].keyframe; --i)
+				++snapshots_since_keyframe;
+		}
+	}
+
+	void SnapshotRingBuffer::Clear()
+	{
+		Truncate(0);
+		// release all the memory
+		free_entries.clear();
+		last_snapshot = {};
+		memory_usage = 0;
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	ThreadPool::ThreadPool(size_t thread_count)
+	{
+		if (thread_count == 0)
+			thread_count = std::max(size_t(std::thread::hardware_concurrency()), size_t(2)) - 1;
+
+		threads.reserve(thread_count);
+		for (size_t i = 0; i < thread_count; ++i)
+			threads.emplace_back(&ThreadPool::WorkerMain, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		task_condition.notify_all();
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+
+	ThreadPool* ThreadPool::GetDefaultInstance()
+	{
+		static ThreadPool default_instance;
+		return &default_instance;
+	}
+
+	size_t ThreadPool::GetPendingTaskCount() const
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		return tasks.size() + running_task_count;
+	}
+
+	void ThreadPool::AddTask(std::function<void()> task)
+	{
+		assert(task);
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			tasks.push_back(std::move(task));
+		}
+		task_condition.notify_one();
+	}
+
+	void ThreadPool::WaitIdle()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		idle_condition.wait(lock, [this]()
+		{
+			return (tasks.size() == 0 && running_task_count == 0);
+		});
+	}
+
+	bool ThreadPool::ExecuteOneTask()
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			if (tasks.size() == 0)
+				return false;
+			task = std::move(tasks.front());
+			tasks.pop_front();
+			++running_task_count;
+		}
+
+		task();
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			--running_task_count;
+		}
+		idle_condition.notify_all();
+		return true;
+	}
+
+	void ThreadPool::WorkerMain()
+	{
+		while (true)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				task_condition.wait(lock, [this]()
+				{
+					return (stopping || tasks.size() > 0);
+				});
+				if (tasks.size() == 0) // stopping, once the queue is empty
+					return;
+				task = std::move(tasks.front());
+				tasks.pop_front();
+				++running_task_count;
+			}
+
+			task();
+
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				--running_task_count;
+			}
+			idle_condition.notify_all();
+		}
+	}
+
+}; // namespace chaos
\ No newline at end of file
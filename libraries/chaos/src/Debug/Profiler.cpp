@@ -0,0 +1,167 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(bool, EnableProfiler, false);
+		CHAOS_GLOBAL_VARIABLE(size_t, ProfilerFrameCount, 600);
+	};
+
+	Profiler::Profiler():
+		enabled(GlobalVariables::EnableProfiler.Get()),
+		frames(std::max(GlobalVariables::ProfilerFrameCount.Get(), size_t(1))),
+		reference_time(std::chrono::steady_clock::now())
+	{
+	}
+
+	double Profiler::GetTime() const
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - reference_time).count();
+	}
+
+	void Profiler::SetEnabled(bool in_enabled)
+	{
+		if (enabled == in_enabled)
+			return;
+		enabled = in_enabled;
+		// the current frame is incomplete
+		frame_started = false;
+		current_depth = 0;
+		current_frame = {};
+	}
+
+	void Profiler::BeginFrame()
+	{
+		++frame_counter;
+		if (!enabled)
+			return;
+
+		frame_started = true;
+		frame_thread_id = std::this_thread::get_id();
+		current_depth = 0;
+
+		current_frame.frame_index = frame_counter;
+		current_frame.start_time = GetTime();
+		current_frame.end_time = current_frame.start_time;
+		current_frame.cpu_zones.clear();
+		current_frame.gpu_zones.clear();
+	}
+
+	void Profiler::EndFrame()
+	{
+		if (!frame_started)
+			return;
+		frame_started = false;
+
+		current_frame.end_time = GetTime();
+		// close the zones that are still opened (should not happen with scoped zones)
+		for (ProfilerZone& zone : current_frame.cpu_zones)
+			if (zone.end_time < zone.start_time)
+				zone.end_time = current_frame.end_time;
+
+		frames.push_back(std::move(current_frame));
+		current_frame = {};
+	}
+
+	int Profiler::BeginZone(char const* name)
+	{
+		assert(name != nullptr);
+
+		if (!frame_started || std::this_thread::get_id() != frame_thread_id)
+			return -1;
+
+		ProfilerZone zone;
+		zone.name = name;
+		zone.start_time = GetTime();
+		zone.end_time = -1.0; // not finished yet
+		zone.depth = current_depth++;
+		current_frame.cpu_zones.push_back(zone);
+
+		return int(current_frame.cpu_zones.size() - 1);
+	}
+
+	void Profiler::EndZone(int zone_index)
+	{
+		// the frame may have been closed (or the profiler disabled) since the zone has been started
+		if (!frame_started || zone_index < 0 || size_t(zone_index) >= current_frame.cpu_zones.size())
+			return;
+		current_frame.cpu_zones[zone_index].end_time = GetTime();
+		--current_depth;
+	}
+
+	void Profiler::AddGPUZones(uint64_t frame_index, std::vector<ProfilerZone> const& zones)
+	{
+		if (frame_index == current_frame.frame_index && frame_started)
+		{
+			current_frame.gpu_zones.insert(current_frame.gpu_zones.end(), zones.begin(), zones.end());
+			return;
+		}
+		for (size_t i = frames.size(); i > 0; --i) // the frame is most likely one of the latest
+		{
+			ProfilerFrame& frame = frames[i - 1];
+			if (frame.frame_index == frame_index)
+			{
+				frame.gpu_zones.insert(frame.gpu_zones.end(), zones.begin(), zones.end());
+				return;
+			}
+			if (frame.frame_index < frame_index)
+				return;
+		}
+	}
+
+	void Profiler::ClearFrames()
+	{
+		frames.clear();
+	}
+
+	bool Profiler::ExportChromeTrace(FilePathParam const& path) const
+	{
+		// XXX : Chrome trace event format. "X" are complete events, time is in microseconds
+		//       CPU and GPU zones are exported as 2 distinct threads
+		nlohmann::json events = nlohmann::json::array();
+
+		auto add_thread_name = [&events](int tid, char const* thread_name)
+		{
+			nlohmann::json event;
+			event["name"] = "thread_name";
+			event["ph"] = "M";
+			event["pid"] = 1;
+			event["tid"] = tid;
+			event["args"]["name"] = thread_name;
+			events.push_back(std::move(event));
+		};
+		add_thread_name(1, "CPU");
+		add_thread_name(2, "GPU");
+
+		auto add_zone = [&events](int tid, char const* name, double start_time, double duration, uint64_t frame_index)
+		{
+			nlohmann::json event;
+			event["name"] = name;
+			event["ph"] = "X";
+			event["pid"] = 1;
+			event["tid"] = tid;
+			event["ts"] = start_time * 1000000.0;
+			event["dur"] = duration * 1000000.0;
+			event["args"]["frame"] = frame_index;
+			events.push_back(std::move(event));
+		};
+
+		for (ProfilerFrame const& frame : frames)
+		{
+			add_zone(1, "Frame", frame.start_time, frame.GetDuration(), frame.frame_index);
+			for (ProfilerZone const& zone : frame.cpu_zones)
+				add_zone(1, zone.name, zone.start_time, zone.GetDuration(), frame.frame_index);
+			for (ProfilerZone const& zone : frame.gpu_zones)
+				add_zone(2, zone.name, zone.start_time, zone.GetDuration(), frame.frame_index);
+		}
+
+		nlohmann::json json;
+		json["traceEvents"] = std::move(events);
+		json["displayTimeUnit"] = "ms";
+
+		return JSONTools::SaveJSONToFile(&json, path);
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -131,23 +131,38 @@ namespace chaos
 	}
 
 
-	FT_BitmapGlyph FontTools::GetBitmapGlyph(FT_Face face, uint32_t charcode, bool accept_notfound_glyph)
+	/** the result of a glyph rasterization (errors are not logged immediately because the logger is not thread safe) */
+	class GlyphRasterizationResult
+	{
+	public:
+
+		/** the glyph */
+		FT_BitmapGlyph glyph = nullptr;
+		/** the index of the glyph in the face */
+		FT_UInt glyph_index = 0;
+		/** the FreeType function that fails */
+		char const* failed_function = nullptr;
+	};
+
+	static GlyphRasterizationResult DoGetBitmapGlyph(FT_Face face, uint32_t charcode, bool accept_notfound_glyph)
 	{
+		GlyphRasterizationResult result;
+
 		FT_Error error = 0;
 
-		FT_UInt glyph_index = FT_Get_Char_Index(face, charcode);
-		if (charcode != 0 && (glyph_index == 0 && !accept_notfound_glyph))
+		result.glyph_index = FT_Get_Char_Index(face, charcode);
+		if (charcode != 0 && (result.glyph_index == 0 && !accept_notfound_glyph))
 		{
-			FontLog::Error("FontTools::GetBitmapGlyph(...): FT_Get_Char_Index fails with charcode = [0x%X]", charcode);
-			return nullptr;
+			result.failed_function = "FT_Get_Char_Index";
+			return result;
 		}
 
 		// load the glyph
-		error = FT_Load_Glyph(face, glyph_index, FT_LOAD_DEFAULT);
+		error = FT_Load_Glyph(face, result.glyph_index, FT_LOAD_DEFAULT);
 		if (error)
 		{
-			FontLog::Error("FontTools::GetBitmapGlyph(...): FT_Load_Glyph fails with charcode = [0x%X]   glyph_index = [%d]", charcode, glyph_index);
-			return nullptr;
+			result.failed_function = "FT_Load_Glyph";
+			return result;
 		}
 
 		FT_BitmapGlyph glyph;
@@ -156,8 +171,8 @@ namespace chaos
 		error = FT_Get_Glyph(face->glyph, (FT_Glyph*)&glyph);
 		if (error || glyph == nullptr)
 		{
-			FontLog::Error("FontTools::GetBitmapGlyph(...): FT_Get_Glyph fails with charcode = [0x%X]   glyph_index = [%d]", charcode, glyph_index);
-			return nullptr;
+			result.failed_function = "FT_Get_Glyph";
+			return result;
 		}
 
 		// convert to a bitmap if necessary
@@ -166,12 +181,250 @@ namespace chaos
 			error = FT_Glyph_To_Bitmap((FT_Glyph*)&glyph, FT_RENDER_MODE_NORMAL, nullptr, true);
 			if (error)
 			{
-				FontLog::Error("FontTools::GetBitmapGlyph(...): FT_Glyph_To_Bitmap fails with charcode = [0x%X]   glyph_index = [%d]", charcode, glyph_index);
-				return nullptr;
+				result.failed_function = "FT_Glyph_To_Bitmap";
+				return result;
+			}
+		}
+
+		result.glyph = glyph;
+		return result;
+	}
+
+	static void LogGlyphRasterizationError(GlyphRasterizationResult const& result, uint32_t charcode)
+	{
+		if (result.failed_function == nullptr)
+			return;
+		if (strcmp(result.failed_function, "FT_Get_Char_Index") == 0)
+			FontLog::Error("FontTools::GetBitmapGlyph(...): %s fails with charcode = [0x%X]", result.failed_function, charcode);
+		else
+			FontLog::Error("FontTools::GetBitmapGlyph(...): %s fails with charcode = [0x%X]   glyph_index = [%d]", result.failed_function, charcode, result.glyph_index);
+	}
+
+	FT_BitmapGlyph FontTools::GetBitmapGlyph(FT_Face face, uint32_t charcode, bool accept_notfound_glyph)
+	{
+		GlyphRasterizationResult result = DoGetBitmapGlyph(face, charcode, accept_notfound_glyph);
+		LogGlyphRasterizationError(result, charcode);
+		return result.glyph;
+	}
+
+	ImageDescription FontTools::GlyphArena::GetImageDescription(ArenaGlyph const& glyph) const
+	{
+		if (glyph.width <= 0 || glyph.height <= 0)
+			return {};
+		return ImageDescription(pixels.data + glyph.offset, glyph.width, glyph.height, PixelFormat::Gray);
+	}
+
+	std::vector<uint32_t> FontTools::GetCharactersForString(char const* str)
+	{
+		assert(str != nullptr);
+
+		std::vector<uint32_t> result;
+		for (int i = 0; str[i] != 0; ++i)
+		{
+			uint32_t charcode = str[i];
+			result.push_back(charcode);
+		}
+		result.push_back(0); // the glyph for missing characters
+
+		std::sort(result.begin(), result.end());
+		result.erase(std::unique(result.begin(), result.end()), result.end());
+		return result;
+	}
+
+	/** the settings of a face required to duplicate it (read before the tasks start : the source face is used by the first task meanwhile) */
+	class FaceCloneInfo
+	{
+	public:
+
+		/** constructor */
+		FaceCloneInfo(FT_Face face)
+		{
+			if (face->stream != nullptr)
+			{
+				data = face->stream->base;
+				data_size = FT_Long(face->stream->size);
+			}
+			face_index = face->face_index;
+			if (face->charmap != nullptr)
+				charmap_index = FT_Get_Charmap_Index(face->charmap);
+			if (face->size != nullptr)
+			{
+				has_size = true;
+				metrics = face->size->metrics;
 			}
 		}
 
-		return glyph;
+	public:
+
+		/** the data of the face (null if not in memory) */
+		FT_Byte const* data = nullptr;
+		/** the size of the data */
+		FT_Long data_size = 0;
+		/** the index of the face in the file */
+		FT_Long face_index = 0;
+		/** the index of the selected charmap (-1 if none) */
+		FT_Int charmap_index = -1;
+		/** whether a size is selected */
+		bool has_size = false;
+		/** the metrics of the selected size */
+		FT_Size_Metrics metrics = {};
+	};
+
+	/** create a face on the same data than another one, with its own library (returns false if the face cannot be duplicated exactly) */
+	static bool CloneFace(FaceCloneInfo const& info, library_ptr& library, face_ptr& clone)
+	{
+		// the data must be in memory (memory faces or memory mapped files)
+		if (info.data == nullptr)
+			return false;
+
+		FT_Library new_library = nullptr;
+		if (FT_Init_FreeType(&new_library) != 0)
+			return false;
+		library.reset(new_library);
+
+		FT_Face new_face = nullptr;
+		if (FT_New_Memory_Face(new_library, info.data, info.data_size, info.face_index, &new_face) != 0)
+			return false;
+		clone.reset(new_face);
+
+		// same charmap
+		if (info.charmap_index >= 0)
+		{
+			if (info.charmap_index >= new_face->num_charmaps || FT_Set_Charmap(new_face, new_face->charmaps[info.charmap_index]) != 0)
+				return false;
+		}
+
+		// same size (ensure the scale is the same, otherwise glyphs may be different)
+		if (info.has_size)
+		{
+			if (FT_Set_Pixel_Sizes(new_face, info.metrics.x_ppem, info.metrics.y_ppem) != 0)
+				return false;
+			if (new_face->size->metrics.x_scale != info.metrics.x_scale || new_face->size->metrics.y_scale != info.metrics.y_scale)
+				return false;
+		}
+		return true;
+	}
+
+	// XXX : FreeType objects are not thread safe (a face and its library must only be used by one thread at a time)
+	//       each task uses its own library and its own face, loaded on the same memory as the source face
+	//       glyphs are interleaved between the tasks so that the work is balanced
+	//
+	//       the bitmaps are then packed in a single buffer (one allocation instead of one FIBITMAP per glyph)
+
+	bool FontTools::RasterizeGlyphs(FT_Face face, std::vector<uint32_t> const& charcodes, GlyphArena& result)
+	{
+		assert(face != nullptr);
+
+		static constexpr size_t GLYPHS_PER_TASK = 32; // do not create faces for very few glyphs
+
+		result.glyphs.clear();
+		result.pixels = Buffer<char>();
+
+		size_t count = charcodes.size();
+
+		// the first task uses the source face, others create their own face
+		ThreadPool* thread_pool = ThreadPool::GetDefaultInstance();
+
+		size_t task_count = std::min(thread_pool->GetThreadCount() + 1, (count + GLYPHS_PER_TASK - 1) / GLYPHS_PER_TASK);
+		if (face->stream == nullptr || face->stream->base == nullptr)
+			task_count = 1;
+		task_count = std::max(task_count, size_t(1));
+
+		std::vector<library_ptr> task_libraries(task_count);
+		std::vector<face_ptr> task_faces(task_count); // XXX : declared after the libraries, so destroyed first
+		std::vector<char> task_done(task_count, 0); // not std::vector<bool> : written by several threads
+
+		std::vector<GlyphRasterizationResult> rasterization_results(count);
+
+		FaceCloneInfo const clone_info(face);
+
+		thread_pool->ParallelFor(task_count, [&](size_t task_index)
+		{
+			FT_Face task_face = face;
+			if (task_index > 0)
+			{
+				if (!CloneFace(clone_info, task_libraries[task_index], task_faces[task_index]))
+					return; // processed later with the source face
+				task_face = task_faces[task_index].get();
+			}
+			for (size_t i = task_index; i < count; i += task_count)
+				rasterization_results[i] = DoGetBitmapGlyph(task_face, charcodes[i], false);
+			task_done[task_index] = 1;
+		});
+
+		// the tasks that could not duplicate the face
+		for (size_t task_index = 0; task_index < task_count; ++task_index)
+			if (!task_done[task_index])
+				for (size_t i = task_index; i < count; i += task_count)
+					rasterization_results[i] = DoGetBitmapGlyph(face, charcodes[i], false);
+
+		// the metrics and the position of each glyph in the arena (in order)
+		std::vector<FT_BitmapGlyph> ordered_glyphs;
+		ordered_glyphs.reserve(count);
+
+		size_t arena_size = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			GlyphRasterizationResult const& rasterization_result = rasterization_results[i];
+
+			LogGlyphRasterizationError(rasterization_result, charcodes[i]);
+
+			FT_BitmapGlyph glyph = rasterization_result.glyph;
+			if (glyph == nullptr)
+				continue;
+
+			ArenaGlyph arena_glyph;
+			static_cast<CharacterMetrics&>(arena_glyph) = CharacterMetrics(glyph);
+			arena_glyph.charcode = charcodes[i];
+			arena_glyph.offset = arena_size;
+			if (arena_glyph.width > 0 && arena_glyph.height > 0)
+			{
+				if (glyph->bitmap.pixel_mode != FT_PIXEL_MODE_GRAY) // other format not supported yet (as GenerateImage(...))
+				{
+					FontLog::Error("FontTools::RasterizeGlyphs(...): bitmap.pixel_mode != FT_PIXEL_MODE_GRAY");
+					FT_Done_Glyph((FT_Glyph)glyph);
+					continue;
+				}
+				arena_size += size_t(arena_glyph.width) * size_t(arena_glyph.height);
+			}
+			result.glyphs.push_back(arena_glyph);
+			ordered_glyphs.push_back(glyph);
+		}
+
+		// copy the bitmaps into the arena (bottom to top, as FreeImage)
+		if (arena_size > 0)
+			result.pixels = SharedBufferPolicy<char>::NewBuffer(arena_size);
+
+		thread_pool->ParallelFor(result.glyphs.size(), [&result, &ordered_glyphs](size_t i)
+		{
+			ArenaGlyph const& arena_glyph = result.glyphs[i];
+			if (arena_glyph.width <= 0 || arena_glyph.height <= 0)
+				return;
+
+			ImageDescription src_desc = FontTools::GetImageDescription(ordered_glyphs[i]->bitmap);
+			ImageDescription dst_desc = result.GetImageDescription(arena_glyph);
+
+			ImagePixelAccessor<PixelGray> src_acc(src_desc);
+			ImagePixelAccessor<PixelGray> dst_acc(dst_desc);
+
+			for (int j = 0; j < arena_glyph.height; ++j) // glyph is reversed compare to what we want
+				memcpy(&dst_acc(0, j), &src_acc(0, arena_glyph.height - 1 - j), size_t(arena_glyph.width));
+		}, 16);
+
+		// release the glyphs (before their libraries)
+		for (FT_BitmapGlyph glyph : ordered_glyphs)
+			FT_Done_Glyph((FT_Glyph)glyph);
+
+		return true;
+	}
+
+	void FontTools::CopyGlyphPixels(ImageDescription const& src_desc, ImageDescription& dst_desc)
+	{
+		assert(src_desc.width == dst_desc.width);
+		assert(src_desc.height == dst_desc.height);
+
+		ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, 0, 0, src_desc.width, src_desc.height);
+		MakeAlphaChannelConsistent(dst_desc);
 	}
 
 	std::map<uint32_t, FontTools::CharacterBitmapGlyph> FontTools::GetGlyphCacheForString(FT_Face face, char const * str)
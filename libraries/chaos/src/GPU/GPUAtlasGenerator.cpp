@@ -45,6 +45,40 @@ namespace chaos
 		return result;
 	}
 
+	GPUAtlas* GPUAtlasGenerator::GenerateAtlas(AtlasBinary const& in_atlas) const
+	{
+		GPUAtlas* result = new GPUAtlas;
+		if (result == nullptr)
+			return nullptr;
+		if (!FillAtlasContent(result, in_atlas))
+		{
+			delete(result);
+			return nullptr;
+		}
+		return result;
+	}
+
+	GPUAtlas* GPUAtlasGenerator::GenerateAtlas(AtlasBinary&& in_atlas) const
+	{
+		GPUAtlas* result = new GPUAtlas;
+		if (result == nullptr)
+			return nullptr;
+		if (!FillAtlasContent(result, std::move(in_atlas)))
+		{
+			delete(result);
+			return nullptr;
+		}
+		return result;
+	}
+
+	GPUAtlas* GPUAtlasGenerator::LoadBinaryAtlas(FilePathParam const& path) const
+	{
+		AtlasBinary atlas;
+		if (!atlas.LoadAtlas(path))
+			return nullptr;
+		return GenerateAtlas(std::move(atlas));
+	}
+
 	bool GPUAtlasGenerator::FillAtlasContent(GPUAtlas* result, Atlas const & in_atlas) const
 	{
 		// empty previous content
@@ -82,6 +116,43 @@ namespace chaos
 		return true;
 	}
 
+	bool GPUAtlasGenerator::FillAtlasContent(GPUAtlas* result, AtlasBinary const& in_atlas) const
+	{
+		// empty previous content
+		result->Clear();
+		// create the texture (if at least one page)
+		if (in_atlas.GetBitmapCount() > 0)
+		{
+			GPUTexture* texture = CreateTextureFromAtlas(in_atlas);
+			if (texture == nullptr)
+				return false;
+			result->texture = texture;
+		}
+		// copy data
+		result->atlas_count = in_atlas.atlas_count;
+		result->dimension = in_atlas.dimension;
+		return CopyAtlasFolders(&result->root_folder, &in_atlas.root_folder);
+	}
+
+	bool GPUAtlasGenerator::FillAtlasContent(GPUAtlas* result, AtlasBinary&& in_atlas) const
+	{
+		// empty previous content
+		result->Clear();
+		// create the texture (if at least one page)
+		if (in_atlas.GetBitmapCount() > 0)
+		{
+			GPUTexture* texture = CreateTextureFromAtlas(in_atlas);
+			if (texture == nullptr)
+				return false;
+			result->texture = texture;
+		}
+		// steal all data (the mapping is released with in_atlas)
+		result->atlas_count = in_atlas.atlas_count;
+		result->dimension = in_atlas.dimension;
+		result->root_folder = std::move(in_atlas.root_folder);
+		return true;
+	}
+
 	GPUTexture * GPUAtlasGenerator::CreateTextureFromAtlas(Atlas const & in_atlas) const
 	{
 		// create and fill a texture array generator
@@ -94,6 +165,51 @@ namespace chaos
 		return generator.GenTextureObject();
 	}
 
+	GPUTexture* GPUAtlasGenerator::CreateTextureFromAtlas(AtlasBinary const& in_atlas) const
+	{
+		glm::ivec2 dimension = in_atlas.GetAtlasDimension();
+		int page_count = int(in_atlas.GetBitmapCount());
+
+		// compute the 'array' target
+		TextureType array_type = GLTextureTools::ToArrayTextureType(GLTextureTools::GetTexture2DTypeFromSize(dimension.x, dimension.y));
+		if (array_type == TextureType::Unknown)
+			return nullptr;
+
+		// create the texture
+		TextureDescription description;
+		description.width        = dimension.x;
+		description.height       = dimension.y;
+		description.depth        = page_count;
+		description.pixel_format = in_atlas.GetPixelFormat();
+		description.type         = array_type;
+		description.use_mipmaps  = true;
+
+		GPUTexture* result = GetGPUDevice()->CreateTexture(description);
+		if (result == nullptr)
+			return nullptr;
+
+		// upload the pages and their precomputed mipmaps (pixels are already in the texture format)
+		int level_count = std::min(in_atlas.GetMipmapCount(), result->GetMipmapCount());
+		for (int i = 0; i < page_count; ++i)
+			for (int level = 0; level < level_count; ++level)
+				result->SetSubImage(in_atlas.GetPageImage(i, level), { 0, 0, i }, level);
+
+		GenTextureParameters parameters;
+		result->SetMinificationFilter(parameters.min_filter);
+		result->SetMagnificationFilter(parameters.mag_filter);
+		result->SetWrapMethods(parameters.wrap_methods);
+
+		// the file may have been saved with a shorter mipmap chain: generate the missing levels only (from the last uploaded one)
+		if (level_count > 0 && level_count < result->GetMipmapCount())
+		{
+			glTextureParameteri(result->GetResourceID(), GL_TEXTURE_BASE_LEVEL, level_count - 1);
+			result->GenerateMipmaps();
+			glTextureParameteri(result->GetResourceID(), GL_TEXTURE_BASE_LEVEL, 0);
+		}
+
+		return result;
+	}
+
 	bool GPUAtlasGenerator::CopyAtlasFolders(AtlasFolderInfo* dst_folder_info, AtlasFolderInfo const* src_folder_info) const
 	{
 		assert(dst_folder_info != nullptr);
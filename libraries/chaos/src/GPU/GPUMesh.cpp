@@ -35,6 +35,9 @@ namespace chaos
 
 	int GPUMesh::DoDisplay(GPURenderContext* render_context, GPUProgramProviderInterface const * uniform_provider, GPURenderParams const& render_params)
 	{
+		CHAOS_PROFILE_ZONE("GPUMesh::DoDisplay");
+		CHAOS_GPU_PROFILE_ZONE(render_context, "GPUMesh::DoDisplay");
+
 		// display the elements
 		std::optional<GPURenderMaterial const*> previous_element_material;
 		std::optional<GPURenderMaterial const*> previous_effective_material;
@@ -88,7 +91,7 @@ namespace chaos
 			{
 				if (primitive.count <= 0)
 					continue;
-				render_context->Draw(primitive, render_params.instancing);
+				render_context->Draw(primitive, (primitive.instancing.instance_count > 0)? primitive.instancing : render_params.instancing);
 				++result;
 			}
 		}
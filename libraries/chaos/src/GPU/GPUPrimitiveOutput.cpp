@@ -15,6 +15,8 @@ namespace chaos
 			return GL_TRIANGLES;
 		if (primitive_type == PrimitiveType::Quad)
 			return GL_TRIANGLES;
+		if (primitive_type == PrimitiveType::InstancedQuad)
+			return GL_TRIANGLES;
 
 		if (primitive_type == PrimitiveType::TriangleStrip)
 			return GL_TRIANGLE_STRIP;
@@ -245,6 +247,19 @@ namespace chaos
 					buffer_unflushed += 4 * count * vertex_size;
 				}
 			}
+			// instanced quads: the 6 vertices of each quad are generated by the vertex shader, the buffer is read once per instance
+			else if (current_primitive_type == PrimitiveType::InstancedQuad)
+			{
+				primitive.count = 6;
+				primitive.indexed = false;
+				primitive.start = 0;
+				primitive.base_vertex_index = 0;
+				primitive.instancing.instance_count = int((buffer_position - buffer_unflushed) / vertex_size);
+				primitive.instancing.base_instance = int((buffer_unflushed - buffer_start) / vertex_size); // start relative to the vertex buffer
+				pending_primitives.push_back(primitive);
+
+				buffer_unflushed = buffer_position;
+			}
 			// other primitives than QUAD produces a single draw call
 			else
 			{
@@ -0,0 +1,186 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(int, GPUProfilerMaxPendingFrames, 4);
+		CHAOS_GLOBAL_VARIABLE(int, GPUProfilerMaxZonesPerFrame, 256);
+	};
+
+	// =====================================================================
+	// GPUProfiler
+	// =====================================================================
+
+	GPUProfiler::GPUProfiler(GPURenderContext* in_render_context) :
+		render_context(in_render_context)
+	{
+		assert(in_render_context != nullptr);
+	}
+
+	void GPUProfiler::OnBeginRenderingFrame()
+	{
+		// read the results that are available (never wait for the GPU)
+		ReadPendingFrames();
+
+		Profiler* profiler = Profiler::GetInstance();
+		if (!profiler->IsEnabled())
+			return;
+
+		// too many frames waiting for their results: skip this one
+		if (pending_frames.size() >= size_t(std::max(GlobalVariables::GPUProfilerMaxPendingFrames.Get(), 1)))
+			return;
+
+		// the GPU time and the CPU time have different origins
+		GLint64 gpu_time = 0;
+		glGetInteger64v(GL_TIMESTAMP, &gpu_time);
+
+		frame_started = true;
+		current_depth = 0;
+		current_frame.frame_index = profiler->GetCurrentFrameIndex();
+		current_frame.time_offset = profiler->GetTime() - double(gpu_time) * 1.0e-9;
+		current_frame.zones.clear();
+	}
+
+	void GPUProfiler::OnEndRenderingFrame()
+	{
+		if (!frame_started)
+			return;
+		frame_started = false;
+
+		// remove the zones that are not closed (should not happen with scoped zones)
+		auto it = std::remove_if(current_frame.zones.begin(), current_frame.zones.end(), [this](PendingZone& zone)
+		{
+			if (zone.end_query != nullptr)
+				return false;
+			if (zone.begin_query != nullptr)
+				query_pool.push_back(std::move(zone.begin_query));
+			return true;
+		});
+		current_frame.zones.erase(it, current_frame.zones.end());
+
+		if (current_frame.zones.size() > 0)
+			pending_frames.push_back(std::move(current_frame));
+		current_frame = {};
+	}
+
+	int GPUProfiler::BeginZone(char const* name)
+	{
+		assert(name != nullptr);
+
+		if (!frame_started)
+			return -1;
+		if (current_frame.zones.size() >= size_t(GlobalVariables::GPUProfilerMaxZonesPerFrame.Get()))
+			return -1;
+
+		shared_ptr<GPUQuery> query = GetQuery();
+		if (query == nullptr || !query->QueryCounter())
+			return -1;
+
+		PendingZone zone;
+		zone.name = name;
+		zone.depth = current_depth++;
+		zone.begin_query = std::move(query);
+		current_frame.zones.push_back(std::move(zone));
+
+		return int(current_frame.zones.size() - 1);
+	}
+
+	void GPUProfiler::EndZone(int zone_index)
+	{
+		if (!frame_started || zone_index < 0 || size_t(zone_index) >= current_frame.zones.size())
+			return;
+		--current_depth;
+
+		shared_ptr<GPUQuery> query = GetQuery();
+		if (query == nullptr || !query->QueryCounter())
+			return;
+		current_frame.zones[zone_index].end_query = std::move(query);
+	}
+
+	void GPUProfiler::ReadPendingFrames()
+	{
+		Profiler* profiler = Profiler::GetInstance();
+
+		while (pending_frames.size() > 0)
+		{
+			PendingFrame& frame = pending_frames.front();
+
+			// the zones are stored by start time: the end of an outer zone is issued after its nested zones
+			// check every query of the frame before reading any result
+			for (PendingZone const& zone : frame.zones)
+				if (!zone.begin_query->IsResultAvailable() || !zone.end_query->IsResultAvailable())
+					return;
+
+			std::vector<ProfilerZone> zones;
+			zones.reserve(frame.zones.size());
+			for (PendingZone& zone : frame.zones)
+			{
+				ProfilerZone profiler_zone;
+				profiler_zone.name = zone.name;
+				profiler_zone.depth = zone.depth;
+				profiler_zone.start_time = double(zone.begin_query->GetResult64(false)) * 1.0e-9 + frame.time_offset;
+				profiler_zone.end_time = double(zone.end_query->GetResult64(false)) * 1.0e-9 + frame.time_offset;
+				zones.push_back(profiler_zone);
+			}
+			profiler->AddGPUZones(frame.frame_index, zones);
+
+			ReleaseFrameQueries(frame);
+			pending_frames.pop_front();
+		}
+	}
+
+	shared_ptr<GPUQuery> GPUProfiler::GetQuery()
+	{
+		if (query_pool.size() > 0)
+		{
+			shared_ptr<GPUQuery> result = std::move(query_pool.back());
+			query_pool.pop_back();
+			return result;
+		}
+
+		shared_ptr<GPUQuery> result = new GLTimeStampQuery(render_context->GetWindow());
+		if (!result->IsValid())
+			return nullptr;
+		return result;
+	}
+
+	void GPUProfiler::ReleaseFrameQueries(PendingFrame& frame)
+	{
+		for (PendingZone& zone : frame.zones)
+		{
+			if (zone.begin_query != nullptr)
+				query_pool.push_back(std::move(zone.begin_query));
+			if (zone.end_query != nullptr)
+				query_pool.push_back(std::move(zone.end_query));
+		}
+		frame.zones.clear();
+	}
+
+	void GPUProfiler::Destroy()
+	{
+		frame_started = false;
+		current_frame = {};
+		pending_frames.clear();
+		query_pool.clear();
+	}
+
+	// =====================================================================
+	// GPUProfilerScopedZone
+	// =====================================================================
+
+	GPUProfilerScopedZone::GPUProfilerScopedZone(GPURenderContext* in_render_context, char const* name):
+		render_context(in_render_context)
+	{
+		if (render_context != nullptr && Profiler::GetInstance()->IsEnabled())
+			zone_index = render_context->GetProfiler().BeginZone(name);
+	}
+
+	GPUProfilerScopedZone::~GPUProfilerScopedZone()
+	{
+		if (zone_index >= 0)
+			render_context->GetProfiler().EndZone(zone_index);
+	}
+
+}; // namespace chaos
\ No newline at end of file
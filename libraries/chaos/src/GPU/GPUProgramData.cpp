@@ -29,6 +29,15 @@ namespace chaos
 	GPUUniformInfo const * GPUProgramData::FindUniform(char const * name) const
 	{
 		assert(name != nullptr);
+		// a string that has never been interned cannot be the name of an uniform
+		InternedString interned_name = InternedString::Find(name);
+		if (interned_name.empty())
+			return nullptr;
+		return FindUniform(interned_name);
+	}
+
+	GPUUniformInfo const * GPUProgramData::FindUniform(InternedString name) const
+	{
 		for (GPUUniformInfo const & uniform : uniforms)
 			if (uniform.name == name)
 				return &uniform;
@@ -298,6 +298,11 @@ namespace chaos
 			{
 				if (program_type == GPUProgramType::Render)
 					result->default_material = GPURenderMaterial::GenRenderMaterialObject(result, true);
+				// keep track of the source files (for hot reload)
+				for (auto const& [shader_type, generators] : shaders)
+					for (shared_ptr<GPUProgramSourceGenerator> const& generator : generators)
+						if (GPUProgramFileSourceGenerator const* file_generator = auto_cast(generator.get()))
+							result->AddDependentPath(file_generator->GetPath());
 				return result;
 			}
 		}
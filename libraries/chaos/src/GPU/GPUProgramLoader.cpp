@@ -80,12 +80,12 @@ namespace chaos
 		GPUProgram* result = nullptr;
 		FileTools::WithFile(path.GetResolvedPath(), [this, &result](boost::filesystem::path const& p)
 		{
-			boost::filesystem::file_status status = boost::filesystem::status(p);
-			if (status.type() == boost::filesystem::file_type::directory_file)
+			// XXX : the mounted archives are searched first (as FileTools::LoadFile(...) does)
+			if (FileTools::IsArchivedDirectory(p) || (!FileTools::IsArchivedFile(p) && boost::filesystem::is_directory(p)))
 			{
 				result = GenProgramObjectFromDirectory(p);
 			}
-			else if (status.type() == boost::filesystem::file_type::regular_file)
+			else if (FileTools::IsArchivedFile(p) || boost::filesystem::is_regular_file(p))
 			{
 				nlohmann::json json;
 				if (JSONTools::LoadJSONFile(p, json, LoadFileFlag::Recursive))
@@ -119,26 +119,31 @@ namespace chaos
 
 		GPUProgramGenerator program_generator;
 
-		for (auto it = boost::filesystem::directory_iterator(p); it != boost::filesystem::directory_iterator(); ++it)
+		bool failure = false;
+		FileTools::WithDirectoryContent(p, [&program_generator, &failure](boost::filesystem::path const& file_path)
 		{
-			if (it->status().type() == boost::filesystem::file_type::regular_file)
-			{
-				boost::filesystem::path file_path = it->path();
-				std::string ext = file_path.extension().string();
+			// the content of the directory may be inside a mounted archive
+			if (!FileTools::IsArchivedFile(file_path) && !boost::filesystem::is_regular_file(file_path))
+				return false;
+
+			std::string ext = file_path.extension().string();
 
-				auto ext_it = extension_map.find(ext.c_str());
-				if (ext_it != extension_map.end())
+			auto ext_it = extension_map.find(ext.c_str());
+			if (ext_it != extension_map.end())
+			{
+				// add source to the generator
+				ShaderType shader_type = ext_it->second;
+				if (!program_generator.AddShaderSourceFile(shader_type, file_path))
 				{
-					// add source to the generator
-					ShaderType shader_type = ext_it->second;
-					if (!program_generator.AddShaderSourceFile(shader_type, file_path))
-					{
-						GLLog::Error("GPUProgramLoader::GenProgramObjectFromDirectory(...) fails to add source [%s]", p.c_str());
-						return nullptr;
-					}
+					GLLog::Error("GPUProgramLoader::GenProgramObjectFromDirectory(...) fails to add source [%s]", file_path.string().c_str());
+					failure = true;
+					return true; // stop
 				}
 			}
-		}
+			return false;
+		});
+		if (failure)
+			return nullptr;
 		return program_generator.GenProgramObject();
 	}
 
@@ -11,7 +11,18 @@ namespace chaos
 	{
 		GPUProgramProviderExecutionData execution_data(name, action);
 		execution_data.top_provider = this;
+		return ProcessAction(execution_data);
+	}
 
+	bool GPUProgramProviderInterface::ProcessAction(InternedString name, GPUProgramAction& action) const
+	{
+		GPUProgramProviderExecutionData execution_data(name, action);
+		execution_data.top_provider = this;
+		return ProcessAction(execution_data);
+	}
+
+	bool GPUProgramProviderInterface::ProcessAction(GPUProgramProviderExecutionData& execution_data) const
+	{
 		// search for explict first ...
 		execution_data.pass_type = GPUProgramProviderPassType::Explicit;
 		if (DoProcessAction(execution_data))
@@ -30,13 +41,13 @@ namespace chaos
 	bool GPUProgramProviderInterface::BindUniform(GPUUniformInfo const& uniform) const
 	{
 		GPUProgramSetUniformAction action(uniform);
-		return ProcessAction(uniform.name.c_str(), action);
+		return ProcessAction(uniform.name, action);
 	}
 
 	bool GPUProgramProviderInterface::BindAttribute(GPUAttributeInfo const& attribute) const
 	{
 		GPUProgramSetAttributeAction action(attribute);
-		return ProcessAction(attribute.name.c_str(), action);
+		return ProcessAction(attribute.name, action);
 	}
 
 	bool GPUProgramProviderInterface::DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const
@@ -50,7 +61,7 @@ namespace chaos
 
 	bool GPUProgramProviderTexture::DoProcessAction(GPUProgramProviderExecutionData const & execution_data) const
 	{
-		if (execution_data.Match(handled_name.c_str(), pass_type))
+		if (execution_data.Match(handled_name, pass_type))
 			return execution_data.Process(value.get(), this); // This is the only place where the provider is required (for texture replacement)
 		return false;
 	}
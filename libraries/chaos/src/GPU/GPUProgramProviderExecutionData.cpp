@@ -56,6 +56,23 @@ namespace chaos
 		}
 	}
 
+	GPUProgramProviderExecutionData::GPUProgramProviderExecutionData(InternedString in_searched_name, GPUProgramAction& in_action, GPUProgramProviderExecutionData const* base_execution) :
+		GPUProgramProviderExecutionData(in_searched_name.c_str(), in_action, base_execution)
+	{
+		searched_interned_name = in_searched_name;
+	}
+
+	bool GPUProgramProviderExecutionData::Match(InternedString other_name, GPUProgramProviderPassType in_pass_type) const
+	{
+		if (in_pass_type != GetPassType())
+			return false;
+		if (StringTools::IsEmpty(searched_name))
+			return true;
+		if (!searched_interned_name.empty())
+			return (other_name == searched_interned_name);
+		return (StringTools::Strcmp(other_name.c_str(), searched_name) == 0);
+	}
+
 	bool GPUProgramProviderExecutionData::Match(char const* other_name, GPUProgramProviderPassType in_pass_type) const
 	{
 		if (in_pass_type != GetPassType())
@@ -19,7 +19,8 @@ namespace chaos
 
 	}
 
-	GPUProgramFileSourceGenerator::GPUProgramFileSourceGenerator(FilePathParam const & path)
+	GPUProgramFileSourceGenerator::GPUProgramFileSourceGenerator(FilePathParam const & path):
+		source_path(path.GetResolvedPath())
 	{
 		buffer = FileTools::LoadFile(path, LoadFileFlag::Ascii | LoadFileFlag::NoErrorTrace);
 		if (buffer == nullptr)
@@ -142,6 +142,20 @@ namespace chaos
 		return true;
 	}
 
+	bool GPUQuery::QueryCounter()
+	{
+		if (query_id == 0)
+			return false;
+		if (query_target != GL_TIMESTAMP) // the only target for glQueryCounter(...)
+			return false;
+		if (query_started || conditional_rendering_started)
+			return false;
+
+		query_ended = true;
+		glQueryCounter(query_id, GL_TIMESTAMP);
+		return true;
+	}
+
 	bool GPUQuery::IsResultAvailable()
 	{
 		if (query_id == 0)
@@ -6,7 +6,8 @@ namespace chaos
 	GPURenderContext::GPURenderContext(GPUDevice* in_gpu_device, Window* in_window) :
 		GPUDeviceResourceInterface(in_gpu_device),
 		window(in_window),
-		vertex_array_cache(this)
+		vertex_array_cache(this),
+		profiler(this)
 	{
 		assert(in_window != nullptr);
 	}
@@ -34,6 +35,7 @@ namespace chaos
 	void GPURenderContext::Destroy()
 	{
 		vertex_array_cache.Destroy();
+		profiler.Destroy();
 	}
 
 	bool GPURenderContext::RenderIntoFramebuffer(GPUFramebuffer* framebuffer, bool generate_mipmaps, LightweightFunction<bool()> render_func)
@@ -120,10 +122,12 @@ namespace chaos
 	void GPURenderContext::BeginRenderingFrame()
 	{
 		stats.OnBeginRenderingFrame(GetGPUDevice()->GetTimestamp());
+		profiler.OnBeginRenderingFrame();
 	}
 
 	void GPURenderContext::EndRenderingFrame()
 	{
+		profiler.OnEndRenderingFrame();
 		stats.OnEndRenderingFrame();
 	}
 
@@ -151,24 +155,28 @@ namespace chaos
 		if (primitive.count <= 0)
 			return;
 
+		// XXX : a single instance that does not start at the beginning of the buffer still requires the base instance
+		bool instanced = (instancing.instance_count > 1) || (instancing.base_instance != 0);
+		int instance_count = std::max(instancing.instance_count, 1);
+
 		if (!primitive.indexed)
 		{
-			if (instancing.instance_count <= 1)
+			if (!instanced)
 			{
 				glDrawArrays(primitive.primitive_type, primitive.start, primitive.count);
 			}
 			else
 			{
 				if (instancing.base_instance == 0)
-					glDrawArraysInstanced(primitive.primitive_type, primitive.start, primitive.count, instancing.instance_count);
+					glDrawArraysInstanced(primitive.primitive_type, primitive.start, primitive.count, instance_count);
 				else
-					glDrawArraysInstancedBaseInstance(primitive.primitive_type, primitive.start, primitive.count, instancing.instance_count, instancing.base_instance);
+					glDrawArraysInstancedBaseInstance(primitive.primitive_type, primitive.start, primitive.count, instance_count, instancing.base_instance);
 			}
 		}
 		else
 		{
 			GLvoid * offset = ((int32_t*)nullptr) + primitive.start;
-			if (instancing.instance_count <= 1)
+			if (!instanced)
 			{
 				if (primitive.base_vertex_index == 0)
 					glDrawElements(primitive.primitive_type, primitive.count, GL_UNSIGNED_INT, offset);
@@ -177,15 +185,14 @@ namespace chaos
 			}
 			else
 			{
-				if (primitive.base_vertex_index == 0)
-					glDrawElementsInstanced(primitive.primitive_type, primitive.count, GL_UNSIGNED_INT, offset, instancing.instance_count);
+				if (primitive.base_vertex_index == 0 && instancing.base_instance == 0)
+					glDrawElementsInstanced(primitive.primitive_type, primitive.count, GL_UNSIGNED_INT, offset, instance_count);
 				else
-					glDrawElementsInstancedBaseVertexBaseInstance(primitive.primitive_type, primitive.count, GL_UNSIGNED_INT, offset, instancing.instance_count, primitive.base_vertex_index, instancing.base_instance);
+					glDrawElementsInstancedBaseVertexBaseInstance(primitive.primitive_type, primitive.count, GL_UNSIGNED_INT, offset, instance_count, primitive.base_vertex_index, instancing.base_instance);
 			}
 		}
 
 		// update some statistics
-		int instance_count = (instancing.instance_count > 1) ? instancing.instance_count : 1;
 		stats.OnDrawCall(primitive.count * instance_count);
 	}
 
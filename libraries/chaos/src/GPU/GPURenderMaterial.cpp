@@ -15,7 +15,7 @@ namespace chaos
 			{
 			}
 			/** override */
-			virtual bool OnRenderMaterial(GPURenderMaterial const * render_material, GPURenderMaterialInfo const * material_info, char const * renderpass_name) override
+			virtual bool OnRenderMaterial(GPURenderMaterial const * render_material, GPURenderMaterialInfo const * material_info, InternedString renderpass_name) override
 			{
 				if (material_info->uniform_provider.DoProcessAction(execution_data)) // search in the materials uniforms
 					return true;
@@ -29,7 +29,7 @@ namespace chaos
 		};
 		// traverse the material for finding uniform
 		GPURenderMaterialProviderTraverseFunc traversal_func(execution_data);
-		if (render_material->Traverse(traversal_func, render_params->renderpass_name.c_str()))
+		if (render_material->Traverse(traversal_func, render_params->renderpass_name))
 			return true;
 		// use variables inside this provider (should be empty)
 		if (GPUProgramProvider::DoProcessAction(execution_data))
@@ -129,12 +129,12 @@ namespace chaos
 		return result;
 	}
 
-	bool GPURenderMaterial::Traverse(GPURenderMaterialInfoTraverseFunc & traverse_func, char const * renderpass_name) const
+	bool GPURenderMaterial::Traverse(GPURenderMaterialInfoTraverseFunc & traverse_func, InternedString renderpass_name) const
 	{
 		return TraverseImpl(this, material_info.get(), traverse_func, renderpass_name);
 	}
 
-	bool GPURenderMaterial::TraverseImpl(GPURenderMaterial const * render_material, GPURenderMaterialInfo const * material_info, GPURenderMaterialInfoTraverseFunc & traverse_func, char const * renderpass_name)
+	bool GPURenderMaterial::TraverseImpl(GPURenderMaterial const * render_material, GPURenderMaterialInfo const * material_info, GPURenderMaterialInfoTraverseFunc & traverse_func, InternedString renderpass_name)
 	{
 		assert(render_material != nullptr);
 		assert(material_info != nullptr);
@@ -160,7 +160,7 @@ namespace chaos
 	{
 	public:
 
-		virtual bool OnRenderMaterial(GPURenderMaterial const * render_material, GPURenderMaterialInfo const * material_info, char const * renderpass_name) override
+		virtual bool OnRenderMaterial(GPURenderMaterial const * render_material, GPURenderMaterialInfo const * material_info, InternedString renderpass_name) override
 		{
 			// use the traversal as an opportunity to know whether the object is visible (HIDDEN flag)
 			if (check_hidden_flag && material_info->hidden_specified)
@@ -210,7 +210,7 @@ namespace chaos
 		if (default_material_program != nullptr)
 			return default_material_program.get();
 		GPURenderMaterialInfoGetProgramTraverseFunc traversal_func;
-		Traverse(traversal_func, render_params.renderpass_name.c_str()); // this may return TRUE or FALSE depending on the fact that HIDDEN may be specified or NOT
+		Traverse(traversal_func, render_params.renderpass_name); // this may return TRUE or FALSE depending on the fact that HIDDEN may be specified or NOT
 		return traversal_func.program.get();
 	}
 
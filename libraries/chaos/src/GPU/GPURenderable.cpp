@@ -23,7 +23,7 @@ namespace chaos
 		if (!IsVisible())
 			return false;
 		// internal filters
-		if (!IsRenderPassEnabled(render_params.renderpass_name.c_str()))
+		if (!IsRenderPassEnabled(render_params.renderpass_name))
 			return false;
 		// filter object
 		if (render_params.object_filter != nullptr)
@@ -92,7 +92,7 @@ namespace chaos
 		tick_hidden = in_tick_hidden;
 	}
 
-	bool GPURenderable::IsRenderPassEnabled(char const * renderpass_name) const
+	bool GPURenderable::IsRenderPassEnabled(InternedString renderpass_name) const
 	{
 		return renderpass_filter.IsNameEnabled(renderpass_name);
 	}
@@ -24,6 +24,10 @@ namespace chaos
 
 		quad_mesh = nullptr;
 		quad_index_buffer = nullptr;
+
+		if (file_watcher != nullptr)
+			file_watcher->Clear();
+		watched_resource_count = 0;
 	}
 
 	size_t GPUResourceManager::GetTextureCount() const
@@ -161,6 +165,10 @@ namespace chaos
 
 	bool GPUResourceManager::OnInitialize(JSONReadConfiguration config)
 	{
+		bool hot_reload = false;
+		JSONTools::GetAttribute(config, "hot_reload", hot_reload, false);
+		SetHotReloadEnabled(hot_reload);
+
 		bool ignore_internal_resources = false;
 		JSONTools::GetAttribute(config, "ignore_internal_resources", ignore_internal_resources, false);
 		if (!ignore_internal_resources)
@@ -309,6 +317,7 @@ namespace chaos
 			// XXX : we cannot simply copy texture_id => this would produce a double deletion of OpenGL resource
 			std::swap(ori_object->texture_id, other_object->texture_id);
 			std::swap(ori_object->file_timestamp, other_object->file_timestamp);
+			std::swap(ori_object->dependent_paths, other_object->dependent_paths);
 			std::swap(ori_object->texture_description, other_object->texture_description);
 		});
 		return true;
@@ -332,6 +341,7 @@ namespace chaos
 			// XXX : we cannot simply copy program_id => this would produce a double deletion of OpenGL resource
 			std::swap(ori_object->program_id, other_object->program_id);
 			std::swap(ori_object->file_timestamp, other_object->file_timestamp);
+			std::swap(ori_object->dependent_paths, other_object->dependent_paths);
 			std::swap(ori_object->program_data, other_object->program_data);
 		});
 
@@ -391,6 +401,7 @@ namespace chaos
 			reload_data.render_material_map[other_object] = ori_object;
 
 			std::swap(ori_object->file_timestamp, other_object->file_timestamp);
+			std::swap(ori_object->dependent_paths, other_object->dependent_paths);
 
 			std::swap(ori_object->material_info, other_object->material_info);
 #if 0
@@ -472,6 +483,7 @@ namespace chaos
 			return false;
 		GiveClonedConfiguration(other_gpu_resource_manager.get());
 		JSONTools::SetAttribute(other_gpu_resource_manager->GetJSONWriteConfiguration(), "ignore_internal_resources", true);
+		JSONTools::SetAttribute(other_gpu_resource_manager->GetJSONWriteConfiguration(), "hot_reload", false);
 		// start
 		if (!other_gpu_resource_manager->StartManager())
 			return false;
@@ -482,6 +494,148 @@ namespace chaos
 		return true;
 	}
 
+	// Hot reload works with the files behind each resource:
+	//
+	//   file          -> texture  (the image or its JSON description)
+	//   file          -> program  (the .pgm description and the shader sources)
+	//   file          -> material (its JSON description)
+	//
+	// The affected resources only are loaded into a temporary manager. The other resources are shared between both managers so that
+	// references (by name or path) are resolved as usual. Then RefreshGPUResources(...) swaps the content of the reloaded objects.
+	// Because the GPUTexture/GPUProgram objects are kept (only their content is swapped), the materials that use them (and
+	// the materials that inherit from them) are up to date without being rebuilt
+
+	void GPUResourceManager::SetHotReloadEnabled(bool enabled)
+	{
+		if (enabled == IsHotReloadEnabled())
+			return;
+		if (enabled)
+			file_watcher = std::make_unique<FileWatcher>();
+		else
+			file_watcher = nullptr;
+		watched_resource_count = 0;
+	}
+
+	void GPUResourceManager::WatchResourceFiles()
+	{
+		assert(file_watcher != nullptr);
+
+		auto watch_resource = [this](FileResource const* resource)
+		{
+			if (!resource->GetPath().empty())
+				file_watcher->WatchFile(resource->GetPath()); // fails for directories: the sources are watched instead
+			for (boost::filesystem::path const& p : resource->GetDependentPaths())
+				file_watcher->WatchFile(p);
+		};
+
+		for (auto const& texture : textures)
+			watch_resource(texture.get());
+		for (auto const& program : programs)
+			watch_resource(program.get());
+		for (auto const& render_material : render_materials)
+			watch_resource(render_material.get());
+
+		watched_resource_count = textures.size() + programs.size() + render_materials.size();
+	}
+
+	bool GPUResourceManager::ProcessFileChanges()
+	{
+		if (file_watcher == nullptr)
+			return true;
+
+		// some resources have been added since the last call
+		if (watched_resource_count != textures.size() + programs.size() + render_materials.size())
+			WatchResourceFiles();
+
+		std::vector<boost::filesystem::path> paths = file_watcher->PollChanges();
+		if (paths.size() == 0)
+			return true;
+		return ReloadResourcesFromFiles(paths);
+	}
+
+	bool GPUResourceManager::ReloadResourcesFromFiles(std::vector<boost::filesystem::path> const& paths)
+	{
+		auto start_time = std::chrono::steady_clock::now();
+
+		std::set<boost::filesystem::path> changed_paths;
+		for (boost::filesystem::path const& p : paths)
+			changed_paths.insert(FileWatcher::GetWatchedPath(p));
+
+		auto is_affected = [&changed_paths](FileResource const* resource)
+		{
+			if (resource == nullptr || resource->GetPath().empty())
+				return false;
+			if (changed_paths.contains(FileWatcher::GetWatchedPath(resource->GetPath())))
+				return true;
+			for (boost::filesystem::path const& p : resource->GetDependentPaths())
+				if (changed_paths.contains(FileWatcher::GetWatchedPath(p)))
+					return true;
+			return false;
+		};
+
+		// the resources to reload
+		std::vector<GPUTexture*> affected_textures;
+		for (auto const& texture : textures)
+			if (is_affected(texture.get()))
+				affected_textures.push_back(texture.get());
+
+		std::vector<GPUProgram*> affected_programs;
+		for (auto const& program : programs)
+			if (is_affected(program.get()))
+				affected_programs.push_back(program.get());
+
+		std::vector<GPURenderMaterial*> affected_render_materials;
+		for (auto const& render_material : render_materials)
+			if (is_affected(render_material.get()))
+				affected_render_materials.push_back(render_material.get());
+
+		if (affected_textures.size() + affected_programs.size() + affected_render_materials.size() == 0)
+			return true;
+
+		// create a temporary manager that shares the unaffected resources
+		shared_ptr<GPUResourceManager> other_gpu_resource_manager = new GPUResourceManager(GetGPUDevice()); // destroyed at the end of the function
+		if (other_gpu_resource_manager == nullptr)
+			return false;
+
+		auto share_unaffected = [](auto const& src, auto& dst, auto const& affected)
+		{
+			for (auto const& object : src)
+				if (std::find(affected.begin(), affected.end(), object.get()) == affected.end())
+					dst.push_back(object);
+		};
+		share_unaffected(textures, other_gpu_resource_manager->textures, affected_textures);
+		share_unaffected(programs, other_gpu_resource_manager->programs, affected_programs);
+		share_unaffected(render_materials, other_gpu_resource_manager->render_materials, affected_render_materials);
+
+		// reload the affected resources (on failure, the resource keeps its previous content)
+		int reload_count = 0;
+		for (GPUTexture* texture : affected_textures)
+			if (other_gpu_resource_manager->LoadTexture(texture->GetPath(), texture->GetName()) != nullptr)
+				++reload_count;
+		for (GPUProgram* program : affected_programs)
+			if (other_gpu_resource_manager->LoadProgram(program->GetPath(), program->GetName()) != nullptr)
+				++reload_count;
+		for (GPURenderMaterial* render_material : affected_render_materials)
+			if (other_gpu_resource_manager->LoadRenderMaterial(render_material->GetPath(), render_material->GetName()) != nullptr)
+				++reload_count;
+
+		// steal data from other manager
+		bool result = RefreshGPUResources(other_gpu_resource_manager.get());
+
+		// the reloaded resources may depend on new files (a new #include in a shader for example)
+		// already watched files are kept as is: their pending modifications are not lost
+		if (file_watcher != nullptr && reload_count > 0)
+			WatchResourceFiles();
+
+		double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+		GPUResourceManagerLog::Message("hot reload: %d/%d resource(s) reloaded in %.2f ms",
+			reload_count,
+			int(affected_textures.size() + affected_programs.size() + affected_render_materials.size()),
+			duration);
+
+		return result;
+	}
+
 	bool GPUResourceManager::DoStartManager()
 	{
 		// super method
@@ -510,6 +664,11 @@ namespace chaos
 				{
 					ReloadDefaultPropertiesFromFile(ReloadConfigurationMode::CurrentNodeOnly, true);
 				}
+				bool hot_reload = IsHotReloadEnabled();
+				if (ImGui::MenuItem("Hot Reload", nullptr, &hot_reload))
+				{
+					SetHotReloadEnabled(hot_reload);
+				}
 				ImGui::EndMenu();
 			}
 		});
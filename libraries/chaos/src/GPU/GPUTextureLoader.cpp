@@ -96,7 +96,13 @@ namespace chaos
 		noascii_buffer.data = ascii_buffer.data;
 		noascii_buffer.bufsize = ascii_buffer.bufsize - 1;
 
-		if (FIBITMAP* image = ImageTools::LoadImageFromBuffer(noascii_buffer))
+		if (CubeMapMipChain::IsMipChainBuffer(noascii_buffer.data, noascii_buffer.bufsize))
+		{
+			CubeMapMipChain mip_chain;
+			if (mip_chain.LoadFromBuffer(noascii_buffer.data, noascii_buffer.bufsize))
+				result = GenTextureObject(&mip_chain, parameters);
+		}
+		else if (FIBITMAP* image = ImageTools::LoadImageFromBuffer(noascii_buffer))
 		{
 			result = GenTextureObject(image, parameters);
 			FreeImage_Unload(image);
@@ -273,24 +279,7 @@ namespace chaos
 				ImageTools::ConvertPixels(image, pixel_format, conversion_buffer, subimage_face_info[i].central_symetry ? ImageTransform::CentralSymetry : ImageTransform::None) :
 				image;
 
-			CubeMapFaceType face_type;
-			switch(CubeMapImageType(i))
-			{
-				case CubeMapImageType::ImageLeft:
-					face_type = CubeMapFaceType::NegativeX; break;
-				case CubeMapImageType::ImageRight:
-					face_type = CubeMapFaceType::PositiveX; break;
-				case CubeMapImageType::ImageTop:
-					face_type = CubeMapFaceType::NegativeY; break;
-				case CubeMapImageType::ImageBottom:
-					face_type = CubeMapFaceType::PositiveY; break;
-				case CubeMapImageType::ImageFront:
-					face_type = CubeMapFaceType::PositiveZ; break;
-				case CubeMapImageType::ImageBack:
-					face_type = CubeMapFaceType::NegativeZ; break;
-			}
-
-			result->SetSubImageCubeMap(effective_image, face_type);
+			result->SetSubImageCubeMap(effective_image, CubeMapTools::GetCubeMapFaceType(CubeMapImageType(i)));
 		}
 
 		// this is smoother to clamp at edges
@@ -312,6 +301,49 @@ namespace chaos
 		return result;
 	}
 
+	GPUTexture * GPUTextureLoader::GenTextureObject(CubeMapMipChain const * mip_chain, GenTextureParameters const & parameters) const
+	{
+		assert(mip_chain != nullptr);
+
+		if (mip_chain->IsEmpty())
+			return nullptr;
+
+		int level_count = mip_chain->GetLevelCount();
+		int cubemap_size = mip_chain->GetCubeMapSize();
+
+		TextureDescription texture_description;
+		texture_description.type = TextureType::TextureCubeMap;
+		texture_description.pixel_format = PixelFormat::RGBAFloat;
+		texture_description.width = cubemap_size;
+		texture_description.height = cubemap_size;
+		texture_description.depth = 1;
+		texture_description.use_mipmaps = (level_count > 1);
+
+		// create the texture
+		GPUTexture* result = GetGPUDevice()->CreateTexture(texture_description);
+		if (result == nullptr)
+			return nullptr;
+
+		// the levels are already filtered : upload them as is (never GenerateMipmaps())
+		for (int level = 0; level < level_count; ++level)
+			for (int face = int(CubeMapFaceType::PositiveX); face <= int(CubeMapFaceType::NegativeZ); ++face)
+				result->SetSubImageCubeMap(mip_chain->GetFaceDescription(level, CubeMapFaceType(face)), CubeMapFaceType(face), { 0, 0, 0 }, level);
+
+		// the chain may be shorter than what has been allocated
+		glTextureParameteri(result->GetResourceID(), GL_TEXTURE_MAX_LEVEL, level_count - 1);
+
+		TextureWrapMethods smoother_wrap_methods = parameters.wrap_methods;
+		smoother_wrap_methods.wrap_x = TextureWrapMethod::ClampToEdge;
+		smoother_wrap_methods.wrap_y = TextureWrapMethod::ClampToEdge;
+		smoother_wrap_methods.wrap_z = TextureWrapMethod::ClampToEdge;
+
+		result->SetMinificationFilter(parameters.min_filter);
+		result->SetMagnificationFilter(parameters.mag_filter);
+		result->SetWrapMethods(smoother_wrap_methods);
+
+		return result;
+	}
+
 	GPUTexture * GPUTextureLoader::GenTextureObject(nlohmann::json const * json, GenTextureParameters const & parameters) const
 	{
 		// the entry has a reference to another file => recursive call
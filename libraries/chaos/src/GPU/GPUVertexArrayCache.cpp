@@ -153,6 +153,9 @@ namespace chaos
 				binding_info.vertex_buffer->GetResourceID(),
 				binding_info.vertex_buffer_offset,
 				(GLsizei)binding_info.vertex_declaration->GetVertexSize());
+			// the attributes are read once per instance
+			if (binding_info.vertex_declaration->IsPerInstance())
+				glVertexArrayBindingDivisor(vertex_array_id, binding_index, 1);
 		}
 
 		// set the index buffer
@@ -116,6 +116,12 @@ namespace chaos
 		effective_size = in_effective_size;
 	}
 
+	void GPUVertexDeclaration::SetPerInstance(bool in_per_instance)
+	{
+		per_instance = in_per_instance;
+		hash.reset();
+	}
+
 	size_t GPUVertexDeclaration::GetSemanticCount(VertexAttributeSemantic semantic) const
 	{
 		size_t result = 0;
@@ -152,6 +158,7 @@ namespace chaos
 			std::size_t hash_value = 0;
 			for (GPUVertexDeclarationEntry const& entry : entries)
 				boost::hash_combine(hash_value, entry.GetHash());
+			boost::hash_combine(hash_value, per_instance);
 			hash = hash_value;
 		}
 		return hash.value();
@@ -49,6 +49,8 @@ namespace chaos
 
 	bool Camera::DoTick(float delta_time)
 	{
+		// keep the box of the previous step for render interpolation
+		previous_camera_box = camera_box;
 		// tick all components
 		size_t count = components.size();
 		for (size_t i = 0; i < count; ++i)
@@ -56,6 +58,30 @@ namespace chaos
 		return true;
 	}
 
+	void Camera::SetCameraBox(box2 const& in_box, bool teleport)
+	{
+		if (teleport)
+			previous_camera_box.reset();
+		camera_box = in_box;
+	}
+
+	void Camera::BeginRenderInterpolation(float alpha)
+	{
+		if (!previous_camera_box.has_value() || alpha >= 1.0f || simulated_camera_box.has_value())
+			return;
+		simulated_camera_box = camera_box;
+		camera_box.position = glm::mix(previous_camera_box->position, camera_box.position, alpha);
+		camera_box.half_size = glm::mix(previous_camera_box->half_size, camera_box.half_size, alpha);
+	}
+
+	void Camera::EndRenderInterpolation()
+	{
+		if (!simulated_camera_box.has_value())
+			return;
+		camera_box = *simulated_camera_box;
+		simulated_camera_box.reset();
+	}
+
 	box2 Camera::GetCameraBox(bool apply_modifiers) const
 	{
 		box2 result = camera_box;
@@ -129,7 +155,26 @@ namespace chaos
 			return false;
 		box2 b;
 		if (JSONTools::GetAttribute(config, "CAMERA_BOX", b))
-			SetCameraBox(b);
+			SetCameraBox(b, true);
+		return true;
+	}
+
+	bool Camera::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!JSONSerializableInterface::SerializeIntoSnapshot(writer))
+			return false;
+		writer.Write(GetCameraBox(false));
+		return true;
+	}
+
+	bool Camera::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!JSONSerializableInterface::SerializeFromSnapshot(reader))
+			return false;
+		box2 b;
+		if (!reader.Read(b))
+			return false;
+		SetCameraBox(b, true);
 		return true;
 	}
 
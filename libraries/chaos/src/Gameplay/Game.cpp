@@ -54,6 +54,15 @@ namespace chaos
 
 	void Game::Tick(float delta_time)
 	{
+		CHAOS_PROFILE_ZONE("Game::Tick");
+
+		// keep the pawns boxes of the previous step for render interpolation
+		size_t player_count = GetPlayerCount();
+		for (size_t i = 0; i < player_count; ++i)
+			if (Player* player = GetPlayer(i))
+				if (PlayerPawn* pawn = player->GetPawn())
+					pawn->SavePreviousBoundingBox();
+
 		// tick the free camera
 		if (free_camera != nullptr)
 			free_camera->Tick(delta_time);
@@ -190,7 +199,32 @@ namespace chaos
 	void Game::Display(GPURenderContext * render_context, GPUProgramProviderInterface const * uniform_provider, GPURenderParams const & render_params)
 	{
 		GPUProgramProviderChain main_uniform_provider(this, game_instance.get(), level_instance.get(), uniform_provider);
+		BeginRenderInterpolation(render_params.interpolation_alpha);
 		DoDisplay(render_context, &main_uniform_provider, render_params);
+		EndRenderInterpolation();
+	}
+
+	void Game::BeginRenderInterpolation(float alpha)
+	{
+		// XXX : the pawns are called even without blending (their GPU buffer may still contain the previous blended box)
+		if (Camera* camera = GetCamera(0))
+			camera->BeginRenderInterpolation(alpha);
+		size_t player_count = GetPlayerCount();
+		for (size_t i = 0; i < player_count; ++i)
+			if (Player* player = GetPlayer(i))
+				if (PlayerPawn* pawn = player->GetPawn())
+					pawn->BeginRenderInterpolation(alpha);
+	}
+
+	void Game::EndRenderInterpolation()
+	{
+		if (Camera* camera = GetCamera(0))
+			camera->EndRenderInterpolation();
+		size_t player_count = GetPlayerCount();
+		for (size_t i = 0; i < player_count; ++i)
+			if (Player* player = GetPlayer(i))
+				if (PlayerPawn* pawn = player->GetPawn())
+					pawn->EndRenderInterpolation();
 	}
 
 	bool Game::DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const
@@ -995,6 +1029,7 @@ namespace chaos
 
 	bool Game::TickGameLoop(float delta_time)
 	{
+		CHAOS_PROFILE_ZONE("Game::TickGameLoop");
 
 		// shurefactor
 
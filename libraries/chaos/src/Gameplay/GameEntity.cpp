@@ -65,15 +65,74 @@ namespace chaos
 
 
 
-	void GameEntity::SetPosition(glm::vec2 const& in_position)
+	void GameEntity::SavePreviousBoundingBox()
 	{
+		previous_bounding_box = GetBoundingBox();
+	}
+
+	void GameEntity::ClearPreviousBoundingBox()
+	{
+		previous_bounding_box.reset();
+	}
+
+	box2 GameEntity::GetInterpolatedBoundingBox(float alpha) const
+	{
+		box2 result = GetBoundingBox();
+		if (previous_bounding_box.has_value() && alpha < 1.0f)
+		{
+			result.position = glm::mix(previous_bounding_box->position, result.position, alpha);
+			result.half_size = glm::mix(previous_bounding_box->half_size, result.half_size, alpha);
+		}
+		return result;
+	}
+
+	glm::vec2 GameEntity::GetInterpolatedPosition(float alpha) const
+	{
+		return GetInterpolatedBoundingBox(alpha).position;
+	}
+
+	// XXX : the GPU buffer is only regenerated once per frame, with the blended box
+	//       restoring the simulated box does not require a new buffer (it is never displayed) except when the next frame is not blended
+
+	void GameEntity::BeginRenderInterpolation(float alpha)
+	{
+		if (simulated_bounding_box.has_value())
+			return;
+
+		bool interpolate = (previous_bounding_box.has_value() && alpha < 1.0f);
+		if (interpolate)
+		{
+			simulated_bounding_box = GetBoundingBox();
+			SetBoundingBox(GetInterpolatedBoundingBox(alpha));
+		}
+		if (interpolate || gpu_buffer_interpolated)
+			if (allocations != nullptr)
+				if (ParticleLayerBase* layer = allocations->GetLayer())
+					layer->SetGPUVerticesDirty();
+		gpu_buffer_interpolated = interpolate;
+	}
+
+	void GameEntity::EndRenderInterpolation()
+	{
+		if (!simulated_bounding_box.has_value())
+			return;
+		SetBoundingBox(*simulated_bounding_box);
+		simulated_bounding_box.reset();
+	}
+
+	void GameEntity::SetPosition(glm::vec2 const& in_position, bool teleport)
+	{
+		if (teleport)
+			ClearPreviousBoundingBox();
 		if (is_particle_master)
 			if (ParticleTools::SetParticlePosition(allocations.get(), 0, in_position))
 				return;
 		bounding_box.position = in_position;
 	}
-	void GameEntity::SetBoundingBox(box2 const& in_bounding_box)
+	void GameEntity::SetBoundingBox(box2 const& in_bounding_box, bool teleport)
 	{
+		if (teleport)
+			ClearPreviousBoundingBox();
 		if (is_particle_master)
 			if (ParticleTools::SetParticleBox(allocations.get(), 0, in_bounding_box))
 				return;
@@ -141,7 +200,7 @@ namespace chaos
 
 		box2 b;
 		if (JSONTools::GetAttribute(config, "BOUNDING_BOX", b))
-			SetBoundingBox(b);
+			SetBoundingBox(b, true);
 
 		return true;
 	}
@@ -154,5 +213,24 @@ namespace chaos
 		return true;
 	}
 
+	bool GameEntity::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!JSONSerializableInterface::SerializeIntoSnapshot(writer))
+			return false;
+		writer.Write(GetBoundingBox());
+		return true;
+	}
+
+	bool GameEntity::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!JSONSerializableInterface::SerializeFromSnapshot(reader))
+			return false;
+		box2 b;
+		if (!reader.Read(b))
+			return false;
+		SetBoundingBox(b, true);
+		return true;
+	}
+
 }; // namespace chaos
 
@@ -3,6 +3,13 @@
 
 namespace chaos
 {
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(bool, EnableGameRewind, false);
+		CHAOS_GLOBAL_VARIABLE(size_t, GameRewindMemory, 16); // in MB
+		CHAOS_GLOBAL_VARIABLE(bool, BinaryCheckpoints, false);
+	};
+
 	CHAOS_IMPLEMENT_GAMEPLAY_GETTERS(GameInstance);
 
 	int GameInstance::GetBestPlayerScore() const
@@ -87,6 +94,14 @@ namespace chaos
 
 	bool GameInstance::DoTick(float delta_time)
 	{
+		// record the state at the beginning of the frame
+		if (rewind_enabled && GetLevelInstance() != nullptr)
+		{
+			rewind_writer.Reset();
+			if (SaveIntoSnapshot(rewind_writer, true))
+				rewind_buffer.Push(rewind_writer.GetBuffer());
+		}
+
 		size_t count = players.size();
 		for (size_t i = 0; i < count; ++i)
 			players[i]->Tick(delta_time);
@@ -164,6 +179,9 @@ namespace chaos
 		assert(game == nullptr);
 		// set the game
 		game = in_game;
+		// the rewind buffer
+		rewind_enabled = GlobalVariables::EnableGameRewind.Get();
+		rewind_buffer = SnapshotRingBuffer(GlobalVariables::GameRewindMemory.Get() * 1024 * 1024);
 		// initialize from configuration
 		if (!ReadConfigurableProperties(ReadConfigurablePropertiesContext::Initialization, false))
 			return false;
@@ -302,6 +320,9 @@ namespace chaos
 
 	void GameInstance::OnLevelChanged(Level * new_level, Level * old_level, LevelInstance * new_level_instance)
 	{
+		// the recorded frames belong to the previous level
+		rewind_buffer.Clear();
+
 		size_t count = GetPlayerCount();
 		for (size_t i = 0; i < count; ++i)
 		{
@@ -342,6 +363,16 @@ namespace chaos
 
 	bool GameInstance::DoSaveIntoCheckpoint(GameCheckpoint * checkpoint) const
 	{
+		// binary save
+		if (GlobalVariables::BinaryCheckpoints.Get())
+		{
+			SnapshotWriter writer;
+			if (!SaveIntoSnapshot(writer, false))
+				return false;
+			checkpoint->snapshot = writer.GetBuffer();
+			return true;
+		}
+
 		// save level instance data
 		// XXX : this is important that it is first so we can test LEVEL INDEX correspond to the level
 		LevelInstance const* level_instance = GetLevelInstance();
@@ -374,6 +405,13 @@ namespace chaos
 
 	bool GameInstance::DoLoadFromCheckpoint(GameCheckpoint const * checkpoint)
 	{
+		// binary load
+		if (checkpoint->snapshot.size() > 0)
+		{
+			SnapshotReader reader(checkpoint->snapshot);
+			return LoadFromSnapshot(reader, false);
+		}
+
 		// load level instance data
 		// XXX : this is important that it is first so we can test LEVEL INDEX correspond to the level
 		LevelInstance * level_instance = GetLevelInstance();
@@ -400,6 +438,132 @@ namespace chaos
 		return true;
 	}
 
+	bool GameInstance::SaveIntoSnapshot(SnapshotWriter & writer, bool with_clocks) const
+	{
+		size_t chunk_position = writer.BeginChunk(MakeSnapshotTag("GAME"));
+		writer.Write(uint32_t(SNAPSHOT_VERSION));
+
+		// save level instance data
+		// XXX : this is important that it is first so we can test LEVEL INDEX correspond to the level
+		LevelInstance const* level_instance = GetLevelInstance();
+		writer.Write(level_instance != nullptr);
+		if (level_instance != nullptr)
+			if (!writer.WriteObject(MakeSnapshotTag("LEVL"), *level_instance))
+				return false;
+
+		// save player data
+		Player const* player = GetPlayer(0);
+		writer.Write(player != nullptr);
+		if (player != nullptr)
+			if (!writer.WriteObject(MakeSnapshotTag("PLYR"), *player))
+				return false;
+
+		// save the clocks
+		writer.Write(with_clocks);
+		if (with_clocks)
+		{
+			if (!writer.WriteObject(MakeSnapshotTag("MCLK"), *main_clock))
+				return false;
+			if (!writer.WriteObject(MakeSnapshotTag("GCLK"), *game_clock))
+				return false;
+		}
+
+		writer.EndChunk(chunk_position);
+		return true;
+	}
+
+	bool GameInstance::LoadFromSnapshot(SnapshotReader & reader, bool with_clocks)
+	{
+		size_t chunk_end = 0;
+		if (!reader.BeginChunk(MakeSnapshotTag("GAME"), chunk_end))
+			return false;
+
+		uint32_t version = 0;
+		if (!reader.Read(version) || version != SNAPSHOT_VERSION)
+		{
+			SnapshotLog::Error("GameInstance::LoadFromSnapshot: unsupported version %d", int(version));
+			return false;
+		}
+
+		// load level instance data
+		// XXX : this is important that it is first so we can test LEVEL INDEX correspond to the level
+		bool has_level_instance = false;
+		if (!reader.Read(has_level_instance))
+			return false;
+		if (has_level_instance)
+		{
+			LevelInstance * level_instance = GetLevelInstance();
+			if (level_instance == nullptr || !reader.ReadObject(MakeSnapshotTag("LEVL"), *level_instance))
+				return false;
+		}
+
+		// load player data
+		bool has_player = false;
+		if (!reader.Read(has_player))
+			return false;
+		if (has_player)
+		{
+			Player * player = GetPlayer(0);
+			if (player != nullptr)
+			{
+				if (!reader.ReadObject(MakeSnapshotTag("PLYR"), *player))
+					return false;
+			}
+			else
+				reader.SkipChunk(MakeSnapshotTag("PLYR"));
+		}
+
+		// load the clocks
+		bool has_clocks = false;
+		if (!reader.Read(has_clocks))
+			return false;
+		if (has_clocks)
+		{
+			if (with_clocks)
+			{
+				reader.ReadObject(MakeSnapshotTag("MCLK"), *main_clock);
+				reader.ReadObject(MakeSnapshotTag("GCLK"), *game_clock);
+			}
+			else
+			{
+				reader.SkipChunk(MakeSnapshotTag("MCLK"));
+				reader.SkipChunk(MakeSnapshotTag("GCLK"));
+			}
+		}
+
+		return reader.EndChunk(chunk_end);
+	}
+
+	void GameInstance::SetRewindEnabled(bool in_enabled)
+	{
+		rewind_enabled = in_enabled;
+		if (!rewind_enabled)
+			rewind_buffer.Clear();
+	}
+
+	size_t GameInstance::GetRewindFrameCount() const
+	{
+		return rewind_buffer.GetSnapshotCount();
+	}
+
+	bool GameInstance::Rewind(size_t frame_count)
+	{
+		size_t snapshot_count = rewind_buffer.GetSnapshotCount();
+		if (snapshot_count == 0)
+			return false;
+		// the frame to restore (the oldest one if we cannot go that far)
+		size_t index = (frame_count < snapshot_count) ? snapshot_count - 1 - frame_count : 0;
+		if (!rewind_buffer.GetSnapshot(index, rewind_snapshot))
+			return false;
+
+		SnapshotReader reader(rewind_snapshot);
+		if (!LoadFromSnapshot(reader, true))
+			return false;
+		// the frames after the restored one are no more valid (it is recorded again by next tick)
+		rewind_buffer.Truncate(index);
+		return true;
+	}
+
 	bool GameInstance::CanCompleteLevel() const
 	{
 		return true;
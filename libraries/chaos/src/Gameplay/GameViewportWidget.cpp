@@ -61,6 +61,7 @@ namespace chaos
 				// set the viewport
 				GPURenderParams render_params;
 				render_params.viewport = placement;
+				render_params.interpolation_alpha = draw_params.interpolation_alpha;
 				GLTools::SetViewport(render_params.viewport); // ignore the size from draw_params. use our own placement
 
 				// scissor: avoid glClearBufferfv(...) functions to clear the whole screen
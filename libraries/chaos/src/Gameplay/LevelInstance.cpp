@@ -429,6 +429,52 @@ namespace chaos
 		return true;
 	}
 
+	bool LevelInstance::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!JSONSerializableInterface::SerializeIntoSnapshot(writer))
+			return false;
+
+		// level index (just to be sure this is valid to apply a snapshot on this level)
+		writer.Write(level->GetLevelIndex());
+		// attributes
+		writer.Write(level_timeout);
+		// the camera 0
+		Camera const * camera = DoGetCamera(0, false); // do not accept free camera
+		writer.Write(camera != nullptr);
+		if (camera != nullptr)
+			if (!writer.WriteObject(MakeSnapshotTag("CAM0"), *camera))
+				return false;
+
+		return true;
+	}
+
+	bool LevelInstance::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!JSONSerializableInterface::SerializeFromSnapshot(reader))
+			return false;
+
+		// check for level index
+		int index = 0;
+		if (!reader.Read(index) || level->GetLevelIndex() != index)
+			return false;
+
+		// attributes
+		reader.Read(level_timeout);
+		// the camera 0
+		bool has_camera = false;
+		if (!reader.Read(has_camera))
+			return false;
+		if (has_camera)
+		{
+			Camera * camera = DoGetCamera(0, false); // do not accept free camera
+			if (camera != nullptr)
+				reader.ReadObject(MakeSnapshotTag("CAM0"), *camera);
+			else
+				reader.SkipChunk(MakeSnapshotTag("CAM0"));
+		}
+		return !reader.HasError();
+	}
+
 	box2 LevelInstance::GetBoundingBox() const
 	{
 		if (game != nullptr)
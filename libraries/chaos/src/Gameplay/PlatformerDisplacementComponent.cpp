@@ -274,7 +274,7 @@ namespace chaos
 
 		TileCollisionComputer computer = TileCollisionComputer(GetLevelInstance(), initial_pawn_box, pawn_box, CollisionMask::PLAYER, pawn->GetAllocation(), displacement_info.pawn_extend, wangset_name);
 
-		pawn_box = computer.Run([&computer, &collision_flags](TileCollisionInfo const& collision_info)
+		auto collision_func = [&computer, &collision_flags](TileCollisionInfo const& collision_info)
 		{
 			if ((collision_info.particle->flags & PlatformerParticleFlags::LADDER) != 0)
 			{
@@ -300,7 +300,12 @@ namespace chaos
 					return true;
 				});
 			}
-		});
+		};
+
+		if (displacement_info.continuous_collision)
+			pawn_box = computer.RunContinuous(collision_func);
+		else
+			pawn_box = computer.Run(collision_func);
 
 		// update player state
 		displacement_state = ComputeDisplacementState(pawn_box, jump_pressed, stick_position, collision_flags);
@@ -291,6 +291,51 @@ namespace chaos
 		return true;
 	}
 
+	bool Player::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!JSONSerializableInterface::SerializeIntoSnapshot(writer))
+			return false;
+
+		writer.Write(life_count);
+		writer.Write(health);
+		writer.Write(max_health);
+		writer.Write(invulnerability_timer);
+		writer.Write(invulnerability_duration);
+		writer.Write(score);
+
+		writer.Write(pawn != nullptr);
+		if (pawn != nullptr)
+			if (!writer.WriteObject(MakeSnapshotTag("PAWN"), *pawn))
+				return false;
+
+		return true;
+	}
+
+	bool Player::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!JSONSerializableInterface::SerializeFromSnapshot(reader))
+			return false;
+
+		reader.Read(life_count);
+		reader.Read(health);
+		reader.Read(max_health);
+		reader.Read(invulnerability_timer);
+		reader.Read(invulnerability_duration);
+		reader.Read(score);
+
+		bool has_pawn = false;
+		if (!reader.Read(has_pawn))
+			return false;
+		if (has_pawn)
+		{
+			if (pawn != nullptr)
+				reader.ReadObject(MakeSnapshotTag("PAWN"), *pawn);
+			else
+				reader.SkipChunk(MakeSnapshotTag("PAWN"));
+		}
+		return !reader.HasError();
+	}
+
 	void Player::OnLifeLost()
 	{
         health = max_health;
@@ -0,0 +1,275 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================
+	// TMChunkStreamer implementation
+	// =====================================
+
+	TMChunkStreamer::~TMChunkStreamer()
+	{
+		// the tasks reference this object
+		WaitPendingBuilds();
+	}
+
+	void TMChunkStreamer::WaitPendingBuilds()
+	{
+		while (pending_build_count > 0)
+			std::this_thread::yield();
+	}
+
+	bool TMChunkStreamer::Initialize(TMLayerInstance* in_layer_instance, TiledMap::TileLayer const* in_tile_layer)
+	{
+		assert(in_layer_instance != nullptr);
+		assert(in_layer_instance->particle_layer != nullptr);
+		assert(in_tile_layer != nullptr);
+
+		layer_instance = in_layer_instance;
+		tile_layer = in_tile_layer;
+
+		TMLevel* level = layer_instance->GetLevel();
+		if (level == nullptr)
+			return false;
+		TMLevelInstance* level_instance = layer_instance->GetLevelInstance();
+		if (level_instance == nullptr)
+			return false;
+
+		// the workers use the level tables only : they must be relative to the folder of the particle layer
+		GPUAtlas const* texture_atlas = layer_instance->particle_layer->GetTextureAtlas();
+		if (texture_atlas == nullptr)
+			return false;
+		AtlasFolderInfo const* folder_info = texture_atlas->GetFolderInfo(level->GetAtlasFolderInfoRequest());
+		if (folder_info == nullptr || level_instance->GetTileAtlasTable().GetFolderInfo() != folder_info)
+		{
+			TiledMap::TiledMapLog::Warning("TMChunkStreamer::Initialize : layer [%s] is not streamed (the atlas folder differs from the level's one)", tile_layer->name.c_str());
+			return false;
+		}
+		tile_atlas_table = &level_instance->GetTileAtlasTable();
+
+		// the factories cannot be used by the workers : search once for all the tiles that would create an object
+		if (TiledMap::Map const* tiled_map = level_instance->GetTiledMap())
+		{
+			for (TiledMap::TileSetData const& data : tiled_map->tilesets)
+			{
+				if (data.tileset == nullptr)
+					continue;
+				for (shared_ptr<TiledMap::TileData> const& tiledata : data.tileset->tiles)
+					if (tiledata != nullptr && layer_instance->GetObjectFactory(tiledata.get()))
+						object_gids.insert(data.first_gid + tiledata->id);
+			}
+		}
+
+		// the properties
+		streaming_radius = tile_layer->GetPropertyValueFloat("STREAMING_RADIUS", streaming_radius);
+		int budget_kb = tile_layer->GetPropertyValueInt("STREAMING_MEMORY_BUDGET", int(memory_budget / 1024));
+		memory_budget = size_t(std::max(budget_kb, 0)) * 1024;
+
+		// the extent of the chunks (the images of the tiles may be larger than the tiles, the radius is there for that)
+		glm::vec2 tile_size = auto_cast_vector(tile_layer->tile_size);
+
+		chunks.reserve(tile_layer->tile_chunks.size());
+		for (TiledMap::TileLayerChunk const& chunk : tile_layer->tile_chunks)
+		{
+			StreamedChunk streamed_chunk;
+			streamed_chunk.chunk = &chunk;
+			streamed_chunk.bounding_box =
+				tile_layer->GetTileBoundingBox(chunk.offset, tile_size, 0, false) |
+				tile_layer->GetTileBoundingBox(chunk.offset + chunk.size - glm::ivec2(1, 1), tile_size, 0, false);
+			chunks.push_back(std::move(streamed_chunk));
+		}
+		return true;
+	}
+
+	box2 TMChunkStreamer::GetBoundingBox() const
+	{
+		box2 result;
+		for (StreamedChunk const& streamed_chunk : chunks)
+			result = result | streamed_chunk.bounding_box;
+		return result;
+	}
+
+	size_t TMChunkStreamer::GetResidentChunkCount() const
+	{
+		size_t result = 0;
+		for (StreamedChunk const& streamed_chunk : chunks)
+			if (streamed_chunk.resident)
+				++result;
+		return result;
+	}
+
+	bool TMChunkStreamer::IsInRange(StreamedChunk const& streamed_chunk, box2 const& streaming_box) const
+	{
+		return Collide(streamed_chunk.bounding_box, streaming_box);
+	}
+
+	void TMChunkStreamer::Tick(box2 const& camera_box)
+	{
+		box2 streaming_box = camera_box;
+		streaming_box.half_size += glm::vec2(streaming_radius, streaming_radius);
+
+		// the very first time, the visible chunks are built immediately so that the level does not start empty
+		if (initial_tick)
+		{
+			initial_tick = false;
+
+			std::vector<StreamedChunk*> initial_chunks;
+			for (StreamedChunk& streamed_chunk : chunks)
+			{
+				if (IsInRange(streamed_chunk, streaming_box))
+				{
+					streamed_chunk.build = std::make_shared<BuildResult>();
+					initial_chunks.push_back(&streamed_chunk);
+				}
+			}
+			ThreadPool::GetDefaultInstance()->ParallelFor(initial_chunks.size(), [this, &initial_chunks](size_t i)
+			{
+				StreamedChunk* streamed_chunk = initial_chunks[i];
+				BuildChunkParticles(*streamed_chunk->chunk, streamed_chunk->build->particles);
+				streamed_chunk->build->finished = true;
+			});
+		}
+
+		for (StreamedChunk& streamed_chunk : chunks)
+		{
+			bool in_range = IsInRange(streamed_chunk, streaming_box);
+
+			// the build is finished (the result is useless if the camera went away)
+			if (streamed_chunk.build != nullptr && streamed_chunk.build->finished)
+			{
+				if (in_range && !CompleteBuild(streamed_chunk))
+					streamed_chunk.failed = true;
+				streamed_chunk.build = nullptr;
+			}
+			// the allocation may have been destroyed by the gameplay (the chunk must not be rebuilt from the map data)
+			if (streamed_chunk.resident && streamed_chunk.memory_size > 0 && streamed_chunk.allocation.get() == nullptr)
+			{
+				resident_memory_size -= streamed_chunk.memory_size;
+				streamed_chunk.memory_size = 0;
+				streamed_chunk.modified = true;
+			}
+			// request the chunk
+			if (in_range && !streamed_chunk.resident && !streamed_chunk.failed && streamed_chunk.build == nullptr && pending_build_count < MAX_PENDING_BUILD_COUNT)
+				StartBuild(streamed_chunk);
+		}
+
+		// evict the farthest chunks that are out of range
+		if (resident_memory_size > memory_budget)
+		{
+			std::vector<std::pair<float, StreamedChunk*>> candidates;
+			for (StreamedChunk& streamed_chunk : chunks)
+				if (streamed_chunk.resident && !IsInRange(streamed_chunk, streaming_box) && !CheckModified(streamed_chunk))
+					candidates.emplace_back(glm::distance2(streamed_chunk.bounding_box.position, camera_box.position), &streamed_chunk);
+
+			std::sort(candidates.begin(), candidates.end(), [](auto const& src1, auto const& src2)
+			{
+				return src1.first > src2.first;
+			});
+
+			for (size_t i = 0; i < candidates.size() && resident_memory_size > memory_budget; ++i)
+				EvictChunk(*candidates[i].second);
+		}
+	}
+
+	void TMChunkStreamer::StartBuild(StreamedChunk& streamed_chunk)
+	{
+		std::shared_ptr<BuildResult> build = std::make_shared<BuildResult>();
+		streamed_chunk.build = build;
+
+		++pending_build_count;
+		ThreadPool::GetDefaultInstance()->AddTask([this, build, chunk = streamed_chunk.chunk]()
+		{
+			BuildChunkParticles(*chunk, build->particles);
+			build->finished = true;
+			--pending_build_count; // XXX : the streamer may be destroyed as soon as this counter is decremented
+		});
+	}
+
+	void TMChunkStreamer::BuildChunkParticles(TiledMap::TileLayerChunk const& chunk, std::vector<TMParticle>& particles) const
+	{
+		if (!TMLevelInstance::PrepareTileChunkParticles(tile_layer, chunk, *tile_atlas_table, particles))
+			return;
+
+		// remove the tiles that create objects and the unknown bitmaps
+		auto it = std::remove_if(particles.begin(), particles.end(), [this](TMParticle const& particle)
+		{
+			if (particle.bitmap_info == nullptr)
+				return true;
+			return (object_gids.size() > 0 && object_gids.find(particle.gid) != object_gids.end());
+		});
+		particles.erase(it, particles.end());
+	}
+
+	bool TMChunkStreamer::CompleteBuild(StreamedChunk& streamed_chunk)
+	{
+		std::vector<TMParticle> const& particles = streamed_chunk.build->particles;
+
+		// an empty chunk
+		if (particles.size() == 0)
+		{
+			streamed_chunk.resident = true;
+			return true;
+		}
+		// create the allocation
+		ParticleAllocationBase* allocation = layer_instance->SpawnParticles(0);
+		if (allocation == nullptr)
+		{
+			ParticleLog::Error("TMChunkStreamer::CompleteBuild : fails to SpawnParticles");
+			return false;
+		}
+		ParticleAccessor<TMParticle> accessor = allocation->AddParticles(particles.size());
+		if (!accessor.IsValid())
+		{
+			ParticleLog::Error("TMChunkStreamer::CompleteBuild : invalid accessor");
+			allocation->RemoveFromLayer();
+			return false;
+		}
+		for (size_t i = 0; i < particles.size(); ++i)
+			accessor[i] = particles[i];
+
+		if (!layer_instance->FinalizeParticles(allocation))
+		{
+			allocation->RemoveFromLayer();
+			return false;
+		}
+
+		streamed_chunk.resident = true;
+		streamed_chunk.allocation = allocation;
+		streamed_chunk.particle_count = particles.size();
+		streamed_chunk.memory_size = particles.size() * allocation->GetParticleSize();
+		resident_memory_size += streamed_chunk.memory_size;
+		return true;
+	}
+
+	void TMChunkStreamer::EvictChunk(StreamedChunk& streamed_chunk)
+	{
+		if (ParticleAllocationBase* allocation = streamed_chunk.allocation.get())
+			allocation->RemoveFromLayer();
+
+		resident_memory_size -= streamed_chunk.memory_size;
+		streamed_chunk.memory_size = 0;
+		streamed_chunk.particle_count = 0;
+		streamed_chunk.allocation = nullptr;
+		streamed_chunk.resident = false;
+		streamed_chunk.modified = false;
+	}
+
+	bool TMChunkStreamer::CheckModified(StreamedChunk& streamed_chunk)
+	{
+		// XXX : only the destruction of particles is detected (the particles changed in place are not)
+		if (!streamed_chunk.modified)
+			if (ParticleAllocationBase const* allocation = streamed_chunk.allocation.get())
+				if (allocation->GetParticleCount() != streamed_chunk.particle_count)
+					streamed_chunk.modified = true;
+		return streamed_chunk.modified;
+	}
+
+	void TMChunkStreamer::Reset()
+	{
+		for (StreamedChunk& streamed_chunk : chunks)
+			if (streamed_chunk.resident)
+				EvictChunk(streamed_chunk);
+		initial_tick = true; // the visible chunks are built immediately again
+	}
+
+}; // namespace chaos
\ No newline at end of file
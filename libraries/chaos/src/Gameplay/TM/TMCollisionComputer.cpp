@@ -106,6 +106,19 @@ namespace chaos
 	//               +-----------
 	//               |
 
+	// -----------------------
+	// Continuous collision
+	// -----------------------
+	//
+	// With discrete collisions, a fast PAWN can go through a thin wall in a single step (tunnelling) => the tick must be clamped or sub-stepped
+	//
+	// RunContinuous(...) sweeps the PAWN along its displacement against the (non shared) edges of the tiles
+	//
+	//   - the first edge hit gives a time of impact and a normal
+	//   - the PAWN is stopped at the limit ZONE 1/ZONE 2 and the remaining displacement slides along the edge
+	//   - this is done several times (max_sweep_iterations) to handle corners
+	//   - finally, the discrete computation is done around the final position (so that ZONE 2 touches are reported as usual)
+
 	static bool RangeOverlaps(box_corners2 const & range1, box_corners2 const& range2, int component)
 	{
 		if (range1.min[component] > range2.max[component] || range1.max[component] < range2.min[component])
@@ -115,15 +128,42 @@ namespace chaos
 
 	box2 TileCollisionComputer::Run(LightweightFunction<void(TileCollisionInfo const& collision_info)> func)
 	{
-		assert(level_instance != nullptr);
+		DoRun(src_box | dst_box, func);
+		return dst_box;
+	}
 
-		// work on extended copy of the box
-		box2 extended_box = src_box | dst_box;
+	box2 TileCollisionComputer::RunContinuous(LightweightFunction<void(TileCollisionInfo const& collision_info)> func)
+	{
+		box2 box = src_box;
+		glm::vec2 displacement = dst_box.position - src_box.position;
+
+		for (int i = 0; i < max_sweep_iterations; ++i)
+		{
+			if (displacement == glm::vec2(0.0f, 0.0f))
+				break;
+
+			TileSweepResult sweep_result = Sweep(box, displacement);
+			box.position += displacement * sweep_result.time_of_impact;
+			if (!sweep_result.hit)
+				break;
+			// slide along the edge with the remaining displacement
+			displacement *= (1.0f - sweep_result.time_of_impact);
+			displacement -= sweep_result.normal * glm::dot(displacement, sweep_result.normal);
+		}
+		dst_box = box;
 
-		glm::vec2 delta = box_extend;
-		extended_box.half_size += delta;
+		// discrete computation around the final position only
+		DoRun(dst_box, func);
+		return dst_box;
+	}
+
+	void TileCollisionComputer::DoRun(box2 const& box, LightweightFunction<void(TileCollisionInfo const& collision_info)> func)
+	{
+		assert(level_instance != nullptr);
 
-		glm::vec2 delta_position = dst_box.position - src_box.position;
+		// work on extended copy of the box
+		box2 extended_box = box;
+		extended_box.half_size += box_extend;
 
 		// iterate over all particles
 		TMTileCollisionIterator it = level_instance->GetTileCollisionIterator(extended_box, collision_mask, false);
@@ -140,21 +180,65 @@ namespace chaos
 			// next
 			++it;
 		}
-		return dst_box;
 	}
 
-	void TileCollisionComputer::ComputeReaction(TileCollisionInfo const& collision_info, LightweightFunction<bool(TileCollisionInfo const &, Edge)> func)
+	TileSweepResult TileCollisionComputer::Sweep(box2 const& box, glm::vec2 const& displacement)
 	{
-		int particle_flags = collision_info.particle->flags;
+		assert(level_instance != nullptr);
 
-		// search for wang flags (use cache for faster search)
-		TiledMap::WangTile wangtile;
+		TileSweepResult result;
+
+		// the whole volume covered by the box during the displacement
+		box2 swept_box = box;
+		swept_box.position += displacement;
+		swept_box = swept_box | box;
+		swept_box.half_size += box_extend;
+
+		TMTileCollisionIterator it = level_instance->GetTileCollisionIterator(swept_box, collision_mask, false);
+		while (it)
+		{
+			// ignore pawn allocation
+			if (it->allocation == ignore_allocation)
+			{
+				it.NextAllocation();
+				continue;
+			}
+
+			TileCollisionInfo const& collision_info = *it;
+
+			TiledMap::WangTile wangtile;
+			if (GetWangTile(collision_info, wangtile))
+			{
+				box_corners2 particle_corners = GetBoxCorners(collision_info.particle->bounding_box);
+
+				for (Edge edge : {Edge::Left, Edge::Right, Edge::Bottom, Edge::Top})
+				{
+					float time_of_impact = 1.0f;
+					if (IsCollisionEdge(collision_info, wangtile, edge) && SweepEdge(particle_corners, box, displacement, box_extend, edge, time_of_impact))
+					{
+						if (!result.hit || time_of_impact < result.time_of_impact)
+						{
+							result.hit = true;
+							result.time_of_impact = time_of_impact;
+							result.normal = GetEdgeNormal(edge);
+							result.edge = edge;
+							result.collision_info = collision_info;
+						}
+					}
+				}
+			}
+			++it;
+		}
+		return result;
+	}
 
+	bool TileCollisionComputer::GetWangTile(TileCollisionInfo const& collision_info, TiledMap::WangTile& result)
+	{
 		if (wangset_name != nullptr)
 		{
 			// cannot do anything without a known tileset : this should never happen
 			if (collision_info.tile_info.tileset == nullptr)
-				return;
+				return false;
 			// different tileset than the one for previous particle ?
 			if (collision_info.tile_info.tileset != tileset)
 			{
@@ -163,151 +247,166 @@ namespace chaos
 			}
 			// no wangset cannot continue
 			if (wangset == nullptr)
-				return;
+				return false;
 			// get the wang tile and apply particle transforms
-			wangtile = wangset->GetWangTile(collision_info.tile_info.id);
-			wangtile.ApplyParticleFlags(particle_flags);
+			result = wangset->GetWangTile(collision_info.tile_info.id);
+			result.ApplyParticleFlags(collision_info.particle->flags);
 		}
+		return true;
+	}
 
-		box_corners2 particle_corners = GetBoxCorners(collision_info.particle->bounding_box);
-		box_corners2 dst_corners = GetBoxCorners(dst_box);
-
+	bool TileCollisionComputer::IsCollisionEdge(TileCollisionInfo const& collision_info, TiledMap::WangTile const& wangtile, Edge edge) const
+	{
 		// XXX : an edge with wang value
 		//         0 -> the tile does not use the wangset at all
 		//         1 -> this is the empty wang value
 		//        +2 -> good
 
-		glm::vec2 best_position = dst_box.position;
-		float best_distance = std::numeric_limits<float>::max();
+		if (wangset != nullptr)
+			return (wangtile.GetEdgeValue(edge) > 1);
 
-		// LEFT EDGE
-		bool left_collision_candidate = (wangset != nullptr) ? (wangtile.GetEdgeValue(Edge::Left) > 1) : ((particle_flags & TiledMap::TileParticleFlags::NEIGHBOUR_LEFT) == 0);
+		int particle_flags = collision_info.particle->flags;
+		switch (edge)
+		{
+		case Edge::Left: return (particle_flags & TiledMap::TileParticleFlags::NEIGHBOUR_LEFT) == 0;
+		case Edge::Right: return (particle_flags & TiledMap::TileParticleFlags::NEIGHBOUR_RIGHT) == 0;
+		case Edge::Bottom: return (particle_flags & TiledMap::TileParticleFlags::NEIGHBOUR_BOTTOM) == 0;
+		case Edge::Top: return (particle_flags & TiledMap::TileParticleFlags::NEIGHBOUR_TOP) == 0;
+		}
+		return false;
+	}
 
-		// check whether the EDGE is valid and whether the distance between the objects does no increase
-		if (left_collision_candidate && delta_position.x >= 0.0f)
+	glm::vec2 TileCollisionComputer::GetEdgeNormal(Edge edge)
+	{
+		switch (edge)
 		{
-			// check whether EDGE/BOX collision may happen
-			if (MathTools::IsInRange(particle_corners.min.x, dst_box.position.x, dst_corners.max.x + box_extend.x) && RangeOverlaps(dst_corners, particle_corners, 1))
-			{
-				// check whether the collision is at least in ZONE 2
-				if (particle_corners.min.x < dst_corners.max.x + box_extend.x)
-				{
-					bool displacement_enabled = func(collision_info, Edge::Left); // ZONE 1 or 2 : indicates to caller that there is a touch
+		case Edge::Left: return { -1.0f, 0.0f };
+		case Edge::Right: return { 1.0f, 0.0f };
+		case Edge::Bottom: return { 0.0f, -1.0f };
+		case Edge::Top: return { 0.0f, 1.0f };
+		}
+		return { 0.0f, 0.0f };
+	}
 
-					// in ZONE 1 ?
-					if (displacement_enabled && (particle_corners.min.x < dst_corners.max.x + box_extend.x * 0.5f))
-					{
-						float new_x = particle_corners.min.x - dst_box.half_size.x - box_extend.x * 0.5f;
+	int TileCollisionComputer::ComputeEdgeContact(box_corners2 const& particle_corners, box2 const& dst_box, glm::vec2 const& delta_position, glm::vec2 const& box_extend, Edge edge, glm::vec2& new_position)
+	{
+		box_corners2 dst_corners = GetBoxCorners(dst_box);
 
-						float distance = std::abs(dst_box.position.x - new_x);
+		// LEFT/BOTTOM edges are hit by a box moving toward positive coordinates, RIGHT/TOP edges by a box moving toward negative coordinates
+		int axis = (edge == Edge::Left || edge == Edge::Right) ? 0 : 1;
+		int other_axis = 1 - axis;
 
-						// check for best distance among other edges
-						if (distance < best_distance)
-						{
-							best_position.x = new_x;
-							best_position.y = dst_box.position.y;
-							best_distance = distance;
-						}
-					}
-				}
-			}
+		if (edge == Edge::Left || edge == Edge::Bottom)
+		{
+			// check whether the distance between the objects does no increase
+			if (delta_position[axis] < 0.0f)
+				return 0;
+			// check whether EDGE/BOX collision may happen
+			if (!MathTools::IsInRange(particle_corners.min[axis], dst_box.position[axis], dst_corners.max[axis] + box_extend[axis]) || !RangeOverlaps(dst_corners, particle_corners, other_axis))
+				return 0;
+			// check whether the collision is at least in ZONE 2
+			if (particle_corners.min[axis] >= dst_corners.max[axis] + box_extend[axis])
+				return 0;
+			// in ZONE 1 ?
+			if (particle_corners.min[axis] >= dst_corners.max[axis] + box_extend[axis] * 0.5f)
+				return 1;
+			new_position = dst_box.position;
+			new_position[axis] = particle_corners.min[axis] - dst_box.half_size[axis] - box_extend[axis] * 0.5f;
+			return 2;
 		}
-
-		// RIGHT EDGE
-		bool right_collision_candidate = (wangset != nullptr) ? (wangtile.GetEdgeValue(Edge::Right) > 1) : ((particle_flags & TiledMap::TileParticleFlags::NEIGHBOUR_RIGHT) == 0);
-
-		// check whether the EDGE is valid and whether the distance between the objects does no increase
-		if (right_collision_candidate && delta_position.x <= 0.0f)
+		else
 		{
+			// check whether the distance between the objects does no increase
+			if (delta_position[axis] > 0.0f)
+				return 0;
 			// check whether EDGE/BOX collision may happen
-			if (MathTools::IsInRange(particle_corners.max.x, dst_corners.min.x - box_extend.x, dst_box.position.x) && RangeOverlaps(dst_corners, particle_corners, 1))
-			{
-				// check whether the collision is at least in ZONE 2
-				if (particle_corners.max.x > dst_corners.min.x - box_extend.x)
-				{
-					bool displacement_enabled = func(collision_info, Edge::Right); // ZONE 1 or 2 : indicates to caller that there is a touch
-
-					// in ZONE 1 ?
-					if (displacement_enabled && (particle_corners.max.x > dst_corners.min.x - box_extend.x * 0.5f))
-					{
-						float new_x = particle_corners.max.x + dst_box.half_size.x + box_extend.x * 0.5f;
+			if (!MathTools::IsInRange(particle_corners.max[axis], dst_corners.min[axis] - box_extend[axis], dst_box.position[axis]) || !RangeOverlaps(dst_corners, particle_corners, other_axis))
+				return 0;
+			// check whether the collision is at least in ZONE 2
+			if (particle_corners.max[axis] <= dst_corners.min[axis] - box_extend[axis])
+				return 0;
+			// in ZONE 1 ?
+			if (particle_corners.max[axis] <= dst_corners.min[axis] - box_extend[axis] * 0.5f)
+				return 1;
+			new_position = dst_box.position;
+			new_position[axis] = particle_corners.max[axis] + dst_box.half_size[axis] + box_extend[axis] * 0.5f;
+			return 2;
+		}
+	}
 
-						float distance = std::abs(dst_box.position.x - new_x);
+	bool TileCollisionComputer::SweepEdge(box_corners2 const& particle_corners, box2 const& box, glm::vec2 const& displacement, glm::vec2 const& box_extend, Edge edge, float& time_of_impact)
+	{
+		int axis = (edge == Edge::Left || edge == Edge::Right) ? 0 : 1;
+		int other_axis = 1 - axis;
 
-						// check for best distance among other edges
-						if (distance < best_distance)
-						{
-							best_position.x = new_x;
-							best_position.y = dst_box.position.y;
-							best_distance = distance;
-						}
-					}
-				}
-			}
+		float t = 0.0f;
+		if (edge == Edge::Left || edge == Edge::Bottom)
+		{
+			if (displacement[axis] <= 0.0f)
+				return false;
+			float face = box.position[axis] + box.half_size[axis];
+			if (face > particle_corners.min[axis]) // already beyond the edge : let the discrete computation handle that
+				return false;
+			t = (particle_corners.min[axis] - box_extend[axis] * 0.5f - face) / displacement[axis];
+		}
+		else
+		{
+			if (displacement[axis] >= 0.0f)
+				return false;
+			float face = box.position[axis] - box.half_size[axis];
+			if (face < particle_corners.max[axis]) // already beyond the edge : let the discrete computation handle that
+				return false;
+			t = (particle_corners.max[axis] + box_extend[axis] * 0.5f - face) / displacement[axis];
 		}
 
-		// BOTTOM EDGE
-		bool bottom_collision_candidate = (wangset != nullptr) ? (wangtile.GetEdgeValue(Edge::Bottom) > 1) : ((particle_flags & TiledMap::TileParticleFlags::NEIGHBOUR_BOTTOM) == 0);
+		if (t > 1.0f)
+			return false;
+		t = std::max(t, 0.0f); // already in ZONE 1
 
-		// check whether the EDGE is valid and whether the distance between the objects does no increase
-		if (bottom_collision_candidate && delta_position.y >= 0.0f)
-		{
-			// check whether EDGE/BOX collision may happen
-			if (MathTools::IsInRange(particle_corners.min.y, dst_box.position.y, dst_corners.max.y + box_extend.y) && RangeOverlaps(dst_corners, particle_corners, 0))
-			{
-				// check whether the collision is at least in ZONE 2
-				if (particle_corners.min.y < dst_corners.max.y + box_extend.y)
-				{
-					bool displacement_enabled = func(collision_info, Edge::Bottom); // ZONE 1 or 2 : indicates to caller that there is a touch
+		// the box must overlap the edge at the time of impact
+		float other_position = box.position[other_axis] + displacement[other_axis] * t;
+		if (other_position + box.half_size[other_axis] <= particle_corners.min[other_axis] || other_position - box.half_size[other_axis] >= particle_corners.max[other_axis])
+			return false;
 
-					// in ZONE 1 ?
-					if (displacement_enabled && (particle_corners.min.y < dst_corners.max.y + box_extend.y * 0.5f))
-					{
-						float new_y = particle_corners.min.y - dst_box.half_size.y - box_extend.y * 0.5f;
+		time_of_impact = t;
+		return true;
+	}
 
-						float distance = std::abs(dst_box.position.y - new_y);
+	void TileCollisionComputer::ComputeReaction(TileCollisionInfo const& collision_info, LightweightFunction<bool(TileCollisionInfo const &, Edge)> func)
+	{
+		// search for wang flags (use cache for faster search)
+		TiledMap::WangTile wangtile;
+		if (!GetWangTile(collision_info, wangtile))
+			return;
 
-						// check for best distance among other edges
-						if (distance < best_distance)
-						{
-							best_position.x = dst_box.position.x;
-							best_position.y = new_y;
-							best_distance = distance;
-						}
-					}
-				}
-			}
-		}
+		box_corners2 particle_corners = GetBoxCorners(collision_info.particle->bounding_box);
 
-		// TOP EDGE
-		bool top_collision_candidate = (wangset != nullptr) ? (wangtile.GetEdgeValue(Edge::Top) > 1) : ((particle_flags & TiledMap::TileParticleFlags::NEIGHBOUR_TOP) == 0);
+		glm::vec2 best_position = dst_box.position;
+		float best_distance = std::numeric_limits<float>::max();
 
-		// check whether the EDGE is valid and whether the distance between the objects does no increase
-		if (top_collision_candidate && delta_position.y <= 0.0f)
+		for (Edge edge : {Edge::Left, Edge::Right, Edge::Bottom, Edge::Top})
 		{
-			// check whether EDGE/BOX collision may happen
-			if (MathTools::IsInRange(particle_corners.max.y, dst_corners.min.y - box_extend.y, dst_box.position.y) && RangeOverlaps(dst_corners, particle_corners, 0))
-			{
-				// check whether the collision is at least in ZONE 2
-				if (particle_corners.max.y > dst_corners.min.y - box_extend.y)
-				{
-					bool displacement_enabled = func(collision_info, Edge::Top); // ZONE 1 or 2 : indicates to caller that there is a touch
+			// check whether the EDGE is valid
+			if (!IsCollisionEdge(collision_info, wangtile, edge))
+				continue;
 
-					// in ZONE 1 ?
-					if (displacement_enabled && (particle_corners.max.y > dst_corners.min.y - box_extend.y * 0.5f))
-					{
-						float new_y = particle_corners.max.y + dst_box.half_size.y + box_extend.y * 0.5f;
+			glm::vec2 new_position = dst_box.position;
+			int contact = ComputeEdgeContact(particle_corners, dst_box, delta_position, box_extend, edge, new_position);
+			if (contact == 0)
+				continue;
 
-						float distance = std::abs(dst_box.position.y - new_y);
+			bool displacement_enabled = func(collision_info, edge); // ZONE 1 or 2 : indicates to caller that there is a touch
 
-						// check for best distance among other edges
-						if (distance < best_distance)
-						{
-							best_position.x = dst_box.position.x;
-							best_position.y = new_y;
-							best_distance = distance;
-						}
-					}
+			// in ZONE 1 ?
+			if (displacement_enabled && contact == 2)
+			{
+				float distance = glm::length(dst_box.position - new_position);
+
+				// check for best distance among other edges
+				if (distance < best_distance)
+				{
+					best_position = new_position;
+					best_distance = distance;
 				}
 			}
 		}
@@ -319,4 +418,4 @@ namespace chaos
 		}
 	}
 
-}; // namespace chaos
+}; // namespace chaos
\ No newline at end of file
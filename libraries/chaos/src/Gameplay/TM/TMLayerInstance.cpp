@@ -216,7 +216,12 @@ namespace chaos
 	{
 		// clear allocation if required
 		if (autoclean_particles && particle_layer != nullptr)
+		{
 			particle_layer->ClearAllAllocations();
+			// the streamed chunks are rebuilt from the map data
+			if (chunk_streamer != nullptr)
+				chunk_streamer->Reset();
+		}
 		// restart all objects
 		size_t count = objects.size();
 		for (size_t i = 0; i < count; ++i)
@@ -274,6 +279,44 @@ namespace chaos
 		return true;
 	}
 
+	bool TMLayerInstance::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!JSONSerializableInterface::SerializeIntoSnapshot(writer))
+			return false;
+		// the objects
+		writer.Write(uint32_t(objects.size()));
+		for (auto const& object : objects)
+		{
+			writer.Write(object->GetObjectID());
+			if (!writer.WriteObject(MakeSnapshotTag("OBJT"), *object))
+				return false;
+		}
+		// the child layers
+		return TMTools::SerializeLayersIntoSnapshot(layer_instances, writer);
+	}
+
+	bool TMLayerInstance::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!JSONSerializableInterface::SerializeFromSnapshot(reader))
+			return false;
+		// the objects (as for JSON, only the triggers are restored)
+		uint32_t count = 0;
+		if (!reader.Read(count))
+			return false;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			int object_id = 0;
+			if (!reader.Read(object_id))
+				return false;
+			if (TMTrigger* trigger = FindObjectByID<TMTrigger>(object_id))
+				reader.ReadObject(MakeSnapshotTag("OBJT"), *trigger);
+			else
+				reader.SkipChunk(MakeSnapshotTag("OBJT"));
+		}
+		// the child layers
+		return TMTools::SerializeLayersFromSnapshot(this, reader);
+	}
+
 	bool TMLayerInstance::InitializeImageLayer(TiledMap::ImageLayer const * image_layer, TMObjectReferenceSolver& reference_solver)
 	{
 		return true;
@@ -281,8 +324,6 @@ namespace chaos
 
 	void TMLayerInstance::CreateObjectParticles(TiledMap::GeometricObject const* in_geometric_object, TMObject* object, TMParticlePopulator& particle_populator)
 	{
-		TiledMap::Map* tiled_map = level_instance->GetTiledMap();
-
 		// does the object wants the ownership of the particles
 		bool particle_ownership = false;
 		if (object != nullptr)
@@ -328,9 +369,10 @@ namespace chaos
 			int gid = tile->gid;
 
 			// search the tile information
-			TiledMap::TileInfo tile_info = tiled_map->FindTileInfo(gid);
-			if (tile_info.tiledata == nullptr)
+			TMTileAtlasEntry const* tile_entry = level_instance->GetTileAtlasTable().FindEntry(gid);
+			if (tile_entry == nullptr)
 				return;
+			TiledMap::TileInfo const& tile_info = tile_entry->tile_info;
 
 			// create a simple particle
 			box2 particle_box = tile->GetBoundingBox(true);
@@ -345,7 +387,7 @@ namespace chaos
 
 			bool keep_aspect_ratio = false;
 			effective_particle_populator->AddParticle(
-				tile_info.tiledata->atlas_key.c_str(),
+				*tile_entry,
 				hotpoint,
 				particle_box,
 				glm::vec4(1.0f, 1.0f, 1.0f, 1.0f),
@@ -583,6 +625,110 @@ namespace chaos
 		return particle_layer.get();
 	}
 
+	void TMLayerInstance::CreateTileObject(glm::ivec2 const& tile_coord, int gid, box2 const& particle_box, TiledMap::TileInfo const& tile_info, TMObjectFactory const& factory, TMObjectReferenceSolver& reference_solver, TMParticlePopulator& particle_populator)
+	{
+		// to avoid the creation of a TMObject, use a wrapper on the properties
+		PropertyOwnerOverride<TiledMap::GeometricObjectTile> tile_object = { nullptr, tile_info.tiledata };
+
+		// compute an ID base on 'tile_coord'
+		// TiledMap gives positive ID
+		// we want a negative ID to avoid conflicts
+		// for a 32 bits integer
+		// 15 bits for X
+		// 15 bits for Y
+		// 1  unused
+		// 1  bit for sign
+
+		int int_bit_count = 8 * sizeof(int);
+		int per_component_bit_count = (int_bit_count - 1) / 2;
+		int mask = ~((unsigned int)-1 << per_component_bit_count);
+		int idx = tile_coord.x & mask;
+		int idy = tile_coord.y & mask;
+		int object_id = -1 * (idx | (idy << per_component_bit_count));
+
+		tile_object.id = object_id;
+		tile_object.gid = gid;
+		tile_object.type = tile_info.tiledata->type;
+		tile_object.size = particle_box.half_size * 2.0f;
+
+
+		// shuyyy : should depend on the pivot ???
+
+
+		tile_object.position.x = particle_box.position.x - particle_box.half_size.x;
+		tile_object.position.y = particle_box.position.y - particle_box.half_size.y;
+
+		// XXX : for player start : but this is not a great idea to process by exception
+		//       We are writing int the fake object properties, not in the 'tile_info.tiledata'
+		//       That means that if 'tile_info.tiledata' already has a BITMAP_NAME property, this does not
+		//       interfere with that (a just in case value)
+		tile_object.CreatePropertyString("BITMAP_NAME", tile_info.tiledata->atlas_key.c_str());
+
+		TMObject* object = factory(&tile_object, reference_solver);
+		if (object != nullptr)
+			if (ShouldCreateParticleForObject(&tile_object, object))
+				CreateObjectParticles(&tile_object, object, particle_populator);
+	}
+
+	bool TMLayerInstance::CreateStreamedTileObjects(TiledMap::TileLayer const* tile_layer, TMObjectReferenceSolver& reference_solver)
+	{
+		assert(chunk_streamer != nullptr);
+
+		// the workers only build the particles of the tiles : the objects are created here, once for all (whatever the camera)
+		if (chunk_streamer->object_gids.size() == 0)
+			return true;
+		TiledMap::TiledMapLog::Message("TMLayerInstance::CreateStreamedTileObjects : all chunks of layer [%s] are decoded to create the objects of its factory tiles", name.c_str());
+
+		TMParticlePopulator particle_populator;
+		if (!particle_populator.Initialize(this))
+			return false;
+
+		TMTileAtlasTable const& tile_atlas_table = level_instance->GetTileAtlasTable();
+
+		std::unordered_map<int, TMObjectFactory> factories;
+		std::vector<TiledMap::Tile> decoded_tiles;
+
+		for (TiledMap::TileLayerChunk const& chunk : tile_layer->tile_chunks)
+		{
+			std::vector<TiledMap::Tile> const* tiles = &chunk.tile_indices;
+			if (!chunk.IsDecoded())
+			{
+				if (!tile_layer->DecodeTileChunk(chunk, decoded_tiles))
+				{
+					TiledMap::TiledMapLog::Error("TMLayerInstance::CreateStreamedTileObjects : fails to decode chunk for layer [%s]", name.c_str());
+					continue;
+				}
+				tiles = &decoded_tiles;
+			}
+
+			size_t count = tiles->size();
+			for (size_t i = 0; i < count; ++i)
+			{
+				int gid = (*tiles)[i].gid;
+				if (gid == 0 || !chunk_streamer->object_gids.contains(gid))
+					continue;
+
+				TMTileAtlasEntry const* tile_entry = tile_atlas_table.FindEntry(gid);
+				if (tile_entry == nullptr)
+					continue;
+				TiledMap::TileInfo const& tile_info = tile_entry->tile_info;
+
+				auto factory_it = factories.find(gid);
+				if (factory_it == factories.end())
+					factory_it = factories.emplace(gid, GetObjectFactory(tile_info.tiledata)).first;
+				if (!factory_it->second)
+					continue;
+
+				glm::ivec2 tile_coord = tile_layer->GetTileCoordinate(chunk, i);
+				box2 particle_box = tile_layer->GetTileBoundingBox(tile_coord, tile_info.tiledata->image_size, (*tiles)[i].flags, false);
+				CreateTileObject(tile_coord, gid, particle_box, tile_info, factory_it->second, reference_solver, particle_populator);
+			}
+		}
+		particle_populator.FlushParticles();
+		content_bounding_box = content_bounding_box | particle_populator.GetBoundingBox();
+		return true;
+	}
+
 	bool TMLayerInstance::InitializeTileLayer(TiledMap::TileLayer const * tile_layer, TMObjectReferenceSolver& reference_solver)
 	{
 		TMLevel* level = GetLevel();
@@ -590,23 +736,79 @@ namespace chaos
 		// create particle layer
 		if (CreateParticleLayer() == nullptr)
 			return false;
+		// the particles of streamed layers are built around the camera (see DoTick(...))
+		if (tile_layer->IsStreamed())
+		{
+			if (wrap_x || wrap_y)
+			{
+				TiledMap::TiledMapLog::Warning("TMLayerInstance::InitializeTileLayer : wrapped layer [%s] cannot be streamed", name.c_str());
+			}
+			else
+			{
+				chunk_streamer = std::make_unique<TMChunkStreamer>();
+				if (chunk_streamer->Initialize(this, tile_layer))
+				{
+					content_bounding_box = chunk_streamer->GetBoundingBox();
+					return CreateStreamedTileObjects(tile_layer, reference_solver);
+				}
+				chunk_streamer = nullptr;
+			}
+		}
+
 		// prepare the populator
 		TMParticlePopulator particle_populator;
 		if (!particle_populator.Initialize(this))
 			return false;
 
-		// populate the layer for each chunk
-		TiledMap::Map* tiled_map = level_instance->GetTiledMap();
+		// the tiles of streamed chunks that are instanciated anyway
+		std::vector<TiledMap::Tile> decoded_tiles;
+
+		// populate the layer for each chunk (gid are resolved through the level tables)
+		TMTileAtlasTable const& tile_atlas_table = level_instance->GetTileAtlasTable();
+
+		// build the particles of this layer on the thread pool (they are released chunk per chunk, as soon as consumed)
+		bool use_prepared_particles = (particle_populator.GetTileAtlasTable() == &tile_atlas_table);
+		if (use_prepared_particles)
+			level_instance->PrepareTileParticles(tile_layer);
 
 		bool particle_creation_success = true; // as soon as some particle creation fails, do not try to create other particles
 
+		// the factory for each gid (it only depends on the tile data)
+		std::unordered_map<int, TMObjectFactory> factories;
+
 		for (TiledMap::TileLayerChunk const& chunk : tile_layer->tile_chunks)
 		{
-			size_t count = chunk.tile_indices.size();
+			std::vector<TiledMap::Tile> const* tiles = &chunk.tile_indices;
+			if (!chunk.IsDecoded())
+			{
+				if (!tile_layer->DecodeTileChunk(chunk, decoded_tiles))
+				{
+					TiledMap::TiledMapLog::Error("TMLayerInstance::InitializeTileLayer : fails to decode chunk for layer [%s]", name.c_str());
+					continue;
+				}
+				tiles = &decoded_tiles;
+			}
+
+			// the particles built on the thread pool (see TMLevelInstance::PrepareTileParticles(...))
+			std::vector<TMParticle> prepared_particles;
+			bool has_prepared_particles = false;
+			if (use_prepared_particles)
+			{
+				auto it = level_instance->prepared_tile_particles.find(&chunk);
+				if (it != level_instance->prepared_tile_particles.end())
+				{
+					prepared_particles = std::move(it->second);
+					level_instance->prepared_tile_particles.erase(it);
+					has_prepared_particles = true;
+				}
+			}
+			size_t prepared_index = 0;
+
+			size_t count = tiles->size();
 			for (size_t i = 0; i < count; ++i)
 			{
-				int gid = chunk.tile_indices[i].gid;
-				int particle_flags = chunk.tile_indices[i].flags;
+				int gid = (*tiles)[i].gid;
+				int particle_flags = (*tiles)[i].flags;
 
 
 
@@ -618,9 +820,13 @@ namespace chaos
 					continue;
 
 				// search the tile information
-				TiledMap::TileInfo tile_info = tiled_map->FindTileInfo(gid);
-				if (tile_info.tiledata == nullptr)
+				TMTileAtlasEntry const* tile_entry = tile_atlas_table.FindEntry(gid);
+				if (tile_entry == nullptr)
 					continue;
+				TiledMap::TileInfo const& tile_info = tile_entry->tile_info;
+
+				// there is a prepared particle for each tile with a known gid
+				TMParticle const* prepared_particle = (has_prepared_particles) ? &prepared_particles[prepared_index++] : nullptr;
 
 				// prepare data for the tile/object
 				glm::ivec2  tile_coord = tile_layer->GetTileCoordinate(chunk, i);
@@ -646,52 +852,14 @@ namespace chaos
 				box2 particle_box = tile_layer->GetTileBoundingBox(tile_coord, tile_info.tiledata->image_size, particle_flags, false);
 
 				// try to create a geometric object from the tile
-				TMObjectFactory factory = GetObjectFactory(tile_info.tiledata);
+				auto factory_it = factories.find(gid);
+				if (factory_it == factories.end())
+					factory_it = factories.emplace(gid, GetObjectFactory(tile_info.tiledata)).first;
+
+				TMObjectFactory const& factory = factory_it->second;
 				if (factory)
 				{
-					// to avoid the creation of a TMObject, use a wrapper on the properties
-					PropertyOwnerOverride<TiledMap::GeometricObjectTile> tile_object = { nullptr, tile_info.tiledata };
-
-					// compute an ID base on 'tile_coord'
-					// TiledMap gives positive ID
-					// we want a negative ID to avoid conflicts
-					// for a 32 bits integer
-					// 15 bits for X
-					// 15 bits for Y
-					// 1  unused
-					// 1  bit for sign
-
-					int int_bit_count = 8 * sizeof(int);
-					int per_component_bit_count = (int_bit_count - 1) / 2;
-					int mask = ~((unsigned int)-1 << per_component_bit_count);
-					int idx = tile_coord.x & mask;
-					int idy = tile_coord.y & mask;
-					int object_id = -1 * (idx | (idy << per_component_bit_count));
-
-					tile_object.id = object_id;
-					tile_object.gid = gid;
-					tile_object.type = tile_info.tiledata->type;
-					tile_object.size = particle_box.half_size * 2.0f;
-
-
-					// shuyyy : should depend on the pivot ???
-
-
-					tile_object.position.x = particle_box.position.x - particle_box.half_size.x;
-					tile_object.position.y = particle_box.position.y - particle_box.half_size.y;
-
-					// XXX : for player start : but this is not a great idea to process by exception
-					//       We are writing int the fake object properties, not in the 'tile_info.tiledata'
-					//       That means that if 'tile_info.tiledata' already has a BITMAP_NAME property, this does not
-					//       interfere with that (a just in case value)
-					tile_object.CreatePropertyString("BITMAP_NAME", tile_info.tiledata->atlas_key.c_str());
-
-					TMObject* object = factory(&tile_object, reference_solver);
-					if (object != nullptr)
-						if (ShouldCreateParticleForObject(&tile_object, object))
-							CreateObjectParticles(&tile_object, object, particle_populator);
-
-
+					CreateTileObject(tile_coord, gid, particle_box, tile_info, factory, reference_solver, particle_populator);
 					continue; // while we have a factory, let the concerned object create its particle
 				}
 
@@ -702,18 +870,27 @@ namespace chaos
 
 				if (particle_creation_success)
 				{
-					particle_creation_success = particle_populator.AddParticle(
-						tile_info.tiledata->atlas_key.c_str(),
-						hotpoint, particle_box,
-						glm::vec4(1.0f, 1.0f, 1.0f, 1.0f),
-						0.0f,
-						particle_flags,
-						gid,
-						keep_aspect_ratio);
+					if (prepared_particle != nullptr && prepared_particle->bitmap_info != nullptr)
+					{
+						particle_creation_success = particle_populator.AddParticle(*prepared_particle);
+					}
+					else
+					{
+						particle_creation_success = particle_populator.AddParticle(
+							*tile_entry,
+							hotpoint, particle_box,
+							glm::vec4(1.0f, 1.0f, 1.0f, 1.0f),
+							0.0f,
+							particle_flags,
+							gid,
+							keep_aspect_ratio);
+					}
 				}
 			}
 		}
 
+		level_instance->prepared_tile_particles.clear(); // should be empty : all chunks have been consumed
+
 		// final flush
 		if (particle_creation_success)
 			particle_populator.FlushParticles();
@@ -739,6 +916,13 @@ namespace chaos
 
 	bool TMLayerInstance::DoTick(float delta_time)
 	{
+		// stream the chunks around the camera (layer coordinates)
+		if (chunk_streamer != nullptr)
+		{
+			box2 camera_box = chaos::GetBoundingBox(GetLayerCameraOBox());
+			camera_box.position -= offset;
+			chunk_streamer->Tick(camera_box);
+		}
 		// objects
 		size_t object_count = objects.size();
 		for (size_t i = 0; i < object_count; ++i)
@@ -753,45 +937,51 @@ namespace chaos
 		return true;
 	}
 
-	int TMLayerInstance::DoDisplay(GPURenderContext* render_context, GPUProgramProviderInterface const * uniform_provider, GPURenderParams const& render_params)
+	obox2 TMLayerInstance::GetLayerCameraOBox() const
 	{
-		// display this layer particles
-		int result = 0;
-		if (particle_layer != nullptr)
-		{
-			// camera is expressed in world, so is for layer
-			obox2 camera_obox = GetLevelInstance()->GetCameraOBox(0);
-			obox2 initial_camera_obox = GetLevelInstance()->GetInitialCameraOBox(0);
+		obox2 camera_obox = GetLevelInstance()->GetCameraOBox(0);
+		obox2 initial_camera_obox = GetLevelInstance()->GetInitialCameraOBox(0);
 
-			// XXX : we want some layers to appear further or more near the camera
-			//       the displacement_ratio represent how fast this layer is moving relatively to other layers.
-			//       The reference layer is the layer where the 'effective' camera (and so the PlayerStart is)
-			//         => when player goes outside the screen, the camera is updated so that it is still watching the player
-			//         => that why we consider the PlayerStart's layer as the reference
-			//       to simulate other layer's speed, we just create at rendering time 'virtual cameras' (here this is 'final_camera_box')
-			//       We only multiply 'true camera' distance from its initial position by a ratio value
+		// XXX : we want some layers to appear further or more near the camera
+		//       the displacement_ratio represent how fast this layer is moving relatively to other layers.
+		//       The reference layer is the layer where the 'effective' camera (and so the PlayerStart is)
+		//         => when player goes outside the screen, the camera is updated so that it is still watching the player
+		//         => that why we consider the PlayerStart's layer as the reference
+		//       to simulate other layer's speed, we just create at rendering time 'virtual cameras' (here this is 'final_camera_box')
+		//       We only multiply 'true camera' distance from its initial position by a ratio value
 
-			// apply the displacement to the camera
+		// apply the displacement to the camera
 
-			glm::vec2 final_ratio = glm::vec2(1.0f, 1.0f);
+		glm::vec2 final_ratio = glm::vec2(1.0f, 1.0f);
 
-			TMLayerInstance const* reference_layer = level_instance->reference_layer.get();
-			if (reference_layer != nullptr)
-			{
-				if (reference_layer->displacement_ratio.x != 0.0f)
-					final_ratio.x = displacement_ratio.x / reference_layer->displacement_ratio.x;
-				if (reference_layer->displacement_ratio.y != 0.0f)
-					final_ratio.y = displacement_ratio.y / reference_layer->displacement_ratio.y;
+		TMLayerInstance const* reference_layer = level_instance->reference_layer.get();
+		if (reference_layer != nullptr)
+		{
+			if (reference_layer->displacement_ratio.x != 0.0f)
+				final_ratio.x = displacement_ratio.x / reference_layer->displacement_ratio.x;
+			if (reference_layer->displacement_ratio.y != 0.0f)
+				final_ratio.y = displacement_ratio.y / reference_layer->displacement_ratio.y;
 
-			}
+		}
 
-			// shulayer
+		// shulayer
 
-			obox2 final_camera_obox;
-			final_camera_obox.position = initial_camera_obox.position + (camera_obox.position - initial_camera_obox.position) * final_ratio;
-			final_camera_obox.half_size = initial_camera_obox.half_size + (camera_obox.half_size - initial_camera_obox.half_size) * final_ratio;
+		obox2 final_camera_obox;
+		final_camera_obox.position = initial_camera_obox.position + (camera_obox.position - initial_camera_obox.position) * final_ratio;
+		final_camera_obox.half_size = initial_camera_obox.half_size + (camera_obox.half_size - initial_camera_obox.half_size) * final_ratio;
+		return final_camera_obox;
+	}
 
+	int TMLayerInstance::DoDisplay(GPURenderContext* render_context, GPUProgramProviderInterface const * uniform_provider, GPURenderParams const& render_params)
+	{
+		// display this layer particles
+		int result = 0;
+		if (particle_layer != nullptr)
+		{
+			// camera is expressed in world, so is for layer
+			obox2 final_camera_obox = GetLayerCameraOBox();
 
+			TMLayerInstance const* reference_layer = level_instance->reference_layer.get();
 
 			// shu48
 
@@ -16,6 +16,21 @@ namespace chaos
 	// TMLevelInstance implementation
 	// =====================================
 
+	TMLevelInstance::~TMLevelInstance()
+	{
+		// XXX : the tasks of the chunk streamers read the tile_atlas_table. The layer instances may outlive the level (shared_ptr)
+		//       destroy the streamers now (this waits for their pending tasks)
+		std::function<void(std::vector<shared_ptr<TMLayerInstance>>&)> destroy_streamers = [&destroy_streamers](std::vector<shared_ptr<TMLayerInstance>>& layers)
+		{
+			for (shared_ptr<TMLayerInstance>& layer : layers)
+			{
+				layer->chunk_streamer = nullptr;
+				destroy_streamers(layer->layer_instances);
+			}
+		};
+		destroy_streamers(layer_instances);
+	}
+
 	TiledMap::Map* TMLevelInstance::GetTiledMap()
 	{
 		TMLevel* level = GetLevel();
@@ -224,8 +239,15 @@ namespace chaos
 		if (!LevelInstance::Initialize(in_game, in_level))
 			return false;
 
+		std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+		// prepare the tile resolution tables
+		if (!CreateTileAtlasTable())
+			return false;
+		std::chrono::steady_clock::time_point tables_time = std::chrono::steady_clock::now();
+
 		TMObjectReferenceSolver reference_solver;
-		// create a the layers instances
+		// create a the layers instances (serial : objects creation, renderables, particle layers. The tile particles are built on the thread pool)
 		if (!CreateLayerInstances(in_game, reference_solver))
 			return false;
 		// initialize the level instance
@@ -233,13 +255,158 @@ namespace chaos
 		assert(lvl != nullptr);
 		if (!InitializeLevelInstance(reference_solver, lvl->tiled_map.get()))
 			return false;
+		std::chrono::steady_clock::time_point layers_time = std::chrono::steady_clock::now();
+
 		// solve the references
 		reference_solver.SolveReferences(this);
 		// change the level timeout
 		level_timeout = in_level->GetLevelTimeout();
+		std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+
+		// log the instantiation time
+		auto get_duration = [](std::chrono::steady_clock::time_point t1, std::chrono::steady_clock::time_point t2)
+		{
+			return std::chrono::duration<double, std::milli>(t2 - t1).count();
+		};
+		TiledMap::TiledMapLog::Message("TMLevelInstance::Initialize [%s] instantiated in %.2f ms (tables %.2f ms, layers %.2f ms, references %.2f ms)",
+			in_level->GetPath().string().c_str(),
+			get_duration(start_time, end_time),
+			get_duration(start_time, tables_time),
+			get_duration(tables_time, layers_time),
+			get_duration(layers_time, end_time));
+
+		return true;
+	}
+
+	bool TMLevelInstance::CreateTileAtlasTable()
+	{
+		TMLevel* level = GetLevel();
+		if (level == nullptr)
+			return false;
+		TiledMap::Map* tiled_map = level->GetTiledMap();
+		if (tiled_map == nullptr)
+			return true;
+		// get the atlas and the folder containing the bitmaps
+		// XXX : levels without tile particles do not require any atlas. Only the layers that create tile particles fail without it (see TMParticlePopulator::Initialize(...))
+		AtlasFolderInfo const* folder_info = nullptr;
+		if (WindowApplication* window_application = Application::GetInstance())
+			if (GPUAtlas const* texture_atlas = window_application->GetTextureAtlas())
+				folder_info = texture_atlas->GetFolderInfo(level->GetAtlasFolderInfoRequest());
+		// build the tables
+		return tile_atlas_table.Initialize(tiled_map, folder_info);
+	}
+
+	// XXX : the layer instances are created serially, in the map order, because their initialization runs object factories, user callbacks
+	//       and GPU resource lookups. What is independent is the computation of the tile particles : this is done on the thread pool, layer per layer,
+	//       just before TMLayerInstance::InitializeTileLayer(...) consumes the prepared particles in the same order (the result is identical)
+	//       only the particles of one layer are alive at a time. The chunks are split into ranges of tiles so that a single large chunk uses several threads
+
+	void TMLevelInstance::PrepareTileParticles(TiledMap::TileLayer const* tile_layer)
+	{
+		assert(tile_layer != nullptr);
+
+		prepared_tile_particles.clear();
+
+		// streamed layers build their chunks on demand
+		if (tile_layer->IsStreamed())
+			return;
+		// no bitmap can be resolved without atlas folder
+		if (tile_atlas_table.GetFolderInfo() == nullptr)
+			return;
+
+		// split the chunks into ranges of tiles (the chunks that are not decoded are processed, and reported, by the layer instance)
+		size_t const range_size = 4096;
+
+		std::vector<std::tuple<TiledMap::TileLayerChunk const*, size_t, size_t>> ranges;
+		for (TiledMap::TileLayerChunk const& chunk : tile_layer->tile_chunks)
+		{
+			if (!chunk.IsDecoded())
+				continue;
+			size_t count = chunk.tile_indices.size();
+			for (size_t begin = 0; begin < count; begin += range_size)
+				ranges.emplace_back(&chunk, begin, std::min(begin + range_size, count));
+		}
+
+		// build the particles
+		std::vector<std::vector<TMParticle>> particles(ranges.size());
+
+		ThreadPool::GetDefaultInstance()->ParallelFor(ranges.size(), [this, tile_layer, &ranges, &particles](size_t i)
+		{
+			auto [chunk, begin, end] = ranges[i];
+			DoPrepareTileParticles(tile_layer, *chunk, chunk->tile_indices, begin, end, tile_atlas_table, particles[i]);
+		});
+
+		// concatenate the ranges of each chunk (in order)
+		for (size_t i = 0; i < ranges.size(); ++i)
+		{
+			std::vector<TMParticle>& chunk_particles = prepared_tile_particles[std::get<0>(ranges[i])];
+			if (chunk_particles.size() == 0)
+			{
+				chunk_particles = std::move(particles[i]);
+			}
+			else
+			{
+				chunk_particles.insert(chunk_particles.end(), particles[i].begin(), particles[i].end());
+				particles[i] = {}; // release the memory as soon as possible
+			}
+		}
+	}
+
+	bool TMLevelInstance::PrepareTileChunkParticles(TiledMap::TileLayer const* tile_layer, TiledMap::TileLayerChunk const& chunk, TMTileAtlasTable const& tile_atlas_table, std::vector<TMParticle>& particles)
+	{
+		assert(tile_layer != nullptr);
+
+		// decode the tiles if necessary
+		std::vector<TiledMap::Tile> decoded_tiles;
+
+		std::vector<TiledMap::Tile> const* tiles = &chunk.tile_indices;
+		if (!chunk.IsDecoded())
+		{
+			if (!tile_layer->DecodeTileChunk(chunk, decoded_tiles))
+				return false;
+			tiles = &decoded_tiles;
+		}
+		DoPrepareTileParticles(tile_layer, chunk, *tiles, 0, tiles->size(), tile_atlas_table, particles);
 		return true;
 	}
 
+	void TMLevelInstance::DoPrepareTileParticles(TiledMap::TileLayer const* tile_layer, TiledMap::TileLayerChunk const& chunk, std::vector<TiledMap::Tile> const& tiles, size_t begin, size_t end, TMTileAtlasTable const& tile_atlas_table, std::vector<TMParticle>& particles)
+	{
+		assert(tile_layer != nullptr);
+		assert(begin <= end && end <= tiles.size());
+
+		// same particles than TMParticlePopulator::AddParticle(...) in TMLayerInstance::InitializeTileLayer(...)
+		particles.clear();
+		particles.reserve(end - begin);
+		for (size_t i = begin; i < end; ++i)
+		{
+			int gid = tiles[i].gid;
+			int particle_flags = tiles[i].flags;
+
+			if (gid == 0)
+				continue;
+
+			TMTileAtlasEntry const* tile_entry = tile_atlas_table.FindEntry(gid);
+			if (tile_entry == nullptr)
+				continue;
+
+			glm::ivec2 tile_coord = tile_layer->GetTileCoordinate(chunk, i);
+
+			box2 particle_box = tile_layer->GetTileBoundingBox(tile_coord, tile_entry->tile_info.tiledata->image_size, particle_flags, false);
+			particle_box = TMParticlePopulator::ComputeParticleBox(tile_entry->layout, particle_box, particle_flags, true);
+
+			particles.push_back(TMParticlePopulator::MakeParticle( // bitmap_info may be null : the layer instance reports the error
+				tile_entry->bitmap_info,
+				tile_entry->layout,
+				Hotpoint::BottomLeft,
+				particle_box,
+				glm::vec4(1.0f, 1.0f, 1.0f, 1.0f),
+				0.0f,
+				particle_flags,
+				gid));
+		}
+	}
+
 	bool TMLevelInstance::InitializeLevelInstance(TMObjectReferenceSolver& reference_solver, TiledMap::PropertyOwner const * property_owner)
 	{
 		reference_solver.DeclareReference(player_start, "PLAYER_START", property_owner);
@@ -551,4 +718,18 @@ namespace chaos
 		return true;
 	}
 
+	bool TMLevelInstance::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!LevelInstance::SerializeIntoSnapshot(writer))
+			return false;
+		return TMTools::SerializeLayersIntoSnapshot(layer_instances, writer);
+	}
+
+	bool TMLevelInstance::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!LevelInstance::SerializeFromSnapshot(reader))
+			return false;
+		return TMTools::SerializeLayersFromSnapshot(this, reader);
+	}
+
 }; // namespace chaos
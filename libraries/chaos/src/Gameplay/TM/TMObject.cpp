@@ -55,6 +55,26 @@ namespace chaos
 		return true;
 	}
 
+	bool TMObject::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!GameEntity::SerializeIntoSnapshot(writer))
+			return false;
+		writer.WriteString(name);
+		writer.Write(id);
+		writer.Write(particle_ownership);
+		return true;
+	}
+
+	bool TMObject::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!GameEntity::SerializeFromSnapshot(reader))
+			return false;
+		reader.ReadString(name);
+		reader.Read(id);
+		reader.Read(particle_ownership);
+		return !reader.HasError();
+	}
+
 	bool TMObject::IsParticleCreationEnabled() const
 	{
 		return true;
@@ -114,6 +134,28 @@ namespace chaos
 		return true;
 	}
 
+	bool TMTrigger::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!TMObject::SerializeIntoSnapshot(writer))
+			return false;
+		writer.Write(enabled);
+		writer.Write(trigger_once);
+		writer.Write(outside_box_factor);
+		writer.Write(enter_event_triggered);
+		return true;
+	}
+
+	bool TMTrigger::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!TMObject::SerializeFromSnapshot(reader))
+			return false;
+		reader.Read(enabled);
+		reader.Read(trigger_once);
+		reader.Read(outside_box_factor);
+		reader.Read(enter_event_triggered);
+		return !reader.HasError();
+	}
+
 	bool TMTrigger::IsCollisionWith(box2 const& other_box, CollisionType collision_type) const
 	{
 		box2 bounding_box = GetBoundingBox(true);
@@ -205,6 +247,22 @@ namespace chaos
 		return true;
 	}
 
+	bool TMPlayerStart::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!TMObject::SerializeIntoSnapshot(writer))
+			return false;
+		writer.WriteString(bitmap_name);
+		return true;
+	}
+
+	bool TMPlayerStart::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!TMObject::SerializeFromSnapshot(reader))
+			return false;
+		reader.ReadString(bitmap_name);
+		return !reader.HasError();
+	}
+
 	// =================================================
 	// TMNotificationTrigger
 	// =================================================
@@ -249,6 +307,28 @@ namespace chaos
 		return true;
 	}
 
+	bool TMNotificationTrigger::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!TMTrigger::SerializeIntoSnapshot(writer))
+			return false;
+		writer.WriteString(notification_string);
+		writer.Write(notification_lifetime);
+		writer.Write(stop_when_collision_over);
+		writer.Write(player_collision);
+		return true;
+	}
+
+	bool TMNotificationTrigger::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!TMTrigger::SerializeFromSnapshot(reader))
+			return false;
+		reader.ReadString(notification_string);
+		reader.Read(notification_lifetime);
+		reader.Read(stop_when_collision_over);
+		reader.Read(player_collision);
+		return !reader.HasError();
+	}
+
 
 	bool TMNotificationTrigger::OnCollisionEvent(float delta_time, Object* object, CollisionType event_type)
 	{
@@ -337,6 +417,32 @@ namespace chaos
 		return true;
 	}
 
+	bool TMSoundTrigger::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!TMTrigger::SerializeIntoSnapshot(writer))
+			return false;
+		writer.WriteString(sound_name);
+		writer.Write(min_distance_ratio);
+		writer.Write(pause_timer_when_too_far);
+		writer.Write(is_3D_sound);
+		writer.Write(looping);
+		writer.Write(stop_when_collision_over);
+		return true;
+	}
+
+	bool TMSoundTrigger::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!TMTrigger::SerializeFromSnapshot(reader))
+			return false;
+		reader.ReadString(sound_name);
+		reader.Read(min_distance_ratio);
+		reader.Read(pause_timer_when_too_far);
+		reader.Read(is_3D_sound);
+		reader.Read(looping);
+		reader.Read(stop_when_collision_over);
+		return !reader.HasError();
+	}
+
 	Sound* TMSoundTrigger::CreateSound() const
 	{
 		// early exit
@@ -453,6 +559,24 @@ namespace chaos
 		return true;
 	}
 
+	bool TMChangeLevelTrigger::SerializeIntoSnapshot(SnapshotWriter & writer) const
+	{
+		if (!TMTrigger::SerializeIntoSnapshot(writer))
+			return false;
+		writer.WriteString(level_name);
+		writer.WriteString(player_start_name);
+		return true;
+	}
+
+	bool TMChangeLevelTrigger::SerializeFromSnapshot(SnapshotReader & reader)
+	{
+		if (!TMTrigger::SerializeFromSnapshot(reader))
+			return false;
+		reader.ReadString(level_name);
+		reader.ReadString(player_start_name);
+		return !reader.HasError();
+	}
+
 	// =====================================
 	// TMCameraTemplate implementation
 	// =====================================
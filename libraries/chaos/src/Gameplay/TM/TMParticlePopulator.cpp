@@ -11,7 +11,8 @@ namespace chaos
 		layer_instance(src.layer_instance),
 		level(src.level),
 		texture_atlas(src.texture_atlas),
-		folder_info(src.folder_info)
+		folder_info(src.folder_info),
+		tile_atlas_table(src.tile_atlas_table)
 	{
 		// XXX : do not copy nor particles, nor allocation => force a new allocation
 	}
@@ -34,6 +35,10 @@ namespace chaos
 		folder_info = texture_atlas->GetFolderInfo(level->GetAtlasFolderInfoRequest());
 		if (folder_info == nullptr)
 			return false;
+		// use the level tables for faster lookups (if they are relative to the same folder)
+		TMLevelInstance* level_instance = layer_instance->GetLevelInstance();
+		if (level_instance != nullptr && level_instance->GetTileAtlasTable().GetFolderInfo() == folder_info)
+			tile_atlas_table = &level_instance->GetTileAtlasTable();
 		return true;
 	}
 
@@ -80,7 +85,9 @@ namespace chaos
 		assert(bitmap_name != nullptr);
 
 		// search bitmap information for the particle
-		AtlasBitmapInfo const* bitmap_info = folder_info->GetBitmapInfo(bitmap_name);
+		AtlasBitmapInfo const* bitmap_info = (tile_atlas_table != nullptr) ?
+			tile_atlas_table->FindBitmapInfo(bitmap_name) :
+			folder_info->GetBitmapInfo(bitmap_name);
 		if (bitmap_info == nullptr)
 		{
 			ParticleLog::Error("TMParticlePopulator::AddParticle : unknown bitmap [%s]", (bitmap_name != nullptr)? bitmap_name : "");
@@ -90,6 +97,42 @@ namespace chaos
 		AtlasBitmapLayout layout = *bitmap_info;
 		if (bitmap_info->HasAnimation() && bitmap_info->GetAnimationImageCount() > 0)
 			layout = bitmap_info->GetAnimationLayout(0, WrapMode::Clamp); // take frame 0 by default
+
+		return DoAddParticle(bitmap_info, layout, hotpoint, particle_box, color, rotation, particle_flags, gid, keep_aspect_ratio);
+	}
+
+	bool TMParticlePopulator::AddParticle(TMTileAtlasEntry const& tile_entry, Hotpoint hotpoint, box2 particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid, bool keep_aspect_ratio)
+	{
+		assert(tile_entry.tile_info.tiledata != nullptr);
+
+		// the entry has been resolved for another folder : use the name
+		if (tile_atlas_table == nullptr)
+			return AddParticle(tile_entry.tile_info.tiledata->atlas_key.c_str(), hotpoint, particle_box, color, rotation, particle_flags, gid, keep_aspect_ratio);
+
+		if (tile_entry.bitmap_info == nullptr)
+		{
+			ParticleLog::Error("TMParticlePopulator::AddParticle : unknown bitmap [%s]", tile_entry.tile_info.tiledata->atlas_key.c_str());
+			return false;
+		}
+		return DoAddParticle(tile_entry.bitmap_info, tile_entry.layout, hotpoint, particle_box, color, rotation, particle_flags, gid, keep_aspect_ratio);
+	}
+
+	bool TMParticlePopulator::AddParticle(TMParticle const& particle)
+	{
+		particles[particle_count++] = particle;
+
+		// increment the bounding box
+		bounding_box = bounding_box | particle.bounding_box;
+
+		// flush previous particles to make room for the new one
+		if (particle_count == PARTICLE_BUFFER_SIZE)
+			if (!FlushParticles())
+				return false;
+		return true;
+	}
+
+	box2 TMParticlePopulator::ComputeParticleBox(AtlasBitmapLayout const& layout, box2 particle_box, int particle_flags, bool keep_aspect_ratio)
+	{
 		// compute the bounding box
 		if (IsGeometryEmpty(particle_box))
 		{
@@ -108,8 +151,11 @@ namespace chaos
 				particle_box = SetBoxAspect(particle_box, MathTools::CastAndDiv<float>(layout_width, layout_height), SetBoxAspectMethod::UpdateWidth);
 			}
 		}
+		return particle_box;
+	}
 
-		// add the particle
+	TMParticle TMParticlePopulator::MakeParticle(AtlasBitmapInfo const* bitmap_info, AtlasBitmapLayout const& layout, Hotpoint hotpoint, box2 const& particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid)
+	{
 		TMParticle particle;
 		particle.bounding_box = particle_box;
 		particle.texcoords = layout.GetTexcoords();
@@ -129,8 +175,16 @@ namespace chaos
 
 			particle.bounding_box.position = pivot + GLMTools::Rotate((particle.bounding_box.position - pivot), c, s);
 		}
+		return particle;
+	}
 
-		particles[particle_count++] = particle;
+	bool TMParticlePopulator::DoAddParticle(AtlasBitmapInfo const* bitmap_info, AtlasBitmapLayout const& layout, Hotpoint hotpoint, box2 particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid, bool keep_aspect_ratio)
+	{
+		// compute the bounding box
+		particle_box = ComputeParticleBox(layout, particle_box, particle_flags, keep_aspect_ratio);
+
+		// add the particle
+		particles[particle_count++] = MakeParticle(bitmap_info, layout, hotpoint, particle_box, color, rotation, particle_flags, gid);
 
 		// increment the bounding box
 		bounding_box = bounding_box | particle_box;
@@ -149,6 +203,7 @@ namespace chaos
 		level = src.level;
 		texture_atlas = src.texture_atlas;
 		folder_info = src.folder_info;
+		tile_atlas_table = src.tile_atlas_table;
 		return *this;
 	}
 
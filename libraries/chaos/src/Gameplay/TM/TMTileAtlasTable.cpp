@@ -0,0 +1,102 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================
+	// TMTileAtlasTable implementation
+	// =====================================
+
+	void TMTileAtlasTable::Clear()
+	{
+		folder_info = nullptr;
+		min_gid = 0;
+		entries.clear();
+		bitmap_index.clear();
+	}
+
+	bool TMTileAtlasTable::Initialize(TiledMap::Map const* in_tiled_map, AtlasFolderInfo const* in_folder_info)
+	{
+		assert(in_tiled_map != nullptr);
+
+		Clear();
+
+		// index all bitmaps of the folder by name (without folder, only the tile information is resolved)
+		folder_info = in_folder_info;
+		if (folder_info != nullptr)
+			folder_info->CollectBitmapNameIndex(bitmap_index);
+
+		// compute the gid range for all tilesets
+		int max_gid = 0;
+		bool first_tileset = true;
+		for (TiledMap::TileSetData const& data : in_tiled_map->tilesets)
+		{
+			if (data.tileset == nullptr || data.tileset->tiles.size() == 0)
+				continue;
+			min_gid = (first_tileset) ? data.min_tile_id : std::min(min_gid, data.min_tile_id);
+			max_gid = (first_tileset) ? data.max_tile_id : std::max(max_gid, data.max_tile_id);
+			first_tileset = false;
+		}
+		if (first_tileset) // no tile at all
+			return true;
+
+		// fill the table, tileset per tileset
+		entries.resize(size_t(max_gid - min_gid + 1));
+
+		for (TiledMap::TileSetData const& data : in_tiled_map->tilesets)
+		{
+			if (data.tileset == nullptr)
+				continue;
+
+			for (shared_ptr<TiledMap::TileData> const& tiledata : data.tileset->tiles)
+			{
+				if (tiledata == nullptr)
+					continue;
+
+				TMTileAtlasEntry& entry = entries[size_t(data.first_gid + tiledata->id - min_gid)];
+				entry.tile_info = TiledMap::TileInfo(tiledata->id, data.tileset.get(), tiledata.get());
+
+				// resolve the bitmap and its layout (removing animation)
+				entry.bitmap_info = FindBitmapInfo(tiledata->atlas_key.c_str());
+				if (entry.bitmap_info != nullptr)
+				{
+					entry.layout = *entry.bitmap_info;
+					if (entry.bitmap_info->HasAnimation() && entry.bitmap_info->GetAnimationImageCount() > 0)
+						entry.layout = entry.bitmap_info->GetAnimationLayout(0, WrapMode::Clamp); // take frame 0 by default
+				}
+			}
+		}
+		return true;
+	}
+
+	TMTileAtlasEntry const* TMTileAtlasTable::FindEntry(int gid) const
+	{
+		if (gid < min_gid)
+			return nullptr;
+		size_t index = size_t(gid - min_gid);
+		if (index >= entries.size())
+			return nullptr;
+		TMTileAtlasEntry const* result = &entries[index];
+		if (result->tile_info.tiledata == nullptr) // a hole in the table
+			return nullptr;
+		return result;
+	}
+
+	TiledMap::TileInfo TMTileAtlasTable::FindTileInfo(int gid) const
+	{
+		if (TMTileAtlasEntry const* entry = FindEntry(gid))
+			return entry->tile_info;
+		return {};
+	}
+
+	AtlasBitmapInfo const* TMTileAtlasTable::FindBitmapInfo(char const* bitmap_name) const
+	{
+		if (StringTools::IsEmpty(bitmap_name))
+			return nullptr;
+		auto it = bitmap_index.find(boost::algorithm::to_lower_copy(std::string(bitmap_name)));
+		if (it == bitmap_index.end())
+			return nullptr;
+		return it->second;
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -40,6 +40,8 @@ namespace chaos
 			return true;
 		if (func("Vertices", gpu_menu_path, ImGuiRenderingVerticesStatObject::GetStaticClass()))
 			return true;
+		if (func("Profiler", gpu_menu_path, ImGuiProfilerObject::GetStaticClass()))
+			return true;
 
 		char const* imgui_menu_path = "ImGui";
 
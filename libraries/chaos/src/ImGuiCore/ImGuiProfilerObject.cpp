@@ -0,0 +1,144 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	static ImU32 GetProfilerZoneColor(char const* name)
+	{
+		// the color only depends on the name so that zones are recognized from one frame to another
+		size_t hash = std::hash<std::string_view>()(name);
+		float hue = float(hash % 360) / 360.0f;
+		ImVec4 color = ImVec4(0.0f, 0.0f, 0.0f, 1.0f);
+		ImGui::ColorConvertHSVtoRGB(hue, 0.5f, 0.8f, color.x, color.y, color.z);
+		return ImGui::ColorConvertFloat4ToU32(color);
+	}
+
+	void ImGuiProfilerObject::OnDrawImGuiContent(Window* window)
+	{
+		Profiler* profiler = Profiler::GetInstance();
+
+		bool enabled = profiler->IsEnabled();
+		if (ImGui::Checkbox("Enabled", &enabled)) // disabling the profiler freezes the history
+			profiler->SetEnabled(enabled);
+		ImGui::SameLine();
+		if (ImGui::Button("Clear"))
+		{
+			profiler->ClearFrames();
+			selected_frame = -1;
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Export Chrome trace"))
+			ExportChromeTrace();
+
+		boost::circular_buffer<ProfilerFrame> const& frames = profiler->GetFrames();
+		if (frames.size() == 0)
+		{
+			ImGui::Text("no frame recorded");
+			return;
+		}
+
+		// the duration of the frames
+		std::vector<float> durations;
+		durations.reserve(frames.size());
+		for (ProfilerFrame const& frame : frames)
+			durations.push_back(float(frame.GetDuration() * 1000.0));
+
+		ImGui::PlotHistogram("##frames", durations.data(), int(durations.size()), 0, "frame duration (ms)", 0.0f, FLT_MAX, ImVec2(-1.0f, 60.0f));
+
+		// the selection of the frame
+		int frame_count = int(frames.size());
+		if (selected_frame >= frame_count)
+			selected_frame = -1;
+
+		int frame_index = (selected_frame < 0) ? frame_count - 1 : selected_frame;
+		if (ImGui::SliderInt("Frame", &frame_index, 0, frame_count - 1))
+			selected_frame = (frame_index == frame_count - 1) ? -1 : frame_index;
+		ImGui::SameLine();
+		if (ImGui::Button("Slowest"))
+			selected_frame = int(std::max_element(durations.begin(), durations.end()) - durations.begin());
+		ImGui::SameLine();
+		if (ImGui::Button("Latest"))
+			selected_frame = -1;
+
+		ProfilerFrame const& frame = frames[frame_index];
+		ImGui::Text("frame %d : %.3f ms (%d CPU zones, %d GPU zones)", int(frame.frame_index), frame.GetDuration() * 1000.0, int(frame.cpu_zones.size()), int(frame.gpu_zones.size()));
+
+		// the flame graph
+		double duration = std::max(frame.GetDuration(), 0.000001);
+		float width = std::max(ImGui::GetContentRegionAvail().x, 100.0f);
+
+		ImVec2 position = ImGui::GetCursorScreenPos();
+		float height = DrawTrack("CPU", frame.cpu_zones, frame.start_time, duration, position, width);
+		position.y += height;
+		height += DrawTrack("GPU", frame.gpu_zones, frame.start_time, duration, position, width);
+
+		ImGui::Dummy(ImVec2(width, height));
+	}
+
+	float ImGuiProfilerObject::DrawTrack(char const* title, std::vector<ProfilerZone> const& zones, double start_time, double duration, ImVec2 const& position, float width)
+	{
+		ImDrawList* draw_list = ImGui::GetWindowDrawList();
+
+		float const row_height = ImGui::GetTextLineHeight() + 4.0f;
+
+		// the title of the track
+		draw_list->AddText(position, ImGui::GetColorU32(ImGuiCol_Text), title);
+
+		int max_depth = 0;
+		for (ProfilerZone const& zone : zones)
+			max_depth = std::max(max_depth, zone.depth + 1);
+
+		ImVec2 mouse_position = ImGui::GetMousePos();
+		float top = position.y + row_height;
+
+		for (ProfilerZone const& zone : zones)
+		{
+			float x1 = position.x + width * float((zone.start_time - start_time) / duration);
+			float x2 = position.x + width * float((zone.end_time - start_time) / duration);
+			x1 = std::clamp(x1, position.x, position.x + width);
+			x2 = std::clamp(x2, x1 + 1.0f, position.x + width); // always visible
+			float y1 = top + float(zone.depth) * row_height;
+			float y2 = y1 + row_height - 1.0f;
+
+			draw_list->AddRectFilled(ImVec2(x1, y1), ImVec2(x2, y2), GetProfilerZoneColor(zone.name));
+
+			// the name of the zone (if there is enough room)
+			ImVec2 text_size = ImGui::CalcTextSize(zone.name);
+			if (text_size.x + 4.0f < x2 - x1)
+			{
+				draw_list->PushClipRect(ImVec2(x1, y1), ImVec2(x2, y2), true);
+				draw_list->AddText(ImVec2(x1 + 2.0f, y1 + 2.0f), IM_COL32(0, 0, 0, 255), zone.name);
+				draw_list->PopClipRect();
+			}
+
+			if (ImGui::IsWindowHovered() && mouse_position.x >= x1 && mouse_position.x < x2 && mouse_position.y >= y1 && mouse_position.y < y2)
+				ImGui::SetTooltip("%s\n%.3f ms", zone.name, zone.GetDuration() * 1000.0);
+		}
+		return row_height * float(max_depth + 1) + 4.0f;
+	}
+
+	void ImGuiProfilerObject::ExportChromeTrace()
+	{
+		Application* application = Application::GetInstance();
+		if (application == nullptr)
+			return;
+
+		// create the directory
+		boost::filesystem::path profile_directory_path = application->GetApplicationUserLocalPath() / "Profiles";
+		if (!boost::filesystem::is_directory(profile_directory_path))
+			if (!boost::filesystem::create_directories(profile_directory_path))
+				return;
+
+		// save the trace
+		std::string format = StringTools::Printf(
+			"profile_%s_%%d.json",
+			StringTools::TimeToString(std::chrono::system_clock::now(), TimeToStringFormatType::Filename).c_str());
+
+		boost::filesystem::path file_path = FileTools::GetUniquePath(profile_directory_path, format.c_str(), true);
+		if (file_path.empty())
+			return;
+
+		Profiler::GetInstance()->ExportChromeTrace(file_path);
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -19,15 +19,13 @@ namespace chaos
 		glm::ivec2 client_size = window->GetWindowSize(false); // client area only
 
 		aabox2 viewport = window->GetRequiredViewport(client_size);
-		double x = 0.0;
-		double y = 0.0;
-		glfwGetCursorPos(window->GetGLFWHandler(), &x, &y);
+		glm::vec2 cursor_position = window->GetMousePosition(); // follows the recorded events during a replay (not the real cursor)
 
 		WindowFrameSizeInfo framesize_info;
 		glfwGetWindowFrameSize(window->GetGLFWHandler(), &framesize_info.left, &framesize_info.top, &framesize_info.right, &framesize_info.bottom);
 
 		// trace debugging information
-		ImGui::Text("cursor              : (%d, %d)", (int)x, (int)y);
+		ImGui::Text("cursor              : (%d, %d)", (int)cursor_position.x, (int)cursor_position.y);
 		ImGui::Separator();
 		ImGui::Text("window   position   : (%d, %d)", window_position.x, window_position.y);
 		ImGui::Text("window   size       : (%d, %d)", window_size.x, window_size.y);
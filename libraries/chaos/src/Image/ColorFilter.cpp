@@ -9,6 +9,56 @@ namespace chaos
 		return Compare(distance_operator, d2, distance * distance);
 	}
 
+	template<typename OPERATOR>
+	static void FilterDistances(float const* distances, size_t count, float reference, unsigned char* results, OPERATOR op)
+	{
+		for (size_t i = 0; i < count; ++i)
+			results[i] = op(distances[i], reference) ? 1 : 0;
+	}
+
+	void ColorFilter::FilterRow(glm::vec4 const* colors, size_t count, unsigned char* results) const
+	{
+		// XXX : the operator is resolved once per row instead of once per pixel. The distances are computed exactly as Filter(...) does
+		//       (same operations in the same order) so that both methods always agree
+		if (distance_operator == ComparisonOperator::Never || distance_operator == ComparisonOperator::Always)
+		{
+			memset(results, (distance_operator == ComparisonOperator::Always) ? 1 : 0, count);
+			return;
+		}
+
+		glm::vec4 reference = color_reference * color_mask;
+		float d2_reference = distance * distance;
+
+		float distances[FILTER_BATCH_SIZE];
+		for (size_t start = 0; start < count; start += FILTER_BATCH_SIZE)
+		{
+			size_t batch_count = std::min(FILTER_BATCH_SIZE, count - start);
+			for (size_t i = 0; i < batch_count; ++i)
+				distances[i] = glm::distance2(colors[start + i] * color_mask, reference);
+
+			unsigned char* batch_results = results + start;
+			switch (distance_operator)
+			{
+			case ComparisonOperator::Equal:
+				FilterDistances(distances, batch_count, d2_reference, batch_results, std::equal_to<float>()); break;
+			case ComparisonOperator::NotEqual:
+				FilterDistances(distances, batch_count, d2_reference, batch_results, std::not_equal_to<float>()); break;
+			case ComparisonOperator::Greater:
+				FilterDistances(distances, batch_count, d2_reference, batch_results, std::greater<float>()); break;
+			case ComparisonOperator::GreaterEqual:
+				FilterDistances(distances, batch_count, d2_reference, batch_results, std::greater_equal<float>()); break;
+			case ComparisonOperator::Less:
+				FilterDistances(distances, batch_count, d2_reference, batch_results, std::less<float>()); break;
+			case ComparisonOperator::LessEqual:
+				FilterDistances(distances, batch_count, d2_reference, batch_results, std::less_equal<float>()); break;
+			default:
+				assert(0);
+				memset(batch_results, 0, batch_count);
+				break;
+			}
+		}
+	}
+
 	bool DoSaveIntoJSON(nlohmann::json * json, ColorFilter const& src)
 	{
 		if (!PrepareSaveObjectIntoJSON(json))
@@ -0,0 +1,509 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	static constexpr uint32_t CUBEMAP_MIP_CHAIN_VERSION = 1;
+
+	/** the size of the square tiles faces are split into for parallel processing */
+	static constexpr int CUBEMAP_TILE_SIZE = 32;
+
+	/** the number of rows processed by each task for flat images */
+	static constexpr int CUBEMAP_ROW_BATCH = 16;
+
+	/** call func(face, x, y) for every texel of every face, tiles being processed in parallel */
+	template<typename FUNC>
+	static void ForEachCubeMapTexel(int size, FUNC const& func)
+	{
+		size_t tile_count = size_t((size + CUBEMAP_TILE_SIZE - 1) / CUBEMAP_TILE_SIZE);
+		size_t face_tile_count = tile_count * tile_count;
+
+		ThreadPool::GetDefaultInstance()->ParallelFor(6 * face_tile_count, [&func, size, tile_count, face_tile_count](size_t index)
+		{
+			CubeMapFaceType face = CubeMapFaceType(index / face_tile_count);
+			size_t tile = index % face_tile_count;
+
+			int start_x = int(tile % tile_count) * CUBEMAP_TILE_SIZE;
+			int start_y = int(tile / tile_count) * CUBEMAP_TILE_SIZE;
+			int end_x = std::min(start_x + CUBEMAP_TILE_SIZE, size);
+			int end_y = std::min(start_y + CUBEMAP_TILE_SIZE, size);
+
+			for (int y = start_y; y < end_y; ++y)
+				for (int x = start_x; x < end_x; ++x)
+					func(face, x, y);
+		});
+	}
+
+	/** copy (and convert) a whole image, bands of rows being processed in parallel */
+	static void ParallelCopyPixels(ImageDescription const& src_desc, ImageDescription const& dst_desc)
+	{
+		assert(src_desc.width == dst_desc.width);
+		assert(src_desc.height == dst_desc.height);
+
+		size_t band_count = size_t((src_desc.height + CUBEMAP_ROW_BATCH - 1) / CUBEMAP_ROW_BATCH);
+		ThreadPool::GetDefaultInstance()->ParallelFor(band_count, [&src_desc, &dst_desc](size_t index)
+		{
+			int y = int(index) * CUBEMAP_ROW_BATCH;
+			int height = std::min(CUBEMAP_ROW_BATCH, src_desc.height - y);
+
+			ImageDescription band_dst_desc = dst_desc;
+			ImageTools::CopyPixels(src_desc, band_dst_desc, 0, y, 0, y, src_desc.width, height);
+		});
+	}
+
+	/** Van der Corput radical inverse (second coordinate of the Hammersley sequence) */
+	static float RadicalInverse(uint32_t bits)
+	{
+		bits = (bits << 16u) | (bits >> 16u);
+		bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+		bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+		bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+		bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+		return float(bits) * 2.3283064365386963e-10f; // / 0x100000000
+	}
+
+	// =====================================================================
+	// CubeMapMipLevel
+	// =====================================================================
+
+	ImageDescription CubeMapMipLevel::GetFaceDescription(CubeMapFaceType face) const
+	{
+		std::vector<glm::vec4> const& pixels = faces[size_t(face)];
+		if (pixels.size() == 0)
+			return {};
+		return ImageDescription((void*)pixels.data(), size, size, PixelFormat::RGBAFloat); // glm::vec4 has the same layout than PixelRGBAFloat
+	}
+
+	glm::vec4 CubeMapMipLevel::Sample(glm::vec3 const& direction) const
+	{
+		glm::vec2 texcoord;
+		CubeMapFaceType face = CubeMapTools::GetDirectionFace(direction, texcoord);
+
+		float max_coord = float(size - 1);
+		float x = std::clamp(texcoord.x * float(size) - 0.5f, 0.0f, max_coord);
+		float y = std::clamp(texcoord.y * float(size) - 0.5f, 0.0f, max_coord);
+
+		int x0 = int(x);
+		int y0 = int(y);
+		int x1 = std::min(x0 + 1, size - 1);
+		int y1 = std::min(y0 + 1, size - 1);
+
+		float fx = x - float(x0);
+		float fy = y - float(y0);
+
+		glm::vec4 bottom = glm::mix(GetTexel(face, x0, y0), GetTexel(face, x1, y0), fx);
+		glm::vec4 top    = glm::mix(GetTexel(face, x0, y1), GetTexel(face, x1, y1), fx);
+		return glm::mix(bottom, top, fy);
+	}
+
+	// =====================================================================
+	// CubeMapMipChain
+	// =====================================================================
+
+	void CubeMapMipChain::Release()
+	{
+		levels.clear();
+	}
+
+	int CubeMapMipChain::GetCubeMapSize(int level) const
+	{
+		if (level < 0 || level >= GetLevelCount())
+			return -1;
+		return levels[size_t(level)].size;
+	}
+
+	ImageDescription CubeMapMipChain::GetFaceDescription(int level, CubeMapFaceType face) const
+	{
+		if (level < 0 || level >= GetLevelCount())
+			return {};
+		return levels[size_t(level)].GetFaceDescription(face);
+	}
+
+	glm::vec4 CubeMapMipChain::Sample(glm::vec3 const& direction, int level) const
+	{
+		assert(level >= 0 && level < GetLevelCount());
+		return levels[size_t(level)].Sample(direction);
+	}
+
+	bool CubeMapMipChain::InitializeFromCubeMap(CubeMapImages const& cubemap)
+	{
+		int size = cubemap.GetCubeMapSize();
+		if (size <= 0)
+		{
+			ImageLog::Error("CubeMapMipChain::InitializeFromCubeMap(...): invalid cubemap");
+			return false;
+		}
+
+		levels.clear();
+		CubeMapMipLevel& level = levels.emplace_back();
+		level.size = size;
+		for (std::vector<glm::vec4>& face : level.faces)
+			face.resize(size_t(size) * size_t(size), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)); // missing faces are black
+
+		bool is_single_image = cubemap.IsSingleImage();
+
+		// convert the faces in parallel
+		ThreadPool::GetDefaultInstance()->ParallelFor(6, [&cubemap, &level, size, is_single_image](size_t i)
+		{
+			ImageDescription src_desc = cubemap.GetImageFaceDescription(CubeMapImageType(i));
+			if (src_desc.data == nullptr)
+				return;
+
+			ImageTransform transform = is_single_image ?
+				cubemap.GetSingleImageLayoutFaceInfo(CubeMapImageType(i)).transform :
+				ImageTransform::None;
+
+			ImageDescription dst_desc = level.GetFaceDescription(CubeMapTools::GetCubeMapFaceType(CubeMapImageType(i)));
+			ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, 0, 0, size, size, transform);
+		});
+		return true;
+	}
+
+	bool CubeMapMipChain::InitializeFromEquirectangular(ImageDescription const& image_description, int size)
+	{
+		if (!image_description.IsValid(false) || image_description.width <= 0 || image_description.height <= 0 || size <= 0)
+		{
+			ImageLog::Error("CubeMapMipChain::InitializeFromEquirectangular(...): invalid parameters");
+			return false;
+		}
+
+		int width  = image_description.width;
+		int height = image_description.height;
+
+		// convert the source into floats once (the sampling does not depend on the source format)
+		std::vector<glm::vec4> source(size_t(width) * size_t(height));
+		ParallelCopyPixels(image_description, ImageDescription(source.data(), width, height, PixelFormat::RGBAFloat));
+
+		auto get_source_texel = [&source, width](int x, int y) -> glm::vec4 const&
+		{
+			return source[size_t(x) + size_t(y) * size_t(width)];
+		};
+
+		levels.clear();
+		CubeMapMipLevel& level = levels.emplace_back();
+		level.size = size;
+		for (std::vector<glm::vec4>& face : level.faces)
+			face.resize(size_t(size) * size_t(size));
+
+		ForEachCubeMapTexel(size, [&level, &get_source_texel, size, width, height](CubeMapFaceType face, int x, int y)
+		{
+			glm::vec2 texcoord = { (float(x) + 0.5f) / float(size), (float(y) + 0.5f) / float(size) };
+			glm::vec2 source_texcoord = CubeMapTools::GetEquirectangularTexcoord(CubeMapTools::GetFaceDirection(face, texcoord));
+
+			// bilinear sampling (horizontal wrap, vertical clamp)
+			float sx = source_texcoord.x * float(width) - 0.5f;
+			float sy = std::clamp(source_texcoord.y * float(height) - 0.5f, 0.0f, float(height - 1));
+
+			float floor_sx = std::floor(sx);
+			float fx = sx - floor_sx;
+			int x0 = ((int(floor_sx) % width) + width) % width;
+			int x1 = (x0 + 1) % width;
+
+			int y0 = int(sy);
+			int y1 = std::min(y0 + 1, height - 1);
+			float fy = sy - float(y0);
+
+			glm::vec4 bottom = glm::mix(get_source_texel(x0, y0), get_source_texel(x1, y0), fx);
+			glm::vec4 top    = glm::mix(get_source_texel(x0, y1), get_source_texel(x1, y1), fx);
+
+			level.faces[size_t(face)][size_t(x) + size_t(y) * size_t(size)] = glm::mix(bottom, top, fy);
+		});
+		return true;
+	}
+
+	bool CubeMapMipChain::GenerateGGXMipChain(int level_count, int sample_count)
+	{
+		if (IsEmpty())
+		{
+			ImageLog::Error("CubeMapMipChain::GenerateGGXMipChain(...): no source level");
+			return false;
+		}
+
+		int size = levels[0].size;
+
+		int max_level_count = GetMaxLevelCount(size);
+		if (level_count <= 0 || level_count > max_level_count)
+			level_count = max_level_count;
+		sample_count = std::max(sample_count, 1);
+
+		levels.resize(1); // the source is kept
+
+		// the source, box downsampled (sampled with a lod depending on the solid angle of each sample)
+		std::vector<CubeMapMipLevel> downsampled(size_t(max_level_count - 1));
+		std::vector<CubeMapMipLevel const*> source_levels = { &levels[0] };
+		for (CubeMapMipLevel& dst : downsampled)
+		{
+			CubeMapMipLevel const& src = *source_levels.back();
+
+			dst.size = std::max(src.size / 2, 1);
+			for (std::vector<glm::vec4>& face : dst.faces)
+				face.resize(size_t(dst.size) * size_t(dst.size));
+
+			ForEachCubeMapTexel(dst.size, [&src, &dst](CubeMapFaceType face, int x, int y)
+			{
+				int x0 = std::min(2 * x, src.size - 1);
+				int y0 = std::min(2 * y, src.size - 1);
+				int x1 = std::min(2 * x + 1, src.size - 1);
+				int y1 = std::min(2 * y + 1, src.size - 1);
+				dst.faces[size_t(face)][size_t(x) + size_t(y) * size_t(dst.size)] =
+					0.25f * (src.GetTexel(face, x0, y0) + src.GetTexel(face, x1, y0) + src.GetTexel(face, x0, y1) + src.GetTexel(face, x1, y1));
+			});
+			source_levels.push_back(&dst);
+		}
+
+		float max_lod = float(source_levels.size() - 1);
+		float texel_solid_angle = 4.0f * float(M_PI) / (6.0f * float(size) * float(size));
+
+		// a GGX sample in tangent space (the same set is used for all texels of a level)
+		struct GGXSample
+		{
+			glm::vec3 direction;
+			float weight = 0.0f;
+			float lod = 0.0f;
+		};
+
+		for (int level_index = 1; level_index < level_count; ++level_index)
+		{
+			float roughness = float(level_index) / float(level_count - 1);
+			float alpha = roughness * roughness;
+			float alpha2 = alpha * alpha;
+
+			// importance sampling of the GGX distribution (N = V => the pdf of L is D / 4)
+			std::vector<GGXSample> samples;
+			samples.reserve(size_t(sample_count));
+			for (int i = 0; i < sample_count; ++i)
+			{
+				float xi1 = (float(i) + 0.5f) / float(sample_count);
+				float xi2 = RadicalInverse(uint32_t(i));
+
+				float phi = 2.0f * float(M_PI) * xi1;
+				float cos_theta = std::sqrt((1.0f - xi2) / (1.0f + (alpha2 - 1.0f) * xi2));
+				float sin_theta = std::sqrt(std::max(1.0f - cos_theta * cos_theta, 0.0f));
+
+				glm::vec3 h = { sin_theta * std::cos(phi), sin_theta * std::sin(phi), cos_theta };
+				glm::vec3 l = 2.0f * h.z * h - glm::vec3(0.0f, 0.0f, 1.0f);
+				if (l.z <= 0.0f)
+					continue;
+
+				float d = (cos_theta * cos_theta) * (alpha2 - 1.0f) + 1.0f;
+				float pdf = alpha2 / (float(M_PI) * d * d) * 0.25f;
+				float sample_solid_angle = 1.0f / (float(sample_count) * pdf + 0.0001f);
+
+				GGXSample sample;
+				sample.direction = l;
+				sample.weight = l.z;
+				sample.lod = std::clamp(0.5f * std::log2(sample_solid_angle / texel_solid_angle) + 1.0f, 0.0f, max_lod);
+				samples.push_back(sample);
+			}
+
+			CubeMapMipLevel& level = levels.emplace_back();
+			level.size = std::max(size >> level_index, 1);
+			for (std::vector<glm::vec4>& face : level.faces)
+				face.resize(size_t(level.size) * size_t(level.size));
+
+			ForEachCubeMapTexel(level.size, [&level, &samples, &source_levels](CubeMapFaceType face, int x, int y)
+			{
+				glm::vec2 texcoord = { (float(x) + 0.5f) / float(level.size), (float(y) + 0.5f) / float(level.size) };
+				glm::vec3 n = CubeMapTools::GetFaceDirection(face, texcoord);
+
+				// tangent frame around the normal
+				glm::vec3 up = (std::abs(n.z) < 0.999f) ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+				glm::vec3 t = glm::normalize(glm::cross(up, n));
+				glm::vec3 b = glm::cross(n, t);
+
+				glm::vec4 color = { 0.0f, 0.0f, 0.0f, 0.0f };
+				float total_weight = 0.0f;
+				for (GGXSample const& sample : samples)
+				{
+					glm::vec3 l = t * sample.direction.x + b * sample.direction.y + n * sample.direction.z;
+
+					size_t lod0 = size_t(sample.lod);
+					size_t lod1 = std::min(lod0 + 1, source_levels.size() - 1);
+					float lod_factor = sample.lod - float(lod0);
+
+					color += sample.weight * glm::mix(source_levels[lod0]->Sample(l), source_levels[lod1]->Sample(l), lod_factor);
+					total_weight += sample.weight;
+				}
+				level.faces[size_t(face)][size_t(x) + size_t(y) * size_t(level.size)] = (total_weight > 0.0f) ?
+					color / total_weight :
+					source_levels[0]->Sample(n);
+			});
+		}
+		return true;
+	}
+
+	CubeMapImages CubeMapMipChain::ToCubeMapImages(int level, PixelFormat pixel_format) const
+	{
+		if (level < 0 || level >= GetLevelCount())
+			return {};
+
+		CubeMapMipLevel const& mip_level = levels[size_t(level)];
+
+		// allocate the images
+		CubeMapImages result;
+		std::array<FIBITMAP*, 6> images;
+		for (size_t i = (size_t)CubeMapImageType::ImageLeft; i <= (size_t)CubeMapImageType::ImageBack; ++i)
+		{
+			images[i] = ImageTools::GenFreeImage(pixel_format, mip_level.size, mip_level.size);
+			if (images[i] == nullptr || !result.SetImage(CubeMapImageType(i), images[i], true))
+			{
+				if (images[i] != nullptr)
+					FreeImage_Unload(images[i]);
+				return {};
+			}
+		}
+
+		// convert the faces in parallel
+		ThreadPool::GetDefaultInstance()->ParallelFor(6, [&mip_level, &images](size_t i)
+		{
+			ImageDescription dst_desc = ImageTools::GetImageDescription(images[i]);
+			ImageTools::CopyPixels(mip_level.GetFaceDescription(CubeMapTools::GetCubeMapFaceType(CubeMapImageType(i))), dst_desc, 0, 0, 0, 0, mip_level.size, mip_level.size);
+		});
+		return result;
+	}
+
+	FIBITMAP* CubeMapMipChain::ToEquirectangular(int level, int width, int height, PixelFormat pixel_format) const
+	{
+		if (level < 0 || level >= GetLevelCount() || width <= 0 || height <= 0)
+			return nullptr;
+
+		CubeMapMipLevel const& mip_level = levels[size_t(level)];
+
+		// sample the cubemap (bands of rows in parallel)
+		std::vector<glm::vec4> pixels(size_t(width) * size_t(height));
+
+		size_t band_count = size_t((height + CUBEMAP_ROW_BATCH - 1) / CUBEMAP_ROW_BATCH);
+		ThreadPool::GetDefaultInstance()->ParallelFor(band_count, [&mip_level, &pixels, width, height](size_t index)
+		{
+			int start_y = int(index) * CUBEMAP_ROW_BATCH;
+			int end_y = std::min(start_y + CUBEMAP_ROW_BATCH, height);
+			for (int y = start_y; y < end_y; ++y)
+			{
+				for (int x = 0; x < width; ++x)
+				{
+					glm::vec2 texcoord = { (float(x) + 0.5f) / float(width), (float(y) + 0.5f) / float(height) };
+					pixels[size_t(x) + size_t(y) * size_t(width)] = mip_level.Sample(CubeMapTools::GetEquirectangularDirection(texcoord));
+				}
+			}
+		});
+
+		// convert into the wanted format
+		FIBITMAP* result = ImageTools::GenFreeImage(pixel_format, width, height);
+		if (result == nullptr)
+			return nullptr;
+		ParallelCopyPixels(ImageDescription(pixels.data(), width, height, PixelFormat::RGBAFloat), ImageTools::GetImageDescription(result));
+		return result;
+	}
+
+	bool CubeMapMipChain::SaveToFile(FilePathParam const& path) const
+	{
+		SnapshotWriter writer;
+
+		size_t chunk = writer.BeginChunk(MakeSnapshotTag("CMIP"));
+		writer.Write(CUBEMAP_MIP_CHAIN_VERSION);
+		writer.Write(uint32_t(levels.size()));
+		for (CubeMapMipLevel const& level : levels)
+		{
+			writer.Write(int32_t(level.size));
+			for (std::vector<glm::vec4> const& face : level.faces)
+				writer.WriteBytes(face.data(), face.size() * sizeof(glm::vec4));
+		}
+		writer.EndChunk(chunk);
+
+		boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+
+		std::ofstream stream(resolved_path.string().c_str(), std::ios::binary);
+		if (!stream)
+		{
+			ImageLog::Error("CubeMapMipChain::SaveToFile(...): fails to open [%s]", resolved_path.string().c_str());
+			return false;
+		}
+		std::vector<char> const& buffer = writer.GetBuffer();
+		stream.write(buffer.data(), std::streamsize(buffer.size()));
+		return true;
+	}
+
+	bool CubeMapMipChain::LoadFromFile(FilePathParam const& path)
+	{
+		Buffer<char> buffer = FileTools::LoadFile(path);
+		if (buffer == nullptr)
+		{
+			ImageLog::Error("CubeMapMipChain::LoadFromFile(...): fails to load [%s]", path.GetResolvedPath().string().c_str());
+			return false;
+		}
+		return LoadFromBuffer(buffer.data, buffer.bufsize);
+	}
+
+	bool CubeMapMipChain::IsMipChainBuffer(char const* data, size_t size)
+	{
+		uint32_t tag = 0;
+		if (data == nullptr || size < sizeof(tag))
+			return false;
+		memcpy(&tag, data, sizeof(tag));
+		return (tag == MakeSnapshotTag("CMIP"));
+	}
+
+	int CubeMapMipChain::GetMaxLevelCount(int size)
+	{
+		int result = 1;
+		while ((size >> result) > 0)
+			++result;
+		return result;
+	}
+
+	bool CubeMapMipChain::LoadFromBuffer(char const* data, size_t size)
+	{
+		levels.clear();
+
+		SnapshotReader reader(data, size);
+
+		size_t chunk_end = 0;
+		uint32_t version = 0;
+		uint32_t level_count = 0;
+		if (!reader.BeginChunk(MakeSnapshotTag("CMIP"), chunk_end) || !reader.Read(version) || version != CUBEMAP_MIP_CHAIN_VERSION || !reader.Read(level_count) || level_count == 0)
+		{
+			ImageLog::Error("CubeMapMipChain::LoadFromBuffer(...): invalid mip chain");
+			return false;
+		}
+
+		for (uint32_t i = 0; i < level_count; ++i)
+		{
+			int32_t level_size = 0;
+			if (!reader.Read(level_size))
+				break;
+			// each level is half the previous one
+			int expected_size = (i == 0) ? level_size : std::max(levels[0].size >> i, 1);
+			if (level_size <= 0 || level_size != expected_size || 6 * size_t(level_size) * size_t(level_size) * sizeof(glm::vec4) > reader.GetRemainingSize())
+			{
+				ImageLog::Error("CubeMapMipChain::LoadFromBuffer(...): invalid level size");
+				levels.clear();
+				return false;
+			}
+			// the chain cannot go beyond 1x1 (the GPU texture would not have storage for these levels)
+			if (i == 0 && level_count > uint32_t(GetMaxLevelCount(level_size)))
+			{
+				ImageLog::Error("CubeMapMipChain::LoadFromBuffer(...): %d levels for a %d size", int(level_count), int(level_size));
+				levels.clear();
+				return false;
+			}
+
+			CubeMapMipLevel& level = levels.emplace_back();
+			level.size = level_size;
+			for (std::vector<glm::vec4>& face : level.faces)
+			{
+				face.resize(size_t(level_size) * size_t(level_size));
+				if (!reader.ReadBytes(face.data(), face.size() * sizeof(glm::vec4)))
+					break;
+			}
+		}
+
+		if (reader.HasError() || !reader.EndChunk(chunk_end))
+		{
+			ImageLog::Error("CubeMapMipChain::LoadFromBuffer(...): truncated mip chain");
+			levels.clear();
+			return false;
+		}
+		return true;
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -207,22 +207,27 @@ namespace chaos
 		// the wanted size for every face
 		int size = GetSingleImageSize(src_image_desc);
 
-		// iterate over all faces
+		// allocate all faces => in case of error, forget about result and returns an empty object
 		CubeMapImages result;
 		for (size_t i = (size_t)CubeMapImageType::ImageLeft ; i <= (size_t)CubeMapImageType::ImageBack ; ++i)
+		{
+			FIBITMAP * image = ImageTools::GenFreeImage(src_image_desc.pixel_format, size, size);
+			if (image == nullptr)
+				return {};
+			result.images[i] = image;
+			result.release_images[i] = true;
+		}
+
+		// copy the faces in parallel (each face has its own destination)
+		ThreadPool::GetDefaultInstance()->ParallelFor(6, [this, &result, &src_image_desc, size](size_t i)
 		{
 			CubeMapSingleImageLayoutFaceInfo face_info = GetSingleImageLayoutFaceInfo((CubeMapImageType)i);
 
 			int left   = face_info.position.x * size; // number of pixels / number of images aligned
 			int bottom = face_info.position.y * size;
 
-			// allocate a face => in case of error, forget about result and returns an empty object
-			FIBITMAP * image = ImageTools::GenFreeImage(src_image_desc.pixel_format, size, size);
-			if (image == nullptr)
-				return {};
-
 			// copy pixels
-			ImageDescription dst_image_desc = ImageTools::GetImageDescription(image);
+			ImageDescription dst_image_desc = ImageTools::GetImageDescription(result.images[i]);
 
 			int src_x = left;
 			int src_y = bottom;
@@ -230,10 +235,7 @@ namespace chaos
 			int dst_y = 0;
 
 			ImageTools::CopyPixels(src_image_desc, dst_image_desc, src_x, src_y, dst_x, dst_y, size, size, face_info.transform);
-
-			result.images[i] = image;
-			result.release_images[i] = true;
-		}
+		});
 
 		return result;
 	}
@@ -285,12 +287,14 @@ namespace chaos
 
 		ImageTools::FillImageBackground(dst_image_desc, fill_color);
 
-		// copy the faces into the single image
-		for (size_t i = (size_t)CubeMapImageType::ImageLeft ; i <= (size_t)CubeMapImageType::ImageBack ; ++i)
+		// copy the faces into the single image (in parallel, faces do not overlap)
+		ThreadPool::GetDefaultInstance()->ParallelFor(6, [this, layout, dst_image_desc, size](size_t i)
 		{
 			FIBITMAP * image = images[i];
 			if (image == nullptr)
-				continue;
+				return;
+
+			ImageDescription face_dst_image_desc = dst_image_desc;
 
 			ImageDescription src_image_desc = ImageTools::GetImageDescription(image);
 
@@ -307,8 +311,8 @@ namespace chaos
 			int dst_x = left;
 			int dst_y = bottom;
 
-			ImageTools::CopyPixels(src_image_desc, dst_image_desc, src_x, src_y, dst_x, dst_y, size, size, face_info.transform);
-		}
+			ImageTools::CopyPixels(src_image_desc, face_dst_image_desc, src_x, src_y, dst_x, dst_y, size, size, face_info.transform);
+		});
 
 		return result;
 	}
@@ -490,6 +494,144 @@ namespace chaos
 		return result;
 	}
 
+	CubeMapImages CubeMapTools::EquirectangularToCubeMap(FIBITMAP * image, int size)
+	{
+		assert(image != nullptr);
+
+		ImageDescription image_description = ImageTools::GetImageDescription(image);
+
+		CubeMapMipChain mip_chain;
+		if (!mip_chain.InitializeFromEquirectangular(image_description, size))
+			return {};
+		return mip_chain.ToCubeMapImages(0, image_description.pixel_format);
+	}
+
+	FIBITMAP * CubeMapTools::CubeMapToEquirectangular(CubeMapImages const & cubemap, int width, int height)
+	{
+		CubeMapMipChain mip_chain;
+		if (!mip_chain.InitializeFromCubeMap(cubemap))
+			return nullptr;
+		return mip_chain.ToEquirectangular(0, width, height, cubemap.GetMergedPixelFormat(PixelFormatMergeParams()));
+	}
+
+	CubeMapFaceType CubeMapTools::GetCubeMapFaceType(CubeMapImageType image_type)
+	{
+		switch (image_type)
+		{
+			case CubeMapImageType::ImageLeft:
+				return CubeMapFaceType::NegativeX;
+			case CubeMapImageType::ImageRight:
+				return CubeMapFaceType::PositiveX;
+			case CubeMapImageType::ImageTop:
+				return CubeMapFaceType::NegativeY;
+			case CubeMapImageType::ImageBottom:
+				return CubeMapFaceType::PositiveY;
+			case CubeMapImageType::ImageFront:
+				return CubeMapFaceType::PositiveZ;
+			case CubeMapImageType::ImageBack:
+				return CubeMapFaceType::NegativeZ;
+			default:
+				assert(0);
+		}
+		return CubeMapFaceType::PositiveX;
+	}
+
+	// XXX : the OpenGL specification gives, for the major axis of the direction, the values (sc, tc, ma) such as
+	//
+	//       s = (sc / |ma| + 1) / 2
+	//       t = (tc / |ma| + 1) / 2
+	//
+	//       +X : sc = -z, tc = -y
+	//       -X : sc = +z, tc = -y
+	//       +Y : sc = +x, tc = +z
+	//       -Y : sc = +x, tc = -z
+	//       +Z : sc = +x, tc = -y
+	//       -Z : sc = -x, tc = -y
+
+	glm::vec3 CubeMapTools::GetFaceDirection(CubeMapFaceType face, glm::vec2 const & texcoord)
+	{
+		float sc = 2.0f * texcoord.x - 1.0f;
+		float tc = 2.0f * texcoord.y - 1.0f;
+
+		glm::vec3 result = { 0.0f, 0.0f, 0.0f };
+		switch (face)
+		{
+			case CubeMapFaceType::PositiveX:
+				result = { 1.0f, -tc, -sc }; break;
+			case CubeMapFaceType::NegativeX:
+				result = { -1.0f, -tc, sc }; break;
+			case CubeMapFaceType::PositiveY:
+				result = { sc, 1.0f, tc }; break;
+			case CubeMapFaceType::NegativeY:
+				result = { sc, -1.0f, -tc }; break;
+			case CubeMapFaceType::PositiveZ:
+				result = { sc, -tc, 1.0f }; break;
+			case CubeMapFaceType::NegativeZ:
+				result = { -sc, -tc, -1.0f }; break;
+		}
+		return glm::normalize(result);
+	}
+
+	CubeMapFaceType CubeMapTools::GetDirectionFace(glm::vec3 const & direction, glm::vec2 & texcoord)
+	{
+		glm::vec3 abs_direction = glm::abs(direction);
+
+		CubeMapFaceType result;
+		float sc = 0.0f;
+		float tc = 0.0f;
+		float ma = 0.0f;
+
+		if (abs_direction.x >= abs_direction.y && abs_direction.x >= abs_direction.z)
+		{
+			result = (direction.x >= 0.0f) ? CubeMapFaceType::PositiveX : CubeMapFaceType::NegativeX;
+			sc = (direction.x >= 0.0f) ? -direction.z : direction.z;
+			tc = -direction.y;
+			ma = abs_direction.x;
+		}
+		else if (abs_direction.y >= abs_direction.z)
+		{
+			result = (direction.y >= 0.0f) ? CubeMapFaceType::PositiveY : CubeMapFaceType::NegativeY;
+			sc = direction.x;
+			tc = (direction.y >= 0.0f) ? direction.z : -direction.z;
+			ma = abs_direction.y;
+		}
+		else
+		{
+			result = (direction.z >= 0.0f) ? CubeMapFaceType::PositiveZ : CubeMapFaceType::NegativeZ;
+			sc = (direction.z >= 0.0f) ? direction.x : -direction.x;
+			tc = -direction.y;
+			ma = abs_direction.z;
+		}
+
+		if (ma <= 0.0f) // null direction
+		{
+			texcoord = { 0.5f, 0.5f };
+			return result;
+		}
+		texcoord.x = 0.5f * (sc / ma + 1.0f);
+		texcoord.y = 0.5f * (tc / ma + 1.0f);
+		return result;
+	}
+
+	glm::vec3 CubeMapTools::GetEquirectangularDirection(glm::vec2 const & texcoord)
+	{
+		float longitude = (texcoord.x - 0.5f) * 2.0f * float(M_PI);
+		float latitude  = (texcoord.y - 0.5f) * float(M_PI);
+
+		float cos_latitude = std::cos(latitude);
+		return { cos_latitude * std::sin(longitude), std::sin(latitude), -cos_latitude * std::cos(longitude) };
+	}
+
+	glm::vec2 CubeMapTools::GetEquirectangularTexcoord(glm::vec3 const & direction)
+	{
+		glm::vec3 d = glm::normalize(direction);
+
+		float longitude = std::atan2(d.x, -d.z);
+		float latitude  = std::asin(std::clamp(d.y, -1.0f, 1.0f));
+
+		return { longitude / (2.0f * float(M_PI)) + 0.5f, latitude / float(M_PI) + 0.5f };
+	}
+
 	bool CubeMapTools::DoLoadMultipleCubeMap_OneImage(CubeMapImages & cubemap, FilePathParam const & path, CubeMapImageType image_index)
 	{
 		FIBITMAP * image = ImageTools::LoadImageFromFile(path);
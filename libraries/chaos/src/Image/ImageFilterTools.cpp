@@ -0,0 +1,141 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	static EnumMetaData<BlurKernelType> const BlurKernelType_metadata =
+	{
+		{ BlurKernelType::Box, "BOX" },
+		{ BlurKernelType::Gaussian, "GAUSSIAN" }
+	};
+
+	CHAOS_IMPLEMENT_ENUM_METHOD(BlurKernelType, &BlurKernelType_metadata, CHAOS_API);
+
+	std::vector<float> ImageFilterTools::GetBlurKernel(BlurKernelType kernel_type, int radius)
+	{
+		radius = std::max(radius, 0);
+
+		std::vector<float> result(size_t(2 * radius + 1), 1.0f);
+		if (kernel_type == BlurKernelType::Gaussian && radius > 0)
+		{
+			// the kernel covers 2 standard deviations on each side
+			float sigma = float(radius) * 0.5f;
+			for (int i = -radius; i <= radius; ++i)
+				result[size_t(i + radius)] = std::exp(-float(i * i) / (2.0f * sigma * sigma));
+		}
+
+		float sum = 0.0f;
+		for (float weight : result)
+			sum += weight;
+		for (float& weight : result)
+			weight /= sum;
+		return result;
+	}
+
+	bool ImageFilterTools::SeparableConvolution(float* pixels, int width, int height, int channel_count, std::vector<float> const& kernel)
+	{
+		if (pixels == nullptr || width <= 0 || height <= 0 || channel_count <= 0)
+		{
+			ImageLog::Error("ImageFilterTools::SeparableConvolution(...): invalid image");
+			return false;
+		}
+		if ((kernel.size() & 1) == 0)
+		{
+			ImageLog::Error("ImageFilterTools::SeparableConvolution(...): the kernel must have an odd number of weights");
+			return false;
+		}
+
+		int radius = int(kernel.size() / 2);
+		size_t row_size = size_t(width) * size_t(channel_count);
+		size_t border_size = size_t(radius) * size_t(channel_count);
+
+		// horizontal pass: each row is copied into a zero padded row, so that each weight is applied on the whole row at once
+		std::vector<float> horizontal(row_size * size_t(height), 0.0f);
+		ParallelForRows(height, [&](int start_y, int end_y)
+		{
+			std::vector<float> padded(row_size + 2 * border_size, 0.0f);
+			for (int y = start_y; y < end_y; ++y)
+			{
+				memcpy(padded.data() + border_size, pixels + size_t(y) * row_size, row_size * sizeof(float));
+
+				float* dst = horizontal.data() + size_t(y) * row_size;
+				for (size_t k = 0; k < kernel.size(); ++k)
+				{
+					float weight = kernel[k];
+					float const* src = padded.data() + k * size_t(channel_count);
+					for (size_t i = 0; i < row_size; ++i)
+						dst[i] += weight * src[i];
+				}
+			}
+		});
+
+		// vertical pass: accumulate the weighted source rows (rows outside the image are skipped)
+		ParallelForRows(height, [&](int start_y, int end_y)
+		{
+			for (int y = start_y; y < end_y; ++y)
+			{
+				float* dst = pixels + size_t(y) * row_size;
+				std::fill(dst, dst + row_size, 0.0f);
+
+				int min_k = std::max(0, radius - y);
+				int max_k = std::min(2 * radius, radius + height - 1 - y);
+				for (int k = min_k; k <= max_k; ++k)
+				{
+					float weight = kernel[size_t(k)];
+					float const* src = horizontal.data() + size_t(y + k - radius) * row_size;
+					for (size_t i = 0; i < row_size; ++i)
+						dst[i] += weight * src[i];
+				}
+			}
+		});
+		return true;
+	}
+
+	void ImageFilterTools::CopyToRGBAFloat(ImageDescription const& src_desc, glm::vec4* dst, int dst_width, int dst_height, int dst_x, int dst_y)
+	{
+		assert(dst_x >= 0 && dst_x + src_desc.width <= dst_width);
+		assert(dst_y >= 0 && dst_y + src_desc.height <= dst_height);
+
+		ImageDescription dst_desc(dst, dst_width, dst_height, PixelFormat::RGBAFloat);
+		ParallelForRows(src_desc.height, [&src_desc, &dst_desc, dst_x, dst_y](int start_y, int end_y)
+		{
+			ImageDescription band_dst_desc = dst_desc;
+			ImageTools::CopyPixels(src_desc, band_dst_desc, 0, start_y, dst_x, dst_y + start_y, src_desc.width, end_y - start_y);
+		});
+	}
+
+	FIBITMAP* ImageFilterTools::GenFreeImageFromRGBAFloat(glm::vec4 const* src, int width, int height, PixelFormat pixel_format)
+	{
+		FIBITMAP* result = ImageTools::GenFreeImage(pixel_format, width, height);
+		if (result == nullptr)
+			return nullptr;
+
+		ImageDescription src_desc(const_cast<glm::vec4*>(src), width, height, PixelFormat::RGBAFloat);
+		ImageDescription dst_desc = ImageTools::GetImageDescription(result);
+		ParallelForRows(height, [&src_desc, &dst_desc, width](int start_y, int end_y)
+		{
+			ImageDescription band_dst_desc = dst_desc;
+			ImageTools::CopyPixels(src_desc, band_dst_desc, 0, start_y, 0, start_y, width, end_y - start_y);
+		});
+		return result;
+	}
+
+	void ImageFilterTools::PremultiplyAlpha(glm::vec4* pixels, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			glm::vec4& p = pixels[i];
+			p = { p.r * p.a, p.g * p.a, p.b * p.a, p.a };
+		}
+	}
+
+	void ImageFilterTools::UnpremultiplyAlpha(glm::vec4* pixels, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			glm::vec4& p = pixels[i];
+			p = (p.a > 0.0f) ? glm::vec4(p.r / p.a, p.g / p.a, p.b / p.a, p.a) : glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+		}
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	FIBITMAP* ImageProcessorBlur::ProcessImage(ImageDescription const& src_desc) const
+	{
+		if (src_desc.pixel_format == PixelFormat::DepthStencil)
+		{
+			ImageProcessorLog::Error("ImageProcessorBlur : cannot process DepthStencil format");
+			return nullptr;
+		}
+
+		int border = (expand) ? std::max(radius, 0) : 0;
+		int dest_width = src_desc.width + 2 * border;
+		int dest_height = src_desc.height + 2 * border;
+
+		std::vector<glm::vec4> pixels(size_t(dest_width) * size_t(dest_height), glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
+		ImageFilterTools::CopyToRGBAFloat(src_desc, pixels.data(), dest_width, dest_height, border, border);
+
+		// blur premultiplied colors so that transparent pixels do not bleed their color
+		ImageFilterTools::PremultiplyAlpha(pixels.data(), pixels.size());
+		if (!ImageFilterTools::SeparableConvolution(&pixels[0].x, dest_width, dest_height, 4, ImageFilterTools::GetBlurKernel(kernel_type, radius)))
+			return nullptr;
+		ImageFilterTools::UnpremultiplyAlpha(pixels.data(), pixels.size());
+
+		return ImageFilterTools::GenFreeImageFromRGBAFloat(pixels.data(), dest_width, dest_height, src_desc.pixel_format);
+	}
+
+	bool ImageProcessorBlur::SerializeIntoJSON(nlohmann::json * json) const
+	{
+		if (!ImageProcessor::SerializeIntoJSON(json))
+			return false;
+		JSONTools::SetAttribute(json, "kernel_type", kernel_type);
+		JSONTools::SetAttribute(json, "radius", radius);
+		JSONTools::SetAttribute(json, "expand", expand);
+		return true;
+	}
+
+	bool ImageProcessorBlur::SerializeFromJSON(JSONReadConfiguration config)
+	{
+		if (!ImageProcessor::SerializeFromJSON(config))
+			return false;
+		JSONTools::GetAttribute(config, "kernel_type", kernel_type);
+		JSONTools::GetAttribute(config, "radius", radius);
+		JSONTools::GetAttribute(config, "expand", expand);
+		return true;
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -43,42 +43,59 @@ namespace chaos
 
 				int d2 = distance * distance;
 
-				// all pixels on destination images
-				for (int y = 0; y < dest_height; ++y)
+				// filter the source pixels once, a whole row at a time
+				size_t src_width = size_t(src_desc.width);
+				std::vector<unsigned char> filtered(src_width * size_t(src_desc.height));
+				ImageFilterTools::ParallelForRows(src_desc.height, [this, &src_accessor, &filtered, src_width](int start_y, int end_y)
 				{
-					for (int x = 0; x < dest_width; ++x)
+					for (int y = start_y; y < end_y; ++y)
+						color_filter.FilterRow(&src_accessor(0, y), src_width, filtered.data() + size_t(y) * src_width);
+				});
+
+				auto is_filtered = [&filtered, src_width](int x, int y)
+				{
+					return filtered[size_t(x) + size_t(y) * src_width] != 0;
+				};
+
+				// all pixels on destination images (rows are independant)
+				ImageFilterTools::ParallelForRows(dest_height, [&](int start_y, int end_y)
+				{
+					for (int y = start_y; y < end_y; ++y)
 					{
-						int src_x = x - distance;
-						int src_y = y - distance;
+						for (int x = 0; x < dest_width; ++x)
+						{
+							int src_x = x - distance;
+							int src_y = y - distance;
 
-						// search whether we must add an outline
-						int min_src_x = std::max(0, src_x - distance);
-						int max_src_x = std::min(src_x + distance, src_desc.width - 1);
+							// search whether we must add an outline
+							int min_src_x = std::max(0, src_x - distance);
+							int max_src_x = std::min(src_x + distance, src_desc.width - 1);
 
-						int min_src_y = std::max(0, src_y - distance);
-						int max_src_y = std::min(src_y + distance, src_desc.height - 1);
+							int min_src_y = std::max(0, src_y - distance);
+							int max_src_y = std::min(src_y + distance, src_desc.height - 1);
 
-						bool all_neighboor_empty = true;
-						for (int sy = min_src_y; (sy <= max_src_y) && all_neighboor_empty; ++sy)
-						{
-							for (int sx = min_src_x; (sx <= max_src_x) && all_neighboor_empty; ++sx)
+							bool all_neighboor_empty = true;
+							for (int sy = min_src_y; (sy <= max_src_y) && all_neighboor_empty; ++sy)
 							{
-								int dx = src_x - sx;
-								int dy = src_y - sy;
-								if (dx * dx + dy * dy <= d2)
-									all_neighboor_empty = !color_filter.Filter(src_accessor(sx, sy));
+								for (int sx = min_src_x; (sx <= max_src_x) && all_neighboor_empty; ++sx)
+								{
+									int dx = src_x - sx;
+									int dy = src_y - sy;
+									if (dx * dx + dy * dy <= d2)
+										all_neighboor_empty = !is_filtered(sx, sy);
+								}
 							}
-						}
 
-						// put the pixel on destination
-						if (all_neighboor_empty)
-							dst_accessor(x, y) = empty;
-						else if (src_x >= 0 && src_x < src_desc.width && src_y >= 0 && src_y < src_desc.height && color_filter.Filter(src_accessor(src_x, src_y)))
-							dst_accessor(x, y) = src_accessor(src_x, src_y);
-						else
-							dst_accessor(x, y) = outline;
+							// put the pixel on destination
+							if (all_neighboor_empty)
+								dst_accessor(x, y) = empty;
+							else if (src_x >= 0 && src_x < src_desc.width && src_y >= 0 && src_y < src_desc.height && is_filtered(src_x, src_y))
+								dst_accessor(x, y) = src_accessor(src_x, src_y);
+							else
+								dst_accessor(x, y) = outline;
+						}
 					}
-				}
+				});
 			}
 			return result;
 		});
@@ -0,0 +1,113 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	FIBITMAP* ImageProcessorShadow::ProcessImage(ImageDescription const& src_desc) const
+	{
+		return DoProcessShadow(src_desc, false);
+	}
+
+	FIBITMAP* ImageProcessorShadow::DoProcessShadow(ImageDescription const& src_desc, bool additive) const
+	{
+		if (src_desc.pixel_format == PixelFormat::DepthStencil)
+		{
+			ImageProcessorLog::Error("ImageProcessorShadow : cannot process DepthStencil format");
+			return nullptr;
+		}
+
+		int margin_x = std::max(radius, 0) + std::abs(offset.x);
+		int margin_y = std::max(radius, 0) + std::abs(offset.y);
+		int dest_width = src_desc.width + 2 * margin_x;
+		int dest_height = src_desc.height + 2 * margin_y;
+		size_t pixel_count = size_t(dest_width) * size_t(dest_height);
+
+		// the source, centered
+		std::vector<glm::vec4> pixels(pixel_count, glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
+		ImageFilterTools::CopyToRGBAFloat(src_desc, pixels.data(), dest_width, dest_height, margin_x, margin_y);
+
+		// the mask: alpha of the filtered pixels, shifted by the offset
+		std::vector<float> mask(pixel_count, 0.0f);
+		ImageFilterTools::ParallelForRows(src_desc.height, [&](int start_y, int end_y)
+		{
+			std::vector<unsigned char> filtered(size_t(src_desc.width));
+			for (int y = start_y; y < end_y; ++y)
+			{
+				glm::vec4 const* src_row = pixels.data() + size_t(margin_x) + size_t(y + margin_y) * size_t(dest_width);
+				float* mask_row = mask.data() + size_t(margin_x + offset.x) + size_t(y + margin_y + offset.y) * size_t(dest_width);
+
+				color_filter.FilterRow(src_row, filtered.size(), filtered.data());
+				for (size_t x = 0; x < filtered.size(); ++x)
+					mask_row[x] = (filtered[x] != 0) ? src_row[x].a : 0.0f;
+			}
+		});
+
+		if (!ImageFilterTools::SeparableConvolution(mask.data(), dest_width, dest_height, 1, ImageFilterTools::GetBlurKernel(kernel_type, radius)))
+			return nullptr;
+
+		// compose the source with the colored mask
+		glm::vec3 shadow_color = color;
+		ImageFilterTools::ParallelForRows(dest_height, [&](int start_y, int end_y)
+		{
+			for (size_t i = size_t(start_y) * size_t(dest_width); i < size_t(end_y) * size_t(dest_width); ++i)
+			{
+				glm::vec4& p = pixels[i];
+				float shadow_alpha = std::min(mask[i] * intensity, 1.0f) * color.a;
+
+				glm::vec3 c;
+				float a;
+				if (additive)
+				{
+					c = glm::vec3(p) * p.a + shadow_color * shadow_alpha;
+					a = std::min(p.a + shadow_alpha, 1.0f);
+				}
+				else
+				{
+					c = glm::vec3(p) * p.a + shadow_color * (shadow_alpha * (1.0f - p.a));
+					a = p.a + shadow_alpha * (1.0f - p.a);
+				}
+				p = (a > 0.0f) ? glm::vec4(glm::min(c / a, glm::vec3(1.0f)), a) : glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+			}
+		});
+
+		return ImageFilterTools::GenFreeImageFromRGBAFloat(pixels.data(), dest_width, dest_height, PixelFormat::BGRA);
+	}
+
+	bool ImageProcessorShadow::SerializeIntoJSON(nlohmann::json * json) const
+	{
+		if (!ImageProcessor::SerializeIntoJSON(json))
+			return false;
+		JSONTools::SetAttribute(json, "kernel_type", kernel_type);
+		JSONTools::SetAttribute(json, "radius", radius);
+		JSONTools::SetAttribute(json, "offset", offset);
+		JSONTools::SetAttribute(json, "color_filter", color_filter);
+		JSONTools::SetAttribute(json, "color", color);
+		JSONTools::SetAttribute(json, "intensity", intensity);
+		return true;
+	}
+
+	bool ImageProcessorShadow::SerializeFromJSON(JSONReadConfiguration config)
+	{
+		if (!ImageProcessor::SerializeFromJSON(config))
+			return false;
+		JSONTools::GetAttribute(config, "kernel_type", kernel_type);
+		JSONTools::GetAttribute(config, "radius", radius);
+		JSONTools::GetAttribute(config, "offset", offset);
+		JSONTools::GetAttribute(config, "color_filter", color_filter);
+		JSONTools::GetAttribute(config, "color", color);
+		JSONTools::GetAttribute(config, "intensity", intensity);
+		return true;
+	}
+
+	ImageProcessorGlow::ImageProcessorGlow()
+	{
+		offset = { 0, 0 };
+		color = { 1.0f, 1.0f, 1.0f, 1.0f };
+	}
+
+	FIBITMAP* ImageProcessorGlow::ProcessImage(ImageDescription const& src_desc) const
+	{
+		return DoProcessShadow(src_desc, true);
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -352,7 +352,7 @@ namespace chaos
 
 			int physical_index = int(i);
 
-			if (glfwJoystickPresent(physical_index) && glfwJoystickIsGamepad(physical_index))
+			if (InputRecorder::IsGamepadPresent(physical_index))
 			{
 				present_physical_gamepads |= uint32_t(1 << i);
 				
@@ -461,7 +461,7 @@ namespace chaos
 			uint32_t physical_gamepad_bit = uint32_t(1 << physical_gamepad.gamepad_index);
 
 			int  physical_index = int(physical_gamepad.gamepad_index);
-			bool is_present     = glfwJoystickPresent(physical_index) && glfwJoystickIsGamepad(physical_index);
+			bool is_present     = InputRecorder::IsGamepadPresent(physical_index); // the record during a replay
 			bool was_present    = physical_gamepad.IsPresent();
 
 			physical_gamepad.is_present = is_present;
@@ -637,11 +637,8 @@ namespace chaos
 	{
 		int physical_index = int(gamepad_index);
 
-		if (glfwJoystickPresent(physical_index) == FALSE || glfwJoystickIsGamepad(physical_index) == GLFW_FALSE)
-			return false;
-
 		GLFWgamepadstate state;
-		if (glfwGetGamepadState(physical_index, &state) == GLFW_FALSE)
+		if (!InputRecorder::GetGamepadState(physical_index, state))
 			return false;
 
 		for (size_t i = 0; i < GamepadState::BUTTON_COUNT; ++i)
@@ -135,11 +135,12 @@ namespace chaos
 	{
 		int physical_index = int(gamepad_index);
 
-		if (glfwJoystickPresent(physical_index) == FALSE || glfwJoystickIsGamepad(physical_index) == GLFW_FALSE)
+		if (!InputRecorder::IsGamepadPresent(physical_index))
 			return;
 
+		// XXX : the state comes from the record during a replay
 		GLFWgamepadstate state;
-		if (glfwGetGamepadState(physical_index, &state) == GLFW_FALSE)
+		if (!InputRecorder::GetGamepadState(physical_index, state))
 		{
 			Clear();
 			return;
@@ -3,116 +3,190 @@
 
 namespace chaos
 {
+	// the addresses of these variables are used as LIGHTUSERDATA keys
+	static char const TOMT_KEY = 0;         // REGISTRY[TOMT_KEY]   = the table of the metatables
+	static char const OBJECT_CACHE_KEY = 0; // REGISTRY[OBJECT_CACHE_KEY] = the weak table of the userdata
+	static char const CLASS_KEY = 0;        // MT[CLASS_KEY]        = the Class
 
-
-#if 0
-
-	char const * LuaBinding::TOMT_KEY = "LuaBinding::TOMT";
-
-	char const * LuaBinding::ID_KEY   = "ID";
-
-	void LuaBinding::GetTOMT()
+	void LuaBinding::PushRegistryTable(lua_State* state, void const* key, char const* mode)
 	{
 #if _DEBUG
 		ensure_luatop_offset(state, +1);
 #endif
 
-		// create if necessary the TOMT
-		lua_pushstring(state, TOMT_KEY);
-		lua_gettable(state, LUA_REGISTRYINDEX);
+		if (lua_rawgetp(state, LUA_REGISTRYINDEX, key) == LUA_TTABLE)
+			return;
+		lua_pop(state, 1); // remove previous result (nil)
 
-		if (lua_isnil(state, -1)) // if the entry does not exists, create it
+		lua_newtable(state);
+		if (mode != nullptr) // a weak table
 		{
-			lua_pop(state, 1);                   // remove previous result (nil)
-
-			lua_newtable(state);                 // create the table
-			lua_pushstring(state, TOMT_KEY);     // push the KEY
-			lua_pushvalue(state, -2);            // push value (a duplication of the table), this wil be consumed soon
-			lua_settable(state, LUA_REGISTRYINDEX);
+			lua_newtable(state);
+			lua_pushstring(state, mode);
+			lua_setfield(state, -2, "__mode");
+			lua_setmetatable(state, -2);
 		}
-		assert(lua_istable(state, -1)); // well if there is an object named "LuaBinding::TOMT" in registry that is not a table, there is a problem !
+		lua_pushvalue(state, -1); // the copy is consumed by the registration
+		lua_rawsetp(state, LUA_REGISTRYINDEX, key);
 	}
 
-	void LuaBinding::CreateEmptyMT(InheritanceIntrospection::ClassRuntimeID ID, int tomt_index) // leave the MT on the stack
+	void LuaBinding::PushClassMetatable(lua_State* state, Class const* cls)
 	{
 #if _DEBUG
 		ensure_luatop_offset(state, +1);
 #endif
+		assert(cls != nullptr);
+
+		PushRegistryTable(state, &TOMT_KEY, nullptr);
+		if (lua_rawgetp(state, -1, cls) == LUA_TTABLE)
+		{
+			lua_remove(state, -2); // remove the TOMT
+			return;
+		}
+		lua_pop(state, 1); // remove previous result (nil)
+
+		// create the MT
+		lua_newtable(state);
 
-		if (tomt_index != 0)
-			tomt_index = lua_absindex(state, tomt_index);
+		lua_pushvalue(state, -1);
+		lua_setfield(state, -2, "__index"); // the methods are stored in the MT itself
 
-		lua_newtable(state);                      // create the MT
+		lua_pushcfunction(state, &ObjectGCFunction);
+		lua_setfield(state, -2, "__gc");
 
-												  // register the MT into TOMT
-		lua_pushlightuserdata(state, (void*)ID);  // KEY
-		lua_pushvalue(state, -2);                 // VALUE = duplicate the MT table
-		lua_settable(state, tomt_index);          // consume both KEY and DUPLICATED VALUE
+		lua_pushstring(state, cls->GetClassName().c_str());
+		lua_setfield(state, -2, "__name");
 
-												  // link MT and RuntimeClassID  (MT["ID"] = ID)
-		lua_pushstring(state, ID_KEY);            // KEY
-		lua_pushlightuserdata(state, (void*)ID);  // VALUE
-		lua_settable(state, -3);
+		lua_pushlightuserdata(state, (void*)cls);
+		lua_rawsetp(state, -2, &CLASS_KEY);
+
+		// the inherited methods are found in the MT of the parent
+		if (Class const* parent_class = cls->GetParentClass())
+		{
+			PushClassMetatable(state, parent_class);
+			lua_setmetatable(state, -2);
+		}
+
+		// register the MT into the TOMT
+		lua_pushvalue(state, -1);
+		lua_rawsetp(state, -3, cls);
+
+		lua_remove(state, -2); // remove the TOMT
 	}
 
-	void LuaBinding::GetMT(InheritanceIntrospection::ClassRuntimeID ID) // leave the MT on the stack
+	void LuaBinding::RegisterClassGlobal(lua_State* state, Class const* cls, char const* name)
 	{
 #if _DEBUG
-		ensure_luatop_offset(state, +1);
+		ensure_luatop_const(state);
 #endif
+		assert(name != nullptr);
 
-		GetTOMT();
-		lua_pushlightuserdata(state, (void *)ID);
-		lua_gettable(state, -2); // read the MT from TOMT
-
-		lua_remove(state, -2); // remove the TOMT from the stack
+		PushClassMetatable(state, cls);
+		if (cls->CanCreateInstance())
+		{
+			lua_pushlightuserdata(state, (void*)cls);
+			lua_pushcclosure(state, &ObjectNewFunction, 1);
+			lua_setfield(state, -2, "New");
+		}
+		lua_setglobal(state, name);
 	}
 
-	InheritanceIntrospection::ClassRuntimeID LuaBinding::GetClassRuntimeIDFromMT(int mt_index)
+	void LuaBinding::PushObject(lua_State* state, Object const* object)
 	{
 #if _DEBUG
-		ensure_luatop_const(state);
+		ensure_luatop_offset(state, +1);
 #endif
 
-		InheritanceIntrospection::ClassRuntimeID result = nullptr;
+		if (object == nullptr)
+		{
+			lua_pushnil(state);
+			return;
+		}
 
-		if (mt_index != 0)
-			mt_index = lua_absindex(state, mt_index);
+		// the object may have already been pushed
+		PushRegistryTable(state, &OBJECT_CACHE_KEY, "v");
+		if (lua_rawgetp(state, -1, object) == LUA_TUSERDATA)
+		{
+			lua_remove(state, -2); // remove the cache
+			return;
+		}
+		lua_pop(state, 1); // remove previous result (nil)
 
-		lua_pushstring(state, ID_KEY);
-		lua_gettable(state, mt_index);
+		// create the userdata
+		void* ptr = lua_newuserdata(state, sizeof(LuaObjectUserData));
+		new (ptr) LuaObjectUserData{ const_cast<Object*>(object) };
 
-		if (lua_islightuserdata(state, -1))
-			result = (InheritanceIntrospection::ClassRuntimeID)lua_touserdata(state, -1);
+		PushClassMetatable(state, object->GetClass());
+		lua_setmetatable(state, -2);
 
-		lua_pop(state, 1); // remove the lightuserdata
+		// register the userdata into the cache
+		lua_pushvalue(state, -1);
+		lua_rawsetp(state, -3, object);
 
-		return result;
+		lua_remove(state, -2); // remove the cache
 	}
 
-	InheritanceIntrospection::ClassRuntimeID LuaBinding::GetClassRuntimeID(int index)
+	Object* LuaBinding::ToObject(lua_State* state, int index, Class const* required_class)
 	{
 #if _DEBUG
 		ensure_luatop_const(state);
 #endif
 
-		InheritanceIntrospection::ClassRuntimeID result = nullptr;
+		if (lua_type(state, index) != LUA_TUSERDATA)
+			return nullptr;
+		if (!lua_getmetatable(state, index))
+			return nullptr;
 
-		if (lua_isuserdata(state, index))
-		{
-			if (index != 0)
-				index = lua_absindex(state, index);
+		// the MT of the userdata gives its class
+		Class const* cls = nullptr;
+		if (lua_rawgetp(state, -1, &CLASS_KEY) == LUA_TLIGHTUSERDATA)
+			cls = (Class const*)lua_touserdata(state, -1);
+		lua_pop(state, 2); // remove the MT and the class
 
-			lua_getmetatable(state, index);
+		if (cls == nullptr)
+			return nullptr; // not a userdata created by the binding
+		if (required_class != nullptr && cls->InheritsFrom(required_class, true) != InheritanceType::Yes)
+			return nullptr;
 
-			result = GetClassRuntimeIDFromMT(-1);
+		LuaObjectUserData* user_data = (LuaObjectUserData*)lua_touserdata(state, index);
+		return user_data->object.get();
+	}
 
-			lua_pop(state, 1); // remove the metatable
+	int LuaBinding::ObjectGCFunction(lua_State* state)
+	{
+		// XXX : the metamethods are reachable through __index (a script may call obj:__gc() or MT.__gc(anything))
+		//       ignore anything that is not a living object of the binding and keep the userdata valid (null object) after the release
+		Object* object = ToObject(state, 1, nullptr);
+		if (object == nullptr)
+			return 0;
+
+		// remove the userdata from the cache (only if it is still the one for this object) so that a later push creates a new userdata
+		PushRegistryTable(state, &OBJECT_CACHE_KEY, "v");
+		lua_rawgetp(state, -1, object);
+		bool cached = lua_rawequal(state, -1, 1);
+		lua_pop(state, 1);
+		if (cached)
+		{
+			lua_pushnil(state);
+			lua_rawsetp(state, -2, object);
 		}
-		return result;
-	};
+		lua_pop(state, 1); // remove the cache
 
+		LuaObjectUserData* user_data = (LuaObjectUserData*)lua_touserdata(state, 1);
+		user_data->object = nullptr; // a null shared_ptr owns nothing: no destructor call is required when Lua frees the memory
+		return 0;
+	}
 
-#endif
+	int LuaBinding::ObjectNewFunction(lua_State* state)
+	{
+		Class const* cls = (Class const*)lua_touserdata(state, lua_upvalueindex(1));
+		assert(cls != nullptr);
+
+		Object* object = cls->CreateInstance(); // the userdata takes the ownership
+		if (object == nullptr)
+			return luaL_error(state, "%s.New(): fails to create instance", cls->GetClassName().c_str());
+		PushObject(state, object);
+		return 1;
+	}
 
-}; // namespace chaos
+}; // namespace chaos
\ No newline at end of file
@@ -40,6 +40,15 @@ namespace chaos
 
 		void ResetRandSeed()
 		{
+			// a recorded session must be replayed with the same random sequence
+			if (InputRecorder const* input_recorder = InputRecorder::GetInstance())
+			{
+				if (input_recorder->GetMode() != InputRecorderMode::None)
+				{
+					srand(input_recorder->GetRandomSeed());
+					return;
+				}
+			}
 			srand((unsigned int)time(nullptr));
 		}
 
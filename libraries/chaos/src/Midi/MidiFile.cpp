@@ -9,61 +9,47 @@ namespace chaos
 			return false;
 		if (format == FORMAT_SINGLE_TRACK && track_count != 1)
 			return false;
+		if (track_count < 0)
+			return false;
 		return true;
 	}
 
 	bool MidiSystemExclusiveEvent::InitializeEventFromChunk(BufferReader & reader)
 	{
-
-		return true;
+		uint32_t size = 0;
+		if (!MidiLoader::ReadVariableLength(reader, size))
+			return false;
+		return reader.ReadSubReader(size, data);
 	}
 
 	bool MidiMetaEvent::InitializeEventFromChunk(BufferReader & reader)
 	{
-
-		return true;
+		uint32_t size = 0;
+		if (!reader.Read(meta_type) || !MidiLoader::ReadVariableLength(reader, size))
+			return false;
+		return reader.ReadSubReader(size, data);
 	}
 
 	bool MidiCommandEvent::InitializeEventFromChunk(BufferReader & reader)
 	{
-
-		return true;
+		command = MIDICommand(signature);
+		return command.ReadParams(reader);
 	}
 
-	MidiChunk const MidiLoader::ReadChunk(BufferReader & reader)
+	bool MidiLoader::ReadChunk(BufferReader & reader, MidiChunk & result)
 	{
-		MidiChunk result;
-		if (reader.IsEnoughData(8)) // 8 = name + size
-		{
-			// read the chunk name
-			reader.ReadN(result.chunk_name, 4);
-			// read the size of the data
-			uint32_t data_size;
-			reader.Read(data_size);
-			data_size = EndianTools::BigEndianToHost(data_size);
-
-			if (reader.IsEnoughData(data_size))
-			{
-				result.bufsize = data_size;
-				result.data = (char *)reader.GetCurrentPosition();
-				reader.Advance(data_size);
-			}
-		}
-		return result;
-	}
-
-	MidiChunk const MidiLoader::ReadHeaderChunk(BufferReader & reader)
-	{
-		MidiChunk const result = ReadChunk(reader);
-		if (result.IsHeaderChunk())
-			if (result.bufsize == 6) // because header is always 6 bytes long
-				return result;
-		return MidiChunk();
+		// read the chunk name and the size of the data
+		uint32_t data_size = 0;
+		if (!reader.ReadN(result.chunk_name, 4) || !reader.ReadBigEndian(data_size))
+			return false;
+		// the content is not copied
+		return reader.ReadSubReader(data_size, result.content);
 	}
 
-	bool MidiLoader::LoadBuffer(Buffer<char> const & buffer)
+	bool MidiLoader::LoadBuffer(Buffer<char> const & in_buffer)
 	{
 		Clean();
+		buffer = in_buffer;
 		BufferReader reader(buffer);
 		if (!DoLoadBuffer(reader))
 		{
@@ -73,64 +59,116 @@ namespace chaos
 		return true;
 	}
 
+	bool MidiLoader::LoadFile(FilePathParam const& path)
+	{
+		Clean();
+
+		bool result = FileTools::WithFile(path, [this](boost::filesystem::path const& p)
+		{
+			if (FileTools::IsArchivedFile(p))
+			{
+				// the archive already gives a view on its own mapping
+				Buffer<char> file_buffer = FileTools::LoadFile(p, LoadFileFlag::NoErrorTrace);
+				if (file_buffer == nullptr)
+					return false;
+				return LoadBuffer(file_buffer);
+			}
+
+			if (!boost::filesystem::is_regular_file(p))
+				return false;
+			mapped_file = new MemoryMappedFile;
+			if (!mapped_file->Open(p))
+			{
+				Clean();
+				return false;
+			}
+			BufferReader reader(mapped_file->GetData(), mapped_file->GetSize());
+			if (!DoLoadBuffer(reader))
+			{
+				Clean();
+				return false;
+			}
+			return true;
+		});
+		return result;
+	}
+
 	void MidiLoader::Clean()
 	{
 		header = MidiHeader();
 		tracks.clear();
+		buffer = Buffer<char>();
+		mapped_file = nullptr;
 	}
 
-	bool MidiLoader::ReadVLTime(BufferReader & reader, uint32_t & result)
+	bool MidiLoader::ReadVariableLength(BufferReader & reader, uint32_t & result)
 	{
 		result = 0;
 
-		unsigned char tmp = 0;
-		uint32_t count = 0;
-		while (!reader.Read(tmp) && count++ < 4) // time is at much 4 bytes long
+		BufferReader tmp_reader = reader; // the position is unchanged in case of failure
+		for (int i = 0; i < 4; ++i) // the value is at most 4 bytes long
 		{
-			result |= ((uint32_t)(tmp & ~0x80));
+			unsigned char value = 0;
+			if (!tmp_reader.Read(value))
+				return false;
+			result = (result << 7) | uint32_t(value & 0x7F);
 			// last byte reached
-			if ((tmp & 0x80) == 0)
+			if ((value & 0x80) == 0)
+			{
+				reader = tmp_reader;
 				return true;
-			result <<= 7;
+			}
 		}
 		return false;
 	}
 
 	bool MidiLoader::InitializeTrackFromChunk(MidiTrack * track, MidiChunk const & track_chunk)
 	{
-		BufferReader reader(track_chunk);
+		BufferReader reader = track_chunk.content;
+
+		unsigned char running_status = 0;
 		while (!reader.IsEOF())
 		{
 			// read the time of the event
-			uint32_t event_time = 0;
-			if (!ReadVLTime(reader, event_time))
+			uint32_t delta_time = 0;
+			if (!ReadVariableLength(reader, delta_time))
 				return false;
 
 			unsigned char signature = 0;
-			reader.Read(signature);
+			if (!reader.Peek(signature))
+				return false;
 
-			// misformed event
 			if ((signature & 0x80) == 0)
-				return false;
+			{
+				// running status: the signature of the previous command is reused
+				if (running_status == 0)
+					return false; // misformed event
+				signature = running_status;
+			}
+			else
+			{
+				reader.Advance(1);
+			}
 
 			std::unique_ptr<MidiEvent> new_event;
 
 			if (signature == 0xF0 || signature == 0xF7) // System exclusive event
 			{
-				new_event = std::move(std::unique_ptr<MidiEvent>(new MidiSystemExclusiveEvent(signature)));
+				new_event = std::make_unique<MidiSystemExclusiveEvent>(signature);
+				running_status = 0;
 			}
 			else if (signature == 0xFF) // meta event
 			{
-				new_event = std::move(std::unique_ptr<MidiEvent>(new MidiMetaEvent(signature)));
+				new_event = std::make_unique<MidiMetaEvent>(signature);
+				running_status = 0;
 			}
 			else // standard MIDI event
 			{
-				new_event = std::move(std::unique_ptr<MidiEvent>(new MidiCommandEvent(signature)));
+				new_event = std::make_unique<MidiCommandEvent>(signature);
+				running_status = signature;
 			}
 
-			if (new_event == nullptr)
-				return false;
-
+			new_event->delta_time = delta_time;
 			if (!new_event->InitializeEventFromChunk(reader))
 				return false;
 			track->events.push_back(std::move(new_event));
@@ -141,50 +179,37 @@ namespace chaos
 	bool MidiLoader::DoLoadBuffer(BufferReader & reader)
 	{
 		// get the headers
-		MidiChunk header_chunk = ReadHeaderChunk(reader);
-		if (header_chunk == nullptr)
+		MidiChunk header_chunk;
+		if (!ReadChunk(reader, header_chunk) || !header_chunk.IsHeaderChunk())
 			return false;
-
 		if (!GetHeaderFromChunk(header_chunk, header))
 			return false;
-		// read the tracks
-		size_t track_found = 0;
 
-		MidiChunk data_chunk = ReadChunk(reader);
-		while (data_chunk.data != nullptr)
+		// read the tracks
+		tracks.reserve(size_t(header.track_count));
+		while (tracks.size() < size_t(header.track_count))
 		{
+			MidiChunk data_chunk;
+			if (!ReadChunk(reader, data_chunk))
+				return false;
 			// don't know how to handle NON-TRACK chunk
 			if (!data_chunk.IsTrackChunk())
 				continue;
-			// do we already have read all expected track chunk
-			if (track_found == header.track_count)
-				continue;
 
 			// create a track from the chunk
 			std::unique_ptr<MidiTrack> new_track(new MidiTrack());
-			if (new_track != nullptr)
-			{
-				if (!InitializeTrackFromChunk(new_track.get(), data_chunk))
-					return false;
-				tracks.push_back(std::move(new_track));
-			}
-
-			// update counts
-			++track_found;
+			if (!InitializeTrackFromChunk(new_track.get(), data_chunk))
+				return false;
+			tracks.push_back(std::move(new_track));
 		}
-
-		return (track_found == header.track_count); // all expected tracks read
+		return true;
 	}
 
 	bool MidiLoader::GetHeaderFromChunk(MidiChunk const & chunk, MidiHeader & result)
 	{
-		BufferReader reader(chunk);
-		reader.Read(result.format);
-		reader.Read(result.track_count);
-		reader.Read(result.division);
-		result.format = EndianTools::BigEndianToHost(result.format);
-		result.track_count = EndianTools::BigEndianToHost(result.track_count);
-		result.division = EndianTools::BigEndianToHost(result.division);
+		BufferReader reader = chunk.content;
+		if (!reader.ReadBigEndian(result.format) || !reader.ReadBigEndian(result.track_count) || !reader.ReadBigEndian(result.division))
+			return false;
 		return result.IsValid();
 	}
-}; // namespace chaos
+}; // namespace chaos
\ No newline at end of file
@@ -118,6 +118,183 @@ namespace chaos
 
 	char const* DefaultScreenSpaceProgramGenerator::fragment_shader_source = DefaultParticleProgramSource::fragment_shader_source;
 
+	/*
+	 * DefaultParticleComputeProgramSource implementation
+	 */
+
+	void DefaultParticleComputeProgramSource::GetSources(GPUProgramGenerator& program_generator)
+	{
+		program_generator.AddShaderSource(ShaderType::Vertex, particle_buffer_source);
+		program_generator.AddShaderSource(ShaderType::Vertex, vertex_shader_source);
+		program_generator.AddShaderSource(ShaderType::Fragment, fragment_shader_source);
+	}
+
+	char const* DefaultParticleComputeProgramSource::particle_buffer_source = R"SHARED_SHADER(
+		struct ParticleCompute
+		{
+			vec2  position;
+			vec2  velocity;
+			vec2  half_size;
+			float rotation;
+			float lifetime;
+			vec4  color;
+			vec4  texcoords; // bottomleft.xy, topright.xy
+			int   bitmap_index;
+			int   flags;
+			float remaining_time;
+			int   alive;
+		};
+
+		layout(std430, binding = 0) buffer ParticleBuffer
+		{
+			ParticleCompute particles[];
+		};
+		)SHARED_SHADER";
+
+	char const* DefaultParticleComputeProgramSource::update_shader_source = R"COMPUTE_SHADER(
+		layout(local_size_x = 64) in;
+
+		uniform float delta_time;
+		uniform uint  particle_count;
+
+		void main()
+		{
+			uint index = gl_GlobalInvocationID.x;
+			if (index >= particle_count || particles[index].alive == 0)
+				return;
+
+			ParticleCompute particle = particles[index];
+			if (UpdateParticle(particle, delta_time))
+				particle.alive = 0;
+			particles[index] = particle;
+		}
+		)COMPUTE_SHADER";
+
+	char const* DefaultParticleComputeProgramSource::vertex_shader_source = R"VERTEX_SHADER(
+		out vec2 vs_position;
+		out vec3 vs_texcoord;
+		out vec4 vs_color;
+		out flat int vs_flags;
+
+		uniform mat4 local_to_camera;
+		uniform mat4 projection_matrix;
+
+		uniform sampler2DArray material; // texture required in VS for Half pixel correction
+
+		void main()
+		{
+			// 2 triangles per particle (BL, BR, TR) + (BL, TR, TL)
+			const int corner_indices[6] = { 0, 1, 2, 0, 2, 3 };
+			const vec2 corner_offsets[4] = { vec2(-1.0, -1.0), vec2(+1.0, -1.0), vec2(+1.0, +1.0), vec2(-1.0, +1.0) };
+			const int corner_flags[4] = { BOTTOM_LEFT, BOTTOM_RIGHT, TOP_RIGHT, TOP_LEFT };
+
+			ParticleCompute particle = particles[gl_VertexID / 6];
+			int corner = corner_indices[gl_VertexID % 6];
+
+			// destroyed particle => degenerated triangle
+			if (particle.alive == 0)
+			{
+				gl_Position = vec4(0.0, 0.0, 0.0, 0.0);
+				return;
+			}
+
+			vec2 offset = corner_offsets[corner] * particle.half_size;
+			float c = cos(particle.rotation);
+			float s = sin(particle.rotation);
+			vec2 position = particle.position + vec2(c * offset.x - s * offset.y, s * offset.x + c * offset.y);
+
+			int flags = corner_flags[corner] | (particle.flags & EIGHT_BITS_MODE);
+
+			vec3 texcoord;
+			texcoord.x = (corner == 0 || corner == 3)? particle.texcoords.x : particle.texcoords.z;
+			texcoord.y = (corner == 0 || corner == 1)? particle.texcoords.y : particle.texcoords.w;
+			texcoord.z = float(particle.bitmap_index);
+			if (particle.bitmap_index >= 0)
+				texcoord = HalfPixelCorrection(texcoord, flags, material);
+
+			vs_position = position;
+			vs_texcoord = texcoord;
+			vs_flags    = ExtractFragmentFlags(flags);
+			vs_color    = particle.color;
+
+			gl_Position = projection_matrix * local_to_camera * vec4(position.x, position.y, 0.0, 1.0);
+		}
+		)VERTEX_SHADER";
+
+	char const* DefaultParticleComputeProgramSource::fragment_shader_source = DefaultParticleProgramSource::fragment_shader_source;
+
+	/*
+	 * DefaultParticleInstanceProgramSource implementation
+	 */
+
+	void DefaultParticleInstanceProgramSource::GetSources(GPUProgramGenerator& program_generator)
+	{
+		program_generator.AddShaderSource(ShaderType::Vertex, vertex_shader_source);
+		program_generator.AddShaderSource(ShaderType::Fragment, fragment_shader_source);
+	}
+
+	char const* DefaultParticleInstanceProgramSource::vertex_shader_source = R"VERTEX_SHADER(
+		in vec2  position;
+		in vec2  half_size;
+		in vec4  texcoord; // bottomleft.xy, topright.zw
+		in vec4  color;
+		in float rotation;
+		in int   bitmap_index;
+		in int   flags;
+
+		out vec2 vs_position;
+		out vec3 vs_texcoord;
+		out vec4 vs_color;
+		out flat int vs_flags;
+
+		uniform mat4 local_to_camera;
+		uniform mat4 projection_matrix;
+
+		uniform sampler2DArray material; // texture required in VS for Half pixel correction
+
+		void main()
+		{
+			// 2 triangles per instance (BL, BR, TR) + (BL, TR, TL)
+			const int corner_indices[6] = { 0, 1, 2, 0, 2, 3 };
+			const vec2 corner_offsets[4] = { vec2(-1.0, -1.0), vec2(+1.0, -1.0), vec2(+1.0, +1.0), vec2(-1.0, +1.0) };
+			const int corner_flags[4] = { BOTTOM_LEFT, BOTTOM_RIGHT, TOP_RIGHT, TOP_LEFT };
+
+			int corner = corner_indices[gl_VertexID % 6];
+
+			vec2 offset = corner_offsets[corner] * half_size;
+			float c = cos(rotation);
+			float s = sin(rotation);
+			vec2 vertex_position = position + vec2(c * offset.x - s * offset.y, s * offset.x + c * offset.y);
+
+			// texture symetries (same as GenerateVertexTextureAttributes(...))
+			int texture_corner = corner;
+			if ((flags & 2) != 0) // TEXTURE_VERTICAL_FLIP
+				texture_corner = 3 - texture_corner;
+			if ((flags & 1) != 0) // TEXTURE_HORIZONTAL_FLIP
+				texture_corner = texture_corner ^ 1;
+			if ((flags & 4) != 0 && (texture_corner & 1) == 0) // TEXTURE_DIAGONAL_FLIP
+				texture_corner = 2 - texture_corner;
+
+			int vertex_flags = corner_flags[corner] | (flags & EIGHT_BITS_MODE);
+
+			vec3 vertex_texcoord;
+			vertex_texcoord.x = (texture_corner == 0 || texture_corner == 3)? texcoord.x : texcoord.z;
+			vertex_texcoord.y = (texture_corner == 0 || texture_corner == 1)? texcoord.y : texcoord.w;
+			vertex_texcoord.z = float(bitmap_index);
+			if (bitmap_index >= 0)
+				vertex_texcoord = HalfPixelCorrection(vertex_texcoord, vertex_flags, material);
+
+			vs_position = vertex_position;
+			vs_texcoord = vertex_texcoord;
+			vs_flags    = ExtractFragmentFlags(vertex_flags);
+			vs_color    = color;
+
+			gl_Position = projection_matrix * local_to_camera * vec4(vertex_position.x, vertex_position.y, 0.0, 1.0);
+		}
+		)VERTEX_SHADER";
+
+	char const* DefaultParticleInstanceProgramSource::fragment_shader_source = DefaultParticleProgramSource::fragment_shader_source;
+
 
 }; // namespace chaos
 
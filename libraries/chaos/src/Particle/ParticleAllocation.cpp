@@ -31,6 +31,7 @@ namespace chaos
 	{
 		if (layer == nullptr)
 			return;
+		layer->require_broadphase_update = true; // invisible particles still collide
 		if (skip_if_invisible && !IsVisible())
 			return;
 		if (skip_if_empty && GetParticleCount() == 0)
@@ -38,6 +39,19 @@ namespace chaos
 		layer->require_GPU_update = true;
 	}
 
+	void ParticleAllocationBase::ResetAllocationState()
+	{
+		paused = false;
+		visible = true;
+		destroy_when_empty = false;
+		layer_handle = {};
+	}
+
+	bool ParticleAllocationBase::IsRecyclable() const
+	{
+		return (shared_count == 1 && weak_ptr_data == nullptr); // a weak pointer must not see the object alive again
+	}
+
 	bool ParticleAllocationBase::IsAttachedToLayer() const
 	{
 		return (layer != nullptr);
@@ -0,0 +1,114 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	ParticleBroadphase::ParticleBroadphase(float in_cell_size)
+	{
+		SetCellSize(in_cell_size);
+	}
+
+	void ParticleBroadphase::SetCellSize(float in_cell_size)
+	{
+		assert(in_cell_size > 0.0f);
+		if (cell_size != in_cell_size)
+		{
+			cell_size = in_cell_size;
+			Clear();
+		}
+	}
+
+	void ParticleBroadphase::Clear()
+	{
+		entries.clear();
+		entry_min_cells.clear();
+		cells.clear();
+		oversized_entries.clear();
+		grid_min_cell = cell_coord(std::numeric_limits<int>::max());
+		grid_max_cell = cell_coord(std::numeric_limits<int>::min());
+	}
+
+	void ParticleBroadphase::GetCellRange(box2 const& box, cell_coord& min_cell, cell_coord& max_cell) const
+	{
+		glm::vec2 corner_min = box.position - box.half_size;
+		glm::vec2 corner_max = box.position + box.half_size;
+
+		// clamp before the conversion: huge (or infinite) boxes must not overflow
+		float const limit = float(MAX_CELL_COORD);
+		min_cell = cell_coord(glm::clamp(glm::floor(corner_min / cell_size), -limit, limit));
+		max_cell = cell_coord(glm::clamp(glm::floor(corner_max / cell_size), -limit, limit));
+	}
+
+	bool ParticleBroadphase::Build(ParticleLayerBase const* layer)
+	{
+		CHAOS_PROFILE_ZONE("ParticleBroadphase::Build");
+
+		assert(layer != nullptr);
+
+		Clear();
+
+		if (!layer->IsParticleClassCompatible<ParticleDefault>())
+		{
+			ParticleLog::Error("ParticleBroadphase::Build: the particles of the layer do not inherit ParticleDefault");
+			return false;
+		}
+
+		// collect the bounding boxes
+		entries.reserve(layer->GetParticleCount());
+
+		size_t allocation_count = layer->GetAllocationCount();
+		for (size_t i = 0; i < allocation_count; ++i)
+		{
+			ParticleAllocationBase const* allocation = layer->GetAllocation(i);
+
+			ParticleConstAccessor<ParticleDefault> accessor = allocation->GetParticleConstAccessor<ParticleDefault>();
+			size_t count = accessor.GetDataCount();
+			for (size_t j = 0; j < count; ++j)
+			{
+				ParticleDefault const& particle = accessor[j];
+				if (IsGeometryEmpty(particle.bounding_box))
+					continue;
+				entries.push_back({ particle.bounding_box, { allocation->GetLayerHandle(), uint32_t(j) } });
+			}
+		}
+
+		// insert the entries in the cells they overlap
+		entry_min_cells.reserve(entries.size());
+		cells.reserve(entries.size() * 2);
+
+		for (uint32_t entry_index = 0; entry_index < uint32_t(entries.size()); ++entry_index)
+		{
+			cell_coord min_cell, max_cell;
+			GetCellRange(entries[entry_index].bounding_box, min_cell, max_cell);
+			entry_min_cells.push_back(min_cell);
+
+			cell_coord cell_count = max_cell - min_cell + cell_coord(1, 1);
+			if (int64_t(cell_count.x) * int64_t(cell_count.y) > MAX_CELLS_PER_ENTRY)
+			{
+				oversized_entries.push_back(entry_index);
+				continue;
+			}
+			grid_min_cell = glm::min(grid_min_cell, min_cell);
+			grid_max_cell = glm::max(grid_max_cell, max_cell);
+
+			for (int x = min_cell.x; x <= max_cell.x; ++x)
+				for (int y = min_cell.y; y <= max_cell.y; ++y)
+					cells.emplace_back(GetCellKey({ x, y }), entry_index);
+		}
+
+		std::sort(cells.begin(), cells.end());
+
+		return true;
+	}
+
+	size_t ParticleBroadphase::Query(box2 const& box, std::vector<ParticleBroadphaseHandle>& result) const
+	{
+		size_t initial_size = result.size();
+		ForEachCollision(box, [&result](ParticleBroadphaseEntry const& entry)
+		{
+			result.push_back(entry.handle);
+		});
+		return result.size() - initial_size;
+	}
+
+}; // namespace chaos
\ No newline at end of file
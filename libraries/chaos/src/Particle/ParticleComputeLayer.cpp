@@ -0,0 +1,254 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// ==============================================================
+	// ParticleComputeDefaultLayerTrait
+	// ==============================================================
+
+	char const* ParticleComputeDefaultLayerTrait::GetUpdateKernelSource() const
+	{
+		return R"COMPUTE_SHADER(
+		uniform vec2 acceleration;
+
+		bool UpdateParticle(inout ParticleCompute particle, float delta_time)
+		{
+			particle.velocity += acceleration * delta_time;
+			particle.position += particle.velocity * delta_time;
+			if (particle.lifetime > 0.0)
+			{
+				particle.remaining_time -= delta_time;
+				if (particle.remaining_time <= 0.0)
+					return true;
+			}
+			return false;
+		}
+		)COMPUTE_SHADER";
+	}
+
+	void ParticleComputeDefaultLayerTrait::AddKernelUniforms(GPUProgramProvider& uniform_provider) const
+	{
+		uniform_provider.AddVariable("acceleration", acceleration);
+	}
+
+	// ==============================================================
+	// ParticleComputeLayerBase
+	// ==============================================================
+
+	ParticleComputeLayerBase::ParticleComputeLayerBase(size_t in_max_particle_count):
+		max_particle_count(std::max(in_max_particle_count, size_t(1)))
+	{
+	}
+
+	size_t ParticleComputeLayerBase::GetParticleCount() const
+	{
+		return std::min(emitted_count, max_particle_count);
+	}
+
+	Class const* ParticleComputeLayerBase::GetParticleClass() const
+	{
+		return ClassManager::GetDefaultInstance()->FindCPPClass<ParticleCompute>();
+	}
+
+	GPUVertexDeclaration* ParticleComputeLayerBase::GetVertexDeclaration() const
+	{
+		return new GPUVertexDeclaration;
+	}
+
+	std::span<ParticleCompute> ParticleComputeLayerBase::EmitParticles(size_t count)
+	{
+		size_t previous_count = pending_particles.size();
+		pending_particles.resize(previous_count + count);
+		emitted_count += count;
+		return { pending_particles.data() + previous_count, count };
+	}
+
+	void ParticleComputeLayerBase::ClearParticles()
+	{
+		pending_particles.clear();
+		emitted_count = 0;
+		clear_requested = true;
+	}
+
+	bool ParticleComputeLayerBase::DoTick(float delta_time)
+	{
+		// the simulation is done at next GPU update
+		if (AreParticlesDynamic())
+			pending_delta_time += delta_time;
+		return true;
+	}
+
+	bool ParticleComputeLayerBase::DoUpdateGPUResources(GPURenderContext* render_context)
+	{
+		if (!CreateGPUResources(render_context))
+			return false;
+		// update the particles that are already in GPU memory ...
+		if (pending_delta_time > 0.0f)
+		{
+			DispatchUpdate(render_context, pending_delta_time);
+			pending_delta_time = 0.0f;
+		}
+		// ... then add the new ones
+		UploadEmittedParticles(render_context);
+		return true;
+	}
+
+	bool ParticleComputeLayerBase::CreateGPUResources(GPURenderContext* render_context)
+	{
+		// the (empty) vertex declaration
+		if (vertex_declaration == nullptr)
+		{
+			vertex_declaration = GetVertexDeclaration();
+			if (vertex_declaration == nullptr)
+				return false;
+		}
+		// the storage buffer (all slots are initialized with dead particles)
+		if (particle_buffer == nullptr)
+		{
+			particle_buffer = render_context->GetGPUDevice()->CreateBuffer(max_particle_count * sizeof(ParticleCompute), GPUBufferFlags::Dynamic);
+			if (particle_buffer == nullptr)
+			{
+				ParticleLog::Error("ParticleComputeLayerBase::CreateGPUResources: fails to create the particle buffer");
+				return false;
+			}
+			glClearNamedBufferData(particle_buffer->GetResourceID(), GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+			clear_requested = false;
+		}
+		// the update program
+		if (update_program == nullptr && !update_program_failure)
+		{
+			char const* kernel_source = GetUpdateKernelSource();
+			if (kernel_source != nullptr)
+			{
+				GPUProgramGenerator program_generator;
+				program_generator.AddShaderSource(ShaderType::Compute, DefaultParticleComputeProgramSource::particle_buffer_source);
+				program_generator.AddShaderSource(ShaderType::Compute, kernel_source);
+				program_generator.AddShaderSource(ShaderType::Compute, DefaultParticleComputeProgramSource::update_shader_source);
+				update_program = program_generator.GenProgramObject();
+			}
+			if (update_program == nullptr)
+			{
+				ParticleLog::Error("ParticleComputeLayerBase::CreateGPUResources: fails to generate the update program");
+				update_program_failure = true;
+			}
+		}
+		return true;
+	}
+
+	void ParticleComputeLayerBase::DispatchUpdate(GPURenderContext* render_context, float delta_time)
+	{
+		CHAOS_PROFILE_ZONE("ParticleComputeLayer::DispatchUpdate");
+		CHAOS_GPU_PROFILE_ZONE(render_context, "ParticleComputeLayer::DispatchUpdate");
+
+		size_t particle_count = GetParticleCount();
+		if (update_program == nullptr || particle_count == 0)
+			return;
+
+		DisableReferenceCount<GPUProgramProvider> uniform_provider;  // while on stack, use DisableReferenceCount<...>
+		uniform_provider.AddVariable("delta_time", delta_time);
+		uniform_provider.AddVariable("particle_count", GLuint(particle_count));
+		AddKernelUniforms(uniform_provider);
+
+		if (update_program->UseProgram(&uniform_provider))
+		{
+			GLuint group_count = GLuint((particle_count + 63) / 64); // local_size_x = 64
+
+			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, particle_buffer->GetResourceID());
+			glDispatchCompute(group_count, 1, 1);
+			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+			// the results are read by the vertex shader
+			glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+		}
+		glUseProgram(0);
+	}
+
+	void ParticleComputeLayerBase::UploadEmittedParticles(GPURenderContext* render_context)
+	{
+		// kill all particles
+		if (clear_requested)
+		{
+			glClearNamedBufferData(particle_buffer->GetResourceID(), GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+			clear_requested = false;
+		}
+
+		size_t count = pending_particles.size();
+		if (count == 0)
+			return;
+
+		// the particles whose remaining_time has not been set start with their whole lifetime
+		for (ParticleCompute& particle : pending_particles)
+			if (particle.remaining_time < 0.0f)
+				particle.remaining_time = particle.lifetime;
+
+		// only the last particles survive when more than the capacity has been emitted
+		ParticleCompute const* particles = pending_particles.data();
+		size_t first_index = emitted_count - count;
+		if (count > max_particle_count)
+		{
+			particles += count - max_particle_count;
+			first_index += count - max_particle_count;
+			count = max_particle_count;
+		}
+
+		// copy into the ring buffer (in 2 parts whenever the end of the buffer is reached)
+		size_t first_slot = first_index % max_particle_count;
+		size_t first_part_count = std::min(count, max_particle_count - first_slot);
+
+		particle_buffer->SetBufferData(particles, first_slot * sizeof(ParticleCompute), first_part_count * sizeof(ParticleCompute));
+		if (count > first_part_count)
+			particle_buffer->SetBufferData(particles + first_part_count, 0, (count - first_part_count) * sizeof(ParticleCompute));
+
+		pending_particles.clear();
+	}
+
+	int ParticleComputeLayerBase::DoDisplay(GPURenderContext* render_context, GPUProgramProviderInterface const* uniform_provider, GPURenderParams const& render_params)
+	{
+		// early exit
+		size_t particle_count = GetParticleCount();
+		if (particle_buffer == nullptr || particle_count == 0)
+			return 0;
+		// search the material (the default one reads the particles from the storage buffer)
+		GPURenderMaterial const* default_material = (render_material != nullptr) ? render_material.get() : DefaultParticleComputeProgram::GetMaterial();
+		GPURenderMaterial const* final_material = render_params.GetMaterial(this, default_material);
+		if (final_material == nullptr)
+			return 0;
+		// prepare rendering state
+		UpdateRenderingStates(render_context, true);
+
+		int result = 0;
+
+		// update uniform provider with atlas
+		GPUProgramProviderChain main_uniform_provider(uniform_provider);
+		if (atlas != nullptr)
+			main_uniform_provider.AddTexture("material", atlas->GetTexture());
+
+		GPUProgram const* program = final_material->UseMaterial(&main_uniform_provider, render_params);
+		if (program != nullptr)
+		{
+			// no vertex buffer: the vertex shader reads the storage buffer
+			GPUVertexArrayBindingInfo binding_info;
+			binding_info.program = program;
+			binding_info.vertex_declaration = vertex_declaration.get();
+
+			if (render_context->BindVertexArray(binding_info))
+			{
+				GPUDrawPrimitive primitive;
+				primitive.primitive_type = GL_TRIANGLES;
+				primitive.count = int(particle_count * 6);
+
+				glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, particle_buffer->GetResourceID());
+				render_context->Draw(primitive);
+				glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+
+				render_context->UnbindVertexArray();
+				result = 1;
+			}
+			glUseProgram(0);
+		}
+		// restore rendering states
+		UpdateRenderingStates(render_context, false);
+		return result;
+	}
+
+}; // namespace chaos
\ No newline at end of file
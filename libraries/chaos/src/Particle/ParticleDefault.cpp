@@ -74,5 +74,29 @@ namespace chaos
 		result->Push(VertexAttributeSemantic::None, -1, VertexAttributeType::Int1, "flags");
 	}
 
+	void GetTypedVertexDeclaration(GPUVertexDeclaration* result, boost::mpl::identity<QuadInstanceDefault>)
+	{
+		result->Push(VertexAttributeSemantic::Position, 0, VertexAttributeType::Float2, "position");
+		result->Push(VertexAttributeSemantic::None, -1, VertexAttributeType::Float2, "half_size");
+		result->Push(VertexAttributeSemantic::Texcoord, 0, VertexAttributeType::Float4, "texcoord");
+		result->Push(VertexAttributeSemantic::Color, 0, VertexAttributeType::Float4, "color");
+		result->Push(VertexAttributeSemantic::None, -1, VertexAttributeType::Float1, "rotation");
+		result->Push(VertexAttributeSemantic::None, -1, VertexAttributeType::Int1, "bitmap_index");
+		result->Push(VertexAttributeSemantic::None, -1, VertexAttributeType::Int1, "flags");
+		result->SetPerInstance(true);
+	}
+
+	void ParticleToPrimitives(ParticleDefault const& particle, GPUPrimitiveOutput<QuadInstanceDefault>& output)
+	{
+		QuadInstanceDefault& instance = output.AddInstancedQuads()[0];
+		instance.position = particle.bounding_box.position;
+		instance.half_size = particle.bounding_box.half_size;
+		instance.texcoord = { particle.texcoords.bottomleft, particle.texcoords.topright };
+		instance.color = particle.color;
+		instance.rotation = particle.rotation;
+		instance.bitmap_index = particle.texcoords.bitmap_index;
+		instance.flags = particle.flags;
+	}
+
 }; // namespace chaos
 
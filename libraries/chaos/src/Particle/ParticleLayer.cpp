@@ -5,6 +5,7 @@ namespace chaos
 {
 	ParticleLayerBase::~ParticleLayerBase()
 	{
+		max_recycled_allocation_count = 0; // no need to recycle
 		DetachAllParticleAllocations();
 	}
 
@@ -19,30 +20,76 @@ namespace chaos
 	{
 		assert(allocation != nullptr);
 		assert(allocation->layer == this);
+		assert(particles_allocations.Contains(allocation->layer_handle));
 
-		for (size_t i = particles_allocations.size(); i > 0; --i) // from end to beginning because DetachAllParticleAllocations(...) is from end to the beginning => make the code much faster
-		{
-			size_t index = i - 1;
+		allocation->OnRemovedFromLayer();
 
-			if (particles_allocations[index] == allocation)
-			{
-				allocation->OnRemovedFromLayer();
-				particles_allocations.erase(particles_allocations.begin() + index);
-				return;
-			}
+		// keep the order of the allocations (the rendering order, and SpawnParticles(...) reuses the first one)
+		std::optional<shared_ptr<ParticleAllocationBase>> removed_allocation = particles_allocations.RemoveOrdered(allocation->layer_handle);
+		allocation->layer_handle = {};
+
+		// keep the object for a further spawn whenever the layer owns the last reference
+		if (removed_allocation.has_value() && recycled_allocations.size() < max_recycled_allocation_count)
+			if (allocation->IsRecyclable() && allocation->Recycle())
+				recycled_allocations.push_back(std::move(*removed_allocation));
+	}
+
+	shared_ptr<ParticleAllocationBase> ParticleLayerBase::CreateParticleAllocation()
+	{
+		if (recycled_allocations.size() > 0)
+		{
+			shared_ptr<ParticleAllocationBase> result = std::move(recycled_allocations.back());
+			recycled_allocations.pop_back();
+			result->layer = this;
+			return result;
 		}
+		return DoCreateParticleAllocation();
 	}
 
 	bool ParticleLayerBase::DoTick(float delta_time)
 	{
 		// update the particles themselves
 		if (AreParticlesDynamic())
-			require_GPU_update |= TickAllocations(delta_time);
+		{
+			if (TickAllocations(delta_time))
+			{
+				require_GPU_update = true;
+				require_broadphase_update = true;
+			}
+		}
 		return true;
 	}
 
+	void ParticleLayerBase::EnableBroadphase(float cell_size)
+	{
+		if (broadphase == nullptr)
+			broadphase = std::make_unique<ParticleBroadphase>(cell_size);
+		else
+			broadphase->SetCellSize(cell_size);
+		require_broadphase_update = true;
+	}
+
+	void ParticleLayerBase::DisableBroadphase()
+	{
+		broadphase = nullptr;
+	}
+
+	ParticleBroadphase const* ParticleLayerBase::GetBroadphase()
+	{
+		if (broadphase == nullptr)
+			return nullptr;
+		if (require_broadphase_update)
+		{
+			broadphase->Build(this);
+			require_broadphase_update = false;
+		}
+		return broadphase.get();
+	}
+
 	bool ParticleLayerBase::TickAllocations(float delta_time)
 	{
+		CHAOS_PROFILE_ZONE("ParticleLayer::TickAllocations");
+
 		bool result = false;
 
 		// store allocations that want to be notified of their emptyness here,
@@ -87,10 +134,11 @@ namespace chaos
 		// create an allocation is mandatory
 		if (new_allocation || particles_allocations.size() == 0)
 		{
-			allocation = DoCreateParticleAllocation();
-			if (allocation == nullptr)
+			shared_ptr<ParticleAllocationBase> created_allocation = CreateParticleAllocation();
+			if (created_allocation == nullptr)
 				return nullptr;
-			particles_allocations.push_back(allocation); // register the allocation
+			allocation = created_allocation.get();
+			allocation->layer_handle = particles_allocations.Insert(std::move(created_allocation)); // register the allocation
 		}
 		// get the very first allocation
 		else
@@ -140,7 +188,9 @@ namespace chaos
         size_t result = GetDynamicMeshVertexCount(in_mesh);
         if (result == 0) // happens whenever the mesh is empty (first call for example)
         {
-            result = GetParticleCount() * 4; // XXX : by default, suppose the particles will be rendered has quads
+            // XXX : by default, suppose the particles will be rendered has quads (or as one instance per particle)
+            bool per_instance = (vertex_declaration != nullptr && vertex_declaration->IsPerInstance());
+            result = GetParticleCount() * (per_instance? 1 : 4);
         }
         return result;
     }
@@ -245,6 +295,27 @@ namespace chaos
 		return particles_allocations[index].get();
 	}
 
+	ParticleAllocationBase* ParticleLayerBase::FindAllocation(SlotMapHandle handle)
+	{
+		if (shared_ptr<ParticleAllocationBase>* result = particles_allocations.Find(handle))
+			return result->get();
+		return nullptr;
+	}
+
+	ParticleAllocationBase const* ParticleLayerBase::FindAllocation(SlotMapHandle handle) const
+	{
+		if (shared_ptr<ParticleAllocationBase> const* result = particles_allocations.Find(handle))
+			return result->get();
+		return nullptr;
+	}
+
+	void ParticleLayerBase::SetMaxRecycledAllocationCount(size_t in_count)
+	{
+		max_recycled_allocation_count = in_count;
+		if (recycled_allocations.size() > in_count)
+			recycled_allocations.resize(in_count);
+	}
+
 	void ParticleLayerBase::ClearAllAllocations()
 	{
 		size_t count = particles_allocations.size();
@@ -262,7 +333,7 @@ namespace chaos
 			{
 				GPUMeshElement const& element = in_mesh->GetMeshElement(i);
 				for (GPUDrawPrimitive const& primitive : element.primitives)
-					result += primitive.count;
+					result += (primitive.instancing.instance_count > 0)? primitive.instancing.instance_count : primitive.count;
 			}
 		}
         return result;
@@ -0,0 +1,438 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	namespace TiledMap
+	{
+		static_assert(std::is_trivially_copyable_v<Tile>); // tiles are read/written as raw arrays
+
+		// ==========================================
+		// BakedMapHeader
+		// ==========================================
+
+		class BakedMapHeader
+		{
+		public:
+
+			/** the magic number */
+			char magic[4] = { 'C', 'T', 'M', 'B' };
+			/** the version of the format */
+			uint32_t version = BakedMap::FORMAT_VERSION;
+			/** the number of files the map depends on */
+			uint32_t dependency_count = 0;
+			/** the size of the XML document */
+			uint32_t xml_size = 0;
+			/** the number of property blocks */
+			uint32_t property_block_count = 0;
+			/** the number of tile layers */
+			uint32_t tile_layer_count = 0;
+		};
+
+		// ==========================================
+		// Utility functions
+		// ==========================================
+
+		/** get the size and the write time of a file (with redirection) */
+		static bool GetBakedFileStamp(boost::filesystem::path const& path, uint64_t& file_size, int64_t& write_time)
+		{
+			return FileTools::WithFile(path, [&file_size, &write_time](boost::filesystem::path const& p)
+			{
+				boost::system::error_code error;
+				file_size = uint64_t(boost::filesystem::file_size(p, error));
+				if (error)
+					return false;
+				write_time = int64_t(boost::filesystem::last_write_time(p, error));
+				if (error)
+					return false;
+				return true;
+			});
+		}
+
+		/** collect all tile layers (recursively through groups) */
+		static void CollectBakedTileLayers(std::vector<shared_ptr<LayerBase>> const& layers, std::vector<TileLayer const*>& result)
+		{
+			for (shared_ptr<LayerBase> const& layer : layers)
+			{
+				if (TileLayer const* tile_layer = auto_cast(layer.get()))
+					result.push_back(tile_layer);
+				else if (GroupLayer const* group_layer = auto_cast(layer.get()))
+					CollectBakedTileLayers(group_layer->layers, result);
+			}
+		}
+
+		/** remove the tile content of all tile layers (recursively through groups) */
+		static void StripBakedTileLayerData(tinyxml2::XMLElement* element)
+		{
+			for (tinyxml2::XMLElement* child = element->FirstChildElement(); child != nullptr; child = child->NextSiblingElement())
+			{
+				if (StringTools::Stricmp(child->Name(), "layer") == 0)
+				{
+					if (tinyxml2::XMLElement* data = child->FirstChildElement("data"))
+						data->DeleteChildren(); // text for non infinite layers, chunks for infinite layers
+				}
+				else if (StringTools::Stricmp(child->Name(), "group") == 0)
+				{
+					StripBakedTileLayerData(child);
+				}
+			}
+		}
+
+		/** replace the <properties> elements with an index into the typed property blocks (recursively) */
+		static void StripBakedProperties(tinyxml2::XMLElement* element, std::vector<std::vector<shared_ptr<Property>>>& property_blocks)
+		{
+			if (tinyxml2::XMLElement* properties_element = element->FirstChildElement("properties"))
+			{
+				// decode the properties the same way than a TMX loading
+				shared_ptr<PropertyOwner> property_owner = new PropertyOwner(nullptr);
+				property_owner->DoLoadProperties(properties_element);
+
+				element->SetAttribute("baked_properties", int(property_blocks.size()));
+				element->DeleteChild(properties_element);
+				property_blocks.push_back(std::move(property_owner->properties));
+			}
+			for (tinyxml2::XMLElement* child = element->FirstChildElement(); child != nullptr; child = child->NextSiblingElement())
+				StripBakedProperties(child, property_blocks);
+		}
+
+		/** write a string with its size */
+		static void WriteBakedString(SparseWriteBuffer<>& writer, std::string const& str)
+		{
+			writer.Write(uint32_t(str.length()));
+			if (str.length() > 0)
+				writer.Write(str.c_str(), str.length());
+		}
+
+		/** read a string with its size */
+		static bool ReadBakedString(BufferReader& reader, std::string& result)
+		{
+			uint32_t size = 0;
+			BufferReader string_reader;
+			if (!reader.Read(size) || !reader.ReadSubReader(size, string_reader))
+				return false;
+			result.assign(string_reader.GetCurrentPosition(), size);
+			return true;
+		}
+
+		// ==========================================
+		// BakedMap methods
+		// ==========================================
+
+		boost::filesystem::path BakedMap::GetBakedPath(boost::filesystem::path const& map_path)
+		{
+			boost::filesystem::path result = map_path;
+			result.replace_extension(".tmb");
+			return result;
+		}
+
+		BakedTileLayer* BakedMap::FindTileLayer(int layer_id)
+		{
+			for (BakedTileLayer& layer : tile_layers)
+				if (layer.layer_id == layer_id)
+					return &layer;
+			return nullptr;
+		}
+
+		bool BakedMap::CreateProperties(int block_index, PropertyOwner* owner) const
+		{
+			assert(owner != nullptr);
+
+			if (block_index < 0 || size_t(block_index) >= property_blocks.size())
+			{
+				TiledMapLog::Error("BakedMap::CreateProperties: invalid property block %d", block_index);
+				return false;
+			}
+			for (BakedProperty const& property : property_blocks[size_t(block_index)])
+			{
+				char const* name = property.name.c_str();
+				if (property.type == PropertyType::Int)
+					owner->CreatePropertyInt(name, property.int_value);
+				else if (property.type == PropertyType::Float)
+					owner->CreatePropertyFloat(name, property.float_value);
+				else if (property.type == PropertyType::Bool)
+					owner->CreatePropertyBool(name, property.int_value != 0);
+				else if (property.type == PropertyType::String)
+					owner->CreatePropertyString(name, property.string_value.c_str());
+				else if (property.type == PropertyType::Color)
+					owner->CreatePropertyColor(name, property.color_value);
+				else if (property.type == PropertyType::Object)
+					owner->CreatePropertyObject(name, property.int_value);
+			}
+			return true;
+		}
+
+		bool BakedMap::Load(FilePathParam const& map_path)
+		{
+			boost::filesystem::path const& resolved_map_path = map_path.GetResolvedPath();
+			boost::filesystem::path map_directory = resolved_map_path.parent_path();
+			boost::filesystem::path baked_path = GetBakedPath(resolved_map_path);
+
+			// the content is parsed in place (the file is memory mapped whenever it is not inside an archive)
+			return FileTools::WithFile(baked_path, [this, &map_directory, &baked_path](boost::filesystem::path const& p)
+			{
+				if (FileTools::IsArchivedFile(p))
+				{
+					Buffer<char> buffer = FileTools::LoadFile(p, LoadFileFlag::NoErrorTrace);
+					if (buffer == nullptr)
+						return false;
+					return DoLoad(BufferReader(buffer), map_directory, baked_path);
+				}
+
+				if (!boost::filesystem::is_regular_file(p))
+					return false;
+				shared_ptr<MemoryMappedFile> mapped_file = new MemoryMappedFile;
+				if (!mapped_file->Open(p))
+					return false;
+				return DoLoad(BufferReader(mapped_file->GetData(), mapped_file->GetSize()), map_directory, baked_path);
+			});
+		}
+
+		bool BakedMap::DoLoad(BufferReader reader, boost::filesystem::path const& map_directory, boost::filesystem::path const& baked_path)
+		{
+			// check the header
+			BakedMapHeader header;
+			BakedMapHeader const expected_header;
+			if (!reader.Read(header))
+				return false;
+			if (memcmp(header.magic, expected_header.magic, sizeof(header.magic)) != 0 || header.version != FORMAT_VERSION)
+				return false;
+
+			// check whether a dependency has changed since the bake
+			for (uint32_t i = 0; i < header.dependency_count; ++i)
+			{
+				std::string relative_path;
+				if (!ReadBakedString(reader, relative_path))
+					return false;
+
+				uint64_t file_size = 0;
+				int64_t write_time = 0;
+				if (!reader.Read(file_size) || !reader.Read(write_time))
+					return false;
+
+				uint64_t current_file_size = 0;
+				int64_t current_write_time = 0;
+				if (!GetBakedFileStamp(map_directory / relative_path, current_file_size, current_write_time))
+					return false;
+				if (file_size != current_file_size || write_time != current_write_time)
+				{
+					TiledMapLog::Message("BakedMap::Load: [%s] is stale", baked_path.string().c_str());
+					return false;
+				}
+			}
+
+			// parse the XML document
+			BufferReader xml_reader;
+			if (!reader.ReadSubReader(header.xml_size, xml_reader))
+				return false;
+			doc = std::make_unique<tinyxml2::XMLDocument>();
+			if (doc->Parse(xml_reader.GetCurrentPosition(), header.xml_size) != tinyxml2::XML_SUCCESS)
+				return false;
+
+			// read the properties
+			if (!reader.IsEnoughData(size_t(header.property_block_count) * sizeof(uint32_t))) // do not trust the counts before allocation
+				return false;
+			property_blocks.resize(header.property_block_count);
+			for (std::vector<BakedProperty>& block : property_blocks)
+				if (!DoLoadPropertyBlock(reader, block))
+					return false;
+
+			// read the tiles
+			size_t const chunk_header_size = 2 * sizeof(glm::ivec2) + sizeof(uint32_t);
+			size_t const layer_header_size = sizeof(int32_t) + sizeof(uint32_t);
+
+			if (header.tile_layer_count > reader.GetRemainingSize() / layer_header_size) // do not trust the counts before allocation
+				return false;
+			tile_layers.resize(header.tile_layer_count);
+			for (BakedTileLayer& layer : tile_layers)
+			{
+				int32_t layer_id = 0;
+				uint32_t chunk_count = 0;
+				if (!reader.Read(layer_id) || !reader.Read(chunk_count))
+					return false;
+				if (chunk_count > reader.GetRemainingSize() / chunk_header_size) // do not trust the counts before allocation
+					return false;
+
+				layer.layer_id = layer_id;
+				layer.tile_chunks.resize(chunk_count);
+				for (TileLayerChunk& chunk : layer.tile_chunks)
+				{
+					uint32_t tile_count = 0;
+					if (!reader.Read(chunk.size) || !reader.Read(chunk.offset) || !reader.Read(tile_count))
+						return false;
+					if (tile_count > reader.GetRemainingSize() / sizeof(Tile)) // do not trust the counts before allocation
+						return false;
+					chunk.tile_indices.resize(tile_count);
+					if (tile_count > 0 && !reader.ReadN(chunk.tile_indices.data(), tile_count))
+						return false;
+				}
+			}
+			return true;
+		}
+
+		bool BakedMap::DoLoadPropertyBlock(BufferReader& reader, std::vector<BakedProperty>& result)
+		{
+			size_t const property_min_size = 2 * sizeof(uint32_t) + sizeof(int32_t);
+
+			uint32_t property_count = 0;
+			if (!reader.Read(property_count))
+				return false;
+			if (property_count > reader.GetRemainingSize() / property_min_size) // do not trust the counts before allocation
+				return false;
+
+			result.resize(property_count);
+			for (BakedProperty& property : result)
+			{
+				int32_t type = 0;
+				if (!ReadBakedString(reader, property.name) || !reader.Read(type))
+					return false;
+				property.type = PropertyType(type);
+
+				bool success = false;
+				if (property.type == PropertyType::Int || property.type == PropertyType::Bool || property.type == PropertyType::Object)
+				{
+					int32_t value = 0;
+					success = reader.Read(value);
+					property.int_value = int(value);
+				}
+				else if (property.type == PropertyType::Float)
+					success = reader.Read(property.float_value);
+				else if (property.type == PropertyType::Color)
+					success = reader.Read(property.color_value);
+				else if (property.type == PropertyType::String)
+					success = ReadBakedString(reader, property.string_value);
+				if (!success)
+					return false;
+			}
+			return true;
+		}
+
+		bool BakedMap::Save(Map const* map, tinyxml2::XMLDocument* doc, FilePathParam const& baked_path)
+		{
+			assert(map != nullptr);
+			assert(doc != nullptr);
+
+			boost::filesystem::path map_directory = map->GetPath().parent_path();
+
+			// the files the map depends on
+			std::vector<boost::filesystem::path> dependencies;
+			dependencies.push_back(map->GetPath());
+			for (TileSetData const& data : map->tilesets)
+				if (data.tileset != nullptr && !data.tileset->GetPath().empty()) // embedded tilesets have no path
+					dependencies.push_back(data.tileset->GetPath());
+
+			// the document without the tiles nor the properties
+			std::vector<std::vector<shared_ptr<Property>>> property_blocks;
+			if (tinyxml2::XMLElement* root = doc->RootElement())
+			{
+				StripBakedTileLayerData(root);
+				StripBakedProperties(root, property_blocks);
+			}
+			tinyxml2::XMLPrinter printer(nullptr, true); // compact mode
+			doc->Print(&printer);
+
+			// the tile layers
+			std::vector<TileLayer const*> layers;
+			CollectBakedTileLayers(map->layers, layers);
+
+			std::set<int> layer_ids;
+			for (TileLayer const* layer : layers)
+			{
+				if (!layer_ids.insert(layer->id).second) // layers are matched by ID at loading time (old TMX files have no layer ID)
+				{
+					TiledMapLog::Error("BakedMap::Save: [%s] has several tile layers with ID %d", map->GetPath().string().c_str(), layer->id);
+					return false;
+				}
+			}
+
+			SparseWriteBuffer<> writer(64 * 1024);
+
+			// write the header
+			BakedMapHeader header;
+			header.dependency_count = uint32_t(dependencies.size());
+			header.xml_size = uint32_t(printer.CStrSize() - 1); // CStrSize() counts the null terminator
+			header.property_block_count = uint32_t(property_blocks.size());
+			header.tile_layer_count = uint32_t(layers.size());
+			writer.Write(header);
+
+			// write the dependencies
+			for (boost::filesystem::path const& dependency : dependencies)
+			{
+				uint64_t file_size = 0;
+				int64_t write_time = 0;
+				if (!GetBakedFileStamp(dependency, file_size, write_time))
+				{
+					TiledMapLog::Error("BakedMap::Save: fails to get stamp for [%s]", dependency.string().c_str());
+					return false;
+				}
+				WriteBakedString(writer, dependency.lexically_relative(map_directory).generic_string());
+				writer.Write(file_size);
+				writer.Write(write_time);
+			}
+
+			// write the document
+			if (header.xml_size > 0)
+				writer.Write(printer.CStr(), header.xml_size);
+
+			// write the properties
+			for (std::vector<shared_ptr<Property>> const& block : property_blocks)
+			{
+				writer.Write(uint32_t(block.size()));
+				for (shared_ptr<Property> const& property : block)
+				{
+					WriteBakedString(writer, property->name);
+					writer.Write(int32_t(property->type));
+					if (property->IsPropertyInt())
+						writer.Write(int32_t(*property->GetPropertyInt()));
+					else if (property->IsPropertyFloat())
+						writer.Write(*property->GetPropertyFloat());
+					else if (property->IsPropertyBool())
+						writer.Write(int32_t(*property->GetPropertyBool() ? 1 : 0));
+					else if (property->IsPropertyString())
+						WriteBakedString(writer, *property->GetPropertyString());
+					else if (property->IsPropertyColor())
+						writer.Write(*property->GetPropertyColor());
+					else if (property->IsPropertyObject())
+						writer.Write(int32_t(*property->GetPropertyObject()));
+				}
+			}
+
+			// write the tiles (the chunks of streamed layers are decoded on the fly)
+			std::vector<Tile> decoded_tiles;
+			for (TileLayer const* layer : layers)
+			{
+				writer.Write(int32_t(layer->id));
+				writer.Write(uint32_t(layer->tile_chunks.size()));
+				for (TileLayerChunk const& chunk : layer->tile_chunks)
+				{
+					std::vector<Tile> const* tiles = &chunk.tile_indices;
+					if (!chunk.IsDecoded())
+					{
+						if (!layer->DecodeTileChunk(chunk, decoded_tiles))
+							decoded_tiles.clear();
+						tiles = &decoded_tiles;
+					}
+					writer.Write(chunk.size);
+					writer.Write(chunk.offset);
+					writer.Write(uint32_t(tiles->size()));
+					if (tiles->size() > 0)
+						writer.Write(tiles->data(), tiles->size() * sizeof(Tile));
+				}
+			}
+
+			// write the file
+			std::vector<char> content(writer.GetWrittenSize());
+			writer.CopyToBuffer(content.data(), content.size());
+
+			std::ofstream stream(baked_path.GetResolvedPath().string().c_str(), std::ofstream::binary | std::ofstream::trunc);
+			if (!stream)
+			{
+				TiledMapLog::Error("BakedMap::Save: fails to open [%s]", baked_path.GetResolvedPath().string().c_str());
+				return false;
+			}
+			stream.write(content.data(), std::streamsize(content.size()));
+			return bool(stream);
+		}
+
+	};  // namespace TiledMap
+
+}; // namespace chaos
\ No newline at end of file
@@ -152,6 +152,11 @@ namespace chaos
 		Tile TileLayerChunk::GetTile(glm::ivec2 pos) const // pos is expressed in local coordinate
 		{
 			assert(ContainTile(pos));
+			if (!IsDecoded()) // streamed chunk : the tiles are not available (see TileLayer::DecodeTileChunk(...))
+			{
+				TiledMapLog::Warning("TileLayerChunk::GetTile : the chunk at (%d, %d) is streamed, its tiles are not decoded", offset.x, offset.y);
+				return {};
+			}
 			pos = pos - offset;
 			return tile_indices[(size_t)(pos.x + pos.y * size.x)];
 		}
@@ -203,6 +208,19 @@ namespace chaos
 			// some attributes
 			XMLTools::ReadAttribute(element, "width", size.x);
 			XMLTools::ReadAttribute(element, "height", size.y);
+			// use the already decoded and processed tiles whenever possible
+			if (Map* map = GetMap())
+			{
+				if (map->baked_map != nullptr)
+				{
+					if (BakedTileLayer* baked_layer = map->baked_map->FindTileLayer(id))
+					{
+						tile_chunks = std::move(baked_layer->tile_chunks);
+						streamed = GetPropertyValueBool("STREAMED", false); // the tiles are decoded, but the user may still want to build the chunks on demand
+						return true;
+					}
+				}
+			}
 			// load tiles
 			if (!DoLoadTileBuffer(element))
 				return false;
@@ -238,32 +256,137 @@ namespace chaos
 			}
 		}
 
-		std::vector<Tile> TileLayer::DoLoadTileChunkFromBuffer(Buffer<char> const & buffer, glm::ivec2 const & chunk_size)
+		bool TileLayer::CanStreamTileChunks(char const* encoding, char const* compression) const
 		{
-			size_t count = (size_t)(chunk_size.x * chunk_size.y);
+			// XML encoding requires the document
+			if (StringTools::Stricmp(encoding, "base64") != 0 && StringTools::Stricmp(encoding, "csv") != 0)
+				return false;
+			// the compression must be known now because the chunks are decoded later without any error trace
+			if (!StringTools::IsEmpty(compression) &&
+				StringTools::Stricmp(compression, "zlib") != 0 &&
+				StringTools::Stricmp(compression, "gzip") != 0 &&
+				StringTools::Stricmp(compression, "zstd") != 0)
+				return false;
+			// without zstd, the error is reported at loading time (the workers must not log)
+			if (!MyZStd::IsAvailable() && StringTools::Stricmp(compression, "zstd") == 0)
+				return false;
+			// the processors work on the whole layer
+			if (GetPropertyValueString("TILE_FLAG_PROCESSORS", "").length() > 0)
+				return false;
+			return true;
+		}
 
-			if (buffer.bufsize != count * sizeof(uint32_t))  // array width * height * sizeof(uint32)
-				return {};
+		bool TileLayer::DecodeTileChunk(TileLayerChunk const& chunk, std::vector<Tile>& result) const
+		{
+			if (chunk.IsDecoded())
+			{
+				result = chunk.tile_indices;
+				return true;
+			}
+			std::vector<char> compressed_buffer;
+			return DoLoadTileChunkFromText(chunk.encoded_tiles.c_str(), encoding.c_str(), compression.c_str(), (size_t)(chunk.size.x * chunk.size.y), result, compressed_buffer);
+		}
+
+		bool TileLayer::DoLoadTileChunkFromText(char const* txt, char const* encoding, char const* compression, size_t count, std::vector<Tile>& tiles, std::vector<char>& compressed_buffer) const
+		{
+			tiles.clear();
+
+			if (StringTools::Stricmp(encoding, "base64") == 0)
+			{
+				if (!DoLoadTileChunkFromBase64(txt, compression, count, tiles, compressed_buffer))
+					return false;
+			}
+			else if (StringTools::Stricmp(encoding, "csv") == 0)
+			{
+				tiles.reserve(count);
+
+				// XXX : for tiles that have any flags set, we have to work with UNSIGNED int
+				int i = 0;
+				while (txt[i] != 0 && tiles.size() != count)
+				{
+					while (txt[i] != 0 && !isdigit(txt[i])) // search first figure
+						++i;
+					if (txt[i] == 0)
+						break;
 
-			std::vector<Tile> result;
-			result.reserve(count);
+					unsigned int pseudo_id = strtoul(&txt[i], nullptr, 10);
+					tiles.push_back({ *(int*)&pseudo_id, 0 }); // do not decode the ID and the flags
 
-			// transform the char buffer into tiles
-			for (size_t i = 0; i < count; ++i)
+					while (txt[i] != 0 && isdigit(txt[i])) // skip all figures
+						++i;
+				}
+			}
+			else
 			{
-				unsigned int a = (unsigned int)buffer[i * 4 + 0];
-				unsigned int b = (unsigned int)buffer[i * 4 + 1];
-				unsigned int c = (unsigned int)buffer[i * 4 + 2];
-				unsigned int d = (unsigned int)buffer[i * 4 + 3];
+				return false;
+			}
+
+			// decode the ID's and the flags
+			for (Tile& tile : tiles)
+				tile.gid = DecodeTileGID(tile.gid, &tile.flags);
+			return true;
+		}
+
+		bool TileLayer::DoLoadTileChunkFromBase64(char const* txt, char const* compression, size_t count, std::vector<Tile>& tiles, std::vector<char>& compressed_buffer) const
+		{
+			size_t txt_size = strlen(txt);
+			size_t raw_size = count * sizeof(uint32_t); // array width * height * sizeof(uint32)
+
+			// XXX : the uint32 values are decoded into the beginning of the tile array, then expanded in place
+			static_assert(sizeof(Tile) >= sizeof(uint32_t));
+			tiles.resize(count);
+			char* raw = (char*)tiles.data();
+
+			size_t decoded_size = 0;
+			if (StringTools::IsEmpty(compression))
+			{
+				if (!MyBase64::Decode(txt, txt_size, raw, raw_size, decoded_size))
+					return false;
+			}
+			else
+			{
+				compressed_buffer.resize(MyBase64::GetMaxDecodedSize(txt_size));
+
+				size_t compressed_size = 0;
+				if (!MyBase64::Decode(txt, txt_size, compressed_buffer.data(), compressed_buffer.size(), compressed_size))
+					return false;
+
+				if (StringTools::Stricmp(compression, "zlib") == 0 || StringTools::Stricmp(compression, "gzip") == 0)
+				{
+					if (!MyZLib().Decode(compressed_buffer.data(), compressed_size, raw, raw_size, decoded_size))
+						return false;
+				}
+				else if (StringTools::Stricmp(compression, "zstd") == 0)
+				{
+					if (!MyZStd().Decode(compressed_buffer.data(), compressed_size, raw, raw_size, decoded_size))
+						return false;
+				}
+				else
+				{
+					return false; // no log : this may be called from any thread (the caller reports the error)
+				}
+			}
+
+			if (decoded_size != raw_size)
+				return false;
+
+			// expand from the end so that no value is overwritten before being read (value i is at byte 4.i, tile i at byte 8.i)
+			unsigned char const* bytes = (unsigned char const*)raw;
+			for (size_t i = count; i-- > 0;)
+			{
+				unsigned int a = (unsigned int)bytes[i * 4 + 0];
+				unsigned int b = (unsigned int)bytes[i * 4 + 1];
+				unsigned int c = (unsigned int)bytes[i * 4 + 2];
+				unsigned int d = (unsigned int)bytes[i * 4 + 3];
 
 				// do not decode yet the ID and the flags
 				unsigned int pseudo_id = (a << 0) | (b << 8) | (c << 16) | (d << 24);
-				result.push_back({ *(int *)&pseudo_id, 0 });
+				tiles[i] = { *(int*)&pseudo_id, 0 };
 			}
-			return result;
+			return true;
 		}
 
-		bool TileLayer::DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression)
+		bool TileLayer::DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression, std::vector<char>& compressed_buffer, bool stream_chunk)
 		{
 			if (element == nullptr)
 				return true;
@@ -279,77 +402,34 @@ namespace chaos
 			XMLTools::ReadAttribute(element, "x", chunk_offset.x);
 			XMLTools::ReadAttribute(element, "y", chunk_offset.y);
 
-			if (StringTools::Stricmp(encoding, "base64") == 0)
+			size_t count = (size_t)(chunk_size.x * chunk_size.y);
+
+			if (StringTools::Stricmp(encoding, "base64") == 0 || StringTools::Stricmp(encoding, "csv") == 0)
 			{
 				char const* txt = element->GetText();
 				if (txt == nullptr)
 					return true;
 
-				if (StringTools::Stricmp(compression, "gzip") == 0)
-				{
-					assert(0);
-
-					// TODO
-
-				}
-				else if (StringTools::Stricmp(compression, "zstd") == 0)
+				// keep the text as is. It is decoded whenever the chunk is required
+				if (stream_chunk)
 				{
-					assert(0);
-
-					// TODO
-
+					TileLayerChunk chunk;
+					chunk.size = chunk_size;
+					chunk.offset = chunk_offset;
+					chunk.encoded_tiles = txt;
+					tile_chunks.push_back(std::move(chunk));
+					return true;
 				}
-				else if (StringTools::Stricmp(compression, "zlib") == 0)
-				{
-					std::string content = StringTools::TrimBase64(txt);
 
-					Buffer<char> base64 = MyBase64().Decode(content.c_str());
-					Buffer<char> decoded = MyZLib().Decode(base64);
-
-					tiles = DoLoadTileChunkFromBuffer(decoded, chunk_size);
-				}
-				else // no encoding
+				if (!DoLoadTileChunkFromText(txt, encoding, compression, count, tiles, compressed_buffer))
 				{
-					std::string content = StringTools::TrimBase64(txt);
-
-					Buffer<char> base64 = MyBase64().Decode(content.c_str());
-
-					tiles = DoLoadTileChunkFromBuffer(base64, chunk_size);
-				}
-			}
-			else if (StringTools::Stricmp(encoding, "csv") == 0)
-			{
-
-				tiles.reserve(chunk_size.x * chunk_size.y);
-
-				// XXX : for tiles that have any flags set, we have to work with UNSIGNED int
-
-				char const* txt = element->GetText();
-				if (txt == nullptr)
+					TiledMapLog::Error("TileLayer::DoLoadTileChunk: fails to decode chunk for layer [%s] (encoding [%s], compression [%s])", name.c_str(), encoding, compression);
 					return true;
-
-				size_t count = (size_t)(chunk_size.x * chunk_size.y);
-
-				int i = 0;
-				while (txt[i] != 0 && tiles.size() != count)
-				{
-					while (txt[i] != 0 && !isdigit(txt[i])) // search first figure
-						++i;
-					if (txt[i] == 0)
-						break;
-
-					unsigned int pseudo_id = strtoul(&txt[i], nullptr, 10);
-					tiles.push_back({ *(int*)&pseudo_id, 0 }); // do not decode the ID and the flags
-
-					while (txt[i] != 0 && isdigit(txt[i])) // skip all figures
-						++i;
 				}
 			}
 			else // else XML
 			{
-				tiles.reserve(chunk_size.x * chunk_size.y);
-
-				size_t count = (size_t)(chunk_size.x * chunk_size.y);
+				tiles.reserve(count);
 
 				tinyxml2::XMLElement const* child = element->FirstChildElement("tile");
 				while (child != nullptr && tiles.size() != count)
@@ -361,14 +441,13 @@ namespace chaos
 
 					child = child->NextSiblingElement("tile");
 				}
+				// decode the ID's and the flags
+				for (Tile& tile : tiles)
+					tile.gid = DecodeTileGID(tile.gid, &tile.flags);
 			}
 
-
 			if (tiles.size() != 0)
 			{
-				// decode the ID's and the flags
-				for (Tile& tile : tiles)
-					tile.gid = DecodeTileGID(tile.gid, &tile.flags);
 				// insert a chunk for theses tiles
 				TileLayerChunk chunk;
 				chunk.size = chunk_size;
@@ -385,19 +464,27 @@ namespace chaos
 			if (data == nullptr)
 				return false;
 
-			std::string encoding;
 			XMLTools::ReadAttribute(data, "encoding", encoding);
-
-			std::string compression;
 			XMLTools::ReadAttribute(data, "compression", compression);
 
+			// the chunks of an infinite layer may be kept encoded until they are required
+			tinyxml2::XMLElement const* chunk = data->FirstChildElement("chunk");
+			if (chunk != nullptr && GetPropertyValueBool("STREAMED", false))
+			{
+				streamed = CanStreamTileChunks(encoding.c_str(), compression.c_str());
+				if (!streamed)
+					TiledMapLog::Warning("TileLayer::DoLoadTileBuffer: layer [%s] cannot be streamed (XML encoding, unknown compression or TILE_FLAG_PROCESSORS)", name.c_str());
+			}
+
+			// working buffer for all compressed chunks
+			std::vector<char> compressed_buffer;
+
 			// for non infinite layer
-			DoLoadTileChunk(data, encoding.c_str(), compression.c_str());
+			DoLoadTileChunk(data, encoding.c_str(), compression.c_str(), compressed_buffer, false);
 			// for infinite layer
-			tinyxml2::XMLElement const* chunk = data->FirstChildElement("chunk");
 			while (chunk != nullptr)
 			{
-				DoLoadTileChunk(chunk, encoding.c_str(), compression.c_str());
+				DoLoadTileChunk(chunk, encoding.c_str(), compression.c_str(), compressed_buffer, streamed);
 				chunk = chunk->NextSiblingElement("chunk");
 			}
 
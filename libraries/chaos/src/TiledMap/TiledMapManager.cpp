@@ -47,14 +47,16 @@ return_type constness * Manager::funcname(FilePathParam const & path) constness\
 		CHAOS_IMPL_MANAGER_FIND(FindObjectTypeSet, ObjectTypeSet, object_type_sets, const);
 #undef CHAOS_IMPL_MANAGER_FIND
 
-#define CHAOS_IMPL_MANAGER_DOLOAD(funcname, return_type, member_name)\
+#define CHAOS_IMPL_MANAGER_DOLOAD_FILE(funcname, return_type)\
 return_type * Manager::funcname(FilePathParam const & path, bool store_object)\
 {\
 	if (Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::Ascii | LoadFileFlag::NoErrorTrace))\
 		return funcname(path, buffer, store_object);\
-	ParticleLog::Error("Manager::" #funcname ": fail to load [%s]", path.GetResolvedPath().string().c_str());\
+	TiledMapLog::Error("Manager::" #funcname ": fail to load [%s]", path.GetResolvedPath().string().c_str());\
 	return nullptr;\
-}\
+}
+
+#define CHAOS_IMPL_MANAGER_DOLOAD(funcname, return_type, member_name)\
 return_type * Manager::funcname(FilePathParam const & path, Buffer<char> buffer, bool store_object)\
 {\
 	return_type * result = nullptr;\
@@ -88,12 +90,107 @@ return_type * Manager::funcname(FilePathParam const & path, tinyxml2::XMLDocumen
 	return result;\
 }
 
+		CHAOS_IMPL_MANAGER_DOLOAD_FILE(DoLoadTileSet, TileSet);
+		CHAOS_IMPL_MANAGER_DOLOAD_FILE(DoLoadObjectTypeSet, ObjectTypeSet);
+
 		CHAOS_IMPL_MANAGER_DOLOAD(DoLoadTileSet, TileSet, tile_sets);
 		CHAOS_IMPL_MANAGER_DOLOAD(DoLoadObjectTypeSet, ObjectTypeSet, object_type_sets);
 		CHAOS_IMPL_MANAGER_DOLOAD(DoLoadMap, Map, maps);
 
+#undef CHAOS_IMPL_MANAGER_DOLOAD_FILE
 #undef CHAOS_IMPL_MANAGER_DOLOAD
 
+		Map * Manager::DoLoadMap(FilePathParam const & path, bool store_object)
+		{
+			auto start_time = std::chrono::steady_clock::now();
+
+			Map* result = nullptr;
+			bool baked = false;
+
+			// try the baked file first
+			if (use_baked_maps)
+			{
+				BakedMap baked_map;
+				if (baked_map.Load(path))
+				{
+					result = DoLoadMap(path, baked_map, store_object);
+					baked = (result != nullptr);
+				}
+			}
+			// fallback to the TMX file
+			if (result == nullptr)
+			{
+				if (Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::Ascii | LoadFileFlag::NoErrorTrace))
+					result = DoLoadMap(path, buffer, store_object);
+				else
+					TiledMapLog::Error("Manager::DoLoadMap: fail to load [%s]", path.GetResolvedPath().string().c_str());
+			}
+
+			if (result != nullptr)
+			{
+				auto end_time = std::chrono::steady_clock::now();
+				TiledMapLog::Message("Manager::DoLoadMap [%s] (%s) : %.2f ms",
+					path.GetResolvedPath().string().c_str(),
+					baked? "baked" : "tmx",
+					std::chrono::duration<double, std::milli>(end_time - start_time).count());
+			}
+			return result;
+		}
+
+		Map * Manager::DoLoadMap(FilePathParam const & path, BakedMap & baked_map, bool store_object)
+		{
+			tinyxml2::XMLDocument const* doc = baked_map.GetDocument();
+			if (doc == nullptr)
+				return nullptr;
+
+			Map* result = new Map(this, path.GetResolvedPath());
+			if (result != nullptr)
+			{
+				result->baked_map = &baked_map;
+				bool success = result->DoLoadDocument(doc);
+				result->baked_map = nullptr;
+
+				if (success)
+				{
+					if (store_object)
+						maps.push_back(result);
+				}
+				else
+				{
+					delete(result);
+					result = nullptr;
+				}
+			}
+			return result;
+		}
+
+		bool Manager::BakeMap(FilePathParam const & path)
+		{
+			boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+
+			Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::Ascii | LoadFileFlag::NoErrorTrace);
+			if (buffer == nullptr)
+			{
+				TiledMapLog::Error("Manager::BakeMap: fail to load [%s]", resolved_path.string().c_str());
+				return false;
+			}
+
+			tinyxml2::XMLDocument doc;
+			if (doc.Parse(buffer.data, buffer.bufsize) != tinyxml2::XML_SUCCESS)
+			{
+				TiledMapLog::Error("Manager::BakeMap: fail to parse [%s]", resolved_path.string().c_str());
+				return false;
+			}
+
+			shared_ptr<Map> map = DoLoadMap(path, &doc, false); // the map is only used for the bake
+			if (map == nullptr)
+			{
+				TiledMapLog::Error("Manager::BakeMap: fail to load map [%s]", resolved_path.string().c_str());
+				return false;
+			}
+			return BakedMap::Save(map.get(), &doc, BakedMap::GetBakedPath(resolved_path));
+		}
+
 		Property const * Manager::FindObjectProperty(char const * type, char const * name, PropertyType type_id) const
 		{
 			if (StringTools::IsEmpty(type))
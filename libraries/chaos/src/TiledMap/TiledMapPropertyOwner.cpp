@@ -144,6 +144,13 @@ namespace chaos
 		{
 			assert(element != nullptr);
 
+			// the properties of a baked map are already typed (see BakedMap::Save(...))
+			int baked_properties = 0;
+			if (element->QueryIntAttribute("baked_properties", &baked_properties) == tinyxml2::XML_SUCCESS)
+				if (Map* map = GetMap())
+					if (map->baked_map != nullptr)
+						return map->baked_map->CreateProperties(baked_properties, this);
+
 			return DoLoadProperties(GetPropertiesChildNode(element));
 		}
 
@@ -210,10 +210,12 @@ namespace chaos
 
 		TileData const * TileSet::FindTileData(int id) const
 		{
-			auto it = std::lower_bound(tiles.begin(), tiles.end(), id, [](shared_ptr<TileData> const& tile_data, int id) { return tile_data->id < id; });
-			if (it == tiles.end() || (*it)->id != id) // maybe the iterator is invalid or does not point exactly the element whose ID is the one searched (this is a lower_bound !!)
+			if (id < min_tile_id || id > max_tile_id)
 				return nullptr;
-			return (*it).get();
+			size_t index = size_t(id - min_tile_id);
+			if (index >= tile_lookup.size())
+				return nullptr;
+			return tile_lookup[index];
 		}
 
 #define CHAOS_IMPL_FIND_TILE_DATA(func_name, arg_type, member_name)\
@@ -276,6 +278,12 @@ namespace chaos
 
 				min_tile_id = tiles[0]->id;
 				max_tile_id = tiles[tile_count - 1]->id;
+
+				// build the dense lookup table (tile ids are most of the time contiguous)
+				tile_lookup.clear();
+				tile_lookup.resize(size_t(max_tile_id - min_tile_id + 1), nullptr);
+				for (shared_ptr<TileData> const& tile_data : tiles)
+					tile_lookup[size_t(tile_data->id - min_tile_id)] = tile_data.get();
 			}
 			return true;
 		}
@@ -22,6 +22,14 @@ namespace chaos
 		glfwWindowHint(GLFW_GREEN_BITS, 8);
 		glfwWindowHint(GLFW_BLUE_BITS, 8);
 		glfwWindowHint(GLFW_ALPHA_BITS, 8);
+
+		if (headless)
+		{
+#ifdef GLFW_OSMESA_CONTEXT_API
+			glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+#endif
+			glfwWindowHint(GLFW_VISIBLE, 0);
+		}
 	}
 
 	bool DoSaveIntoJSON(nlohmann::json * json, GLFWHints const& src)
@@ -38,6 +46,7 @@ namespace chaos
 		JSONTools::SetAttribute(json, "depth_bits", src.depth_bits);
 		JSONTools::SetAttribute(json, "stencil_bits", src.stencil_bits);
 		JSONTools::SetAttribute(json, "unlimited_fps", src.unlimited_fps);
+		JSONTools::SetAttribute(json, "headless", src.headless);
 		return true;
 	}
 
@@ -53,6 +62,7 @@ namespace chaos
 		JSONTools::GetAttribute(config, "depth_bits", dst.depth_bits);
 		JSONTools::GetAttribute(config, "stencil_bits", dst.stencil_bits);
 		JSONTools::GetAttribute(config, "unlimited_fps", dst.unlimited_fps);
+		JSONTools::GetAttribute(config, "headless", dst.headless);
 		return true;
 	}
 
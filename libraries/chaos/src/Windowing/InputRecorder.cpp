@@ -0,0 +1,444 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(std::string, RecordInputs);
+		CHAOS_GLOBAL_VARIABLE(std::string, ReplayInputs);
+		CHAOS_GLOBAL_VARIABLE(std::string, ReplayReport);
+	};
+
+	//
+	// InputReplayStats
+	//
+
+	void InputReplayStats::Clear()
+	{
+		frame_durations.clear();
+		zone_durations.clear();
+		drawcall_count = 0;
+		vertex_count = 0;
+	}
+
+	double InputReplayStats::GetFrameDurationPercentile(double percentile) const
+	{
+		if (frame_durations.size() == 0)
+			return 0.0;
+
+		std::vector<double> sorted_durations = frame_durations;
+		std::ranges::sort(sorted_durations);
+
+		size_t index = size_t(std::clamp(percentile, 0.0, 1.0) * double(sorted_durations.size() - 1) + 0.5);
+		return sorted_durations[index];
+	}
+
+	void InputReplayStats::Log() const
+	{
+		size_t frame_count = frame_durations.size();
+
+		InputRecorderLog::Message("replay: %d frames", int(frame_count));
+		InputRecorderLog::Message("frame duration (ms): p50 %.3f  p90 %.3f  p99 %.3f  max %.3f",
+			GetFrameDurationPercentile(0.5),
+			GetFrameDurationPercentile(0.9),
+			GetFrameDurationPercentile(0.99),
+			GetFrameDurationPercentile(1.0));
+
+		if (frame_count > 0)
+		{
+			InputRecorderLog::Message("draw calls per frame: %.1f  vertices per frame: %.1f", double(drawcall_count) / double(frame_count), double(vertex_count) / double(frame_count));
+			for (auto const& [name, duration] : zone_durations)
+				InputRecorderLog::Message("  %-40s %10.3f ms (%.3f ms per frame)", name.c_str(), duration, duration / double(frame_count));
+		}
+	}
+
+	bool InputReplayStats::SaveToFile(FilePathParam const& path) const
+	{
+		size_t frame_count = frame_durations.size();
+
+		nlohmann::json json;
+		json["frame_count"] = frame_count;
+		json["frame_duration_p50"] = GetFrameDurationPercentile(0.5);
+		json["frame_duration_p90"] = GetFrameDurationPercentile(0.9);
+		json["frame_duration_p99"] = GetFrameDurationPercentile(0.99);
+		json["frame_duration_max"] = GetFrameDurationPercentile(1.0);
+		json["drawcall_count"] = drawcall_count;
+		json["vertex_count"] = vertex_count;
+
+		nlohmann::json zones = nlohmann::json::object();
+		for (auto const& [name, duration] : zone_durations)
+		{
+			zones[name]["total"] = duration;
+			zones[name]["per_frame"] = (frame_count > 0) ? duration / double(frame_count) : 0.0;
+		}
+		json["zones"] = std::move(zones);
+
+		return JSONTools::SaveJSONToFile(&json, path);
+	}
+
+	//
+	// InputRecorder
+	//
+
+	bool InputRecorder::StartFromGlobalVariables()
+	{
+		std::string const& replay_path = GlobalVariables::ReplayInputs.Get();
+		if (!replay_path.empty())
+			return StartReplay(replay_path);
+
+		std::string const& record_path = GlobalVariables::RecordInputs.Get();
+		if (!record_path.empty())
+			return StartRecording(record_path);
+
+		return true;
+	}
+
+	bool InputRecorder::StartRecording(FilePathParam const& path)
+	{
+		if (mode != InputRecorderMode::None)
+		{
+			InputRecorderLog::Error("InputRecorder::StartRecording(...): a record or a replay is already running");
+			return false;
+		}
+
+		record_path = path.GetResolvedPath();
+		random_seed = uint32_t(time(nullptr));
+		srand(random_seed);
+
+		frames.clear();
+		frame_index = 0;
+		mode = InputRecorderMode::Record;
+		return true;
+	}
+
+	bool InputRecorder::StartReplay(FilePathParam const& path)
+	{
+		if (mode != InputRecorderMode::None)
+		{
+			InputRecorderLog::Error("InputRecorder::StartReplay(...): a record or a replay is already running");
+			return false;
+		}
+
+		if (!LoadRecord(path))
+			return false;
+		srand(random_seed);
+
+		// the profiler gives the time spent in each subsystem
+		Profiler::GetInstance()->SetEnabled(true);
+
+		replay_stats.Clear();
+		counted_rendering_timestamps.clear();
+		replay_time = 0.0;
+		frame_index = 0;
+		mode = InputRecorderMode::Replay;
+		return true;
+	}
+
+	bool InputRecorder::Stop()
+	{
+		bool result = true;
+		if (mode == InputRecorderMode::Record)
+		{
+			result = SaveRecord(record_path);
+			if (result)
+				InputRecorderLog::Message("%d frames recorded in [%s]", int(frames.size()), record_path.string().c_str());
+		}
+		else if (mode == InputRecorderMode::Replay)
+		{
+			replay_stats.Log();
+			std::string const& report_path = GlobalVariables::ReplayReport.Get();
+			if (!report_path.empty())
+				result = replay_stats.SaveToFile(report_path);
+		}
+		mode = InputRecorderMode::None;
+		frames.clear();
+		return result;
+	}
+
+	void InputRecorder::BeginRecordFrame()
+	{
+		if (mode != InputRecorderMode::Record)
+			return;
+		frames.emplace_back();
+	}
+
+	void InputRecorder::EndRecordFrame(float real_delta_time)
+	{
+		if (mode != InputRecorderMode::Record || frames.size() == 0)
+			return;
+
+		InputRecordFrame& frame = frames.back();
+		frame.delta_time = real_delta_time;
+
+		// snapshot the gamepads (the game reads them from this snapshot as well, so that the record is exactly what has been used)
+		for (int i = GLFW_JOYSTICK_1; i <= GLFW_JOYSTICK_LAST; ++i)
+		{
+			if (!glfwJoystickPresent(i) || !glfwJoystickIsGamepad(i))
+				continue;
+			InputRecordGamepad gamepad;
+			gamepad.physical_index = i;
+			if (glfwGetGamepadState(i, &gamepad.state) == GLFW_TRUE)
+				frame.gamepads.push_back(gamepad);
+		}
+	}
+
+	bool InputRecorder::ReplayFrame(float& real_delta_time)
+	{
+		if (mode != InputRecorderMode::Replay || frame_index >= frames.size())
+			return false;
+
+		InputRecordFrame const& frame = frames[frame_index];
+
+		replay_frame_start = std::chrono::steady_clock::now();
+
+		// the frame time follows the record (not the real clock)
+		replay_time += double(frame.delta_time);
+		FrameTimeManager::GetInstance()->SetCurrentFrameTime(replay_time);
+		real_delta_time = frame.delta_time;
+
+		for (InputRecordEvent const& event : frame.events)
+			DispatchEvent(event);
+		return true;
+	}
+
+	void InputRecorder::EndFrame()
+	{
+		if (mode != InputRecorderMode::Replay)
+			return;
+
+		// the duration of the frame
+		double frame_duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - replay_frame_start).count();
+		replay_stats.frame_durations.push_back(frame_duration);
+
+		// the time spent in each subsystem (zones are accumulated by name)
+		Profiler const* profiler = Profiler::GetInstance();
+		auto const& profiler_frames = profiler->GetFrames();
+		if (profiler_frames.size() > 0 && profiler_frames.back().frame_index == profiler->GetCurrentFrameIndex())
+		{
+			for (ProfilerZone const& zone : profiler_frames.back().cpu_zones)
+			{
+				auto it = replay_stats.zone_durations.find(std::string_view(zone.name));
+				if (it == replay_stats.zone_durations.end())
+					it = replay_stats.zone_durations.emplace(zone.name, 0.0).first;
+				it->second += zone.GetDuration() * 1000.0;
+			}
+		}
+
+		// the draw calls of the last rendered frame of each window
+		if (WindowApplication* window_application = Application::GetInstance())
+		{
+			window_application->ForAllWindows([this](Window* window)
+			{
+				GPURenderContext const* render_context = window->GetGPURenderContext();
+				if (render_context == nullptr)
+					return;
+				auto const& frame_stats = render_context->GetStats().GetFrameStats();
+				if (frame_stats.size() == 0)
+					return;
+
+				GPURenderContextFrameStats const& last_frame_stats = frame_stats.back();
+
+				auto it = counted_rendering_timestamps.find(render_context);
+				if (it != counted_rendering_timestamps.end() && it->second == last_frame_stats.rendering_timestamp)
+					return; // already counted
+				counted_rendering_timestamps[render_context] = last_frame_stats.rendering_timestamp;
+
+				replay_stats.drawcall_count += uint64_t(last_frame_stats.drawcall_counter);
+				replay_stats.vertex_count += uint64_t(last_frame_stats.vertices_counter);
+			});
+		}
+
+		++frame_index;
+	}
+
+	bool InputRecorder::OnGLFWEvent(InputRecordEvent const& event)
+	{
+		if (mode == InputRecorderMode::Replay)
+			return dispatching_event; // real events are ignored
+		if (mode == InputRecorderMode::Record && frames.size() > 0)
+			frames.back().events.push_back(event);
+		return true;
+	}
+
+	InputRecordGamepad const* InputRecorder::FindGamepad(int physical_index) const
+	{
+		InputRecordFrame const* frame = nullptr;
+		if (mode == InputRecorderMode::Replay && frame_index < frames.size())
+			frame = &frames[frame_index];
+		else if (mode == InputRecorderMode::Record && frames.size() > 0)
+			frame = &frames.back();
+
+		if (frame != nullptr)
+			for (InputRecordGamepad const& gamepad : frame->gamepads)
+				if (gamepad.physical_index == physical_index)
+					return &gamepad;
+		return nullptr;
+	}
+
+	bool InputRecorder::IsGamepadPresent(int physical_index)
+	{
+		InputRecorder const* input_recorder = GetInstance();
+		if (input_recorder->GetMode() != InputRecorderMode::None)
+			return (input_recorder->FindGamepad(physical_index) != nullptr);
+		return (glfwJoystickPresent(physical_index) && glfwJoystickIsGamepad(physical_index));
+	}
+
+	bool InputRecorder::GetGamepadState(int physical_index, GLFWgamepadstate& result)
+	{
+		InputRecorder const* input_recorder = GetInstance();
+		if (input_recorder->GetMode() != InputRecorderMode::None)
+		{
+			InputRecordGamepad const* gamepad = input_recorder->FindGamepad(physical_index);
+			if (gamepad == nullptr)
+				return false;
+			result = gamepad->state;
+			return true;
+		}
+		return (glfwGetGamepadState(physical_index, &result) == GLFW_TRUE);
+	}
+
+	void InputRecorder::DispatchEvent(InputRecordEvent const& event)
+	{
+		WindowApplication* window_application = Application::GetInstance();
+		if (window_application == nullptr)
+			return;
+
+		// the events are sent to the focused window (or the main window when there is no focus, as in headless mode)
+		Window* window = window_application->GetFocusedWindow();
+		if (window == nullptr)
+		{
+			window = window_application->ForAllWindows([](Window* w) -> Window*
+			{
+				return (w->GetWindowCategory() == WindowCategory::MainWindow) ? w : nullptr;
+			});
+		}
+		if (window == nullptr)
+			return;
+
+		GLFWwindow* glfw_window = window->GetGLFWHandler();
+		if (glfw_window == nullptr)
+			return;
+
+		dispatching_event = true;
+		switch (event.type)
+		{
+		case InputRecordEventType::Key:
+			Window::DoOnKeyEvent(glfw_window, event.values[0], event.values[1], event.values[2], event.values[3]);
+			break;
+		case InputRecordEventType::Char:
+			Window::DoOnCharEvent(glfw_window, (unsigned int)event.values[0]);
+			break;
+		case InputRecordEventType::MouseButton:
+			Window::DoOnMouseButton(glfw_window, event.values[0], event.values[1], event.values[2]);
+			break;
+		case InputRecordEventType::MouseMove:
+			Window::DoOnMouseMove(glfw_window, event.position.x, event.position.y);
+			break;
+		case InputRecordEventType::MouseWheel:
+			Window::DoOnMouseWheel(glfw_window, event.position.x, event.position.y);
+			break;
+		}
+		dispatching_event = false;
+	}
+
+	static constexpr uint32_t INPUT_RECORD_VERSION = 1;
+
+	bool InputRecorder::SaveRecord(FilePathParam const& path) const
+	{
+		SnapshotWriter writer;
+
+		size_t chunk = writer.BeginChunk(MakeSnapshotTag("INPT"));
+		writer.Write(INPUT_RECORD_VERSION);
+		writer.Write(random_seed);
+		writer.Write(uint32_t(frames.size()));
+		for (InputRecordFrame const& frame : frames)
+		{
+			writer.Write(frame.delta_time);
+			writer.Write(uint32_t(frame.events.size()));
+			if (frame.events.size() > 0)
+				writer.WriteBytes(frame.events.data(), frame.events.size() * sizeof(InputRecordEvent));
+			writer.Write(uint32_t(frame.gamepads.size()));
+			if (frame.gamepads.size() > 0)
+				writer.WriteBytes(frame.gamepads.data(), frame.gamepads.size() * sizeof(InputRecordGamepad));
+		}
+		writer.EndChunk(chunk);
+
+		boost::filesystem::path const& resolved_path = path.GetResolvedPath();
+
+		std::ofstream stream(resolved_path.string().c_str(), std::ios::binary);
+		if (!stream)
+		{
+			InputRecorderLog::Error("InputRecorder::SaveRecord(...): fails to open [%s]", resolved_path.string().c_str());
+			return false;
+		}
+		std::vector<char> const& buffer = writer.GetBuffer();
+		stream.write(buffer.data(), std::streamsize(buffer.size()));
+		return true;
+	}
+
+	bool InputRecorder::LoadRecord(FilePathParam const& path)
+	{
+		Buffer<char> buffer = FileTools::LoadFile(path);
+		if (buffer == nullptr)
+		{
+			InputRecorderLog::Error("InputRecorder::LoadRecord(...): fails to load [%s]", path.GetResolvedPath().string().c_str());
+			return false;
+		}
+
+		SnapshotReader reader(buffer.data, buffer.bufsize);
+
+		size_t chunk_end = 0;
+		uint32_t version = 0;
+		uint32_t frame_count = 0;
+		if (!reader.BeginChunk(MakeSnapshotTag("INPT"), chunk_end) || !reader.Read(version) || version != INPUT_RECORD_VERSION || !reader.Read(random_seed) || !reader.Read(frame_count))
+		{
+			InputRecorderLog::Error("InputRecorder::LoadRecord(...): invalid record [%s]", path.GetResolvedPath().string().c_str());
+			return false;
+		}
+
+		// the counts are checked against the remaining data before any allocation (a corrupted file must not allocate gigabytes)
+		size_t const min_frame_size = sizeof(float) + 2 * sizeof(uint32_t);
+
+		bool valid = (frame_count <= reader.GetRemainingSize() / min_frame_size);
+		if (valid)
+		{
+			frames.clear();
+			frames.resize(frame_count);
+			for (InputRecordFrame& frame : frames)
+			{
+				uint32_t event_count = 0;
+				uint32_t gamepad_count = 0;
+				if (!reader.Read(frame.delta_time) || !reader.Read(event_count))
+					break;
+				if (event_count > reader.GetRemainingSize() / sizeof(InputRecordEvent))
+				{
+					valid = false;
+					break;
+				}
+				frame.events.resize(event_count);
+				if (event_count > 0 && !reader.ReadBytes(frame.events.data(), event_count * sizeof(InputRecordEvent)))
+					break;
+				if (!reader.Read(gamepad_count))
+					break;
+				if (gamepad_count > reader.GetRemainingSize() / sizeof(InputRecordGamepad))
+				{
+					valid = false;
+					break;
+				}
+				frame.gamepads.resize(gamepad_count);
+				if (gamepad_count > 0 && !reader.ReadBytes(frame.gamepads.data(), gamepad_count * sizeof(InputRecordGamepad)))
+					break;
+			}
+		}
+
+		if (!valid || reader.HasError() || !reader.EndChunk(chunk_end))
+		{
+			InputRecorderLog::Error("InputRecorder::LoadRecord(...): truncated record [%s]", path.GetResolvedPath().string().c_str());
+			frames.clear();
+			return false;
+		}
+		return true;
+	}
+
+}; // namespace chaos
\ No newline at end of file
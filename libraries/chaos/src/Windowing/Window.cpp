@@ -38,6 +38,7 @@ namespace chaos
 		Finalize();
 		UpdateWindowProc(false);
 		DestroyImGuiContext();
+		window_capture.Release();
 		DestroyRenderContext();
 		DestroyGLFWWindow();
 
@@ -288,7 +289,7 @@ namespace chaos
 		if (!Initialize())
 			return false;
 		// now that the window is fully placed ... we can show it
-		if (in_create_params.start_visible)
+		if (in_create_params.start_visible && !in_glfw_hints.headless)
 			glfwShowWindow(glfw_window);
 
 		return true;
@@ -616,6 +617,13 @@ namespace chaos
 
 	void Window::DoOnMouseMove(GLFWwindow* in_glfw_window, double x, double y)
 	{
+		// record the event (or ignore the real events during a replay)
+		InputRecordEvent input_record_event;
+		input_record_event.type = InputRecordEventType::MouseMove;
+		input_record_event.position = { x, y };
+		if (!InputRecorder::GetInstance()->OnGLFWEvent(input_record_event))
+			return;
+
 		// notify the application of the mouse state
 		WindowApplication::SetApplicationInputMode(InputMode::Mouse);
 
@@ -689,6 +697,15 @@ namespace chaos
 
 	void Window::DoOnMouseButton(GLFWwindow* in_glfw_window, int button, int action, int modifiers)
 	{
+		// record the event (or ignore the real events during a replay)
+		InputRecordEvent input_record_event;
+		input_record_event.type = InputRecordEventType::MouseButton;
+		input_record_event.values[0] = button;
+		input_record_event.values[1] = action;
+		input_record_event.values[2] = modifiers;
+		if (!InputRecorder::GetInstance()->OnGLFWEvent(input_record_event))
+			return;
+
 		// notify the application of the mouse state
 		WindowApplication::SetApplicationInputMode(InputMode::Mouse);
 
@@ -720,6 +737,13 @@ namespace chaos
 
 	void Window::DoOnMouseWheel(GLFWwindow* in_glfw_window, double scroll_x, double scroll_y)
 	{
+		// record the event (or ignore the real events during a replay)
+		InputRecordEvent input_record_event;
+		input_record_event.type = InputRecordEventType::MouseWheel;
+		input_record_event.position = { scroll_x, scroll_y };
+		if (!InputRecorder::GetInstance()->OnGLFWEvent(input_record_event))
+			return;
+
 		// notify the application of the mouse state
 		WindowApplication::SetApplicationInputMode(InputMode::Mouse);
 
@@ -759,6 +783,16 @@ namespace chaos
 
 	void Window::DoOnKeyEvent(GLFWwindow* in_glfw_window, int keycode, int scancode, int action, int modifiers)
 	{
+		// record the event (or ignore the real events during a replay)
+		InputRecordEvent input_record_event;
+		input_record_event.type = InputRecordEventType::Key;
+		input_record_event.values[0] = keycode;
+		input_record_event.values[1] = scancode;
+		input_record_event.values[2] = action;
+		input_record_event.values[3] = modifiers;
+		if (!InputRecorder::GetInstance()->OnGLFWEvent(input_record_event))
+			return;
+
 		// notify the application of the keyboard state
 		WindowApplication::SetApplicationInputMode(InputMode::Keyboard);
 
@@ -794,6 +828,13 @@ namespace chaos
 
 	void Window::DoOnCharEvent(GLFWwindow* in_glfw_window, unsigned int c)
 	{
+		// record the event (or ignore the real events during a replay)
+		InputRecordEvent input_record_event;
+		input_record_event.type = InputRecordEventType::Char;
+		input_record_event.values[0] = int(c);
+		if (!InputRecorder::GetInstance()->OnGLFWEvent(input_record_event))
+			return;
+
 		// notify the application of the keyboard button state
 		WindowApplication::SetApplicationInputMode(InputMode::Keyboard);
 
@@ -834,13 +875,22 @@ namespace chaos
 		{
 			assert(glfw_window == glfwGetCurrentContext());
 
+			CHAOS_PROFILE_ZONE("Window::DrawWindow");
+
 			render_context->RenderFrame([this]()
 			{
+				CHAOS_GPU_PROFILE_ZONE(render_context.get(), "Window::DrawWindow");
+
 				GetProgramProviderAndProcess([this](GPUProgramProviderBase* provider)
 				{
 					return DrawInternal(provider);
 				});
 
+				// read the back buffer for the captures (asynchronous)
+				glm::ivec2 framebuffer_size = { 0, 0 };
+				glfwGetFramebufferSize(glfw_window, &framebuffer_size.x, &framebuffer_size.y);
+				window_capture.OnFrameRendered(framebuffer_size);
+
 				if (double_buffer)
 					glfwSwapBuffers(glfw_window);
 				else
@@ -927,70 +977,60 @@ namespace chaos
 
 	bool Window::ScreenCapture()
 	{
-		// get render_context
 		if (glfw_window == nullptr || render_context == nullptr)
 			return false;
 
-		return WithWindowContext([this]()
-		{
-			// this call may take a while causing a jump in 'delta_time'
-			WindowApplication* window_application = Application::GetInstance();
-			if (window_application == nullptr)
-				return false;
-			window_application->FreezeNextFrameTickDuration();
-
-			// compute rendering size
-			glm::ivec2 window_size = GetWindowSize(false); // only interrested in client area
-
-			// generate a framebuffer
-			GPUFramebufferGenerator framebuffer_generator(GetGPURenderContext());
-			framebuffer_generator.AddColorAttachment(0, PixelFormat::BGRA, window_size, "scene");
-			framebuffer_generator.AddDepthStencilAttachment(window_size, "depth");
+		WindowApplication* window_application = Application::GetInstance();
+		if (window_application == nullptr)
+			return false;
 
-			shared_ptr<GPUFramebuffer> framebuffer = framebuffer_generator.GenerateFramebuffer(window_size);
-			if (framebuffer == nullptr)
-				return false;
-			if (!framebuffer->CheckCompletionStatus())
+		// create the directory
+		boost::filesystem::path capture_directory_path = window_application->GetApplicationUserLocalPath() / "Captures";
+		if (!boost::filesystem::is_directory(capture_directory_path))
+			if (!boost::filesystem::create_directories(capture_directory_path))
 				return false;
 
-			// render into the framebuffer
-			render_context->RenderIntoFramebuffer(framebuffer.get(), false, [this]()
-			{
-				GetProgramProviderAndProcess([this](GPUProgramProviderBase* provider)
-				{
-					DrawInternal(provider);
-					return true;
-				});
-				return true;
-			});
+		// get a file name (an empty file is created so that next captures do not use it before it is written)
+		std::string format = StringTools::Printf(
+			"capture_%s_%%d.png",
+			StringTools::TimeToString(std::chrono::system_clock::now(), TimeToStringFormatType::Filename).c_str());
 
-			// extract the texture
-			GPUFramebufferAttachmentInfo const* attachment = framebuffer->GetColorAttachment(0);
-			if (attachment == nullptr || attachment->texture == nullptr)
-				return false;
+		boost::filesystem::path file_path = FileTools::GetUniquePath(capture_directory_path, format.c_str(), true);
+		if (file_path.empty())
+			return false;
 
-			bitmap_ptr img = bitmap_ptr(ImageTools::GenFreeImage(attachment->texture->GetResourceID(), 0));
-			if (img == nullptr)
-				return false;
+		// the back buffer is read at the end of next rendering. The encoding is done on a worker thread
+		return window_capture.RequireScreenCapture(file_path);
+	}
 
-			// create the directory
-			boost::filesystem::path capture_directory_path = window_application->GetApplicationUserLocalPath() / "Captures";
-			if (!boost::filesystem::is_directory(capture_directory_path))
-				if (!boost::filesystem::create_directories(capture_directory_path))
-					return false;
+	bool Window::StartVideoCapture(WindowVideoCaptureMode mode)
+	{
+		if (glfw_window == nullptr || render_context == nullptr)
+			return false;
 
-			// save the image
-			std::string format = StringTools::Printf(
-				"capture_%s_%%d.png",
-				StringTools::TimeToString(std::chrono::system_clock::now(), TimeToStringFormatType::Filename).c_str());
+		WindowApplication* window_application = Application::GetInstance();
+		if (window_application == nullptr)
+			return false;
 
-			boost::filesystem::path file_path = FileTools::GetUniquePath(capture_directory_path, format.c_str(), true);
-			if (file_path.empty())
+		boost::filesystem::path capture_directory_path = window_application->GetApplicationUserLocalPath() / "Captures";
+		if (!boost::filesystem::is_directory(capture_directory_path))
+			if (!boost::filesystem::create_directories(capture_directory_path))
 				return false;
 
-			bitmap_ptr img_without_alpha = bitmap_ptr(FreeImage_ConvertTo24Bits(img.get())); // suppress alpha channel before saving
+		std::string name = StringTools::Printf(
+			(mode == WindowVideoCaptureMode::RawVideo) ? "video_%s.bgra" : "video_%s",
+			StringTools::TimeToString(std::chrono::system_clock::now(), TimeToStringFormatType::Filename).c_str());
+
+		return window_capture.StartVideoCapture(capture_directory_path / name, mode);
+	}
 
-			return (FreeImage_Save(FIF_PNG, img_without_alpha.get(), file_path.string().c_str(), 0) != 0);
+	void Window::StopVideoCapture()
+	{
+		if (glfw_window == nullptr)
+			return;
+		WithWindowContext([this]()
+		{
+			window_capture.StopVideoCapture(); // the pending transfers are read
 		});
 	}
 
@@ -1004,7 +1044,7 @@ namespace chaos
 
 	bool Window::EnumerateInputActions(InputActionProcessor & in_action_processor, EnumerateInputActionContext in_context)
 	{
-		if (in_action_processor.CheckAndProcess(JustActivated(Key::F9) , "Screen Capture", [this]()
+		if (in_action_processor.CheckAndProcess(ForbidModifiers(KeyModifier::Shift, JustActivated(Key::F9)), "Screen Capture", [this]()
 		{
 			ScreenCapture();
 		}))
@@ -1012,6 +1052,17 @@ namespace chaos
 			return true;
 		}
 
+		if (in_action_processor.CheckAndProcess(RequireModifiers(KeyModifier::Shift, JustActivated(Key::F9)), "Toggle Video Capture", [this]()
+		{
+			if (IsCapturingVideo())
+				StopVideoCapture();
+			else
+				StartVideoCapture();
+		}))
+		{
+			return true;
+		}
+
 		if (in_action_processor.CheckAndProcess(JustActivated(Key::F10) , "Toggle Fullscreen", [this]()
 		{
 			ToggleFullscreen();
@@ -1072,6 +1123,8 @@ namespace chaos
 		// some parameters
 		WindowDrawParams draw_params;
 		draw_params.viewport = GetRequiredViewport(window_size);
+		if (WindowApplication const* application = Application::GetConstInstance())
+			draw_params.interpolation_alpha = application->GetInterpolationAlpha();
 
 		// draw the viewport
 		if (!IsGeometryEmpty(draw_params.viewport))
@@ -3,6 +3,11 @@
 
 namespace chaos
 {
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(bool, Headless, false);
+	};
+
 	//
 	// WindowApplication
 	//
@@ -44,6 +49,26 @@ namespace chaos
 		return real_delta_time;
 	}
 
+	int WindowApplication::ComputeFixedTickCount(float delta_time)
+	{
+		assert(fixed_tick_duration > 0.0f);
+
+		fixed_tick_accumulator += delta_time;
+
+		int result = int(fixed_tick_accumulator / fixed_tick_duration);
+		if (result > max_fixed_tick_count)
+		{
+			result = max_fixed_tick_count;
+			fixed_tick_accumulator = std::fmod(fixed_tick_accumulator, fixed_tick_duration); // the simulation slows down rather than trying to catch up forever
+		}
+		else
+		{
+			fixed_tick_accumulator -= float(result) * fixed_tick_duration;
+		}
+		interpolation_alpha = std::clamp(fixed_tick_accumulator / fixed_tick_duration, 0.0f, 1.0f);
+		return result;
+	}
+
 	void WindowApplication::RunMessageLoop(LightweightFunction<bool()> loop_condition_func)
 	{
 		WithGLFWContext(shared_context, [this, loop_condition_func]() // because during callbacks some GPU stuff may be called
@@ -51,22 +76,62 @@ namespace chaos
 			FrameTimeManager * frame_time_manager = FrameTimeManager::GetInstance();
 			assert(frame_time_manager != nullptr);
 
+			Profiler* profiler = Profiler::GetInstance();
+
+			InputRecorder* input_recorder = InputRecorder::GetInstance();
+
 			while (!loop_condition_func.IsValid() || loop_condition_func())
 			{
-				// this is important to be just before the glfwPollEvents() call because
-				// glfwPollEvents is responsible for handling mouse & keyboard events and so
-				// set the new InputStates
-				frame_time_manager->SetCurrentFrameTime(glfwGetTime());
+				profiler->BeginFrame();
+
+				float real_delta_time = 0.0f;
+				if (input_recorder->IsReplaying())
+				{
+					// the real events are ignored. The time and the events come from the record
+					glfwPollEvents();
+					if (!input_recorder->ReplayFrame(real_delta_time))
+						return; // end of the record
+				}
+				else
+				{
+					// this is important to be just before the glfwPollEvents() call because
+					// glfwPollEvents is responsible for handling mouse & keyboard events and so
+					// set the new InputStates
+					frame_time_manager->SetCurrentFrameTime(glfwGetTime());
 
-				glfwPollEvents();
+					input_recorder->BeginRecordFrame();
+					glfwPollEvents();
+
+					real_delta_time = float(frame_time_manager->GetCurrentFrameDuration());
+					input_recorder->EndRecordFrame(real_delta_time);
+				}
 
-				float real_delta_time = float(frame_time_manager->GetCurrentFrameDuration());
-				float delta_time      = ComputeEffectiveDeltaTime(real_delta_time);
+				// reload the resources whose files have been modified (between 2 frames)
+				if (gpu_resource_manager != nullptr)
+					gpu_resource_manager->ProcessFileChanges();
+
+				float delta_time = ComputeEffectiveDeltaTime(real_delta_time);
+
+				// in fixed step mode, the simulation is ticked N times with a constant duration (N may be 0)
+				int tick_count = 1;
+				if (fixed_tick_enabled)
+				{
+					tick_count = ComputeFixedTickCount(delta_time);
+					delta_time = fixed_tick_duration;
+				}
+				else
+				{
+					interpolation_alpha = 1.0f;
+				}
 
 				// internal tick
-				bool tick_result = WithGLFWContext(shared_context, [this, delta_time]()
+				bool tick_result = WithGLFWContext(shared_context, [this, delta_time, tick_count]()
 				{
-					return Tick(delta_time);
+					CHAOS_PROFILE_ZONE("Application::Tick");
+					for (int i = 0; i < tick_count; ++i)
+						if (!Tick(delta_time))
+							return false;
+					return true;
 				});
 				if (!tick_result) // quit the loop if the current tick method requires so
 				{
@@ -81,12 +146,16 @@ namespace chaos
 				});
 
 				// tick the windows
-				ForAllWindows([delta_time, real_delta_time](Window* window)
+				ForAllWindows([delta_time, real_delta_time, tick_count](Window* window)
 				{
 					window->TickRenderer(real_delta_time);
-					window->Tick(delta_time);
+					for (int i = 0; i < tick_count; ++i)
+						window->Tick(delta_time);
 					window->DrawWindow();
 				});
+
+				profiler->EndFrame();
+				input_recorder->EndFrame();
 			}
 		});
 	}
@@ -179,6 +248,8 @@ namespace chaos
 		// the glfw configuration (valid for all windows)
 		if (JSONReadConfiguration glfw_configuration = JSONTools::GetAttributeStructureNode(config, "glfw"))
 			LoadFromJSON(glfw_configuration, glfw_hints);
+		if (GlobalVariables::Headless.Get())
+			glfw_hints.headless = true;
 		glfw_hints.ApplyHints();
 
 		// create a hidden window whose purpose is to provide a sharable context for all others
@@ -287,11 +358,19 @@ namespace chaos
 		if (!CreateStartupWindows())
 			return -1;
 
+		// record or replay the inputs
+		InputRecorder* input_recorder = InputRecorder::GetInstance();
+		if (!input_recorder->StartFromGlobalVariables())
+			return -1;
+
 		// run the main loop as long as there are main windows
 		RunMessageLoop([this]()
 		{
 			return HasMainWindow();
 		});
+
+		if (!input_recorder->Stop())
+			return -1;
 		return 0;
 	}
 
@@ -404,6 +483,18 @@ namespace chaos
 
 	bool WindowApplication::CreateTextureAtlas(JSONReadConfiguration config)
 	{
+		GPUAtlasGenerator generator(GetGPUDevice());
+
+		// a prebuilt binary atlas avoids the generation (no image decoding, no packing)
+		std::string binary_atlas;
+		if (JSONTools::GetAttribute(config, "binary_atlas", binary_atlas))
+		{
+			texture_atlas = generator.LoadBinaryAtlas(binary_atlas);
+			if (texture_atlas != nullptr)
+				return true;
+			ApplicationLog::Warning("CreateTextureAtlas(...): fails to load binary atlas [%s]. Generate the atlas instead", binary_atlas.c_str());
+		}
+
 		// fill sub images for atlas generation
 		AtlasInput input;
 		if (!FillAtlasGeneratorInput(input))
@@ -419,7 +510,6 @@ namespace chaos
 			LoadFromJSON(atlas_config, params);
 
 		// generate the atlas
-		GPUAtlasGenerator generator(GetGPUDevice());
 		texture_atlas = generator.GenerateAtlas(input, params);
 		if (texture_atlas == nullptr)
 			return false;
@@ -588,6 +678,13 @@ namespace chaos
 		JSONTools::GetAttribute(config, "max_tick_duration", max_tick_duration);
 		JSONTools::GetAttribute(config, "forced_tick_duration", forced_tick_duration);
 
+		float fixed_tick_rate = 0.0f;
+		if (JSONTools::GetAttribute(config, "fixed_tick_rate", fixed_tick_rate) && fixed_tick_rate > 0.0f) // in Hz
+			fixed_tick_duration = 1.0f / fixed_tick_rate;
+		JSONTools::GetAttribute(config, "fixed_tick_enabled", fixed_tick_enabled);
+		JSONTools::GetAttribute(config, "max_fixed_tick_count", max_fixed_tick_count);
+		max_fixed_tick_count = std::max(max_fixed_tick_count, 1);
+
 		return true;
 	}
 
@@ -770,6 +867,11 @@ namespace chaos
 		IMGUI_CHECKVERSION();
 		FreeImage_Initialise();
 		FreeImage_SetOutputMessage(&FreeImageOutputMessageFunc);
+#ifdef GLFW_PLATFORM_NULL
+		// no display server is required (CI). The contexts are created with OSMesa (see GLFWHints::headless)
+		if (GlobalVariables::Headless.Get())
+			glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#endif
 		glfwInit();
 		return true;
 	}
@@ -0,0 +1,248 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	WindowCapture::~WindowCapture()
+	{
+		assert(slots[0].buffer_id == 0); // Release() must have been called with the GL context
+		if (video_writer != nullptr)
+			video_writer->WaitIdle();
+	}
+
+	bool WindowCapture::RequireScreenCapture(boost::filesystem::path const& path)
+	{
+		if (path.empty())
+			return false;
+		pending_screen_capture_path = path;
+		return true;
+	}
+
+	bool WindowCapture::StartVideoCapture(boost::filesystem::path const& path, WindowVideoCaptureMode mode)
+	{
+		if (video_capture)
+			return false;
+
+		if (mode == WindowVideoCaptureMode::RawVideo)
+		{
+			video_stream = std::make_shared<std::ofstream>(path.string().c_str(), std::ios::binary | std::ios::trunc);
+			if (!*video_stream)
+			{
+				WindowCaptureLog::Error("WindowCapture::StartVideoCapture(...): fails to open [%s]", path.string().c_str());
+				video_stream = nullptr;
+				return false;
+			}
+			if (video_writer == nullptr)
+				video_writer = std::make_unique<ThreadPool>(1);
+		}
+		else
+		{
+			if (!boost::filesystem::is_directory(path))
+				if (!boost::filesystem::create_directories(path))
+					return false;
+		}
+
+		video_capture = true;
+		video_mode = mode;
+		video_path = path;
+		video_frame_count = 0;
+		return true;
+	}
+
+	void WindowCapture::StopVideoCapture()
+	{
+		if (!video_capture)
+			return;
+		video_capture = false;
+
+		// the frames that are still in the ring belong to the video
+		Flush();
+		video_stream = nullptr;
+
+		WindowCaptureLog::Message("WindowCapture: %d frames written into [%s]", int(video_frame_count), video_path.string().c_str());
+	}
+
+	void WindowCapture::OnFrameRendered(glm::ivec2 const& framebuffer_size)
+	{
+		// get the transfers that are over
+		for (Slot& slot : slots)
+			if (slot.fence != nullptr)
+				ReadSlot(slot, false);
+
+		bool screen_capture = !pending_screen_capture_path.empty();
+		if (!screen_capture && !video_capture)
+			return;
+		if (framebuffer_size.x <= 0 || framebuffer_size.y <= 0)
+			return;
+
+		// the ring is full: wait for the oldest transfer rather than dropping a frame
+		Slot& slot = slots[next_slot];
+		if (slot.fence != nullptr)
+			ReadSlot(slot, true);
+		next_slot = (next_slot + 1) % RING_SIZE;
+
+		// create or resize the PBO
+		size_t required_size = size_t(framebuffer_size.x) * size_t(framebuffer_size.y) * 4;
+		if (slot.buffer_id == 0)
+			glCreateBuffers(1, &slot.buffer_id);
+		if (slot.buffer_size != required_size)
+		{
+			glNamedBufferData(slot.buffer_id, GLsizeiptr(required_size), nullptr, GL_STREAM_READ);
+			slot.buffer_size = required_size;
+		}
+
+		// start the transfer of the back buffer (asynchronous because the destination is a PBO)
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer_id);
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+		glReadPixels(0, 0, framebuffer_size.x, framebuffer_size.y, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		slot.fence = new GPUFence();
+		slot.size = framebuffer_size;
+		slot.screen_capture_path = std::move(pending_screen_capture_path);
+		slot.video_frame = video_capture;
+		slot.video_frame_index = (video_capture) ? video_frame_count++ : 0;
+		pending_screen_capture_path.clear();
+	}
+
+	bool WindowCapture::ReadSlot(Slot& slot, bool wait)
+	{
+		if (slot.fence == nullptr)
+			return false;
+		if (!slot.fence->WaitForCompletion(wait ? 1.0f : 0.0f))
+		{
+			if (!wait)
+				return false;
+			WindowCaptureLog::Error("WindowCapture::ReadSlot(...): transfer timeout");
+		}
+		slot.fence = nullptr;
+
+		// copy the pixels (the PBO is to be reused soon)
+		Buffer<char> pixels = SharedBufferPolicy<char>::NewBuffer(slot.buffer_size);
+		if (pixels == nullptr)
+			return false;
+		void const* data = glMapNamedBufferRange(slot.buffer_id, 0, GLsizeiptr(slot.buffer_size), GL_MAP_READ_BIT);
+		if (data == nullptr)
+			return false;
+		memcpy(pixels.data, data, slot.buffer_size);
+		glUnmapNamedBuffer(slot.buffer_id);
+
+		// give the encodings to the worker threads
+		ThreadPool* thread_pool = ThreadPool::GetDefaultInstance();
+
+		glm::ivec2 size = slot.size;
+		if (!slot.screen_capture_path.empty())
+		{
+			AddEncodingTask(thread_pool, [pixels, size, path = std::move(slot.screen_capture_path)]()
+			{
+				SavePNG(pixels, size, path);
+			});
+			slot.screen_capture_path.clear();
+		}
+
+		if (slot.video_frame)
+		{
+			if (video_mode == WindowVideoCaptureMode::ImageSequence)
+			{
+				boost::filesystem::path path = video_path / StringTools::Printf("frame_%06d.png", int(slot.video_frame_index));
+				AddEncodingTask(thread_pool, [pixels, size, path = std::move(path)]()
+				{
+					SavePNG(pixels, size, path);
+				});
+			}
+			else if (video_stream != nullptr && video_writer != nullptr)
+			{
+				AddEncodingTask(video_writer.get(), [pixels, size, stream = video_stream]()
+				{
+					uint32_t header[2] = { uint32_t(size.x), uint32_t(size.y) };
+					stream->write((char const*)header, sizeof(header));
+					stream->write(pixels.data, std::streamsize(pixels.bufsize));
+				});
+			}
+			slot.video_frame = false;
+			LimitPendingEncodings();
+		}
+		return true;
+	}
+
+	void WindowCapture::AddEncodingTask(ThreadPool* thread_pool, std::function<void()> task)
+	{
+		{
+			std::unique_lock<std::mutex> lock(pending_encoding_mutex);
+			++pending_encoding_count;
+		}
+		thread_pool->AddTask([this, task = std::move(task)]()
+		{
+			task();
+
+			std::unique_lock<std::mutex> lock(pending_encoding_mutex);
+			--pending_encoding_count;
+			pending_encoding_condition.notify_all();
+		});
+	}
+
+	void WindowCapture::LimitPendingEncodings()
+	{
+		// XXX : the encoders may be slower than the game. Rather than dropping frames, the main thread sleeps until enough encodings are finished
+		//       (only the encodings of the capture are counted, not the other tasks of the default thread pool)
+		size_t max_pending_encodings = (video_mode == WindowVideoCaptureMode::RawVideo) ?
+			2 * RING_SIZE :
+			2 * ThreadPool::GetDefaultInstance()->GetThreadCount() + RING_SIZE;
+
+		std::unique_lock<std::mutex> lock(pending_encoding_mutex);
+		pending_encoding_condition.wait(lock, [this, max_pending_encodings]()
+		{
+			return (pending_encoding_count <= max_pending_encodings);
+		});
+	}
+
+	void WindowCapture::Flush()
+	{
+		// read the slots from the oldest to the newest
+		for (size_t i = 0; i < RING_SIZE; ++i)
+			ReadSlot(slots[(next_slot + i) % RING_SIZE], true);
+
+		// wait for the encodings of the capture only (the default thread pool may be busy with other tasks)
+		std::unique_lock<std::mutex> lock(pending_encoding_mutex);
+		pending_encoding_condition.wait(lock, [this]()
+		{
+			return (pending_encoding_count == 0);
+		});
+	}
+
+	void WindowCapture::Release()
+	{
+		StopVideoCapture();
+		Flush();
+		for (Slot& slot : slots)
+		{
+			if (slot.buffer_id != 0)
+				glDeleteBuffers(1, &slot.buffer_id);
+			slot.buffer_id = 0;
+			slot.buffer_size = 0;
+		}
+	}
+
+	bool WindowCapture::SavePNG(Buffer<char> const& pixels, glm::ivec2 const& size, boost::filesystem::path const& path)
+	{
+		// OpenGL and FreeImage both store the rows bottom-up
+		bitmap_ptr image = bitmap_ptr(FreeImage_ConvertFromRawBits(
+			(BYTE*)pixels.data, size.x, size.y, size.x * 4, 32,
+			FI_RGBA_RED_MASK, FI_RGBA_GREEN_MASK, FI_RGBA_BLUE_MASK, FALSE));
+		if (image == nullptr)
+			return false;
+
+		bitmap_ptr image_without_alpha = bitmap_ptr(FreeImage_ConvertTo24Bits(image.get())); // suppress alpha channel before saving
+		if (image_without_alpha == nullptr)
+			return false;
+
+		if (FreeImage_Save(FIF_PNG, image_without_alpha.get(), path.string().c_str(), 0) == 0)
+		{
+			WindowCaptureLog::Error("WindowCapture::SavePNG(...): fails to write [%s]", path.string().c_str());
+			return false;
+		}
+		return true;
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -18,6 +18,7 @@ project:DependOnLib("IRRKLANG")
 project:DependOnLib("FREETYPE2")
 project:DependOnLib("JSON")
 project:DependOnLib("ZLIB")
+project:DependOnLib("ZSTD")
 project:DependOnLib("ASSIMP")
 --project:DependOnLib("FBX")
 project:DependOnLib("GLSLANG")
@@ -279,6 +279,16 @@ if LINUX then
 end
 build:DeclareExternalLib("ZLIB")
 
+--------------------------------------------------------------------
+-- ZSTD
+--------------------------------------------------------------------
+
+if LINUX then
+	ZSTD_BASE_PATH = path.join("/","usr", "include")
+	ZSTD_LIB_NAME = "zstd"
+end
+build:DeclareExternalLib("ZSTD")
+
 --------------------------------------------------------------------
 -- BOOST
 --------------------------------------------------------------------